@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
+use clap::Parser;
+use iceoryx2_bb_lock_free::mpmc::bit_set::BitSet;
+use iceoryx2_bb_posix::clock::Time;
+
+const ITERATIONS: u64 = 1000000;
+const NUMBER_OF_SET_BITS: usize = 4;
+const CAPACITIES: [usize; 5] = [128, 1024, 8192, 65536, 262144];
+
+fn perform_benchmark(args: &Args, capacity: usize) {
+    let bitset = BitSet::new(capacity);
+    let number_of_set_bits = args.number_of_set_bits.clamp(1, capacity);
+    // spread the set bits over the whole capacity so that they land in different words
+    let stride = (capacity / number_of_set_bits).max(1);
+
+    let mut latencies = LatencyHistogram::new();
+    let mut number_of_acquired_ids = 0u64;
+
+    let start = Time::now().expect("failed to acquire time");
+    for i in 0..args.iterations {
+        let wakeup_start = args
+            .percentiles
+            .then(|| Time::now().expect("failed to acquire time"));
+
+        // one wakeup of a listener: a handful of notifiers set their event id and the
+        // listener acquires all of them
+        for n in 0..number_of_set_bits {
+            bitset.set((n * stride + i as usize) % capacity);
+        }
+        bitset.reset_all(|id| {
+            core::hint::black_box(id);
+            number_of_acquired_ids += 1;
+        });
+
+        if let Some(wakeup_start) = wakeup_start {
+            let wakeup = wakeup_start.elapsed().expect("failed to measure time");
+            latencies.record(wakeup.as_nanos() as u64);
+        }
+    }
+    let stop = start.elapsed().expect("failed to measure time");
+
+    Report::new("BitSet")
+        .parameter("Capacity", capacity)
+        .parameter("NumberOfSetBits", number_of_set_bits)
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result_with_unit(
+            "WakeupCost",
+            stop.as_nanos() / args.iterations as u128,
+            "ns",
+        )
+        .result("AcquiredIds", number_of_acquired_ids)
+        .latency_histogram(&latencies)
+        .print(args.output_format);
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// Number of simulated listener wakeups
+    #[clap(short, long, default_value_t = ITERATIONS)]
+    iterations: u64,
+    /// The capacity of the bitset, corresponds to the `event_id_max_value` of an event
+    /// service. When not set, the benchmark is repeated for 128, 1024, 8192, 65536 and 262144.
+    #[clap(short, long)]
+    capacity: Option<usize>,
+    /// The number of bits that are set before every wakeup.
+    #[clap(short, long, default_value_t = NUMBER_OF_SET_BITS)]
+    number_of_set_bits: usize,
+    /// Measure every wakeup and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
+}
+
+fn main() {
+    let args = Args::parse();
+
+    match args.capacity {
+        Some(capacity) => perform_benchmark(&args, capacity.max(1)),
+        None => {
+            for capacity in CAPACITIES {
+                perform_benchmark(&args, capacity);
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Counts the hardware cache misses of the calling thread with the Linux perf events
+//! interface.
+//!
+//! The counter is only available on Linux and only when the kernel allows user space to
+//! access the hardware counters (see `/proc/sys/kernel/perf_event_paranoid`). On all other
+//! setups [`CacheMissCounter::new()`] returns [`None`] and the benchmarks skip the
+//! measurement.
+//!
+//! # Example
+//!
+//! ```
+//! use benchmark_common::cache_misses::CacheMissCounter;
+//!
+//! if let Some(counter) = CacheMissCounter::new() {
+//!     counter.start();
+//!     // code under test
+//!     let cache_misses = counter.stop();
+//!     println!("cache misses: {cache_misses}");
+//! }
+//! ```
+
+/// Counts the cache misses of the thread that created it between
+/// [`CacheMissCounter::start()`] and [`CacheMissCounter::stop()`].
+#[derive(Debug)]
+pub struct CacheMissCounter {
+    #[cfg(target_os = "linux")]
+    fd: i32,
+}
+
+#[cfg(target_os = "linux")]
+mod linux {
+    // only the fields of PERF_ATTR_SIZE_VER0 are required to count a hardware event
+    #[repr(C)]
+    #[derive(Default)]
+    pub(super) struct PerfEventAttr {
+        pub(super) event_type: u32,
+        pub(super) size: u32,
+        pub(super) config: u64,
+        pub(super) sample_period: u64,
+        pub(super) sample_type: u64,
+        pub(super) read_format: u64,
+        pub(super) flags: u64,
+        pub(super) wakeup_events: u32,
+        pub(super) bp_type: u32,
+        pub(super) config1: u64,
+    }
+
+    pub(super) const PERF_TYPE_HARDWARE: u32 = 0;
+    pub(super) const PERF_COUNT_HW_CACHE_MISSES: u64 = 3;
+    pub(super) const FLAG_DISABLED: u64 = 1 << 0;
+    pub(super) const FLAG_EXCLUDE_KERNEL: u64 = 1 << 5;
+    pub(super) const FLAG_EXCLUDE_HV: u64 = 1 << 6;
+    pub(super) const PERF_EVENT_IOC_ENABLE: u64 = 0x2400;
+    pub(super) const PERF_EVENT_IOC_DISABLE: u64 = 0x2401;
+    pub(super) const PERF_EVENT_IOC_RESET: u64 = 0x2403;
+}
+
+impl CacheMissCounter {
+    /// Creates a new disabled counter for the calling thread. Returns [`None`] when the
+    /// platform or the kernel configuration does not provide access to the counter.
+    #[cfg(target_os = "linux")]
+    pub fn new() -> Option<Self> {
+        use linux::*;
+
+        let attr = PerfEventAttr {
+            event_type: PERF_TYPE_HARDWARE,
+            size: core::mem::size_of::<PerfEventAttr>() as u32,
+            config: PERF_COUNT_HW_CACHE_MISSES,
+            flags: FLAG_DISABLED | FLAG_EXCLUDE_KERNEL | FLAG_EXCLUDE_HV,
+            ..Default::default()
+        };
+
+        // pid = 0 and cpu = -1 measures the calling thread on every cpu
+        let fd = unsafe {
+            libc::syscall(
+                libc::SYS_perf_event_open,
+                &attr as *const PerfEventAttr,
+                0,
+                -1,
+                -1,
+                0,
+            )
+        };
+
+        if fd < 0 {
+            return None;
+        }
+
+        Some(Self { fd: fd as i32 })
+    }
+
+    /// Creates a new disabled counter for the calling thread. Returns [`None`] when the
+    /// platform or the kernel configuration does not provide access to the counter.
+    #[cfg(not(target_os = "linux"))]
+    pub fn new() -> Option<Self> {
+        None
+    }
+
+    /// Resets the counter and starts counting.
+    pub fn start(&self) {
+        #[cfg(target_os = "linux")]
+        unsafe {
+            libc::ioctl(self.fd, linux::PERF_EVENT_IOC_RESET as _, 0);
+            libc::ioctl(self.fd, linux::PERF_EVENT_IOC_ENABLE as _, 0);
+        }
+    }
+
+    /// Stops counting and returns the number of cache misses since
+    /// [`CacheMissCounter::start()`].
+    pub fn stop(&self) -> u64 {
+        #[cfg(target_os = "linux")]
+        {
+            let mut value: u64 = 0;
+            let bytes_read = unsafe {
+                libc::ioctl(self.fd, linux::PERF_EVENT_IOC_DISABLE as _, 0);
+                libc::read(
+                    self.fd,
+                    (&mut value as *mut u64).cast(),
+                    core::mem::size_of::<u64>(),
+                )
+            };
+
+            if bytes_read == core::mem::size_of::<u64>() as isize {
+                return value;
+            }
+        }
+
+        0
+    }
+}
+
+#[cfg(target_os = "linux")]
+impl Drop for CacheMissCounter {
+    fn drop(&mut self) {
+        unsafe { libc::close(self.fd) };
+    }
+}
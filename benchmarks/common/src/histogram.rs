@@ -0,0 +1,224 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A log-linear latency histogram in the spirit of HdrHistogram.
+//!
+//! Every power of two is split into [`SUB_BUCKETS_PER_OCTAVE`] linear sub-buckets, therefore
+//! every recorded value is stored with a relative error of at most 1/128, which is less
+//! than 1%, while the whole `u64` range is covered with a few thousand counters. Recording
+//! is a handful of arithmetic instructions and never allocates, so it can be used inside
+//! the measurement loop.
+//!
+//! # Example
+//!
+//! ```
+//! use benchmark_common::histogram::LatencyHistogram;
+//!
+//! let mut histogram = LatencyHistogram::new();
+//! for value in 1..=100 {
+//!     histogram.record(value);
+//! }
+//!
+//! assert_eq!(histogram.count(), 100);
+//! assert_eq!(histogram.percentile(50.0), 50);
+//! assert_eq!(histogram.max(), 100);
+//! ```
+
+const SUB_BUCKET_BITS: u32 = 8;
+const SUB_BUCKET_COUNT: u64 = 1 << SUB_BUCKET_BITS;
+const SUB_BUCKET_HALF_COUNT: u64 = SUB_BUCKET_COUNT / 2;
+
+/// The number of linear sub-buckets every power of two is split into.
+pub const SUB_BUCKETS_PER_OCTAVE: u64 = SUB_BUCKET_HALF_COUNT;
+
+/// The percentiles that are reported by default.
+pub const DEFAULT_PERCENTILES: [f64; 6] = [50.0, 90.0, 99.0, 99.9, 99.99, 100.0];
+
+/// Records latency samples, usually in nanoseconds, and provides percentiles.
+#[derive(Debug, Clone)]
+pub struct LatencyHistogram {
+    counts: Vec<u64>,
+    count: u64,
+    sum: u128,
+    min: u64,
+    max: u64,
+}
+
+impl Default for LatencyHistogram {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl LatencyHistogram {
+    /// Creates a new empty histogram. All memory is acquired here so that
+    /// [`LatencyHistogram::record()`] does not allocate.
+    pub fn new() -> Self {
+        Self {
+            counts: vec![0; Self::bucket_index(u64::MAX) + 1],
+            count: 0,
+            sum: 0,
+            min: u64::MAX,
+            max: 0,
+        }
+    }
+
+    fn bucket_index(value: u64) -> usize {
+        if value < SUB_BUCKET_COUNT {
+            return value as usize;
+        }
+
+        let exponent = (63 - value.leading_zeros()) - (SUB_BUCKET_BITS - 1);
+        let mantissa = value >> exponent;
+        (exponent as u64 * SUB_BUCKET_HALF_COUNT + mantissa) as usize
+    }
+
+    fn highest_equivalent_value(index: usize) -> u64 {
+        let index = index as u64;
+        if index < SUB_BUCKET_COUNT {
+            return index;
+        }
+
+        let exponent = index / SUB_BUCKET_HALF_COUNT - 1;
+        let mantissa = index - exponent * SUB_BUCKET_HALF_COUNT;
+        ((mantissa as u128 + 1) << exponent).saturating_sub(1) as u64
+    }
+
+    /// Records a single value.
+    pub fn record(&mut self, value: u64) {
+        self.counts[Self::bucket_index(value)] += 1;
+        self.count += 1;
+        self.sum += value as u128;
+        self.min = self.min.min(value);
+        self.max = self.max.max(value);
+    }
+
+    /// Adds all values recorded in `other` to this histogram. Used to combine the
+    /// measurements of multiple threads.
+    pub fn merge(&mut self, other: &LatencyHistogram) {
+        for (lhs, rhs) in self.counts.iter_mut().zip(other.counts.iter()) {
+            *lhs += *rhs;
+        }
+        self.count += other.count;
+        self.sum += other.sum;
+        self.min = self.min.min(other.min);
+        self.max = self.max.max(other.max);
+    }
+
+    /// Returns the number of recorded values.
+    pub fn count(&self) -> u64 {
+        self.count
+    }
+
+    /// Returns the smallest recorded value or 0 when the histogram is empty.
+    pub fn min(&self) -> u64 {
+        if self.count == 0 {
+            0
+        } else {
+            self.min
+        }
+    }
+
+    /// Returns the largest recorded value.
+    pub fn max(&self) -> u64 {
+        self.max
+    }
+
+    /// Returns the exact mean of all recorded values or 0 when the histogram is empty.
+    pub fn mean(&self) -> f64 {
+        if self.count == 0 {
+            0.0
+        } else {
+            self.sum as f64 / self.count as f64
+        }
+    }
+
+    /// Returns the value below or equal to which `percentile` percent of all recorded
+    /// values fall. `percentile` is clamped to `[0, 100]`.
+    pub fn percentile(&self, percentile: f64) -> u64 {
+        if self.count == 0 {
+            return 0;
+        }
+
+        let percentile = percentile.clamp(0.0, 100.0);
+        let target = ((percentile / 100.0 * self.count as f64).ceil() as u64).max(1);
+
+        let mut accumulated = 0;
+        for (index, count) in self.counts.iter().enumerate() {
+            accumulated += *count;
+            if accumulated >= target {
+                return Self::highest_equivalent_value(index).clamp(self.min, self.max);
+            }
+        }
+
+        self.max
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn bucket_index_is_monotonic_and_continuous() {
+        let mut last_index = 0;
+        for value in 0..1_000_000u64 {
+            let index = LatencyHistogram::bucket_index(value);
+            assert!(index == last_index || index == last_index + 1);
+            assert!(LatencyHistogram::highest_equivalent_value(index) >= value);
+            last_index = index;
+        }
+    }
+
+    #[test]
+    fn relative_error_is_bounded() {
+        let mut value = 1u64;
+        while value < u64::MAX / 3 {
+            let index = LatencyHistogram::bucket_index(value);
+            let reported = LatencyHistogram::highest_equivalent_value(index);
+            assert!((reported - value) as f64 <= value as f64 / SUB_BUCKETS_PER_OCTAVE as f64);
+            assert!(((reported - value) as f64) < value as f64 * 0.01);
+            value = value * 3 + 1;
+        }
+    }
+
+    #[test]
+    fn percentiles_of_uniform_distribution_are_exact_in_linear_range() {
+        let mut sut = LatencyHistogram::new();
+        for value in 1..=100 {
+            sut.record(value);
+        }
+
+        assert_eq!(sut.count(), 100);
+        assert_eq!(sut.min(), 1);
+        assert_eq!(sut.max(), 100);
+        assert_eq!(sut.percentile(50.0), 50);
+        assert_eq!(sut.percentile(99.0), 99);
+        assert_eq!(sut.percentile(100.0), 100);
+        assert_eq!(sut.mean(), 50.5);
+    }
+
+    #[test]
+    fn merge_combines_all_values() {
+        let mut sut = LatencyHistogram::new();
+        let mut other = LatencyHistogram::new();
+        sut.record(10);
+        other.record(1_000_000);
+
+        sut.merge(&other);
+
+        assert_eq!(sut.count(), 2);
+        assert_eq!(sut.min(), 10);
+        assert_eq!(sut.max(), 1_000_000);
+        assert_eq!(sut.percentile(100.0), 1_000_000);
+    }
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Shared measurement and reporting primitives for the iceoryx2 benchmarks.
+//!
+//! * [`histogram::LatencyHistogram`] records individual latency samples with bounded
+//!   relative error so that tail latencies (p99, p99.9, ...) can be reported and not only
+//!   the average.
+//! * [`cache_misses::CacheMissCounter`] counts the hardware cache misses of a thread so
+//!   that the cache warmth of a code path can be compared and not only its duration.
+//! * [`report::Report`] prints the results either human readable or as one JSON object
+//!   per line so that CI can track regressions.
+
+pub mod cache_misses;
+pub mod histogram;
+pub mod report;
@@ -0,0 +1,323 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Uniform result output of all benchmarks.
+//!
+//! The [`OutputFormat::Text`] output keeps the established
+//! `name ::: key: value, key: value` format, [`OutputFormat::Json`] emits exactly one
+//! JSON object per benchmark run and line so that the output of a whole benchmark suite
+//! can be consumed line by line.
+//!
+//! # Example
+//!
+//! ```
+//! use benchmark_common::histogram::LatencyHistogram;
+//! use benchmark_common::report::{OutputFormat, Report};
+//!
+//! let mut latencies = LatencyHistogram::new();
+//! latencies.record(120);
+//!
+//! Report::new("ipc::Service")
+//!     .parameter("Iterations", 1)
+//!     .result("Latency", 120)
+//!     .latency_histogram(&latencies)
+//!     .print(OutputFormat::Json);
+//! ```
+
+use core::fmt::{Display, Write};
+
+use crate::histogram::{LatencyHistogram, DEFAULT_PERCENTILES};
+
+/// Defines how a [`Report`] is printed.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, clap::ValueEnum)]
+pub enum OutputFormat {
+    /// Human readable single line output.
+    #[default]
+    Text,
+    /// One JSON object per line.
+    Json,
+}
+
+/// A single value of a [`Report`].
+#[derive(Debug, Clone, PartialEq)]
+pub enum Value {
+    Integer(u128),
+    Float(f64),
+    Text(String),
+}
+
+impl Display for Value {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        match self {
+            Value::Integer(v) => write!(f, "{}", v),
+            Value::Float(v) => write!(f, "{}", v),
+            Value::Text(v) => write!(f, "{}", v),
+        }
+    }
+}
+
+macro_rules! value_from_integer {
+    ($($t:ty),*) => {
+        $(impl From<$t> for Value {
+            fn from(value: $t) -> Self {
+                Value::Integer(value as u128)
+            }
+        })*
+    };
+}
+
+value_from_integer!(u8, u16, u32, u64, u128, usize);
+
+impl From<f64> for Value {
+    fn from(value: f64) -> Self {
+        Value::Float(value)
+    }
+}
+
+impl From<&str> for Value {
+    fn from(value: &str) -> Self {
+        Value::Text(value.to_string())
+    }
+}
+
+impl From<String> for Value {
+    fn from(value: String) -> Self {
+        Value::Text(value)
+    }
+}
+
+impl From<bool> for Value {
+    fn from(value: bool) -> Self {
+        Value::Text(value.to_string())
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum Section {
+    Parameters,
+    Results,
+}
+
+#[derive(Debug, Clone)]
+struct Entry {
+    section: Section,
+    key: String,
+    value: Value,
+    unit: Option<&'static str>,
+}
+
+/// Collects the configuration and the results of a single benchmark run. The text output
+/// lists the entries in the order in which they were added.
+#[derive(Debug, Clone)]
+pub struct Report {
+    name: String,
+    entries: Vec<Entry>,
+    percentiles: Vec<(f64, u64)>,
+}
+
+impl Report {
+    /// Creates a new report for the benchmark with the given name, e.g. the service
+    /// type that was benchmarked.
+    pub fn new(name: &str) -> Self {
+        Self {
+            name: name.to_string(),
+            entries: Vec::new(),
+            percentiles: Vec::new(),
+        }
+    }
+
+    /// Adds a configuration parameter of the benchmark.
+    pub fn parameter<V: Into<Value>>(self, key: &str, value: V) -> Self {
+        self.entry(Section::Parameters, key, value.into(), None)
+    }
+
+    /// Adds a measured result.
+    pub fn result<V: Into<Value>>(self, key: &str, value: V) -> Self {
+        self.entry(Section::Results, key, value.into(), None)
+    }
+
+    /// Adds a measured result whose text output is followed by the given unit, e.g.
+    /// `Time: 1.5 s`.
+    pub fn result_with_unit<V: Into<Value>>(self, key: &str, value: V, unit: &'static str) -> Self {
+        self.entry(Section::Results, key, value.into(), Some(unit))
+    }
+
+    fn entry(
+        mut self,
+        section: Section,
+        key: &str,
+        value: Value,
+        unit: Option<&'static str>,
+    ) -> Self {
+        self.entries.push(Entry {
+            section,
+            key: key.to_string(),
+            value,
+            unit,
+        });
+        self
+    }
+
+    /// Adds the [`DEFAULT_PERCENTILES`] of the provided histogram. Nothing is added when
+    /// the histogram is empty.
+    pub fn latency_histogram(mut self, histogram: &LatencyHistogram) -> Self {
+        if histogram.count() == 0 {
+            return self;
+        }
+
+        for percentile in DEFAULT_PERCENTILES {
+            self.percentiles
+                .push((percentile, histogram.percentile(percentile)));
+        }
+        self
+    }
+
+    /// Renders the report in the requested format.
+    pub fn render(&self, format: OutputFormat) -> String {
+        match format {
+            OutputFormat::Text => self.render_text(),
+            OutputFormat::Json => self.render_json(),
+        }
+    }
+
+    /// Prints the report in the requested format to stdout.
+    pub fn print(&self, format: OutputFormat) {
+        println!("{}", self.render(format));
+    }
+
+    fn render_text(&self) -> String {
+        let mut entries: Vec<String> = self
+            .entries
+            .iter()
+            .map(|entry| match entry.unit {
+                Some(unit) => format!("{}: {} {}", entry.key, entry.value, unit),
+                None => format!("{}: {}", entry.key, entry.value),
+            })
+            .collect();
+
+        if !self.percentiles.is_empty() {
+            let percentiles: Vec<String> = self
+                .percentiles
+                .iter()
+                .map(|(p, v)| format!("p{}={}", p, v))
+                .collect();
+            entries.push(format!(
+                "Latency Percentiles [ns]: {}",
+                percentiles.join(" ")
+            ));
+        }
+
+        format!("{} ::: {}", self.name, entries.join(", "))
+    }
+
+    fn render_json(&self) -> String {
+        let mut out = String::new();
+        out.push_str("{\"benchmark\":");
+        push_json_string(&mut out, &self.name);
+
+        for (section, section_name) in [
+            (Section::Parameters, "parameters"),
+            (Section::Results, "results"),
+        ] {
+            let _ = write!(out, ",\"{}\":{{", section_name);
+            let entries = self.entries.iter().filter(|entry| entry.section == section);
+            for (n, entry) in entries.enumerate() {
+                if n != 0 {
+                    out.push(',');
+                }
+                push_json_string(&mut out, &entry.key);
+                out.push(':');
+                push_json_value(&mut out, &entry.value);
+            }
+            out.push('}');
+        }
+
+        out.push_str(",\"latency_percentiles_ns\":{");
+        for (n, (percentile, value)) in self.percentiles.iter().enumerate() {
+            if n != 0 {
+                out.push(',');
+            }
+            let _ = write!(out, "\"p{}\":{}", percentile, value);
+        }
+        out.push_str("}}");
+
+        out
+    }
+}
+
+fn push_json_value(out: &mut String, value: &Value) {
+    match value {
+        Value::Integer(v) => {
+            let _ = write!(out, "{}", v);
+        }
+        Value::Float(v) if v.is_finite() => {
+            let _ = write!(out, "{}", v);
+        }
+        Value::Float(_) => out.push_str("null"),
+        Value::Text(v) => push_json_string(out, v),
+    }
+}
+
+fn push_json_string(out: &mut String, value: &str) {
+    out.push('"');
+    for c in value.chars() {
+        match c {
+            '"' => out.push_str("\\\""),
+            '\\' => out.push_str("\\\\"),
+            '\n' => out.push_str("\\n"),
+            '\r' => out.push_str("\\r"),
+            '\t' => out.push_str("\\t"),
+            c if (c as u32) < 0x20 => {
+                let _ = write!(out, "\\u{:04x}", c as u32);
+            }
+            c => out.push(c),
+        }
+    }
+    out.push('"');
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn text_output_keeps_established_format() {
+        let sut = Report::new("ipc::Service")
+            .parameter("Iterations", 10u64)
+            .result_with_unit("Time", 0.5, "s")
+            .result_with_unit("Latency", 100u64, "ns")
+            .parameter("Sample Size", 8u64);
+
+        assert_eq!(
+            sut.render(OutputFormat::Text),
+            "ipc::Service ::: Iterations: 10, Time: 0.5 s, Latency: 100 ns, Sample Size: 8"
+        );
+    }
+
+    #[test]
+    fn json_output_is_one_object_with_escaped_strings() {
+        let mut histogram = LatencyHistogram::new();
+        histogram.record(5);
+
+        let sut = Report::new("a\"b")
+            .parameter("Mode", "latency")
+            .result("Time", 0.5)
+            .latency_histogram(&histogram);
+
+        assert_eq!(
+            sut.render(OutputFormat::Json),
+            "{\"benchmark\":\"a\\\"b\",\"parameters\":{\"Mode\":\"latency\"},\
+             \"results\":{\"Time\":0.5},\"latency_percentiles_ns\":{\"p50\":5,\"p90\":5,\
+             \"p99\":5,\"p99.9\":5,\"p99.99\":5,\"p100\":5}}"
+        );
+    }
+}
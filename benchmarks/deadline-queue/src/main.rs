@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
+use clap::Parser;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::deadline_queue::*;
+
+const ITERATIONS: u64 = 1000000;
+const NUMBER_OF_DEADLINES: [usize; 5] = [1, 10, 100, 1000, 10000];
+
+fn perform_benchmark(args: &Args, number_of_deadlines: usize) {
+    let deadline_queue = DeadlineQueueBuilder::new()
+        .create()
+        .expect("failed to create deadline queue");
+
+    // long and slightly different periods, so that no deadline is hit during the benchmark but
+    // the queue has to order all of them
+    let mut guards = Vec::with_capacity(number_of_deadlines);
+    for n in 0..number_of_deadlines {
+        guards.push(
+            deadline_queue
+                .add_deadline_interval(Duration::from_secs(3600) + Duration::from_micros(n as u64))
+                .expect("failed to add deadline"),
+        );
+    }
+
+    let mut latencies = LatencyHistogram::new();
+    let mut number_of_missed_deadlines = 0u64;
+
+    let start = Time::now().expect("failed to acquire time");
+    for i in 0..args.iterations {
+        let wakeup_start = args
+            .percentiles
+            .then(|| Time::now().expect("failed to acquire time"));
+
+        // one wakeup of the WaitSet: an attachment with a deadline was notified, its deadline
+        // is reset, the missed deadlines are collected and the next timeout is acquired
+        guards[i as usize % number_of_deadlines]
+            .reset()
+            .expect("failed to reset deadline");
+        deadline_queue
+            .missed_deadlines(|_| {
+                number_of_missed_deadlines += 1;
+                CallbackProgression::Continue
+            })
+            .expect("failed to acquire missed deadlines");
+        core::hint::black_box(
+            deadline_queue
+                .duration_until_next_deadline()
+                .expect("failed to acquire next deadline"),
+        );
+
+        if let Some(wakeup_start) = wakeup_start {
+            let wakeup = wakeup_start.elapsed().expect("failed to measure time");
+            latencies.record(wakeup.as_nanos() as u64);
+        }
+    }
+    let stop = start.elapsed().expect("failed to measure time");
+
+    Report::new("DeadlineQueue")
+        .parameter("NumberOfDeadlines", number_of_deadlines)
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result_with_unit(
+            "WakeupCost",
+            stop.as_nanos() / args.iterations as u128,
+            "ns",
+        )
+        .result("MissedDeadlines", number_of_missed_deadlines)
+        .latency_histogram(&latencies)
+        .print(args.output_format);
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// Number of simulated WaitSet wakeups
+    #[clap(short, long, default_value_t = ITERATIONS)]
+    iterations: u64,
+    /// The number of deadlines attached to the deadline queue. When not set, the benchmark is
+    /// repeated for 1, 10, 100, 1000 and 10000 deadlines.
+    #[clap(short, long)]
+    number_of_deadlines: Option<usize>,
+    /// Measure every wakeup and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
+}
+
+fn main() {
+    let args = Args::parse();
+
+    match args.number_of_deadlines {
+        Some(number_of_deadlines) => perform_benchmark(&args, number_of_deadlines.max(1)),
+        None => {
+            for number_of_deadlines in NUMBER_OF_DEADLINES {
+                perform_benchmark(&args, number_of_deadlines);
+            }
+        }
+    }
+}
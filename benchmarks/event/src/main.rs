@@ -10,12 +10,18 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use clap::Parser;
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
+use clap::{Parser, ValueEnum};
 use iceoryx2::prelude::*;
+use iceoryx2::service::port_factory::event::PortFactory as EventPortFactory;
+use iceoryx2::waitset::ReactorMechanism;
 use iceoryx2_bb_log::set_log_level;
 use iceoryx2_bb_posix::barrier::*;
 use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
 use iceoryx2_bb_posix::thread::ThreadBuilder;
+use iceoryx2_cal::event::Event;
 
 fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
     let service_name_a2b = ServiceName::new("a2b")?;
@@ -62,6 +68,8 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut latencies = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -72,10 +80,18 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             startup_barrier.wait();
             start_benchmark_barrier.wait();
 
+            let now = || Time::now().expect("failed to acquire time");
+            let mut round_trip_start = args.percentiles.then(now);
             notifier_a2b.notify().expect("failed to notify");
 
             for _ in 0..args.iterations {
                 while listener_b2a.blocking_wait_one().unwrap().is_none() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
+
+                round_trip_start = args.percentiles.then(now);
                 notifier_a2b.notify().expect("failed to notify");
             }
         });
@@ -104,18 +120,145 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: MaxEventId: {}, Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<T>(),
-        args.max_event_id,
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2)
-    );
+    Report::new(core::any::type_name::<T>())
+        .parameter("MaxEventId", args.max_event_id)
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result_with_unit(
+            "Latency",
+            stop.as_nanos() / (args.iterations as u128 * 2),
+            "ns",
+        )
+        .latency_histogram(&latencies)
+        .print(args.output_format);
+
+    Ok(())
+}
+
+fn perform_waitset_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>>
+where
+    <T::Event as Event>::Listener: SynchronousMultiplexing,
+{
+    let service_name_a2b = ServiceName::new("a2b")?;
+    let service_name_b2a = ServiceName::new("b2a")?;
+    let service_name_idle = ServiceName::new("idle")?;
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let service_a2b = node.service_builder(&service_name_a2b).event().create()?;
+    let service_b2a = node.service_builder(&service_name_b2a).event().create()?;
+    let service_idle = node
+        .service_builder(&service_name_idle)
+        .event()
+        .max_listeners(2 * args.number_of_idle_attachments + 1)
+        .create()?;
+
+    let start_benchmark_barrier_handle = BarrierHandle::new();
+    let startup_barrier_handle = BarrierHandle::new();
+    let startup_barrier = BarrierBuilder::new(3)
+        .create(&startup_barrier_handle)
+        .unwrap();
+    let start_benchmark_barrier = BarrierBuilder::new(3)
+        .create(&start_benchmark_barrier_handle)
+        .unwrap();
+
+    let mechanism = args.reactor_mechanism.into();
+    let participant = |service_listen: &EventPortFactory<T>,
+                       service_notify: &EventPortFactory<T>,
+                       is_initiator: bool| {
+        let notifier = service_notify.notifier_builder().create().unwrap();
+        let listener = service_listen.listener_builder().create().unwrap();
+        let idle_listeners: Vec<_> = (0..args.number_of_idle_attachments)
+            .map(|_| service_idle.listener_builder().create().unwrap())
+            .collect();
+
+        let waitset = WaitSetBuilder::new()
+            .reactor_mechanism(mechanism)
+            .create::<T>()
+            .unwrap();
+        let guard = waitset.attach_notification(&listener).unwrap();
+        let _idle_guards: Vec<_> = idle_listeners
+            .iter()
+            .map(|l| waitset.attach_notification(l).unwrap())
+            .collect();
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        if is_initiator {
+            notifier.notify().expect("failed to notify");
+        }
+
+        let mut remaining_wakeups = args.iterations;
+        waitset
+            .wait_and_process(|attachment_id| {
+                if attachment_id.has_event_from(&guard) {
+                    while listener.try_wait_one().unwrap().is_some() {}
+                    notifier.notify().expect("failed to notify");
+                    remaining_wakeups -= 1;
+                    if remaining_wakeups == 0 {
+                        return CallbackProgression::Stop;
+                    }
+                }
+                CallbackProgression::Continue
+            })
+            .unwrap();
+    };
+
+    let t1 = ThreadBuilder::new()
+        .affinity(args.cpu_core_participant_1)
+        .priority(255)
+        .spawn(|| participant(&service_b2a, &service_a2b, true));
+
+    let t2 = ThreadBuilder::new()
+        .affinity(args.cpu_core_participant_2)
+        .priority(255)
+        .spawn(|| participant(&service_a2b, &service_b2a, false));
+
+    startup_barrier.wait();
+    let start = Time::now().expect("failed to acquire time");
+    start_benchmark_barrier.wait();
+
+    drop(t1);
+    drop(t2);
+
+    let stop = start.elapsed().expect("failed to measure time");
+    let wakeups = args.iterations as f64 * 2.0;
+    Report::new(core::any::type_name::<T>())
+        .parameter("ReactorMechanism", format!("{:?}", mechanism))
+        .parameter("IdleAttachments", args.number_of_idle_attachments)
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result("WakeupsPerSecond", (wakeups / stop.as_secs_f64()) as u64)
+        .result_with_unit(
+            "Latency",
+            stop.as_nanos() / (args.iterations as u128 * 2),
+            "ns",
+        )
+        .print(args.output_format);
 
     Ok(())
 }
 
+/// The mechanism the [`WaitSet`] uses to wait on its attachments.
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum Mechanism {
+    Select,
+    Epoll,
+    IoUring,
+    IoUringSqPoll,
+}
+
+impl From<Mechanism> for ReactorMechanism {
+    fn from(value: Mechanism) -> Self {
+        match value {
+            Mechanism::Select => ReactorMechanism::Select,
+            Mechanism::Epoll => ReactorMechanism::Epoll,
+            Mechanism::IoUring => ReactorMechanism::IoUring,
+            Mechanism::IoUringSqPoll => ReactorMechanism::IoUringSqPoll,
+        }
+    }
+}
+
 const ITERATIONS: usize = 1000000;
 const EVENT_ID_MAX_VALUE: usize = 128;
 
@@ -152,6 +295,24 @@ struct Args {
     /// The number of additional listeners per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_listeners: usize,
+    /// Measure every round trip and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// Every participant waits with a WaitSet instead of a blocking wait on the listener
+    /// and the number of wakeups per second is reported.
+    #[clap(long)]
+    waitset: bool,
+    /// The mechanism the WaitSet uses to wait on its attachments.
+    #[clap(long, value_enum, default_value_t = Mechanism::Select)]
+    reactor_mechanism: Mechanism,
+    /// The number of additional listeners that are attached to the WaitSet of every
+    /// participant but are never notified.
+    #[clap(long, default_value_t = 0)]
+    number_of_idle_attachments: usize,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -166,12 +327,20 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
     let mut at_least_one_benchmark_did_run = false;
 
     if args.bench_ipc || args.bench_all {
-        perform_benchmark::<ipc::Service>(&args)?;
+        if args.waitset {
+            perform_waitset_benchmark::<ipc::Service>(&args)?;
+        } else {
+            perform_benchmark::<ipc::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
     if args.bench_local || args.bench_all {
-        perform_benchmark::<local::Service>(&args)?;
+        if args.waitset {
+            perform_waitset_benchmark::<local::Service>(&args)?;
+        } else {
+            perform_benchmark::<local::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
@@ -11,20 +11,36 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use core::mem::MaybeUninit;
+use core::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use core::time::Duration;
 
-use clap::Parser;
+use benchmark_common::cache_misses::CacheMissCounter;
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
+use clap::{Parser, ValueEnum};
+use iceoryx2::config::PublishSubscribe as PublishSubscribeSettings;
 use iceoryx2::prelude::*;
+use iceoryx2::service::port_factory::publish_subscribe::PortFactory as PubSubPortFactory;
 use iceoryx2_bb_log::set_log_level;
 use iceoryx2_bb_posix::barrier::*;
 use iceoryx2_bb_posix::clock::Time;
 use iceoryx2_bb_posix::thread::ThreadBuilder;
 
 const ITERATIONS: u64 = 10000000;
+const THROUGHPUT_DURATION_IN_SECONDS: u64 = 5;
+const WAIT_FOR_PEER_INTERVAL: Duration = Duration::from_millis(10);
+const AUTO_TUNE_BUFFER_SIZES: [usize; 7] = [1, 2, 4, 8, 16, 32, 64];
+const AUTO_TUNE_RATE_THRESHOLD: f64 = 0.95;
+const FAN_OUT_ITERATIONS: u64 = 100000;
 
-fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+type Factory<T> = PubSubPortFactory<T, [u8], ()>;
+
+fn create_services<T: Service>(
+    node: &Node<T>,
+    args: &Args,
+) -> Result<(Factory<T>, Factory<T>), Box<dyn core::error::Error>> {
     let service_name_a2b = ServiceName::new("a2b")?;
     let service_name_b2a = ServiceName::new("b2a")?;
-    let node = NodeBuilder::new().create::<T>()?;
 
     let service_a2b = node
         .service_builder(&service_name_a2b)
@@ -34,7 +50,7 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .history_size(0)
         .subscriber_max_buffer_size(1)
         .enable_safe_overflow(true)
-        .create()?;
+        .open_or_create()?;
 
     let service_b2a = node
         .service_builder(&service_name_b2a)
@@ -44,7 +60,58 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .history_size(0)
         .subscriber_max_buffer_size(1)
         .enable_safe_overflow(true)
-        .create()?;
+        .open_or_create()?;
+
+    Ok((service_a2b, service_b2a))
+}
+
+fn latency_report<T: Service>(
+    args: &Args,
+    mode: &str,
+    runtime: Duration,
+    latencies: &LatencyHistogram,
+    cache_misses: Option<u64>,
+) -> Report {
+    // the established fields come first so that existing parsers of the text output keep working
+    let report = Report::new(core::any::type_name::<T>())
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", runtime.as_secs_f64(), "s")
+        .result_with_unit(
+            "Latency",
+            runtime.as_nanos() / (args.iterations as u128 * 2),
+            "ns",
+        )
+        .parameter("Sample Size", args.payload_size)
+        .parameter("Mode", mode)
+        .parameter("Chunk Cache Size", args.chunk_cache_size)
+        .latency_histogram(latencies);
+
+    match cache_misses {
+        Some(cache_misses) => report.result(
+            "Cache Misses per Round Trip",
+            cache_misses as f64 / args.iterations as f64,
+        ),
+        None => report,
+    }
+}
+
+/// Creates a [`CacheMissCounter`] for the calling thread when the user requested the
+/// measurement. Warns once when the platform does not provide the counter.
+fn cache_miss_counter(args: &Args) -> Option<CacheMissCounter> {
+    if !args.cache_misses {
+        return None;
+    }
+
+    let counter = CacheMissCounter::new();
+    if counter.is_none() {
+        eprintln!("Cache misses cannot be measured, the hardware counters are not accessible.");
+    }
+    counter
+}
+
+fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+    let node = NodeBuilder::new().create::<T>()?;
+    let (service_a2b, service_b2a) = create_services(&node, args)?;
 
     let mut additional_publishers = Vec::new();
     let mut additional_subscribers = Vec::new();
@@ -68,6 +135,9 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut latencies = LatencyHistogram::new();
+    let mut cache_misses = None;
+
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -75,13 +145,20 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             let sender_a2b = service_a2b
                 .publisher_builder()
                 .initial_max_slice_len(args.payload_size)
+                .chunk_cache_size(args.chunk_cache_size)
                 .create()
                 .unwrap();
             let receiver_b2a = service_b2a.subscriber_builder().create().unwrap();
 
+            let counter = cache_miss_counter(args);
+
             startup_barrier.wait();
             start_benchmark_barrier.wait();
 
+            if let Some(counter) = &counter {
+                counter.start();
+            }
+
             let mut sample = if args.send_copy {
                 let mut sample = sender_a2b.loan_slice_uninit(args.payload_size).unwrap();
                 sample.payload_mut().fill(MaybeUninit::new(0));
@@ -96,6 +173,9 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             };
 
             for _ in 0..args.iterations {
+                let round_trip_start = args
+                    .percentiles
+                    .then(|| Time::now().expect("failed to acquire time"));
                 sample.send().unwrap();
                 sample = unsafe {
                     sender_a2b
@@ -104,7 +184,13 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
                         .assume_init()
                 };
                 while receiver_b2a.receive().unwrap().is_none() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
             }
+
+            cache_misses = counter.map(|counter| counter.stop());
         });
 
     let t2 = ThreadBuilder::new()
@@ -114,6 +200,7 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             let sender_b2a = service_b2a
                 .publisher_builder()
                 .initial_max_slice_len(args.payload_size)
+                .chunk_cache_size(args.chunk_cache_size)
                 .create()
                 .unwrap();
             let receiver_a2b = service_a2b.subscriber_builder().create().unwrap();
@@ -149,18 +236,416 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
+    latency_report::<T>(args, "latency", stop, &latencies, cache_misses).print(args.output_format);
+
+    Ok(())
+}
+
+/// Runs only one side of the ping-pong so that both participants live in separate
+/// processes. Participant [`Participant::A`] initiates every round trip and measures
+/// it, [`Participant::B`] echoes every sample back.
+fn perform_two_process_benchmark<T: Service>(
+    args: &Args,
+    participant: Participant,
+) -> Result<(), Box<dyn core::error::Error>> {
+    let node = NodeBuilder::new().create::<T>()?;
+    let (service_a2b, service_b2a) = create_services(&node, args)?;
+
+    let (own_service, peer_service) = match participant {
+        Participant::A => (&service_a2b, &service_b2a),
+        Participant::B => (&service_b2a, &service_a2b),
+    };
+
+    let publisher = own_service
+        .publisher_builder()
+        .initial_max_slice_len(args.payload_size)
+        .chunk_cache_size(args.chunk_cache_size)
+        .create()?;
+    let subscriber = peer_service.subscriber_builder().create()?;
+
+    // wait until the other process has created its ports, otherwise the first sample
+    // would be lost
+    while own_service.dynamic_config().number_of_subscribers() == 0
+        || peer_service.dynamic_config().number_of_publishers() == 0
+    {
+        std::thread::sleep(WAIT_FOR_PEER_INTERVAL);
+    }
+
+    let loan = || {
+        if args.send_copy {
+            let mut sample = publisher.loan_slice_uninit(args.payload_size).unwrap();
+            sample.payload_mut().fill(MaybeUninit::new(0));
+            unsafe { sample.assume_init() }
+        } else {
+            unsafe {
+                publisher
+                    .loan_slice_uninit(args.payload_size)
+                    .unwrap()
+                    .assume_init()
+            }
+        }
+    };
+
+    let mut latencies = LatencyHistogram::new();
+    let counter = cache_miss_counter(args);
+    if let Some(counter) = &counter {
+        counter.start();
+    }
+    let start = Time::now().expect("failed to acquire time");
+
+    match participant {
+        Participant::A => {
+            for _ in 0..args.iterations {
+                let sample = loan();
+                let round_trip_start = args
+                    .percentiles
+                    .then(|| Time::now().expect("failed to acquire time"));
+                sample.send().unwrap();
+                while subscriber.receive().unwrap().is_none() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
+            }
+        }
+        Participant::B => {
+            for _ in 0..args.iterations {
+                let sample = loan();
+                while subscriber.receive().unwrap().is_none() {}
+                sample.send().unwrap();
+            }
+        }
+    }
+
+    let stop = start.elapsed().expect("failed to measure time");
+    let cache_misses = counter.map(|counter| counter.stop());
+    if participant == Participant::A {
+        latency_report::<T>(args, "two-process-latency", stop, &latencies, cache_misses)
+            .print(args.output_format);
+    }
+
+    Ok(())
+}
+
+/// The outcome of one run of the throughput benchmark.
+struct ThroughputMeasurement {
+    sent: u64,
+    received: u64,
+    runtime: f64,
+}
+
+impl ThroughputMeasurement {
+    fn receive_rate(&self) -> f64 {
+        self.received as f64 / self.runtime
+    }
+}
+
+/// Every publisher sends as fast as it can for `duration` while every subscriber drains
+/// its buffer. The service and port settings are taken from `settings`, only the number of
+/// publishers and subscribers is defined by `args`.
+fn measure_throughput<T: Service>(
+    args: &Args,
+    settings: &PublishSubscribeSettings,
+    duration: Duration,
+) -> Result<ThroughputMeasurement, Box<dyn core::error::Error>> {
+    let service_name = ServiceName::new("throughput")?;
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let service = node
+        .service_builder(&service_name)
+        .publish_subscribe::<[u8]>()
+        .max_publishers(args.number_of_publishers)
+        .max_subscribers(args.number_of_subscribers)
+        .history_size(settings.publisher_history_size)
+        .subscriber_max_buffer_size(settings.subscriber_max_buffer_size)
+        .subscriber_max_borrowed_samples(settings.subscriber_max_borrowed_samples)
+        .enable_safe_overflow(settings.enable_safe_overflow)
+        .create()?;
+
+    let number_of_threads = args.number_of_publishers + args.number_of_subscribers;
+    let startup_barrier_handle = BarrierHandle::new();
+    let startup_barrier = BarrierBuilder::new(number_of_threads as u32 + 1)
+        .create(&startup_barrier_handle)
+        .unwrap();
+
+    let keep_running = AtomicBool::new(true);
+    let active_publishers = AtomicU64::new(args.number_of_publishers as u64);
+    let sent_samples = AtomicU64::new(0);
+    let received_samples = AtomicU64::new(0);
+
+    let mut threads = Vec::with_capacity(number_of_threads);
+
+    for _ in 0..args.number_of_publishers {
+        threads.push(ThreadBuilder::new().spawn(|| {
+            let publisher = service
+                .publisher_builder()
+                .initial_max_slice_len(args.payload_size)
+                .chunk_cache_size(args.chunk_cache_size)
+                .max_loaned_samples(settings.publisher_max_loaned_samples)
+                .unable_to_deliver_strategy(settings.unable_to_deliver_strategy)
+                .create()
+                .unwrap();
+
+            startup_barrier.wait();
+
+            let mut counter = 0;
+            while keep_running.load(Ordering::Relaxed) {
+                if let Ok(sample) = publisher.loan_slice_uninit(args.payload_size) {
+                    let sample = if args.send_copy {
+                        let mut sample = sample;
+                        sample.payload_mut().fill(MaybeUninit::new(0));
+                        unsafe { sample.assume_init() }
+                    } else {
+                        unsafe { sample.assume_init() }
+                    };
+                    sample.send().unwrap();
+                    counter += 1;
+                }
+            }
+            sent_samples.fetch_add(counter, Ordering::Relaxed);
+            active_publishers.fetch_sub(1, Ordering::Relaxed);
+        }));
+    }
+
+    for _ in 0..args.number_of_subscribers {
+        threads.push(ThreadBuilder::new().spawn(|| {
+            let subscriber = service.subscriber_builder().create().unwrap();
+
+            startup_barrier.wait();
+
+            // a blocking publisher waits for the subscribers, therefore they must drain their
+            // buffers until every publisher stopped
+            let mut counter = 0;
+            while keep_running.load(Ordering::Relaxed)
+                || active_publishers.load(Ordering::Relaxed) != 0
+            {
+                while subscriber.receive().unwrap().is_some() {
+                    counter += 1;
+                }
+            }
+            received_samples.fetch_add(counter, Ordering::Relaxed);
+        }));
+    }
+
+    startup_barrier.wait();
+    let start = Time::now().expect("failed to acquire time");
+    std::thread::sleep(duration);
+    keep_running.store(false, Ordering::Relaxed);
+    drop(threads);
+    let stop = start.elapsed().expect("failed to measure time");
+
+    Ok(ThroughputMeasurement {
+        sent: sent_samples.load(Ordering::Relaxed),
+        received: received_samples.load(Ordering::Relaxed),
+        runtime: stop.as_secs_f64(),
+    })
+}
+
+/// Every publisher sends as fast as it can for a fixed duration while every subscriber
+/// drains its buffer. Reports the sustained send and receive rates.
+fn perform_throughput_benchmark<T: Service>(
+    args: &Args,
+) -> Result<(), Box<dyn core::error::Error>> {
+    let mut settings = Config::global_config().defaults.publish_subscribe.clone();
+    settings.publisher_history_size = 0;
+    settings.subscriber_max_buffer_size = args.subscriber_buffer_size;
+    settings.subscriber_max_borrowed_samples = settings
+        .subscriber_max_borrowed_samples
+        .min(args.subscriber_buffer_size);
+    settings.enable_safe_overflow = true;
+
+    let measurement = measure_throughput::<T>(args, &settings, Duration::from_secs(args.duration))?;
+    let ThroughputMeasurement {
+        sent,
+        received,
+        runtime,
+    } = measurement;
+
+    Report::new(core::any::type_name::<T>())
+        .parameter("Mode", "throughput")
+        .parameter("Publishers", args.number_of_publishers)
+        .parameter("Subscribers", args.number_of_subscribers)
+        .parameter("Sample Size", args.payload_size)
+        .parameter("Subscriber Buffer Size", args.subscriber_buffer_size)
+        .result_with_unit("Time", runtime, "s")
+        .result("Sent Samples", sent)
+        .result("Received Samples", received)
+        .result("Send Rate [samples/s]", sent as f64 / runtime)
+        .result("Receive Rate [samples/s]", received as f64 / runtime)
+        .result(
+            "Receive Rate [MB/s]",
+            received as f64 * args.payload_size as f64 / runtime / 1_000_000.0,
+        )
+        .print(args.output_format);
+
+    Ok(())
+}
+
+/// The `high-throughput` profile with the subscriber buffer size set to `buffer_size`.
+fn high_throughput_profile_with_buffer_size(buffer_size: usize) -> PublishSubscribeSettings {
+    let mut profile = Config::global_config().profiles.high_throughput.clone();
+    profile.subscriber_max_buffer_size = buffer_size;
+    profile.subscriber_max_borrowed_samples =
+        profile.subscriber_max_borrowed_samples.min(buffer_size);
+    profile
+}
+
+/// Sweeps the subscriber buffer size of the `high-throughput` profile with the throughput
+/// benchmark and recommends the smallest buffer that reaches [`AUTO_TUNE_RATE_THRESHOLD`] of
+/// the best receive rate. Every measurement uses exactly the settings of the profile that is
+/// recommended for it. In text mode, the recommended profile is printed so that it can be
+/// pasted into the config file.
+fn perform_auto_tune<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+    let mut measurements = Vec::with_capacity(AUTO_TUNE_BUFFER_SIZES.len());
+
+    for buffer_size in AUTO_TUNE_BUFFER_SIZES {
+        let measurement = measure_throughput::<T>(
+            args,
+            &high_throughput_profile_with_buffer_size(buffer_size),
+            Duration::from_secs(args.duration),
+        )?;
+
+        Report::new(core::any::type_name::<T>())
+            .parameter("Mode", "auto-tune")
+            .parameter("Publishers", args.number_of_publishers)
+            .parameter("Subscribers", args.number_of_subscribers)
+            .parameter("Sample Size", args.payload_size)
+            .parameter("Subscriber Buffer Size", buffer_size)
+            .result("Receive Rate [samples/s]", measurement.receive_rate())
+            .print(args.output_format);
+
+        measurements.push((buffer_size, measurement.receive_rate()));
+    }
+
+    let best_rate = measurements
+        .iter()
+        .map(|(_, rate)| *rate)
+        .fold(0.0, f64::max);
+    let recommended_buffer_size = measurements
+        .iter()
+        .find(|(_, rate)| *rate >= best_rate * AUTO_TUNE_RATE_THRESHOLD)
+        .map(|(buffer_size, _)| *buffer_size)
+        .unwrap_or(args.subscriber_buffer_size);
+
+    if args.output_format != OutputFormat::Text {
+        return Ok(());
+    }
+
+    let profile = high_throughput_profile_with_buffer_size(recommended_buffer_size);
+
+    println!();
+    println!("# recommended profile for {}", core::any::type_name::<T>());
+    println!("[profiles.high-throughput]");
+    println!("max-subscribers = {}", profile.max_subscribers);
+    println!("max-publishers = {}", profile.max_publishers);
+    println!("max-nodes = {}", profile.max_nodes);
+    println!(
+        "publisher-history-size = {}",
+        profile.publisher_history_size
+    );
+    println!(
+        "subscriber-max-buffer-size = {}",
+        profile.subscriber_max_buffer_size
+    );
     println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns, Sample Size: {}",
-        core::any::type_name::<T>(),
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-        args.payload_size
+        "subscriber-max-borrowed-samples = {}",
+        profile.subscriber_max_borrowed_samples
     );
+    println!(
+        "publisher-max-loaned-samples = {}",
+        profile.publisher_max_loaned_samples
+    );
+    println!("enable-safe-overflow = {}", profile.enable_safe_overflow);
+    println!(
+        "unable-to-deliver-strategy = '{:?}'",
+        profile.unable_to_deliver_strategy
+    );
+    println!(
+        "subscriber-expired-connection-buffer = {}",
+        profile.subscriber_expired_connection_buffer
+    );
+
+    Ok(())
+}
+
+/// Measures the average cost of one send for a growing number of subscribers, once with the
+/// per-subscriber connections and once with the broadcast ring. The subscribers are drained
+/// after every send so that the publisher never blocks.
+fn perform_fan_out_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+    let node = NodeBuilder::new().create::<T>()?;
+    let iterations = args.iterations.min(FAN_OUT_ITERATIONS);
+
+    let mut number_of_subscribers = 1;
+    while number_of_subscribers <= args.max_fan_out {
+        for broadcast_ring_size in [0, args.subscriber_buffer_size] {
+            let service_name = ServiceName::new("fan-out")?;
+            let service = node
+                .service_builder(&service_name)
+                .publish_subscribe::<[u8]>()
+                .max_publishers(1)
+                .max_subscribers(number_of_subscribers)
+                .history_size(0)
+                .subscriber_max_buffer_size(args.subscriber_buffer_size)
+                .enable_safe_overflow(true)
+                .broadcast_ring_size(broadcast_ring_size)
+                .create()?;
+
+            let publisher = service
+                .publisher_builder()
+                .initial_max_slice_len(args.payload_size)
+                .chunk_cache_size(args.chunk_cache_size)
+                .create()?;
+            let subscribers = (0..number_of_subscribers)
+                .map(|_| service.subscriber_builder().create())
+                .collect::<Result<Vec<_>, _>>()?;
+
+            let mut send_time = Duration::ZERO;
+            for _ in 0..iterations {
+                let sample = publisher.loan_slice_uninit(args.payload_size)?;
+                let sample = unsafe { sample.assume_init() };
+
+                let start = Time::now().expect("failed to acquire time");
+                sample.send()?;
+                send_time += start.elapsed().expect("failed to measure time");
+
+                for subscriber in &subscribers {
+                    while subscriber.receive()?.is_some() {}
+                }
+            }
+
+            let mode = if broadcast_ring_size == 0 {
+                "fan-out"
+            } else {
+                "fan-out (broadcast ring)"
+            };
+
+            Report::new(core::any::type_name::<T>())
+                .parameter("Mode", mode)
+                .parameter("Subscribers", number_of_subscribers)
+                .parameter("Iterations", iterations)
+                .parameter("Sample Size", args.payload_size)
+                .result_with_unit(
+                    "Send Latency",
+                    send_time.as_nanos() / iterations as u128,
+                    "ns",
+                )
+                .print(args.output_format);
+        }
+
+        number_of_subscribers *= 2;
+    }
 
     Ok(())
 }
 
+#[derive(Debug, Clone, Copy, PartialEq, Eq, ValueEnum)]
+enum Participant {
+    /// Initiates and measures every round trip
+    A,
+    /// Echoes every received sample
+    B,
+}
+
 #[derive(Parser, Debug)]
 #[clap(version, about, long_about = None)]
 struct Args {
@@ -198,6 +683,53 @@ struct Args {
     /// The number of additional subscribers per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_subscribers: usize,
+    /// Measure every round trip and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
+    /// Run only one participant of the latency benchmark in this process. Start a second
+    /// process with the other participant and the same arguments. Only the IPC setup can
+    /// communicate between processes.
+    #[clap(long, value_enum)]
+    process: Option<Participant>,
+    /// Run the sustained throughput benchmark instead of the latency benchmark.
+    #[clap(long)]
+    throughput: bool,
+    /// The number of publishers in the throughput benchmark.
+    #[clap(long, default_value_t = 1)]
+    number_of_publishers: usize,
+    /// The number of subscribers in the throughput benchmark.
+    #[clap(long, default_value_t = 1)]
+    number_of_subscribers: usize,
+    /// The buffer size of every subscriber in the throughput benchmark.
+    #[clap(long, default_value_t = 16)]
+    subscriber_buffer_size: usize,
+    /// The duration in seconds of the throughput benchmark.
+    #[clap(long, default_value_t = THROUGHPUT_DURATION_IN_SECONDS)]
+    duration: u64,
+    /// The number of returned chunks every publisher keeps in its local cache. `0` disables
+    /// the cache.
+    #[clap(long, default_value_t = 0)]
+    chunk_cache_size: usize,
+    /// Count the hardware cache misses of the measuring participant and report them per
+    /// round trip. Requires access to the perf event counters on Linux.
+    #[clap(long)]
+    cache_misses: bool,
+    /// Sweep the subscriber buffer size with the throughput benchmark and print the
+    /// recommended `high-throughput` performance profile. Every step runs for `--duration`
+    /// seconds.
+    #[clap(long)]
+    auto_tune: bool,
+    /// Measure the send latency for 1, 2, 4, ... up to `--max-fan-out` subscribers, with
+    /// and without the broadcast ring. The ring holds `--subscriber-buffer-size` samples.
+    #[clap(long)]
+    fan_out: bool,
+    /// The largest number of subscribers in the fan-out benchmark.
+    #[clap(long, default_value_t = 64)]
+    max_fan_out: usize,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -209,15 +741,35 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
         set_log_level(iceoryx2_bb_log::LogLevel::Error);
     }
 
+    if let Some(participant) = args.process {
+        return perform_two_process_benchmark::<ipc::Service>(&args, participant);
+    }
+
     let mut at_least_one_benchmark_did_run = false;
 
     if args.bench_ipc || args.bench_all {
-        perform_benchmark::<ipc::Service>(&args)?;
+        if args.fan_out {
+            perform_fan_out_benchmark::<ipc::Service>(&args)?;
+        } else if args.auto_tune {
+            perform_auto_tune::<ipc::Service>(&args)?;
+        } else if args.throughput {
+            perform_throughput_benchmark::<ipc::Service>(&args)?;
+        } else {
+            perform_benchmark::<ipc::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
     if args.bench_local || args.bench_all {
-        perform_benchmark::<local::Service>(&args)?;
+        if args.fan_out {
+            perform_fan_out_benchmark::<local::Service>(&args)?;
+        } else if args.auto_tune {
+            perform_auto_tune::<local::Service>(&args)?;
+        } else if args.throughput {
+            perform_throughput_benchmark::<local::Service>(&args)?;
+        } else {
+            perform_benchmark::<local::Service>(&args)?;
+        }
         at_least_one_benchmark_did_run = true;
     }
 
@@ -10,6 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
 use clap::Parser;
 use iceoryx2_bb_lock_free::spsc::index_queue::FixedSizeIndexQueue;
 use iceoryx2_bb_lock_free::spsc::queue::Queue;
@@ -69,6 +71,8 @@ fn perform_benchmark<Q: PushPop>(
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut latencies = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -77,8 +81,15 @@ fn perform_benchmark<Q: PushPop>(
             start_benchmark_barrier.wait();
 
             for _ in 0..args.iterations {
+                let round_trip_start = args
+                    .percentiles
+                    .then(|| Time::now().expect("failed to acquire time"));
                 queue_a2b.push(0);
                 while !queue_b2a.pop() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
             }
         });
 
@@ -104,13 +115,16 @@ fn perform_benchmark<Q: PushPop>(
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<Q>(),
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+    Report::new(core::any::type_name::<Q>())
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result_with_unit(
+            "Latency",
+            stop.as_nanos() / (args.iterations as u128 * 2),
+            "ns",
+        )
+        .latency_histogram(&latencies)
+        .print(args.output_format);
 
     Ok(())
 }
@@ -127,6 +141,13 @@ struct Args {
     /// The cpu core that shall be used by participant 2
     #[clap(long, default_value_t = 1)]
     cpu_core_participant_2: usize,
+    /// Measure every round trip and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -10,6 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::{OutputFormat, Report};
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_log::set_log_level;
@@ -64,6 +66,8 @@ fn perform_response_stream_benchmark<T: Service>(
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut latencies = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -82,9 +86,16 @@ fn perform_response_stream_benchmark<T: Service>(
             let mut response = unsafe { active_request.loan_uninit().unwrap().assume_init() };
 
             for _ in 0..args.iterations {
+                let round_trip_start = args
+                    .percentiles
+                    .then(|| Time::now().expect("failed to acquire time"));
                 response.send().unwrap();
                 response = unsafe { active_request.loan_uninit().unwrap().assume_init() };
                 while pending_response.receive().unwrap().is_none() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
             }
         });
 
@@ -119,13 +130,19 @@ fn perform_response_stream_benchmark<T: Service>(
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "[RESPONSE_STREAM] {} ::: Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<T>(),
-        args.iterations,
-        stop.as_secs_f64(),
+    Report::new(&format!(
+        "[RESPONSE_STREAM] {}",
+        core::any::type_name::<T>()
+    ))
+    .parameter("Iterations", args.iterations)
+    .result_with_unit("Time", stop.as_secs_f64(), "s")
+    .result_with_unit(
+        "Latency",
         stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+        "ns",
+    )
+    .latency_histogram(&latencies)
+    .print(args.output_format);
 
     Ok(())
 }
@@ -173,6 +190,8 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut latencies = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(args.cpu_core_participant_1)
         .priority(255)
@@ -186,9 +205,16 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
             let mut request = unsafe { client_a2b.loan_uninit().unwrap().assume_init() };
 
             for _ in 0..args.iterations {
+                let round_trip_start = args
+                    .percentiles
+                    .then(|| Time::now().expect("failed to acquire time"));
                 request.send().unwrap();
                 request = unsafe { client_a2b.loan_uninit().unwrap().assume_init() };
                 while server_b2a.receive().unwrap().is_none() {}
+                if let Some(round_trip_start) = round_trip_start {
+                    let round_trip = round_trip_start.elapsed().expect("failed to measure time");
+                    latencies.record(round_trip.as_nanos() as u64 / 2);
+                }
             }
         });
 
@@ -218,13 +244,16 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "[REQUESTS] {} ::: Iterations: {}, Time: {} s, Latency: {} ns",
-        core::any::type_name::<T>(),
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+    Report::new(&format!("[REQUESTS] {}", core::any::type_name::<T>()))
+        .parameter("Iterations", args.iterations)
+        .result_with_unit("Time", stop.as_secs_f64(), "s")
+        .result_with_unit(
+            "Latency",
+            stop.as_nanos() / (args.iterations as u128 * 2),
+            "ns",
+        )
+        .latency_histogram(&latencies)
+        .print(args.output_format);
 
     Ok(())
 }
@@ -250,6 +279,13 @@ struct Args {
     /// The number of additional clients per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_clients: usize,
+    /// Measure every round trip and report latency percentiles. Adds the cost of two clock
+    /// reads to every iteration.
+    #[clap(long)]
+    percentiles: bool,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -0,0 +1,238 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use core::time::Duration;
+
+use benchmark_common::report::{OutputFormat, Report};
+use clap::Parser;
+use iceoryx2::prelude::*;
+use iceoryx2_bb_log::set_log_level;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_system_types::ipv4_address::LOCALHOST;
+use iceoryx2_bb_system_types::port::Port;
+use iceoryx2_services_tunnel::tunnel::{Config as TunnelConfig, Tunnel};
+
+const THROUGHPUT_DURATION_IN_SECONDS: u64 = 5;
+const WAIT_FOR_PEER_INTERVAL: Duration = Duration::from_millis(10);
+
+/// Creates the configuration of one iceoryx2 domain. Both domains live on the same host but
+/// do not share any service, only the tunnel connects them.
+fn domain_config(prefix: &[u8]) -> Result<Config, Box<dyn core::error::Error>> {
+    let mut config = Config::default();
+    config.global.prefix = FileName::new(prefix)?;
+    Ok(config)
+}
+
+fn spin_tunnel(
+    args: &Args,
+    config: &Config,
+    local_port: u16,
+    peer_port: u16,
+    keep_running: &AtomicBool,
+) -> Result<(), Box<dyn core::error::Error + Send + Sync>> {
+    let tunnel_config = TunnelConfig {
+        bind_address: LOCALHOST,
+        bind_port: Port::new(local_port),
+        max_datagram_size: args.max_datagram_size,
+        discovery_interval: Duration::from_millis(100),
+        ..Default::default()
+    };
+
+    let mut tunnel = Tunnel::<ipc::Service>::create(&tunnel_config, config)?;
+    tunnel.connect(LOCALHOST, Port::new(peer_port));
+
+    while keep_running.load(Ordering::Relaxed) {
+        tunnel.spin()?;
+    }
+
+    Ok(())
+}
+
+fn perform_benchmark(args: &Args) -> Result<(), Box<dyn core::error::Error>> {
+    let config_a = domain_config(b"tunnel_benchmark_a_")?;
+    let config_b = domain_config(b"tunnel_benchmark_b_")?;
+    let service_name = ServiceName::new("tunnel_throughput")?;
+
+    let node_a = NodeBuilder::new()
+        .config(&config_a)
+        .create::<ipc::Service>()?;
+    let service_a = node_a
+        .service_builder(&service_name)
+        .publish_subscribe::<[u8]>()
+        .history_size(0)
+        .subscriber_max_buffer_size(args.buffer_size)
+        .enable_safe_overflow(true)
+        .create()?;
+    let publisher = service_a
+        .publisher_builder()
+        .initial_max_slice_len(args.payload_size)
+        .create()?;
+
+    let keep_tunnels_running = AtomicBool::new(true);
+    let keep_sending = AtomicBool::new(true);
+    let is_subscriber_ready = AtomicBool::new(false);
+    let received_samples = AtomicU64::new(0);
+    let mut sent_samples = 0u64;
+    let mut runtime = Duration::ZERO;
+
+    std::thread::scope(|s| -> Result<(), Box<dyn core::error::Error>> {
+        let tunnel_a = s.spawn(|| {
+            spin_tunnel(
+                args,
+                &config_a,
+                args.port,
+                args.port + 1,
+                &keep_tunnels_running,
+            )
+        });
+        let tunnel_b = s.spawn(|| {
+            spin_tunnel(
+                args,
+                &config_b,
+                args.port + 1,
+                args.port,
+                &keep_tunnels_running,
+            )
+        });
+
+        let subscriber = s.spawn(
+            || -> Result<(), Box<dyn core::error::Error + Send + Sync>> {
+                let node_b = NodeBuilder::new()
+                    .config(&config_b)
+                    .create::<ipc::Service>()?;
+
+                // the service appears in domain b as soon as the tunnel mirrored it
+                let service_b = loop {
+                    if let Ok(service) = node_b
+                        .service_builder(&service_name)
+                        .publish_subscribe::<[u8]>()
+                        .open()
+                    {
+                        break service;
+                    }
+                    std::thread::sleep(WAIT_FOR_PEER_INTERVAL);
+                };
+                let subscriber = service_b.subscriber_builder().create()?;
+                is_subscriber_ready.store(true, Ordering::Relaxed);
+
+                let mut counter = 0;
+                while keep_tunnels_running.load(Ordering::Relaxed) {
+                    while subscriber.receive()?.is_some() {
+                        counter += 1;
+                    }
+                }
+                received_samples.store(counter, Ordering::Relaxed);
+                Ok(())
+            },
+        );
+
+        while !is_subscriber_ready.load(Ordering::Relaxed) {
+            std::thread::sleep(WAIT_FOR_PEER_INTERVAL);
+        }
+        // the tunnel of domain a must have discovered the service before samples are sent
+        std::thread::sleep(Duration::from_millis(200));
+
+        let start = Time::now().expect("failed to acquire time");
+        let duration = Duration::from_secs(args.duration);
+        while keep_sending.load(Ordering::Relaxed) {
+            let sample = publisher.loan_slice_uninit(args.payload_size)?;
+            let sample = sample.write_from_fn(|n| n as u8);
+            sample.send()?;
+            sent_samples += 1;
+
+            if args.rate_limit > 0 {
+                std::thread::sleep(Duration::from_nanos(1_000_000_000 / args.rate_limit));
+            }
+            if sent_samples % 128 == 0
+                && start.elapsed().expect("failed to measure time") >= duration
+            {
+                keep_sending.store(false, Ordering::Relaxed);
+            }
+        }
+        runtime = start.elapsed().expect("failed to measure time");
+
+        // give the tunnels the chance to deliver the samples that are in flight
+        std::thread::sleep(Duration::from_millis(200));
+        keep_tunnels_running.store(false, Ordering::Relaxed);
+
+        for thread in [tunnel_a, tunnel_b, subscriber] {
+            thread
+                .join()
+                .expect("benchmark thread panicked")
+                .map_err(|e| e.to_string())?;
+        }
+
+        Ok(())
+    })?;
+
+    let received = received_samples.load(Ordering::Relaxed);
+    let runtime_in_seconds = runtime.as_secs_f64();
+    Report::new("UdpTunnel")
+        .parameter("Sample Size", args.payload_size)
+        .parameter("Max Datagram Size", args.max_datagram_size)
+        .parameter("Subscriber Buffer Size", args.buffer_size)
+        .result_with_unit("Time", runtime_in_seconds, "s")
+        .result("Sent Samples", sent_samples)
+        .result("Received Samples", received)
+        .result(
+            "Received Samples per Second",
+            received as f64 / runtime_in_seconds,
+        )
+        .result(
+            "Received MiB per Second",
+            (received * args.payload_size as u64) as f64 / runtime_in_seconds / (1024.0 * 1024.0),
+        )
+        .result(
+            "Loss Ratio",
+            1.0 - received as f64 / sent_samples.max(1) as f64,
+        )
+        .print(args.output_format);
+
+    Ok(())
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// The time in seconds the publisher sends samples through the tunnel.
+    #[clap(short, long, default_value_t = THROUGHPUT_DURATION_IN_SECONDS)]
+    duration: u64,
+    /// The size of the payload of every sample in bytes.
+    #[clap(short, long, default_value_t = 1024)]
+    payload_size: usize,
+    /// The maximum size of a datagram. Larger samples are fragmented, smaller ones are
+    /// coalesced.
+    #[clap(short, long, default_value_t = 1472)]
+    max_datagram_size: usize,
+    /// The buffer size of the subscribers in both domains.
+    #[clap(short, long, default_value_t = 256)]
+    buffer_size: usize,
+    /// The maximum number of samples per second, 0 sends as fast as possible.
+    #[clap(short, long, default_value_t = 0)]
+    rate_limit: u64,
+    /// The UDP port of the tunnel of the sending domain, the receiving tunnel uses the next
+    /// port.
+    #[clap(long, default_value_t = 7450)]
+    port: u16,
+    /// The format of the benchmark results.
+    #[clap(long, value_enum, default_value_t = OutputFormat::Text)]
+    output_format: OutputFormat,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+    set_log_level(iceoryx2_bb_log::LogLevel::Error);
+
+    perform_benchmark(&args)
+}
@@ -19,6 +19,11 @@
 //!    when the data allocator provides shared memory.
 //!  * [`FixedSizeBitSet`] - Bitset with a compile time fixed capacity.
 //!
+//! The bits are stored in machine words. A second level of summary words tracks which data
+//! words contain set bits, so [`BitSet::reset_all()`](details::BitSet::reset_all()) and
+//! [`BitSet::reset_next()`](details::BitSet::reset_next()) visit only the non-empty data words
+//! instead of scanning the whole capacity.
+//!
 //!  # Example
 //!
 //!  ```
@@ -45,7 +50,7 @@ use iceoryx2_bb_elementary::{
 use iceoryx2_bb_elementary_traits::{
     owning_pointer::OwningPointer, relocatable_container::RelocatableContainer,
 };
-use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU8, IoxAtomicUsize};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicUsize};
 
 use iceoryx2_bb_log::{fail, fatal_panic};
 
@@ -59,7 +64,7 @@ pub mod details {
 
     use super::*;
 
-    pub type BitsetElement = IoxAtomicU8;
+    pub type BitsetElement = IoxAtomicUsize;
     const BITSET_ELEMENT_BITSIZE: usize = core::mem::size_of::<BitsetElement>() * 8;
 
     struct Id {
@@ -76,12 +81,18 @@ pub mod details {
         }
     }
 
+    /// The memory consists of `array_capacity` data words followed by `summary_capacity`
+    /// summary words. Bit `n` of the summary is set whenever data word `n` may contain a set
+    /// bit. A bit is always set in the data word first and in the summary afterwards, and the
+    /// summary bit is always cleared first, therefore a set bit is never hidden from the
+    /// consumer.
     #[derive(Debug)]
     #[repr(C)]
     pub struct BitSet<PointerType: PointerTrait<BitsetElement>> {
         data_ptr: PointerType,
         capacity: usize,
         array_capacity: usize,
+        summary_capacity: usize,
         reset_position: IoxAtomicUsize,
         is_memory_initialized: IoxAtomicBool,
     }
@@ -98,9 +109,11 @@ pub mod details {
         /// ```
         pub fn new(capacity: usize) -> Self {
             let array_capacity = Self::array_capacity(capacity);
-            let mut data_ptr = OwningPointer::<BitsetElement>::new_with_alloc(array_capacity);
+            let summary_capacity = Self::summary_capacity(capacity);
+            let mut data_ptr =
+                OwningPointer::<BitsetElement>::new_with_alloc(array_capacity + summary_capacity);
 
-            for i in 0..array_capacity {
+            for i in 0..array_capacity + summary_capacity {
                 unsafe { data_ptr.as_mut_ptr().add(i).write(BitsetElement::new(0)) };
             }
 
@@ -108,6 +121,7 @@ pub mod details {
                 data_ptr,
                 capacity,
                 array_capacity,
+                summary_capacity,
                 is_memory_initialized: IoxAtomicBool::new(true),
                 reset_position: IoxAtomicUsize::new(0),
             }
@@ -120,6 +134,7 @@ pub mod details {
                 data_ptr: RelocatablePointer::new_uninit(),
                 capacity,
                 array_capacity: Self::array_capacity(capacity),
+                summary_capacity: Self::summary_capacity(capacity),
                 is_memory_initialized: IoxAtomicBool::new(false),
                 reset_position: IoxAtomicUsize::new(0),
             }
@@ -136,13 +151,13 @@ pub mod details {
 
             let memory = fail!(from self, when allocator
             .allocate(Layout::from_size_align_unchecked(
-                    core::mem::size_of::<BitsetElement>() * self.array_capacity,
+                    core::mem::size_of::<BitsetElement>() * (self.array_capacity + self.summary_capacity),
                     core::mem::align_of::<BitsetElement>())),
             "Failed to initialize since the allocation of the data memory failed.");
 
             self.data_ptr.init(memory);
 
-            for i in 0..self.array_capacity {
+            for i in 0..self.array_capacity + self.summary_capacity {
                 unsafe {
                     (self.data_ptr.as_ptr() as *mut BitsetElement)
                         .add(i)
@@ -168,9 +183,15 @@ pub mod details {
             capacity.div_ceil(BITSET_ELEMENT_BITSIZE)
         }
 
+        pub(super) const fn summary_capacity(capacity: usize) -> usize {
+            Self::array_capacity(capacity).div_ceil(BITSET_ELEMENT_BITSIZE)
+        }
+
         /// Returns the required memory size for a BitSet with a specified capacity.
         pub const fn const_memory_size(capacity: usize) -> usize {
-            unaligned_mem_size::<BitsetElement>(Self::array_capacity(capacity))
+            unaligned_mem_size::<BitsetElement>(
+                Self::array_capacity(capacity) + Self::summary_capacity(capacity),
+            )
         }
 
         /// Returns the capacity of the BitSet
@@ -187,43 +208,59 @@ pub mod details {
             );
         }
 
+        #[inline(always)]
+        fn data(&self, index: usize) -> &BitsetElement {
+            unsafe { &(*self.data_ptr.as_ptr().add(index)) }
+        }
+
+        #[inline(always)]
+        fn summary(&self, index: usize) -> &BitsetElement {
+            unsafe { &(*self.data_ptr.as_ptr().add(self.array_capacity + index)) }
+        }
+
         fn set_bit(&self, id: Id) -> bool {
-            let data_ref = unsafe { &(*self.data_ptr.as_ptr().add(id.index)) };
-            let mut current = data_ref.load(Ordering::Relaxed);
             let mask = 1 << id.bit;
+            if self.data(id.index).fetch_or(mask, Ordering::Relaxed) & mask != 0 {
+                return false;
+            }
 
-            loop {
-                if current & mask != 0 {
-                    return false;
-                }
-
-                let current_with_bit = current | mask;
+            let summary_id = Id::new(id.index);
+            self.summary(summary_id.index)
+                .fetch_or(1 << summary_id.bit, Ordering::Release);
+            true
+        }
 
-                match data_ref.compare_exchange(
-                    current,
-                    current_with_bit,
-                    Ordering::Relaxed,
-                    Ordering::Relaxed,
-                ) {
-                    Ok(_) => {
-                        return true;
-                    }
-                    Err(v) => current = v,
-                }
+        /// Clears the summary bit of an empty data word. When a bit was set concurrently in the
+        /// meantime, the summary bit is restored.
+        fn clear_summary_bit(&self, data_index: usize) {
+            let summary_id = Id::new(data_index);
+            let mask = 1 << summary_id.bit;
+            self.summary(summary_id.index)
+                .fetch_and(!mask, Ordering::AcqRel);
+
+            if self.data(data_index).load(Ordering::Acquire) != 0 {
+                self.summary(summary_id.index)
+                    .fetch_or(mask, Ordering::Release);
             }
         }
 
-        fn clear_bit(&self, id: Id) -> bool {
-            let data_ref = unsafe { &(*self.data_ptr.as_ptr().add(id.index)) };
+        /// Clears the lowest set bit of a data word that is part of the provided mask and
+        /// returns its position in the word.
+        fn clear_lowest_bit(&self, data_index: usize, mask: usize) -> Option<usize> {
+            let data_ref = self.data(data_index);
             let mut current = data_ref.load(Ordering::Relaxed);
-            let mask = 1 << id.bit;
 
             loop {
-                if current & mask == 0 {
-                    return false;
+                let candidates = current & mask;
+                if candidates == 0 {
+                    if current == 0 {
+                        self.clear_summary_bit(data_index);
+                    }
+                    return None;
                 }
 
-                let current_with_cleared_bit = current & !mask;
+                let bit = candidates.trailing_zeros() as usize;
+                let current_with_cleared_bit = current & !(1 << bit);
 
                 match data_ref.compare_exchange(
                     current,
@@ -232,7 +269,10 @@ pub mod details {
                     Ordering::Relaxed,
                 ) {
                     Ok(_) => {
-                        return true;
+                        if current_with_cleared_bit == 0 {
+                            self.clear_summary_bit(data_index);
+                        }
+                        return Some(bit);
                     }
                     Err(v) => current = v,
                 }
@@ -254,15 +294,47 @@ pub mod details {
         }
 
         /// Resets the next set bit and returns the bit index. If no bit was set it returns
-        /// [`None`].
+        /// [`None`]. The search starts after the previously reset bit so that all set bits are
+        /// served in a round-robin fashion.
         pub fn reset_next(&self) -> Option<usize> {
             self.verify_init("reset_next()");
 
-            let current_position = self.reset_position.load(Ordering::Relaxed);
-            for pos in (current_position..self.capacity).chain(0..current_position) {
-                if self.clear_bit(Id::new(pos)) {
-                    self.reset_position.store(pos + 1, Ordering::Relaxed);
-                    return Some(pos);
+            if self.capacity == 0 {
+                return None;
+            }
+
+            let start = Id::new(self.reset_position.load(Ordering::Relaxed) % self.capacity);
+            let start_word = Id::new(start.index);
+            let bits_from_start = usize::MAX << start.bit;
+            let words_after_start = (usize::MAX << start_word.bit) & !(1 << start_word.bit);
+
+            // the start summary word is visited twice, first for the bits at and after the
+            // start position and at the end for the bits before it
+            for n in 0..=self.summary_capacity {
+                let summary_index = (start_word.index + n) % self.summary_capacity;
+                let mut summary = self.summary(summary_index).load(Ordering::Acquire);
+                if n == 0 {
+                    summary &= usize::MAX << start_word.bit;
+                } else if n == self.summary_capacity {
+                    summary &= !words_after_start;
+                }
+
+                while summary != 0 {
+                    let data_index =
+                        summary_index * BITSET_ELEMENT_BITSIZE + summary.trailing_zeros() as usize;
+                    summary &= summary - 1;
+
+                    let mask = match (data_index == start.index, n == 0) {
+                        (true, true) => bits_from_start,
+                        (true, false) => !bits_from_start,
+                        (false, _) => usize::MAX,
+                    };
+
+                    if let Some(bit) = self.clear_lowest_bit(data_index, mask) {
+                        let pos = data_index * BITSET_ELEMENT_BITSIZE + bit;
+                        self.reset_position.store(pos + 1, Ordering::Relaxed);
+                        return Some(pos);
+                    }
                 }
             }
 
@@ -270,16 +342,22 @@ pub mod details {
         }
 
         /// Reset every set bit in the BitSet and call the provided callback for every bit that
-        /// was set. This is the most efficient way to acquire all bits that were set.
+        /// was set. This is the most efficient way to acquire all bits that were set. Its
+        /// runtime depends on the number of set bits and not on the capacity.
         pub fn reset_all<F: FnMut(usize)>(&self, mut callback: F) {
             self.verify_init("reset_all()");
 
-            for i in 0..self.array_capacity {
-                let value = unsafe { (*self.data_ptr.as_ptr().add(i)).swap(0, Ordering::Relaxed) };
-                let main_index = i * BITSET_ELEMENT_BITSIZE;
-                for b in 0..BITSET_ELEMENT_BITSIZE {
-                    if value & (1 << b) != 0 {
-                        callback(main_index + b);
+            for s in 0..self.summary_capacity {
+                let mut summary = self.summary(s).swap(0, Ordering::Acquire);
+                while summary != 0 {
+                    let i = s * BITSET_ELEMENT_BITSIZE + summary.trailing_zeros() as usize;
+                    summary &= summary - 1;
+
+                    let mut value = self.data(i).swap(0, Ordering::Relaxed);
+                    let main_index = i * BITSET_ELEMENT_BITSIZE;
+                    while value != 0 {
+                        callback(main_index + value.trailing_zeros() as usize);
+                        value &= value - 1;
                     }
                 }
             }
@@ -297,6 +375,8 @@ pub struct FixedSizeBitSet<const CAPACITY: usize> {
     //       data: [`details::BitsetElement; Self::array_capacity(CAPACITY)`]
     //       For now we can live with it, since the bitsets are usually rather small
     data: [details::BitsetElement; CAPACITY],
+    // the data and summary words require together at most CAPACITY + 1 elements
+    summary: details::BitsetElement,
 }
 
 unsafe impl<const CAPACITY: usize> Send for FixedSizeBitSet<CAPACITY> {}
@@ -307,6 +387,7 @@ impl<const CAPACITY: usize> Default for FixedSizeBitSet<CAPACITY> {
         let mut new_self = Self {
             bitset: unsafe { RelocatableBitSet::new_uninit(CAPACITY) },
             data: core::array::from_fn(|_| details::BitsetElement::new(0)),
+            summary: details::BitsetElement::new(0),
         };
 
         let allocator = BumpAllocator::new(core::ptr::addr_of!(new_self.data) as usize);
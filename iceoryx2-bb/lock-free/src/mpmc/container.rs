@@ -212,6 +212,12 @@ impl<T: Copy + Debug> RelocatableContainer for Container<T> {
         fail!(from self, when self.index_set.init(allocator),
             "{} since the underlying UniqueIndexSet could not be initialized", msg);
 
+        // a container without capacity never accesses the active index and data memory
+        if self.capacity == 0 {
+            self.is_initialized.store(true, Ordering::Relaxed);
+            return Ok(());
+        }
+
         self.active_index_ptr.init(fail!(from self, when allocator.allocate(Layout::from_size_align_unchecked(
                         core::mem::size_of::<IoxAtomicU64>() * self.capacity,
                         core::mem::align_of::<IoxAtomicU64>())), "{} since the allocation of the active index memory failed.",
@@ -341,6 +347,55 @@ impl<T: Copy + Debug> Container<T> {
         release_state
     }
 
+    /// Removes the element of the `handle` only when it is still the element that was observed
+    /// in `state`. When multiple parties, for instance multiple processes, try to remove the same
+    /// element of a dead owner, exactly one of them succeeds. Returns [`None`] when the element
+    /// was already removed or replaced, otherwise the [`ReleaseState`].
+    ///
+    /// # Safety
+    ///
+    ///  * Ensure that [`Container::init()`] was called before calling this method
+    ///  * Ensure that the `handle` was acquired from the `state` and that the `state` was
+    ///    acquired by the same [`Container`] with [`Container::get_state()`]
+    ///  * Ensure that the element is never removed with [`Container::remove()`] concurrently
+    ///
+    pub unsafe fn remove_if_unchanged(
+        &self,
+        handle: ContainerHandle,
+        state: &ContainerState<T>,
+        mode: ReleaseMode,
+    ) -> Option<ReleaseState> {
+        self.verify_init("remove_if_unchanged()");
+        debug_assert!(
+            handle.container_id == self.container_id.value()
+                && state.container_id == self.container_id.value(),
+            "The ContainerHandle or the ContainerState was not created by this Container instance."
+        );
+
+        let observed_index_count = state.active_index[handle.index as usize];
+        if observed_index_count % 2 == 0 {
+            return None;
+        }
+
+        if unsafe { &*self.active_index_ptr.as_ptr().add(handle.index as _) }
+            .compare_exchange(
+                observed_index_count,
+                observed_index_count + 1,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            )
+            .is_err()
+        {
+            return None;
+        }
+
+        let release_state = self.index_set.release_raw_index(handle.index, mode);
+
+        // MUST HAPPEN AFTER all other operations
+        self.change_counter.fetch_add(1, Ordering::Release);
+        Some(release_state)
+    }
+
     /// Returns [`ContainerState`] which contains all elements of this container. Be aware that
     /// this state can be out of date as soon as it is returned from this function.
     ///
@@ -525,6 +580,24 @@ impl<T: Copy + Debug, const CAPACITY: usize> FixedSizeContainer<T, CAPACITY> {
         self.container.remove(handle, mode)
     }
 
+    /// Removes the element of the `handle` only when it is still the element that was observed
+    /// in `state`, see [`Container::remove_if_unchanged()`].
+    ///
+    /// # Safety
+    ///
+    ///  * Ensure that the `handle` was acquired from the `state` and that the `state` was
+    ///    acquired by the same [`FixedSizeContainer`]
+    ///  * Ensure that the element is never removed with [`FixedSizeContainer::remove()`]
+    ///    concurrently
+    pub unsafe fn remove_if_unchanged(
+        &self,
+        handle: ContainerHandle,
+        state: &ContainerState<T>,
+        mode: ReleaseMode,
+    ) -> Option<ReleaseState> {
+        self.container.remove_if_unchanged(handle, state, mode)
+    }
+
     /// Returns [`ContainerState`] which contains all elements of this container. Be aware that
     /// this state can be out of date as soon as it is returned from this function.
     pub fn get_state(&self) -> ContainerState<T> {
@@ -0,0 +1,525 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A **threadsafe** **lock-free** single producer multi consumer ring which broadcasts every
+//! [`u64`] value to all consumers. The producer never waits for a consumer, it always
+//! overwrites the oldest element. Every consumer reads with its own cursor and detects
+//! elements it missed by the gap in the sequence numbers.
+//!
+//! Every element is stored together with a key in the range `[0, number_of_keys)`. A consumer
+//! registers itself with [`BroadcastRing::register_reader()`], pins the key of the element it
+//! reads with [`BroadcastRing::pin()`] and releases it with [`BroadcastRing::unpin()`]. When the
+//! producer overwrites an element it can check with [`BroadcastRing::is_pinned()`] whether a
+//! consumer still uses the resource the key refers to.
+//!
+//! The pins are recorded per reader. When a consumer dies while it has pinned elements,
+//! [`BroadcastRing::remove_reader()`] releases all of its pins.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_lock_free::spmc::broadcast_ring::*;
+//!
+//! const CAPACITY: usize = 4;
+//! const NUMBER_OF_KEYS: usize = 8;
+//! const NUMBER_OF_READERS: usize = 2;
+//! let ring = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+//!
+//! // only one thread is allowed to push at a time
+//! unsafe { ring.push(1234, 3) };
+//!
+//! let reader = ring.register_reader(42).unwrap();
+//! let mut cursor = ring.oldest_sequence_number();
+//! match ring.pin(reader, cursor) {
+//!     Ok(Some(element)) => {
+//!         println!("received {}", element.value);
+//!         ring.unpin(reader, element.key);
+//!         cursor += 1;
+//!     }
+//!     Ok(None) => println!("no new element"),
+//!     Err(BroadcastRingPinError::Lapped(oldest)) => {
+//!         println!("missed {} elements", oldest - cursor);
+//!         cursor = oldest;
+//!     }
+//! }
+//!
+//! ring.unregister_reader(reader);
+//! ```
+
+use core::{alloc::Layout, fmt::Debug, sync::atomic::Ordering};
+
+use iceoryx2_bb_elementary::relocatable_ptr::RelocatablePointer;
+use iceoryx2_bb_elementary_traits::{
+    allocator::{AllocationError, BaseAllocator},
+    owning_pointer::OwningPointer,
+    pointer_trait::PointerTrait,
+};
+use iceoryx2_bb_log::{fail, fatal_panic};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU64};
+
+/// An element of the [`BroadcastRing`] that was pinned with [`BroadcastRing::pin()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct PinnedElement {
+    /// The value that was pushed with [`BroadcastRing::push()`]
+    pub value: u64,
+    /// The key that must be provided to [`BroadcastRing::unpin()`]
+    pub key: u64,
+}
+
+/// Identifies a reader that was registered with [`BroadcastRing::register_reader()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ReaderHandle {
+    index: usize,
+}
+
+/// The failure that can occur in [`BroadcastRing::pin()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum BroadcastRingPinError {
+    /// The element was already overwritten by the producer. Contains the sequence number of
+    /// the oldest element that is still stored in the ring.
+    Lapped(u64),
+}
+
+pub type BroadcastRing = details::BroadcastRing<OwningPointer<IoxAtomicU64>>;
+pub type RelocatableBroadcastRing = details::BroadcastRing<RelocatablePointer<IoxAtomicU64>>;
+
+pub mod details {
+    use iceoryx2_bb_elementary::math::unaligned_mem_size;
+
+    use super::*;
+
+    // every slot consists of the sequence, the value and the key
+    const SLOT_SIZE: usize = 3;
+    const SEQUENCE: usize = 0;
+    const VALUE: usize = 1;
+    const KEY: usize = 2;
+
+    // every reader entry consists of the state and the upper and lower half of the reader id
+    const READER_SIZE: usize = 3;
+    const READER_STATE: usize = 0;
+    const READER_ID_HIGH: usize = 1;
+    const READER_ID_LOW: usize = 2;
+
+    const READER_FREE: u64 = 0;
+    const READER_CLAIMED: u64 = 1;
+    const READER_ACTIVE: u64 = 2;
+
+    const READERS_PER_PIN_WORD: usize = u64::BITS as usize;
+
+    /// The ring with a capacity, number of keys and number of readers that can be set up at
+    /// runtime, when the ring is created.
+    #[repr(C)]
+    #[derive(Debug)]
+    pub struct BroadcastRing<PointerType: PointerTrait<IoxAtomicU64>> {
+        data_ptr: PointerType,
+        capacity: usize,
+        number_of_keys: usize,
+        number_of_readers: usize,
+        write_position: IoxAtomicU64,
+        is_memory_initialized: IoxAtomicBool,
+    }
+
+    unsafe impl<PointerType: PointerTrait<IoxAtomicU64>> Sync for BroadcastRing<PointerType> {}
+    unsafe impl<PointerType: PointerTrait<IoxAtomicU64>> Send for BroadcastRing<PointerType> {}
+
+    impl BroadcastRing<OwningPointer<IoxAtomicU64>> {
+        /// Creates a new [`BroadcastRing`] that stores up to `capacity` elements with keys in
+        /// the range `[0, number_of_keys)` and can be read by up to `number_of_readers`
+        /// consumers.
+        pub fn new(capacity: usize, number_of_keys: usize, number_of_readers: usize) -> Self {
+            let len = Self::number_of_atomics(capacity, number_of_keys, number_of_readers);
+            let mut data_ptr = OwningPointer::<IoxAtomicU64>::new_with_alloc(len);
+
+            for i in 0..len {
+                unsafe { data_ptr.as_mut_ptr().add(i).write(IoxAtomicU64::new(0)) };
+            }
+
+            Self {
+                data_ptr,
+                capacity,
+                number_of_keys,
+                number_of_readers,
+                write_position: IoxAtomicU64::new(0),
+                is_memory_initialized: IoxAtomicBool::new(true),
+            }
+        }
+    }
+
+    impl BroadcastRing<RelocatablePointer<IoxAtomicU64>> {
+        /// Creates a new uninitialized [`RelocatableBroadcastRing`]. Before it can be used
+        /// [`RelocatableBroadcastRing::init()`] must be called.
+        ///
+        /// # Safety
+        ///
+        ///  * The ring must be initialized with [`RelocatableBroadcastRing::init()`] before it
+        ///    is used.
+        ///  * The ring must not be moved after it was initialized.
+        pub unsafe fn new_uninit(
+            capacity: usize,
+            number_of_keys: usize,
+            number_of_readers: usize,
+        ) -> Self {
+            Self {
+                data_ptr: RelocatablePointer::new_uninit(),
+                capacity,
+                number_of_keys,
+                number_of_readers,
+                write_position: IoxAtomicU64::new(0),
+                is_memory_initialized: IoxAtomicBool::new(false),
+            }
+        }
+
+        /// Acquires the memory of the slots, readers and pins from the allocator.
+        ///
+        /// # Safety
+        ///
+        ///  * Must be called exactly once before the ring is used.
+        ///  * The allocator must provide at least
+        ///    [`RelocatableBroadcastRing::const_memory_size()`] bytes.
+        pub unsafe fn init<T: BaseAllocator>(
+            &mut self,
+            allocator: &T,
+        ) -> Result<(), AllocationError> {
+            if self.is_memory_initialized.load(Ordering::Relaxed) {
+                fatal_panic!(from self, "Memory already initialized. Initializing it twice may lead to undefined behavior.");
+            }
+
+            let len =
+                Self::number_of_atomics(self.capacity, self.number_of_keys, self.number_of_readers);
+            self.data_ptr.init(fail!(from self, when allocator
+                .allocate(Layout::from_size_align_unchecked(
+                    core::mem::size_of::<IoxAtomicU64>() * len,
+                    core::mem::align_of::<IoxAtomicU64>())),
+                "Failed to initialize since the allocation of the data memory failed."));
+
+            for i in 0..len {
+                (self.data_ptr.as_ptr() as *mut IoxAtomicU64)
+                    .add(i)
+                    .write(IoxAtomicU64::new(0));
+            }
+
+            self.is_memory_initialized.store(true, Ordering::Relaxed);
+            Ok(())
+        }
+    }
+
+    impl<PointerType: PointerTrait<IoxAtomicU64> + Debug> BroadcastRing<PointerType> {
+        #[inline(always)]
+        fn verify_init(&self, source: &str) {
+            debug_assert!(
+                self.is_memory_initialized.load(Ordering::Relaxed),
+                "Undefined behavior when calling BroadcastRing::{} and the object is not initialized.",
+                source
+            );
+        }
+
+        const fn pin_words_per_key(number_of_readers: usize) -> usize {
+            number_of_readers.div_ceil(READERS_PER_PIN_WORD)
+        }
+
+        const fn number_of_atomics(
+            capacity: usize,
+            number_of_keys: usize,
+            number_of_readers: usize,
+        ) -> usize {
+            capacity * SLOT_SIZE
+                + number_of_readers * READER_SIZE
+                + number_of_keys * Self::pin_words_per_key(number_of_readers)
+        }
+
+        /// Returns the amount of memory required to create a [`BroadcastRing`] with the
+        /// provided capacity, number of keys and number of readers.
+        pub const fn const_memory_size(
+            capacity: usize,
+            number_of_keys: usize,
+            number_of_readers: usize,
+        ) -> usize {
+            unaligned_mem_size::<IoxAtomicU64>(Self::number_of_atomics(
+                capacity,
+                number_of_keys,
+                number_of_readers,
+            ))
+        }
+
+        fn slot(&self, sequence_number: u64, field: usize) -> &IoxAtomicU64 {
+            let index = (sequence_number % self.capacity as u64) as usize * SLOT_SIZE + field;
+            unsafe { &*self.data_ptr.as_ptr().add(index) }
+        }
+
+        fn reader(&self, index: usize, field: usize) -> &IoxAtomicU64 {
+            debug_assert!(index < self.number_of_readers);
+            unsafe {
+                &*self
+                    .data_ptr
+                    .as_ptr()
+                    .add(self.capacity * SLOT_SIZE + index * READER_SIZE + field)
+            }
+        }
+
+        // Every key has one bit per reader, the word that contains the bit of the reader is
+        // returned together with the bit.
+        fn pin_word(&self, key: u64, reader: ReaderHandle) -> (&IoxAtomicU64, u64) {
+            let bit = 1 << (reader.index % READERS_PER_PIN_WORD);
+            (
+                self.pin_word_at(key, reader.index / READERS_PER_PIN_WORD),
+                bit,
+            )
+        }
+
+        fn pin_word_at(&self, key: u64, word: usize) -> &IoxAtomicU64 {
+            debug_assert!(key < self.number_of_keys as u64);
+            let words_per_key = Self::pin_words_per_key(self.number_of_readers);
+            unsafe {
+                &*self.data_ptr.as_ptr().add(
+                    self.capacity * SLOT_SIZE
+                        + self.number_of_readers * READER_SIZE
+                        + key as usize * words_per_key
+                        + word,
+                )
+            }
+        }
+
+        // A slot that holds the element with the sequence number `n` stores `2 * (n + 1)`, while
+        // it is written it stores the odd value `2 * (n + 1) - 1`.
+        const fn stored_sequence(sequence_number: u64) -> u64 {
+            2 * (sequence_number + 1)
+        }
+
+        /// Adds a new element to the ring. When the ring is full the oldest element is
+        /// overwritten and returned. The producer must check with
+        /// [`BroadcastRing::is_pinned()`] if the key of the returned element is still used by a
+        /// consumer. The check is only reliable after this call.
+        ///
+        /// # Safety
+        ///
+        ///   * Ensure that no concurrent push occurs. Only one thread at a time is allowed to call
+        ///     push.
+        ///   * `key` must be in the range `[0, number_of_keys)`.
+        pub unsafe fn push(&self, value: u64, key: u64) -> Option<PinnedElement> {
+            self.verify_init("push()");
+            debug_assert!(key < self.number_of_keys as u64);
+
+            let write_position = self.write_position.load(Ordering::Relaxed);
+            let sequence = self.slot(write_position, SEQUENCE);
+            let has_old_element = sequence.load(Ordering::Relaxed) != 0;
+
+            ////////////////
+            // SYNC POINT
+            ////////////////
+            // marks the slot as being written before the caller checks the pin counter of the
+            // overwritten element, pairs with the pin in `pin()`
+            sequence.store(Self::stored_sequence(write_position) - 1, Ordering::SeqCst);
+
+            let old_element = PinnedElement {
+                value: self.slot(write_position, VALUE).load(Ordering::Relaxed),
+                key: self.slot(write_position, KEY).load(Ordering::Relaxed),
+            };
+
+            self.slot(write_position, VALUE)
+                .store(value, Ordering::Relaxed);
+            self.slot(write_position, KEY).store(key, Ordering::Relaxed);
+
+            ////////////////
+            // SYNC POINT
+            ////////////////
+            sequence.store(Self::stored_sequence(write_position), Ordering::Release);
+            self.write_position
+                .store(write_position + 1, Ordering::Release);
+
+            match has_old_element {
+                true => Some(old_element),
+                false => None,
+            }
+        }
+
+        /// Registers a new reader with the provided id. The id is used by
+        /// [`BroadcastRing::remove_reader()`] to release the pins of a reader that no longer
+        /// exists. Returns [`None`] when already `number_of_readers` readers are registered.
+        pub fn register_reader(&self, reader_id: u128) -> Option<ReaderHandle> {
+            self.verify_init("register_reader()");
+
+            for index in 0..self.number_of_readers {
+                if self
+                    .reader(index, READER_STATE)
+                    .compare_exchange(
+                        READER_FREE,
+                        READER_CLAIMED,
+                        Ordering::Acquire,
+                        Ordering::Relaxed,
+                    )
+                    .is_ok()
+                {
+                    self.reader(index, READER_ID_HIGH)
+                        .store((reader_id >> 64) as u64, Ordering::Relaxed);
+                    self.reader(index, READER_ID_LOW)
+                        .store(reader_id as u64, Ordering::Relaxed);
+                    self.reader(index, READER_STATE)
+                        .store(READER_ACTIVE, Ordering::Release);
+                    return Some(ReaderHandle { index });
+                }
+            }
+
+            None
+        }
+
+        /// Releases all pins of the reader and removes it from the ring. The handle must not
+        /// be used afterwards.
+        pub fn unregister_reader(&self, reader: ReaderHandle) {
+            self.verify_init("unregister_reader()");
+
+            for key in 0..self.number_of_keys as u64 {
+                let (pin_word, bit) = self.pin_word(key, reader);
+                pin_word.fetch_and(!bit, Ordering::Release);
+            }
+
+            self.reader(reader.index, READER_ID_HIGH)
+                .store(0, Ordering::Relaxed);
+            self.reader(reader.index, READER_ID_LOW)
+                .store(0, Ordering::Relaxed);
+            self.reader(reader.index, READER_STATE)
+                .store(READER_FREE, Ordering::Release);
+        }
+
+        /// Releases all pins of every reader that was registered with the provided id and
+        /// removes them from the ring. Returns the number of removed readers.
+        ///
+        /// # Safety
+        ///
+        ///   * The readers with the provided id must no longer access the ring, for instance
+        ///     since the process that owned them died.
+        pub unsafe fn remove_reader(&self, reader_id: u128) -> usize {
+            self.verify_init("remove_reader()");
+
+            let mut number_of_removed_readers = 0;
+            for index in 0..self.number_of_readers {
+                if self.reader(index, READER_STATE).load(Ordering::Acquire) != READER_ACTIVE {
+                    continue;
+                }
+
+                let id = ((self.reader(index, READER_ID_HIGH).load(Ordering::Relaxed) as u128)
+                    << 64)
+                    | self.reader(index, READER_ID_LOW).load(Ordering::Relaxed) as u128;
+                if id == reader_id {
+                    self.unregister_reader(ReaderHandle { index });
+                    number_of_removed_readers += 1;
+                }
+            }
+
+            number_of_removed_readers
+        }
+
+        /// Pins the element with the provided sequence number for the provided reader.
+        /// Returns [`None`] when the element was not yet pushed. When it was already
+        /// overwritten [`BroadcastRingPinError::Lapped`] is returned with the sequence number of
+        /// the oldest element that is still available. Every pinned element must be released
+        /// with [`BroadcastRing::unpin()`]. A reader can pin every key only once at a time.
+        pub fn pin(
+            &self,
+            reader: ReaderHandle,
+            sequence_number: u64,
+        ) -> Result<Option<PinnedElement>, BroadcastRingPinError> {
+            self.verify_init("pin()");
+
+            let write_position = self.write_position.load(Ordering::Acquire);
+            if write_position <= sequence_number {
+                return Ok(None);
+            }
+
+            let lapped = || {
+                Err(BroadcastRingPinError::Lapped(
+                    self.oldest_sequence_number().max(sequence_number + 1),
+                ))
+            };
+
+            if write_position - sequence_number > self.capacity as u64 {
+                return lapped();
+            }
+
+            let sequence = self.slot(sequence_number, SEQUENCE);
+            let expected_sequence = Self::stored_sequence(sequence_number);
+            ////////////////
+            // SYNC POINT
+            ////////////////
+            if sequence.load(Ordering::Acquire) != expected_sequence {
+                return lapped();
+            }
+
+            let element = PinnedElement {
+                value: self.slot(sequence_number, VALUE).load(Ordering::Relaxed),
+                key: self.slot(sequence_number, KEY).load(Ordering::Relaxed),
+            };
+
+            if element.key >= self.number_of_keys as u64 {
+                return lapped();
+            }
+
+            ////////////////
+            // SYNC POINT
+            ////////////////
+            // pairs with the SeqCst store in `push()`, either the producer sees the pin or
+            // the consumer sees the overwritten sequence
+            let (pin_word, bit) = self.pin_word(element.key, reader);
+            let previous_pins = pin_word.fetch_or(bit, Ordering::SeqCst);
+            debug_assert!(
+                previous_pins & bit == 0,
+                "The reader pinned the key {} twice.",
+                element.key
+            );
+            if sequence.load(Ordering::SeqCst) != expected_sequence {
+                pin_word.fetch_and(!bit, Ordering::Release);
+                return lapped();
+            }
+
+            Ok(Some(element))
+        }
+
+        /// Releases an element that was acquired by the reader with [`BroadcastRing::pin()`].
+        pub fn unpin(&self, reader: ReaderHandle, key: u64) {
+            self.verify_init("unpin()");
+            let (pin_word, bit) = self.pin_word(key, reader);
+            pin_word.fetch_and(!bit, Ordering::Release);
+        }
+
+        /// Returns true when at least one consumer has pinned an element with the provided key.
+        pub fn is_pinned(&self, key: u64) -> bool {
+            self.verify_init("is_pinned()");
+            (0..Self::pin_words_per_key(self.number_of_readers))
+                .any(|word| self.pin_word_at(key, word).load(Ordering::SeqCst) != 0)
+        }
+
+        /// Returns the sequence number the next pushed element will have.
+        pub fn next_sequence_number(&self) -> u64 {
+            self.write_position.load(Ordering::Acquire)
+        }
+
+        /// Returns the sequence number of the oldest element that is stored in the ring.
+        pub fn oldest_sequence_number(&self) -> u64 {
+            self.next_sequence_number()
+                .saturating_sub(self.capacity as u64)
+        }
+
+        /// Returns the capacity of the [`BroadcastRing`].
+        pub const fn capacity(&self) -> usize {
+            self.capacity
+        }
+
+        /// Returns the number of keys of the [`BroadcastRing`].
+        pub const fn number_of_keys(&self) -> usize {
+            self.number_of_keys
+        }
+
+        /// Returns the maximum number of readers of the [`BroadcastRing`].
+        pub const fn number_of_readers(&self) -> usize {
+            self.number_of_readers
+        }
+    }
+}
@@ -144,6 +144,30 @@ fn bit_set_reset_next_is_fair() {
     assert_that!(sut.reset_next(), eq None);
 }
 
+#[test]
+fn bit_set_sparse_bits_in_large_bit_set_are_acquired_in_order() {
+    const CAPACITY: usize = 262144;
+    const BITS: [usize; 5] = [3, 4095, 4096, 131071, CAPACITY - 1];
+    let sut = BitSet::new(CAPACITY);
+
+    for bit in BITS {
+        assert_that!(sut.set(bit), eq true);
+    }
+
+    let mut ids = vec![];
+    sut.reset_all(|id| ids.push(id));
+    assert_that!(ids, eq BITS.to_vec());
+    assert_that!(sut.reset_next(), eq None);
+
+    for bit in BITS {
+        assert_that!(sut.set(bit), eq true);
+    }
+    for bit in BITS {
+        assert_that!(sut.reset_next(), eq Some(bit));
+    }
+    assert_that!(sut.reset_next(), eq None);
+}
+
 #[test]
 fn bit_set_concurrent_set_and_reset_works() {
     let _watchdog = Watchdog::new_with_timeout(Duration::from_secs(60));
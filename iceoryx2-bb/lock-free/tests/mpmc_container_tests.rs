@@ -164,6 +164,31 @@ mod mpmc_container {
         }
     }
 
+    #[test]
+    fn mpmc_container_with_zero_capacity_is_always_full<
+        T: Debug + Copy + From<usize> + Into<usize>,
+    >() {
+        let mut memory = [0u8; Container::<crate::TestType>::const_memory_size(0)];
+        let allocator = BumpAllocator::new(memory.as_mut_ptr() as usize);
+        let mut sut = unsafe { Container::<T>::new_uninit(0) };
+        unsafe { assert_that!(sut.init(&allocator), is_ok) };
+
+        assert_that!(sut.capacity(), eq 0);
+        assert_that!(sut.is_empty(), eq true);
+
+        let index = unsafe { sut.add(0.into()) };
+        assert_that!(index, is_err);
+        assert_that!(index.err().unwrap(), eq ContainerAddFailure::OutOfSpace);
+
+        let mut counter = 0;
+        let state = unsafe { sut.get_state() };
+        state.for_each(|_, _| {
+            counter += 1;
+            CallbackProgression::Continue
+        });
+        assert_that!(counter, eq 0);
+    }
+
     #[test]
     fn mpmc_container_add_and_unsafe_remove_with_handle_works<
         T: Debug + Copy + From<usize> + Into<usize>,
@@ -200,6 +225,33 @@ mod mpmc_container {
         }
     }
 
+    #[test]
+    fn mpmc_container_remove_if_unchanged_removes_element_only_once<
+        T: Debug + Copy + From<usize> + Into<usize>,
+    >() {
+        let sut = FixedSizeContainer::<T, CAPACITY>::new();
+        let handle = unsafe { sut.add(7.into()) }.unwrap();
+        let state = sut.get_state();
+
+        let result = unsafe { sut.remove_if_unchanged(handle, &state, ReleaseMode::Default) };
+        assert_that!(result, eq Some(ReleaseState::Unlocked));
+        let result = unsafe { sut.remove_if_unchanged(handle, &state, ReleaseMode::Default) };
+        assert_that!(result, eq None);
+
+        // an outdated state must not remove a newly added element
+        let new_handle = unsafe { sut.add(9.into()) }.unwrap();
+        let result = unsafe { sut.remove_if_unchanged(new_handle, &state, ReleaseMode::Default) };
+        assert_that!(result, eq None);
+
+        let mut counter = 0;
+        sut.get_state().for_each(|_, value: &T| {
+            assert_that!((*value).into(), eq 9);
+            counter += 1;
+            CallbackProgression::Continue
+        });
+        assert_that!(counter, eq 1);
+    }
+
     #[test]
     fn mpmc_container_state_of_empty_container_is_empty<
         T: Debug + Copy + From<usize> + Into<usize>,
@@ -0,0 +1,225 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_lock_free::spmc::broadcast_ring::*;
+use iceoryx2_bb_posix::barrier::*;
+use iceoryx2_bb_testing::assert_that;
+use std::thread;
+
+const CAPACITY: usize = 16;
+const NUMBER_OF_KEYS: usize = 64;
+const NUMBER_OF_READERS: usize = 70;
+
+#[test]
+fn spmc_broadcast_ring_is_empty_after_creation() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    assert_that!(sut.capacity(), eq CAPACITY);
+    assert_that!(sut.number_of_keys(), eq NUMBER_OF_KEYS);
+    assert_that!(sut.number_of_readers(), eq NUMBER_OF_READERS);
+    assert_that!(sut.next_sequence_number(), eq 0);
+    assert_that!(sut.oldest_sequence_number(), eq 0);
+
+    let reader = sut.register_reader(0).unwrap();
+    assert_that!(sut.pin(reader, 0), eq Ok(None));
+}
+
+#[test]
+fn spmc_broadcast_ring_every_consumer_receives_every_element() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    for i in 0..CAPACITY as u64 {
+        assert_that!(unsafe { sut.push(i * 10, i) }, eq None);
+    }
+
+    for consumer in 0..3 {
+        let reader = sut.register_reader(consumer).unwrap();
+        for i in 0..CAPACITY as u64 {
+            let element = sut.pin(reader, i).unwrap().unwrap();
+            assert_that!(element.value, eq i * 10);
+            assert_that!(element.key, eq i);
+            sut.unpin(reader, element.key);
+        }
+        assert_that!(sut.pin(reader, CAPACITY as u64), eq Ok(None));
+    }
+}
+
+#[test]
+fn spmc_broadcast_ring_push_returns_overwritten_element() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    for i in 0..CAPACITY as u64 {
+        unsafe { sut.push(i, i) };
+    }
+
+    for i in 0..CAPACITY as u64 {
+        let old_element = unsafe { sut.push(100 + i, CAPACITY as u64 + i) };
+        assert_that!(old_element, eq Some(PinnedElement { value: i, key: i }));
+    }
+}
+
+#[test]
+fn spmc_broadcast_ring_lapped_consumer_gets_oldest_sequence_number() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    for i in 0..3 * CAPACITY as u64 {
+        unsafe { sut.push(i, i % NUMBER_OF_KEYS as u64) };
+    }
+
+    let reader = sut.register_reader(0).unwrap();
+    let oldest = 2 * CAPACITY as u64;
+    assert_that!(sut.oldest_sequence_number(), eq oldest);
+    assert_that!(sut.pin(reader, 0), eq Err(BroadcastRingPinError::Lapped(oldest)));
+
+    let element = sut.pin(reader, oldest).unwrap().unwrap();
+    assert_that!(element.value, eq oldest);
+}
+
+#[test]
+fn spmc_broadcast_ring_pinned_key_is_reported_until_unpinned() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    unsafe { sut.push(123, 7) };
+    assert_that!(sut.is_pinned(7), eq false);
+
+    let reader_1 = sut.register_reader(1).unwrap();
+    let reader_2 = sut.register_reader(2).unwrap();
+    let element_1 = sut.pin(reader_1, 0).unwrap().unwrap();
+    let element_2 = sut.pin(reader_2, 0).unwrap().unwrap();
+    assert_that!(sut.is_pinned(7), eq true);
+
+    sut.unpin(reader_1, element_1.key);
+    assert_that!(sut.is_pinned(7), eq true);
+
+    sut.unpin(reader_2, element_2.key);
+    assert_that!(sut.is_pinned(7), eq false);
+}
+
+#[test]
+fn spmc_broadcast_ring_register_reader_fails_when_all_readers_are_registered() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    let mut readers = vec![];
+    for i in 0..NUMBER_OF_READERS as u128 {
+        readers.push(sut.register_reader(i).unwrap());
+    }
+    assert_that!(sut.register_reader(NUMBER_OF_READERS as u128), is_none);
+
+    sut.unregister_reader(readers[3]);
+    assert_that!(sut.register_reader(NUMBER_OF_READERS as u128), is_some);
+}
+
+#[test]
+fn spmc_broadcast_ring_pins_of_every_reader_are_tracked_separately() {
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    unsafe { sut.push(123, 7) };
+
+    // the readers cover more than one pin word per key
+    let readers: Vec<_> = (0..NUMBER_OF_READERS as u128)
+        .map(|i| sut.register_reader(i).unwrap())
+        .collect();
+    for reader in &readers {
+        sut.pin(*reader, 0).unwrap().unwrap();
+    }
+
+    for reader in &readers {
+        assert_that!(sut.is_pinned(7), eq true);
+        sut.unpin(*reader, 7);
+    }
+    assert_that!(sut.is_pinned(7), eq false);
+}
+
+#[test]
+fn spmc_broadcast_ring_remove_reader_releases_all_of_its_pins() {
+    const DEAD_READER_ID: u128 = u128::MAX - 3;
+    const ALIVE_READER_ID: u128 = 5;
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+
+    for i in 0..CAPACITY as u64 {
+        unsafe { sut.push(i, i) };
+    }
+
+    let dead_reader = sut.register_reader(DEAD_READER_ID).unwrap();
+    let alive_reader = sut.register_reader(ALIVE_READER_ID).unwrap();
+    for i in 0..CAPACITY as u64 {
+        sut.pin(dead_reader, i).unwrap().unwrap();
+    }
+    sut.pin(alive_reader, 0).unwrap().unwrap();
+
+    assert_that!(unsafe { sut.remove_reader(DEAD_READER_ID) }, eq 1);
+
+    assert_that!(sut.is_pinned(0), eq true);
+    for i in 1..CAPACITY as u64 {
+        assert_that!(sut.is_pinned(i), eq false);
+    }
+    assert_that!(unsafe { sut.remove_reader(DEAD_READER_ID) }, eq 0);
+
+    sut.unpin(alive_reader, 0);
+    assert_that!(sut.is_pinned(0), eq false);
+}
+
+#[test]
+fn spmc_broadcast_ring_concurrent_consumers_receive_ordered_elements() {
+    const NUMBER_OF_CONSUMERS: usize = 4;
+    const NUMBER_OF_ELEMENTS: u64 = 100000;
+
+    let sut = BroadcastRing::new(CAPACITY, NUMBER_OF_KEYS, NUMBER_OF_READERS);
+    let barrier_handle = BarrierHandle::new();
+    let barrier = BarrierBuilder::new(NUMBER_OF_CONSUMERS as u32 + 1)
+        .is_interprocess_capable(false)
+        .create(&barrier_handle)
+        .unwrap();
+
+    thread::scope(|s| {
+        for consumer in 0..NUMBER_OF_CONSUMERS {
+            let sut = &sut;
+            let barrier = &barrier;
+            s.spawn(move || {
+                let reader = sut.register_reader(consumer as u128).unwrap();
+                barrier.wait();
+                let mut cursor = 0;
+                let mut last_value = None;
+                let mut received = 0;
+                let mut missed = 0;
+
+                while cursor < NUMBER_OF_ELEMENTS {
+                    match sut.pin(reader, cursor) {
+                        Ok(Some(element)) => {
+                            // the key of an unpinned element is never overwritten while pinned
+                            assert_that!(element.key, eq element.value % NUMBER_OF_KEYS as u64);
+                            if let Some(last_value) = last_value {
+                                assert_that!(element.value, gt last_value);
+                            }
+                            last_value = Some(element.value);
+                            sut.unpin(reader, element.key);
+                            received += 1;
+                            cursor += 1;
+                        }
+                        Ok(None) => (),
+                        Err(BroadcastRingPinError::Lapped(oldest)) => {
+                            missed += oldest - cursor;
+                            cursor = oldest;
+                        }
+                    }
+                }
+
+                assert_that!(received + missed, eq NUMBER_OF_ELEMENTS);
+            });
+        }
+
+        barrier.wait();
+        for i in 0..NUMBER_OF_ELEMENTS {
+            unsafe { sut.push(i, i % NUMBER_OF_KEYS as u64) };
+        }
+    });
+}
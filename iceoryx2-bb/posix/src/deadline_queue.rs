@@ -35,10 +35,19 @@
 //!         CallbackProgression::Continue
 //!     });
 //! ```
+//!
+//! # Complexity
+//!
+//! The deadlines are stored in an indexed binary min-heap ordered by their next deadline.
+//! Adding, removing and resetting a deadline is `O(log n)`, acquiring the duration until the
+//! next deadline is `O(1)` and acquiring `k` missed deadlines is `O(k log n)`, independent of
+//! the total number of deadlines.
 
 pub use iceoryx2_bb_elementary::CallbackProgression;
 
 use core::{cell::RefCell, fmt::Debug, sync::atomic::Ordering, time::Duration};
+use std::collections::HashMap;
+
 use iceoryx2_bb_log::fail;
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
 
@@ -109,15 +118,16 @@ impl DeadlineQueueBuilder {
 
     /// Creates a new [`DeadlineQueue`]
     pub fn create(self) -> Result<DeadlineQueue, TimeError> {
-        let start_time = fail!(from "DeadlineQueue::new()", when Time::now_with_clock(self.clock_type),
-                                "Failed to create DeadlineQueue since the current time could not be acquired.");
-        let start_time = start_time.as_duration().as_nanos();
+        // acquire the time once to verify that the clock is supported
+        fail!(from "DeadlineQueue::new()", when Time::now_with_clock(self.clock_type),
+                "Failed to create DeadlineQueue since the current time could not be acquired.");
 
         Ok(DeadlineQueue {
-            attachments: RefCell::new(vec![]),
+            heap: RefCell::new(DeadlineHeap::default()),
+            missed_attachments: RefCell::new(vec![]),
+            missed_indices: RefCell::new(vec![]),
             id_count: IoxAtomicU64::new(0),
             clock_type: self.clock_type,
-            previous_iteration: RefCell::new(start_time),
         })
     }
 }
@@ -127,26 +137,151 @@ struct Attachment {
     index: u64,
     period: u128,
     start_time: u128,
+    next_deadline: u128,
 }
 
 impl Attachment {
-    fn new(index: u64, period: u128, clock_type: ClockType) -> Result<Self, TimeError> {
-        let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
-                                "Failed to create DeadlineQueue attachment since the current time could not be acquired.");
-        let start_time = start_time.as_duration().as_nanos();
-
-        Ok(Self {
+    fn new(index: u64, period: u128, now: u128) -> Self {
+        Self {
             index,
             period,
-            start_time,
-        })
+            start_time: now,
+            next_deadline: now + period,
+        }
     }
 
-    fn reset(&mut self, clock_type: ClockType) -> Result<(), TimeError> {
-        let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
-                                "Failed to reset DeadlineQueue attachment since the current time could not be acquired.");
-        self.start_time = start_time.as_duration().as_nanos();
-        Ok(())
+    fn reset(&mut self, now: u128) {
+        self.start_time = now;
+        self.next_deadline = now + self.period;
+    }
+
+    /// Moves the next deadline to the first deadline after `now`. Deadlines with a period of
+    /// zero are missed on every iteration.
+    fn advance(&mut self, now: u128) {
+        if self.period == 0 {
+            return;
+        }
+
+        let elapsed_periods = (now - self.start_time) / self.period;
+        self.next_deadline = self.start_time + (elapsed_periods + 1) * self.period;
+    }
+
+    fn key(&self) -> (u128, u64) {
+        (self.next_deadline, self.index)
+    }
+}
+
+/// Binary min-heap of [`Attachment`]s ordered by their next deadline. The position of every
+/// attachment is tracked so that arbitrary attachments can be removed or updated in `O(log n)`.
+#[derive(Debug, Default)]
+struct DeadlineHeap {
+    attachments: Vec<Attachment>,
+    positions: HashMap<u64, usize>,
+}
+
+impl DeadlineHeap {
+    fn len(&self) -> usize {
+        self.attachments.len()
+    }
+
+    fn is_empty(&self) -> bool {
+        self.attachments.is_empty()
+    }
+
+    fn peek(&self) -> Option<&Attachment> {
+        self.attachments.first()
+    }
+
+    fn push(&mut self, attachment: Attachment) {
+        let position = self.attachments.len();
+        self.positions.insert(attachment.index, position);
+        self.attachments.push(attachment);
+        self.sift_up(position);
+    }
+
+    fn pop(&mut self) -> Option<Attachment> {
+        if self.is_empty() {
+            return None;
+        }
+
+        self.remove_at(0)
+    }
+
+    fn remove(&mut self, index: u64) -> Option<Attachment> {
+        match self.positions.get(&index) {
+            Some(position) => self.remove_at(*position),
+            None => None,
+        }
+    }
+
+    fn update<F: FnOnce(&mut Attachment)>(&mut self, index: u64, update: F) {
+        if let Some(position) = self.positions.get(&index).copied() {
+            update(&mut self.attachments[position]);
+            let position = self.sift_up(position);
+            self.sift_down(position);
+        }
+    }
+
+    fn remove_at(&mut self, position: usize) -> Option<Attachment> {
+        let last = self.attachments.len() - 1;
+        self.swap(position, last);
+
+        let attachment = self.attachments.pop()?;
+        self.positions.remove(&attachment.index);
+
+        if position < self.attachments.len() {
+            let position = self.sift_up(position);
+            self.sift_down(position);
+        }
+
+        Some(attachment)
+    }
+
+    fn swap(&mut self, lhs: usize, rhs: usize) {
+        self.attachments.swap(lhs, rhs);
+        self.positions.insert(self.attachments[lhs].index, lhs);
+        self.positions.insert(self.attachments[rhs].index, rhs);
+    }
+
+    fn sift_up(&mut self, mut position: usize) -> usize {
+        while position > 0 {
+            let parent = (position - 1) / 2;
+            if self.attachments[parent].key() <= self.attachments[position].key() {
+                break;
+            }
+
+            self.swap(parent, position);
+            position = parent;
+        }
+
+        position
+    }
+
+    fn sift_down(&mut self, mut position: usize) {
+        loop {
+            let left = 2 * position + 1;
+            let right = left + 1;
+            let mut smallest = position;
+
+            if left < self.attachments.len()
+                && self.attachments[left].key() < self.attachments[smallest].key()
+            {
+                smallest = left;
+            }
+
+            if right < self.attachments.len()
+                && self.attachments[right].key() < self.attachments[smallest].key()
+            {
+                smallest = right;
+            }
+
+            if smallest == position {
+                return;
+            }
+
+            self.swap(position, smallest);
+            position = smallest;
+        }
     }
 }
 
@@ -156,9 +291,11 @@ impl Attachment {
 /// [`DeadlineQueue::missed_deadlines()`].
 #[derive(Debug)]
 pub struct DeadlineQueue {
-    attachments: RefCell<Vec<Attachment>>,
+    heap: RefCell<DeadlineHeap>,
+    // reused buffers to avoid heap allocations in every DeadlineQueue::missed_deadlines() call
+    missed_attachments: RefCell<Vec<Attachment>>,
+    missed_indices: RefCell<Vec<u64>>,
     id_count: IoxAtomicU64,
-    previous_iteration: RefCell<u128>,
 
     clock_type: ClockType,
 }
@@ -166,12 +303,12 @@ pub struct DeadlineQueue {
 impl DeadlineQueue {
     /// Returns the number of attachments.
     pub fn len(&self) -> usize {
-        self.attachments.borrow().len()
+        self.heap.borrow().len()
     }
 
     /// Returns true if the deadline queue does not contain any attachments.
     pub fn is_empty(&self) -> bool {
-        self.attachments.borrow().is_empty()
+        self.heap.borrow().is_empty()
     }
 
     /// Adds a cyclic deadline to the [`DeadlineQueue`] and returns an [`DeadlineQueueGuard`] to
@@ -182,13 +319,12 @@ impl DeadlineQueue {
         &self,
         deadline: Duration,
     ) -> Result<DeadlineQueueGuard, TimeError> {
-        let current_idx = self.id_count.load(Ordering::Relaxed);
-        self.attachments.borrow_mut().push(Attachment::new(
-            current_idx,
-            deadline.as_nanos(),
-            self.clock_type,
-        )?);
-        self.id_count.fetch_add(1, Ordering::Relaxed);
+        let now = fail!(from self, when self.now(),
+                        "Failed to add deadline since the current time could not be acquired.");
+        let current_idx = self.id_count.fetch_add(1, Ordering::Relaxed);
+        self.heap
+            .borrow_mut()
+            .push(Attachment::new(current_idx, deadline.as_nanos(), now));
 
         Ok(DeadlineQueueGuard {
             deadline_queue: self,
@@ -196,28 +332,23 @@ impl DeadlineQueue {
         })
     }
 
-    fn remove(&self, index: u64) {
-        let mut index_to_remove = None;
-        for (n, attachment) in self.attachments.borrow().iter().enumerate() {
-            if attachment.index == index {
-                index_to_remove = Some(n);
-                break;
-            }
-        }
+    fn now(&self) -> Result<u128, TimeError> {
+        Ok(Time::now_with_clock(self.clock_type)?
+            .as_duration()
+            .as_nanos())
+    }
 
-        if let Some(n) = index_to_remove {
-            self.attachments.borrow_mut().remove(n);
-        }
+    fn remove(&self, index: u64) {
+        self.heap.borrow_mut().remove(index);
     }
 
     /// Resets the attached deadline_queue and wait again the full time.
     pub fn reset(&self, index: DeadlineQueueIndex) -> Result<(), TimeError> {
-        for attachment in &mut *self.attachments.borrow_mut() {
-            if attachment.index == index.0 {
-                attachment.reset(self.clock_type)?;
-                break;
-            }
-        }
+        let now = fail!(from self, when self.now(),
+                        "Failed to reset deadline since the current time could not be acquired.");
+        self.heap
+            .borrow_mut()
+            .update(index.0, |attachment| attachment.reset(now));
 
         Ok(())
     }
@@ -225,84 +356,64 @@ impl DeadlineQueue {
     /// Returns the waiting duration until the next deadline is reached. If there have been
     /// already deadlines missed it returns a duration of zero.
     pub fn duration_until_next_deadline(&self) -> Result<Duration, TimeError> {
-        if self.is_empty() {
-            return Ok(Duration::MAX);
-        }
+        let next_deadline = match self.heap.borrow().peek() {
+            Some(attachment) => attachment.next_deadline,
+            None => return Ok(Duration::MAX),
+        };
 
-        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+        let now = fail!(from self, when self.now(),
                         "Unable to return next duration since the current time could not be acquired.");
-        let now = now.as_duration().as_nanos();
-        let mut has_missed_deadline = false;
-        self.handle_missed_deadlines(now, |_| {
-            has_missed_deadline = true;
-            CallbackProgression::Stop
-        });
-
-        if has_missed_deadline {
-            return Ok(Duration::ZERO);
-        }
 
-        // must be set after the return caused by a missed deadline, otherwise the user is unable
-        // to acquire the missed deadline
-        *self.previous_iteration.borrow_mut() = now;
-
-        let mut min_time = u128::MAX;
-        for attachment in &*self.attachments.borrow() {
-            min_time =
-                min_time.min(attachment.period - (now - attachment.start_time) % attachment.period);
+        if next_deadline <= now {
+            return Ok(Duration::ZERO);
         }
 
-        Ok(Duration::from_nanos(min_time as _))
-    }
-
-    fn handle_missed_deadlines<F: FnMut(DeadlineQueueIndex) -> CallbackProgression>(
-        &self,
-        now: u128,
-        mut call: F,
-    ) {
-        let last = *self.previous_iteration.borrow();
-
-        for attachment in &*self.attachments.borrow() {
-            let duration_until_last = last.max(attachment.start_time) - attachment.start_time;
-            let duration_until_now = now - attachment.start_time;
-            match attachment.period {
-                0 => {
-                    if matches!(
-                        call(DeadlineQueueIndex(attachment.index)),
-                        CallbackProgression::Stop
-                    ) {
-                        return;
-                    }
-                }
-                _ => {
-                    let last = duration_until_last / attachment.period;
-                    let current = duration_until_now / attachment.period;
-
-                    if last < current
-                        && matches!(
-                            call(DeadlineQueueIndex(attachment.index)),
-                            CallbackProgression::Stop
-                        )
-                    {
-                        return;
-                    }
-                }
-            }
-        }
+        Ok(Duration::from_nanos((next_deadline - now) as _))
     }
 
     /// Iterates over all missed deadlines and calls the provided callback for each of them
-    /// and provide the [`DeadlineQueueIndex`] to identify them.
+    /// and provide the [`DeadlineQueueIndex`] to identify them. The missed deadlines are
+    /// provided in the order in which they were missed.
     pub fn missed_deadlines<F: FnMut(DeadlineQueueIndex) -> CallbackProgression>(
         &self,
         mut call: F,
     ) -> Result<(), TimeError> {
-        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+        let now = fail!(from self, when self.now(),
                         "Unable to return next duration since the current time could not be acquired.");
 
-        let now = now.as_duration().as_nanos();
-        self.handle_missed_deadlines(now, |idx| -> CallbackProgression { call(idx) });
-        *self.previous_iteration.borrow_mut() = now;
+        let mut missed_attachments = self.missed_attachments.take();
+        let mut missed_indices = self.missed_indices.take();
+
+        {
+            let mut heap = self.heap.borrow_mut();
+            while heap
+                .peek()
+                .is_some_and(|attachment| attachment.next_deadline <= now)
+            {
+                if let Some(attachment) = heap.pop() {
+                    missed_attachments.push(attachment);
+                }
+            }
+
+            // all missed deadlines are handled at once, when the user stops the iteration
+            // the remaining missed deadlines are discarded
+            for mut attachment in missed_attachments.drain(..) {
+                missed_indices.push(attachment.index);
+                attachment.advance(now);
+                heap.push(attachment);
+            }
+        }
+
+        // the heap is not borrowed while calling the user so that the callback can add, remove
+        // or reset deadlines
+        for index in missed_indices.drain(..) {
+            if let CallbackProgression::Stop = call(DeadlineQueueIndex(index)) {
+                break;
+            }
+        }
+
+        *self.missed_attachments.borrow_mut() = missed_attachments;
+        *self.missed_indices.borrow_mut() = missed_indices;
 
         Ok(())
     }
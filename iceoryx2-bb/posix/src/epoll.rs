@@ -0,0 +1,280 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstraction of a Linux epoll instance. An [`Epoll`] is a [`FileDescriptor`] that becomes
+//! readable as soon as one of its attached file descriptors becomes readable. It can be used
+//! to combine multiple [`SynchronousMultiplexing`] objects into a single file descriptor which
+//! can then be attached to a [`crate::file_descriptor_set::FileDescriptorSet`] or any external
+//! event loop.
+//!
+//! Alternatively, one can wait directly on the [`Epoll`]. In contrast to the
+//! [`crate::file_descriptor_set::FileDescriptorSet`], the attachments are registered only once
+//! in the kernel and a wait call returns only the ready file descriptors instead of scanning
+//! all attachments. At most [`Epoll::max_events_per_wait()`] ready file descriptors are
+//! reported per wait call, the kernel hands out the remaining ones in the next call.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::epoll::*;
+//! use iceoryx2_bb_posix::event_fd::*;
+//!
+//! let epoll = EpollBuilder::new().create().unwrap();
+//! let event_fd = EventFdBuilder::new().create().unwrap();
+//!
+//! epoll.attach(&event_fd).unwrap();
+//! // the epoll file descriptor is now readable as soon as the event_fd is notified
+//! event_fd.notify().unwrap();
+//!
+//! epoll.try_wait(|fd| println!("{:?} is readable", fd)).unwrap();
+//!
+//! epoll.detach(&event_fd).unwrap();
+//! ```
+
+use core::time::Duration;
+use iceoryx2_bb_log::{fail, trace};
+use iceoryx2_pal_posix::posix::{self, EpollEventData, Errno, MemZeroedStruct};
+
+use crate::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use crate::file_descriptor_set::SynchronousMultiplexing;
+use crate::handle_errno;
+
+/// Defines the errors that can occur when an [`Epoll`] is created with
+/// [`EpollBuilder::create()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EpollCreationError {
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    FileDescriptorBroken,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when a file descriptor is attached to an [`Epoll`] with
+/// [`Epoll::attach()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EpollAttachmentError {
+    AlreadyAttached,
+    InsufficientMemory,
+    ExceedsMaxSupportedAttachments,
+    NotSupported,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when a file descriptor is detached from an [`Epoll`] with
+/// [`Epoll::detach()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EpollDetachmentError {
+    NotAttached,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when waiting on an [`Epoll`] with
+/// * [`Epoll::try_wait()`]
+/// * [`Epoll::timed_wait()`]
+/// * [`Epoll::blocking_wait()`]
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EpollWaitError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+const MAX_EVENTS_PER_WAIT: usize = 256;
+
+/// Creates an [`Epoll`].
+#[derive(Debug, Default)]
+pub struct EpollBuilder {}
+
+impl EpollBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Creates a new [`Epoll`] instance without any attachments.
+    pub fn create(self) -> Result<Epoll, EpollCreationError> {
+        let msg = "Unable to create Epoll";
+        let raw_fd = unsafe { posix::epoll_create1(posix::EPOLL_CLOEXEC) };
+        if raw_fd >= 0 {
+            return match FileDescriptor::new(raw_fd) {
+                Some(file_descriptor) => {
+                    let epoll = Epoll { file_descriptor };
+                    trace!(from epoll, "created");
+                    Ok(epoll)
+                }
+                None => {
+                    fail!(from self, with EpollCreationError::FileDescriptorBroken,
+                        "This should never happen! {msg} since epoll_create1 returned a broken file descriptor.");
+                }
+            };
+        }
+
+        handle_errno!(EpollCreationError, from self,
+            fatal Errno::EINVAL => ("This should never happen! {msg} since an internal argument was invalid."),
+            Errno::EMFILE => (PerProcessFileHandleLimitReached, "{msg} since the processes file descriptor limit was reached."),
+            Errno::ENFILE => (SystemWideFileHandleLimitReached, "{msg} since the system wide file descriptor limit was reached."),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+}
+
+/// A Linux epoll instance, see the module documentation for details.
+#[derive(Debug)]
+pub struct Epoll {
+    file_descriptor: FileDescriptor,
+}
+
+impl FileDescriptorBased for Epoll {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl SynchronousMultiplexing for Epoll {}
+
+unsafe impl Send for Epoll {}
+unsafe impl Sync for Epoll {}
+
+impl Epoll {
+    /// Attaches a file descriptor. Afterwards, the [`Epoll`] becomes readable whenever the
+    /// attached file descriptor is readable.
+    pub fn attach<T: SynchronousMultiplexing + ?Sized>(
+        &self,
+        fd: &T,
+    ) -> Result<(), EpollAttachmentError> {
+        let mut event = posix::epoll_event::new_zeroed();
+        event.events = posix::EPOLLIN;
+        event.set_data_u64(unsafe { fd.file_descriptor().native_handle() } as u64);
+
+        if unsafe {
+            posix::epoll_ctl(
+                self.file_descriptor.native_handle(),
+                posix::EPOLL_CTL_ADD,
+                fd.file_descriptor().native_handle(),
+                &mut event,
+            )
+        } == 0
+        {
+            return Ok(());
+        }
+
+        let msg = "Unable to attach file descriptor";
+        handle_errno!(EpollAttachmentError, from self,
+            fatal Errno::EBADF => ("This should never happen! {msg} {:?} since a file descriptor was invalid.", fd.file_descriptor());
+            fatal Errno::EINVAL => ("This should never happen! {msg} {:?} since an internal argument was invalid.", fd.file_descriptor()),
+            Errno::EEXIST => (AlreadyAttached, "{msg} {:?} since it is already attached.", fd.file_descriptor()),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} {:?} due to insufficient memory.", fd.file_descriptor()),
+            Errno::ENOSPC => (ExceedsMaxSupportedAttachments, "{msg} {:?} since the maximum number of epoll watches of the user is exceeded.", fd.file_descriptor()),
+            Errno::EPERM => (NotSupported, "{msg} {:?} since the file descriptor does not support epoll.", fd.file_descriptor()),
+            v => (UnknownError(v as i32), "{msg} {:?} since an unknown error occurred ({v}).", fd.file_descriptor())
+        )
+    }
+
+    /// Detaches a previously attached file descriptor.
+    pub fn detach<T: SynchronousMultiplexing + ?Sized>(
+        &self,
+        fd: &T,
+    ) -> Result<(), EpollDetachmentError> {
+        let mut event = posix::epoll_event::new_zeroed();
+
+        if unsafe {
+            posix::epoll_ctl(
+                self.file_descriptor.native_handle(),
+                posix::EPOLL_CTL_DEL,
+                fd.file_descriptor().native_handle(),
+                &mut event,
+            )
+        } == 0
+        {
+            return Ok(());
+        }
+
+        let msg = "Unable to detach file descriptor";
+        handle_errno!(EpollDetachmentError, from self,
+            fatal Errno::EBADF => ("This should never happen! {msg} {:?} since a file descriptor was invalid.", fd.file_descriptor());
+            fatal Errno::EINVAL => ("This should never happen! {msg} {:?} since an internal argument was invalid.", fd.file_descriptor()),
+            Errno::ENOENT => (NotAttached, "{msg} {:?} since it is not attached.", fd.file_descriptor()),
+            v => (UnknownError(v as i32), "{msg} {:?} since an unknown error occurred ({v}).", fd.file_descriptor())
+        )
+    }
+
+    /// Returns the maximum number of ready file descriptors that are reported in one wait call.
+    pub const fn max_events_per_wait() -> usize {
+        MAX_EVENTS_PER_WAIT
+    }
+
+    /// Calls the provided callback for every attachment that is readable without blocking.
+    /// Returns the number of readable attachments.
+    pub fn try_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        self.wait(0, fd_callback)
+    }
+
+    /// Blocks until either at least one attachment is readable or the timeout has passed.
+    /// Calls the provided callback for every readable attachment and returns their number.
+    pub fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Duration,
+        fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        // round up, otherwise a timeout below one millisecond would not block at all
+        let timeout_in_ms = timeout.as_nanos().div_ceil(1_000_000);
+        self.wait(
+            timeout_in_ms.min(posix::int::MAX as u128) as posix::int,
+            fd_callback,
+        )
+    }
+
+    /// Blocks until at least one attachment is readable. Calls the provided callback for every
+    /// readable attachment and returns their number.
+    pub fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        self.wait(-1, fd_callback)
+    }
+
+    fn wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout_in_ms: posix::int,
+        mut fd_callback: F,
+    ) -> Result<usize, EpollWaitError> {
+        let mut events = [posix::epoll_event::new_zeroed(); MAX_EVENTS_PER_WAIT];
+        let number_of_events = unsafe {
+            posix::epoll_wait(
+                self.file_descriptor.native_handle(),
+                events.as_mut_ptr(),
+                MAX_EVENTS_PER_WAIT as _,
+                timeout_in_ms,
+            )
+        };
+
+        if number_of_events >= 0 {
+            for event in events.iter().take(number_of_events as usize) {
+                let fd = FileDescriptor::non_owning_new(event.get_data_u64() as i32).unwrap();
+                fd_callback(&fd);
+            }
+            return Ok(number_of_events as usize);
+        }
+
+        let msg = "Failure while waiting on Epoll";
+        handle_errno!(EpollWaitError, from self,
+            fatal Errno::EBADF => ("This should never happen! {msg} since the internal file descriptor was invalid.");
+            fatal Errno::EFAULT => ("This should never happen! {msg} since the event buffer is not accessible.");
+            fatal Errno::EINVAL => ("This should never happen! {msg} since an internal argument was invalid."),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+}
@@ -0,0 +1,268 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstraction of a Linux eventfd. An [`EventFd`] is a kernel maintained counter that
+//! becomes readable as soon as it is not zero. Notifying it is a single `write` syscall and
+//! since it is a [`FileDescriptor`] it can be attached to a
+//! [`FileDescriptorSet`], an [`crate::epoll::Epoll`] or any other external
+//! event loop. An [`EventFd`] can be transferred to other processes via
+//! [`crate::socket_ancillary::SocketAncillary`].
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::event_fd::*;
+//! use core::time::Duration;
+//!
+//! let event_fd = EventFdBuilder::new().create().unwrap();
+//!
+//! event_fd.notify().unwrap();
+//! event_fd.notify().unwrap();
+//!
+//! // acquires the counter and resets it to zero
+//! assert_eq!(event_fd.try_wait().unwrap(), Some(2));
+//! assert_eq!(event_fd.timed_wait(Duration::from_millis(10)).unwrap(), None);
+//! ```
+
+use core::time::Duration;
+use iceoryx2_bb_log::{fail, fatal_panic, trace};
+use iceoryx2_pal_posix::posix::{self, Errno};
+
+use crate::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use crate::file_descriptor_set::{
+    FileDescriptorSet, FileDescriptorSetWaitError, FileEvent, SynchronousMultiplexing,
+};
+use crate::handle_errno;
+
+/// Defines the errors that can occur when an [`EventFd`] is created with
+/// [`EventFdBuilder::create()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EventFdCreationError {
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    InsufficientResources,
+    FileDescriptorBroken,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when an [`EventFd`] is notified with
+/// [`EventFd::notify()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EventFdNotifyError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when waiting on an [`EventFd`] with
+/// * [`EventFd::try_wait()`]
+/// * [`EventFd::timed_wait()`]
+/// * [`EventFd::blocking_wait()`]
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum EventFdWaitError {
+    Interrupt,
+    InsufficientPermissions,
+    UnknownError(i32),
+}
+
+impl From<FileDescriptorSetWaitError> for EventFdWaitError {
+    fn from(value: FileDescriptorSetWaitError) -> Self {
+        match value {
+            FileDescriptorSetWaitError::Interrupt => EventFdWaitError::Interrupt,
+            FileDescriptorSetWaitError::InsufficientPermissions => {
+                EventFdWaitError::InsufficientPermissions
+            }
+            FileDescriptorSetWaitError::TooManyAttachedFileDescriptors => {
+                EventFdWaitError::UnknownError(0)
+            }
+            FileDescriptorSetWaitError::UnknownError(v) => EventFdWaitError::UnknownError(v),
+        }
+    }
+}
+
+/// Creates an [`EventFd`].
+#[derive(Debug)]
+pub struct EventFdBuilder {
+    initial_value: u32,
+    is_semaphore: bool,
+}
+
+impl Default for EventFdBuilder {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl EventFdBuilder {
+    pub fn new() -> Self {
+        Self {
+            initial_value: 0,
+            is_semaphore: false,
+        }
+    }
+
+    /// Defines the initial value of the counter.
+    pub fn initial_value(mut self, value: u32) -> Self {
+        self.initial_value = value;
+        self
+    }
+
+    /// When set, every wait decrements the counter by one instead of resetting it to zero.
+    pub fn semaphore_mode(mut self, value: bool) -> Self {
+        self.is_semaphore = value;
+        self
+    }
+
+    /// Creates a new non-blocking [`EventFd`].
+    pub fn create(self) -> Result<EventFd, EventFdCreationError> {
+        let msg = "Unable to create EventFd";
+        let mut flags = posix::EFD_NONBLOCK | posix::EFD_CLOEXEC;
+        if self.is_semaphore {
+            flags |= posix::EFD_SEMAPHORE;
+        }
+
+        let raw_fd = unsafe { posix::eventfd(self.initial_value, flags) };
+        if raw_fd >= 0 {
+            return match FileDescriptor::new(raw_fd) {
+                Some(file_descriptor) => {
+                    let event_fd = EventFd { file_descriptor };
+                    trace!(from event_fd, "created");
+                    Ok(event_fd)
+                }
+                None => {
+                    fail!(from self, with EventFdCreationError::FileDescriptorBroken,
+                        "This should never happen! {msg} since eventfd returned a broken file descriptor.");
+                }
+            };
+        }
+
+        handle_errno!(EventFdCreationError, from self,
+            fatal Errno::EINVAL => ("This should never happen! {msg} since an internal argument was invalid."),
+            Errno::EMFILE => (PerProcessFileHandleLimitReached, "{msg} since the processes file descriptor limit was reached."),
+            Errno::ENFILE => (SystemWideFileHandleLimitReached, "{msg} since the system wide file descriptor limit was reached."),
+            Errno::ENODEV => (InsufficientResources, "{msg} since the anonymous inode device could not be mounted."),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+}
+
+/// A Linux eventfd, see the module documentation for details.
+#[derive(Debug)]
+pub struct EventFd {
+    file_descriptor: FileDescriptor,
+}
+
+impl FileDescriptorBased for EventFd {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl SynchronousMultiplexing for EventFd {}
+
+unsafe impl Send for EventFd {}
+unsafe impl Sync for EventFd {}
+
+impl EventFd {
+    /// Takes ownership of a [`FileDescriptor`] that refers to a non-blocking eventfd, for
+    /// instance one that was received from another process via
+    /// [`crate::socket_ancillary::SocketAncillary`]. When [`EventFd`] goes out of scope the
+    /// file descriptor is closed.
+    pub fn from_file_descriptor(file_descriptor: FileDescriptor) -> Self {
+        trace!(from "EventFd::from_file_descriptor", "opened {:?}", file_descriptor);
+        Self { file_descriptor }
+    }
+
+    /// Increments the counter by one and wakes up all waiters.
+    pub fn notify(&self) -> Result<(), EventFdNotifyError> {
+        let value: u64 = 1;
+        let bytes_written = unsafe {
+            posix::write(
+                self.file_descriptor.native_handle(),
+                (&value as *const u64).cast(),
+                core::mem::size_of::<u64>(),
+            )
+        };
+
+        if bytes_written == core::mem::size_of::<u64>() as _ {
+            return Ok(());
+        }
+
+        let msg = "Unable to notify EventFd";
+        // EAGAIN: the counter is saturated, therefore a wakeup is already pending
+        handle_errno!(EventFdNotifyError, from self,
+            success Errno::EAGAIN => (),
+            fatal Errno::EBADF => ("This should never happen! {msg} since the internal file descriptor was invalid.");
+            fatal Errno::EINVAL => ("This should never happen! {msg} since the file descriptor is not an eventfd."),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+
+    /// Acquires the counter without blocking. Returns [`None`] when it was not notified,
+    /// otherwise the value of the counter that is reset to zero, or decremented by one in
+    /// semaphore mode.
+    pub fn try_wait(&self) -> Result<Option<u64>, EventFdWaitError> {
+        let mut value: u64 = 0;
+        let bytes_read = unsafe {
+            posix::read(
+                self.file_descriptor.native_handle(),
+                (&mut value as *mut u64).cast(),
+                core::mem::size_of::<u64>(),
+            )
+        };
+
+        if bytes_read == core::mem::size_of::<u64>() as _ {
+            return Ok(Some(value));
+        }
+
+        let msg = "Unable to wait on EventFd";
+        handle_errno!(EventFdWaitError, from self,
+            success Errno::EAGAIN => None,
+            fatal Errno::EBADF => ("This should never happen! {msg} since the internal file descriptor was invalid.");
+            fatal Errno::EINVAL => ("This should never happen! {msg} since the file descriptor is not an eventfd."),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+
+    /// Blocks until either the [`EventFd`] was notified or the timeout has passed. Returns
+    /// [`None`] when the timeout has passed, otherwise see [`EventFd::try_wait()`].
+    pub fn timed_wait(&self, timeout: Duration) -> Result<Option<u64>, EventFdWaitError> {
+        if let Some(value) = self.try_wait()? {
+            return Ok(Some(value));
+        }
+
+        let fd_set = FileDescriptorSet::new();
+        let _guard = fatal_panic!(from self, when fd_set.add(self),
+                "This should never happen! Unable to attach EventFd to a fd set.");
+        fail!(from self, when fd_set.timed_wait(timeout, FileEvent::Read, |_| {}),
+            "Unable to wait on EventFd with a timeout of {:?}.", timeout);
+        self.try_wait()
+    }
+
+    /// Blocks until the [`EventFd`] was notified. Despite the name, spurious wakeups can cause
+    /// it to return [`None`].
+    pub fn blocking_wait(&self) -> Result<Option<u64>, EventFdWaitError> {
+        if let Some(value) = self.try_wait()? {
+            return Ok(Some(value));
+        }
+
+        let fd_set = FileDescriptorSet::new();
+        let _guard = fatal_panic!(from self, when fd_set.add(self),
+                "This should never happen! Unable to attach EventFd to a fd set.");
+        fail!(from self, when fd_set.blocking_wait(FileEvent::Read, |_| {}),
+            "Unable to blocking wait on EventFd.");
+        self.try_wait()
+    }
+}
@@ -55,7 +55,14 @@ use iceoryx2_pal_posix::posix::{errno::Errno, MemZeroedStruct};
 use iceoryx2_pal_posix::*;
 
 /// A trait which is implement by all objects which can be added to the [`FileDescriptorSet`].
-pub trait SynchronousMultiplexing: FileDescriptorBased {}
+pub trait SynchronousMultiplexing: FileDescriptorBased {
+    /// Returns true when the object provides a [`FileDescriptor`] it can be multiplexed with.
+    /// Objects that own one only in some configurations override it so that they can be
+    /// rejected before [`FileDescriptorBased::file_descriptor()`] is called.
+    fn is_multiplexable(&self) -> bool {
+        true
+    }
+}
 
 #[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
 pub enum FileDescriptorSetWaitError {
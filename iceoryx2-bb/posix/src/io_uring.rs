@@ -0,0 +1,785 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstraction of a Linux io_uring instance that waits until one of its attached
+//! [`SynchronousMultiplexing`] objects becomes readable.
+//!
+//! Every attachment is registered once as multishot poll request. The kernel posts a
+//! completion whenever an attachment becomes readable, a wait call only reaps these
+//! completions from the shared completion queue. Optionally, a kernel thread polls the
+//! submission queue, see [`IoUringBuilder::submission_queue_polling()`], so that attaching
+//! and detaching does not require a system call while the thread is awake.
+//!
+//! A multishot poll reports only when an attachment becomes readable. To behave like the
+//! [`crate::epoll::Epoll`] and the [`crate::file_descriptor_set::FileDescriptorSet`], the
+//! attachments that were reported once are checked with `poll` in every wait call and are
+//! reported again as long as they are readable. The cost of a wait call grows with the number
+//! of readable attachments and not with the number of attachments.
+//!
+//! Requires Linux 5.13 or newer. The kernel or a seccomp filter may disable io_uring, then
+//! [`IoUringBuilder::create()`] fails with [`IoUringCreationError::NotSupported`] or
+//! [`IoUringCreationError::InsufficientPermissions`].
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::io_uring::*;
+//! use iceoryx2_bb_posix::event_fd::*;
+//!
+//! let io_uring = match IoUringBuilder::new().create() {
+//!     Ok(io_uring) => io_uring,
+//!     // io_uring is not available on this system
+//!     Err(_) => return,
+//! };
+//! let event_fd = EventFdBuilder::new().create().unwrap();
+//!
+//! io_uring.attach(&event_fd).unwrap();
+//! event_fd.notify().unwrap();
+//!
+//! io_uring.try_wait(|fd| println!("{:?} is readable", fd)).unwrap();
+//!
+//! io_uring.detach(&event_fd).unwrap();
+//! ```
+
+use core::cell::UnsafeCell;
+use core::fmt::Debug;
+use core::sync::atomic::{fence, AtomicU32, Ordering};
+use core::time::Duration;
+
+use iceoryx2_bb_log::{fail, trace, warn};
+use iceoryx2_pal_posix::posix::{self, Errno, MemZeroedStruct};
+
+use crate::clock::Time;
+use crate::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use crate::file_descriptor_set::SynchronousMultiplexing;
+use crate::handle_errno;
+
+/// Defines the errors that can occur when an [`IoUring`] is created with
+/// [`IoUringBuilder::create()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringCreationError {
+    NotSupported,
+    InsufficientPermissions,
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    InsufficientMemory,
+    FileDescriptorBroken,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when a file descriptor is attached to an [`IoUring`] with
+/// [`IoUring::attach()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringAttachmentError {
+    AlreadyAttached,
+    InsufficientResources,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when a file descriptor is detached from an [`IoUring`]
+/// with [`IoUring::detach()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringDetachmentError {
+    NotAttached,
+    InsufficientResources,
+    UnknownError(i32),
+}
+
+/// Defines the errors that can occur when waiting on an [`IoUring`] with
+/// * [`IoUring::try_wait()`]
+/// * [`IoUring::timed_wait()`]
+/// * [`IoUring::blocking_wait()`]
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringWaitError {
+    Interrupt,
+    UnknownError(i32),
+}
+
+const SUBMISSION_QUEUE_SIZE: u32 = 64;
+const COMPLETION_QUEUE_SIZE: u32 = 8192;
+const MAX_SUBMISSION_RETRIES: usize = 16;
+/// The completions of the requests that remove a multishot poll carry this user data, the
+/// user data of a multishot poll is never zero, see [`user_data()`].
+const REMOVAL_USER_DATA: u64 = 0;
+/// Features required for multishot polls and timed waits. [`posix::IORING_FEAT_RSRC_TAGS`] is
+/// checked since it was introduced with the same kernel release as multishot polls.
+const REQUIRED_FEATURES: u32 = posix::IORING_FEAT_SINGLE_MMAP
+    | posix::IORING_FEAT_NODROP
+    | posix::IORING_FEAT_EXT_ARG
+    | posix::IORING_FEAT_RSRC_TAGS;
+
+fn user_data(attachment: &Attachment) -> u64 {
+    ((attachment.generation as u64) << 32) | attachment.fd as u32 as u64
+}
+
+/// Creates an [`IoUring`].
+#[derive(Debug, Default)]
+pub struct IoUringBuilder {
+    submission_queue_polling: Option<Duration>,
+}
+
+impl IoUringBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Starts a kernel thread that polls the submission queue. The thread goes to sleep when
+    /// no submission arrived for `idle_time` and is woken up with the next submission.
+    /// Requires `CAP_SYS_ADMIN` on kernels older than 5.11.
+    pub fn submission_queue_polling(mut self, idle_time: Duration) -> Self {
+        self.submission_queue_polling = Some(idle_time);
+        self
+    }
+
+    /// Creates a new [`IoUring`] instance without any attachments.
+    pub fn create(self) -> Result<IoUring, IoUringCreationError> {
+        let msg = "Unable to create IoUring";
+        let mut params = posix::io_uring_params::new_zeroed();
+        params.flags = posix::IORING_SETUP_CQSIZE | posix::IORING_SETUP_CLAMP;
+        params.cq_entries = COMPLETION_QUEUE_SIZE;
+        if let Some(idle_time) = self.submission_queue_polling {
+            params.flags |= posix::IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = idle_time.as_millis().clamp(1, u32::MAX as u128) as u32;
+        }
+
+        let raw_fd = unsafe { posix::io_uring_setup(SUBMISSION_QUEUE_SIZE, &mut params) };
+        if raw_fd < 0 {
+            handle_errno!(IoUringCreationError, from self,
+                fatal Errno::EFAULT => ("This should never happen! {msg} since the parameters are not accessible.");
+                fatal Errno::EBADF => ("This should never happen! {msg} since an internal file descriptor was invalid."),
+                Errno::ENOSYS => (NotSupported, "{msg} since the kernel does not support io_uring."),
+                Errno::EINVAL => (NotSupported, "{msg} since the kernel does not support the required io_uring setup flags."),
+                Errno::EPERM => (InsufficientPermissions, "{msg} since io_uring or the submission queue polling is not permitted for the process."),
+                Errno::EMFILE => (PerProcessFileHandleLimitReached, "{msg} since the processes file descriptor limit was reached."),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{msg} since the system wide file descriptor limit was reached."),
+                Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+                v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+            )
+        }
+
+        let file_descriptor = match FileDescriptor::new(raw_fd) {
+            Some(file_descriptor) => file_descriptor,
+            None => {
+                fail!(from self, with IoUringCreationError::FileDescriptorBroken,
+                    "This should never happen! {msg} since io_uring_setup returned a broken file descriptor.");
+            }
+        };
+
+        if params.features & REQUIRED_FEATURES != REQUIRED_FEATURES {
+            fail!(from self, with IoUringCreationError::NotSupported,
+                "{msg} since the kernel does not support multishot polls, Linux 5.13 or newer is required.");
+        }
+
+        let submission_ring_len =
+            params.sq_off.array as usize + params.sq_entries as usize * size_of::<u32>();
+        let completion_ring_len = params.cq_off.cqes as usize
+            + params.cq_entries as usize * size_of::<posix::io_uring_cqe>();
+        let rings = self.map(
+            &file_descriptor,
+            submission_ring_len.max(completion_ring_len),
+            posix::IORING_OFF_SQ_RING,
+        )?;
+        let sqes = self.map(
+            &file_descriptor,
+            params.sq_entries as usize * size_of::<posix::io_uring_sqe>(),
+            posix::IORING_OFF_SQES,
+        )?;
+
+        let read_u32 = |offset: u32| unsafe { *rings.at::<u32>(offset) };
+        let io_uring = IoUring {
+            submission_queue_mask: read_u32(params.sq_off.ring_mask),
+            submission_queue_entries: read_u32(params.sq_off.ring_entries),
+            completion_queue_mask: read_u32(params.cq_off.ring_mask),
+            has_submission_queue_polling: self.submission_queue_polling.is_some(),
+            params,
+            file_descriptor,
+            rings,
+            sqes,
+            internals: UnsafeCell::new(Internals {
+                attachments: vec![],
+                next_generation: 1,
+                readable: vec![],
+                rearm: vec![],
+                poll_fds: vec![],
+                reported: vec![],
+            }),
+        };
+
+        trace!(from io_uring, "created");
+        Ok(io_uring)
+    }
+
+    fn map(
+        &self,
+        file_descriptor: &FileDescriptor,
+        len: usize,
+        offset: posix::off_t,
+    ) -> Result<Mapping, IoUringCreationError> {
+        let address = unsafe {
+            posix::mmap(
+                core::ptr::null_mut(),
+                len,
+                posix::PROT_READ | posix::PROT_WRITE,
+                posix::MAP_SHARED,
+                file_descriptor.native_handle(),
+                offset,
+            )
+        };
+
+        if address != posix::MAP_FAILED {
+            return Ok(Mapping { address, len });
+        }
+
+        let msg = "Unable to map the rings of the IoUring";
+        handle_errno!(IoUringCreationError, from self,
+            Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+}
+
+/// Memory that is shared with the kernel.
+struct Mapping {
+    address: *mut posix::void,
+    len: usize,
+}
+
+impl Mapping {
+    unsafe fn at<T>(&self, offset: u32) -> *mut T {
+        self.address.cast::<u8>().add(offset as usize).cast()
+    }
+}
+
+impl Drop for Mapping {
+    fn drop(&mut self) {
+        if unsafe { posix::munmap(self.address, self.len) } != 0 {
+            warn!(from "IoUring", "Unable to unmap the memory of the rings ({:?}).", Errno::get());
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Attachment {
+    fd: i32,
+    /// Distinguishes the completions of an attachment from the completions of a previously
+    /// detached attachment with the same file descriptor.
+    generation: u32,
+}
+
+struct Internals {
+    /// sorted by file descriptor
+    attachments: Vec<Attachment>,
+    next_generation: u32,
+    /// attachments that were reported readable and not yet confirmed to be drained
+    readable: Vec<i32>,
+    /// attachments whose multishot poll was terminated by the kernel
+    rearm: Vec<Attachment>,
+    poll_fds: Vec<posix::pollfd>,
+    reported: Vec<i32>,
+}
+
+/// A Linux io_uring instance, see the module documentation for details.
+pub struct IoUring {
+    params: posix::io_uring_params,
+    submission_queue_mask: u32,
+    submission_queue_entries: u32,
+    completion_queue_mask: u32,
+    has_submission_queue_polling: bool,
+    file_descriptor: FileDescriptor,
+    rings: Mapping,
+    sqes: Mapping,
+    internals: UnsafeCell<Internals>,
+}
+
+impl Debug for IoUring {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "IoUring {{ file_descriptor: {:?}, has_submission_queue_polling: {}, attachments: {:?} }}",
+            self.file_descriptor,
+            self.has_submission_queue_polling,
+            self.internals().attachments
+        )
+    }
+}
+
+impl FileDescriptorBased for IoUring {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+unsafe impl Send for IoUring {}
+
+impl IoUring {
+    fn internals(&self) -> &Internals {
+        unsafe { &*self.internals.get() }
+    }
+
+    #[allow(clippy::mut_from_ref)]
+    fn internals_mut(&self) -> &mut Internals {
+        unsafe { &mut *self.internals.get() }
+    }
+
+    fn ring_u32(&self, offset: u32) -> &AtomicU32 {
+        unsafe { &*self.rings.at::<AtomicU32>(offset) }
+    }
+
+    /// Returns true when the kernel thread polls the submission queue.
+    pub fn has_submission_queue_polling(&self) -> bool {
+        self.has_submission_queue_polling
+    }
+
+    /// Returns the number of attachments.
+    pub fn len(&self) -> usize {
+        self.internals().attachments.len()
+    }
+
+    /// Returns true when nothing is attached, otherwise false.
+    pub fn is_empty(&self) -> bool {
+        self.internals().attachments.is_empty()
+    }
+
+    /// Attaches a file descriptor. Afterwards, the wait calls report it whenever it is
+    /// readable.
+    pub fn attach<T: SynchronousMultiplexing + ?Sized>(
+        &self,
+        fd: &T,
+    ) -> Result<(), IoUringAttachmentError> {
+        let msg = "Unable to attach file descriptor";
+        let raw_fd = unsafe { fd.file_descriptor().native_handle() };
+        let internals = self.internals_mut();
+        let index = match internals
+            .attachments
+            .binary_search_by_key(&raw_fd, |a| a.fd)
+        {
+            Ok(_) => {
+                fail!(from self, with IoUringAttachmentError::AlreadyAttached,
+                    "{msg} {:?} since it is already attached.", fd.file_descriptor());
+            }
+            Err(index) => index,
+        };
+
+        let attachment = Attachment {
+            fd: raw_fd,
+            generation: internals.next_generation,
+        };
+        internals.next_generation = internals.next_generation.checked_add(1).unwrap_or(1);
+        // registered before the submission, otherwise completions that are reaped during the
+        // submission would be discarded
+        internals.attachments.insert(index, attachment);
+
+        if let Err(e) = self.push(&Self::poll_add_request(&attachment)) {
+            self.internals_mut().attachments.remove(index);
+            fail!(from self, with Self::attachment_error(e),
+                "{msg} {:?} since the poll request could not be submitted ({:?}).", fd.file_descriptor(), e);
+        }
+
+        Ok(())
+    }
+
+    fn attachment_error(errno: Errno) -> IoUringAttachmentError {
+        match errno {
+            Errno::EAGAIN | Errno::EBUSY | Errno::ENOMEM => {
+                IoUringAttachmentError::InsufficientResources
+            }
+            v => IoUringAttachmentError::UnknownError(v as i32),
+        }
+    }
+
+    /// Detaches a previously attached file descriptor.
+    pub fn detach<T: SynchronousMultiplexing + ?Sized>(
+        &self,
+        fd: &T,
+    ) -> Result<(), IoUringDetachmentError> {
+        let msg = "Unable to detach file descriptor";
+        let raw_fd = unsafe { fd.file_descriptor().native_handle() };
+        let internals = self.internals_mut();
+        let attachment = match internals
+            .attachments
+            .binary_search_by_key(&raw_fd, |a| a.fd)
+        {
+            Ok(index) => internals.attachments.remove(index),
+            Err(_) => {
+                fail!(from self, with IoUringDetachmentError::NotAttached,
+                    "{msg} {:?} since it is not attached.", fd.file_descriptor());
+            }
+        };
+        internals.readable.retain(|&v| v != raw_fd);
+        internals.rearm.retain(|v| v.fd != raw_fd);
+
+        let mut request = posix::io_uring_sqe::new_zeroed();
+        request.opcode = posix::IORING_OP_POLL_REMOVE;
+        request.fd = -1;
+        request.addr = user_data(&attachment);
+        request.user_data = REMOVAL_USER_DATA;
+
+        if let Err(e) = self.push(&request) {
+            let error = match e {
+                Errno::EAGAIN | Errno::EBUSY | Errno::ENOMEM => {
+                    IoUringDetachmentError::InsufficientResources
+                }
+                v => IoUringDetachmentError::UnknownError(v as i32),
+            };
+            fail!(from self, with error,
+                "{msg} {:?} since the removal request could not be submitted ({:?}). The kernel keeps a reference to the file until the IoUring is dropped.",
+                fd.file_descriptor(), e);
+        }
+
+        Ok(())
+    }
+
+    /// Calls the provided callback for every attachment that is readable without blocking.
+    /// Returns the number of readable attachments.
+    pub fn try_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(Some(Duration::ZERO), fd_callback)
+    }
+
+    /// Blocks until either at least one attachment is readable or the timeout has passed.
+    /// Calls the provided callback for every readable attachment and returns their number.
+    pub fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Duration,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(Some(timeout), fd_callback)
+    }
+
+    /// Blocks until at least one attachment is readable. Calls the provided callback for every
+    /// readable attachment and returns their number.
+    pub fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait(None, fd_callback)
+    }
+
+    fn wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        timeout: Option<Duration>,
+        mut fd_callback: F,
+    ) -> Result<usize, IoUringWaitError> {
+        let msg = "Failure while waiting on IoUring";
+        let start = match timeout {
+            Some(timeout) if !timeout.is_zero() => Some(fail!(from self, when Time::now(),
+                    with IoUringWaitError::UnknownError(0),
+                    "{msg} since the current time could not be acquired.")),
+            _ => None,
+        };
+
+        loop {
+            self.reap();
+            self.rearm();
+
+            if self.update_readable() > 0 {
+                let mut reported = core::mem::take(&mut self.internals_mut().reported);
+                reported.clear();
+                reported.extend_from_slice(&self.internals().readable);
+                for fd in &reported {
+                    let fd = FileDescriptor::non_owning_new(*fd).unwrap();
+                    fd_callback(&fd);
+                }
+                let number_of_readable = reported.len();
+                self.internals_mut().reported = reported;
+                return Ok(number_of_readable);
+            }
+
+            let remaining = match (timeout, &start) {
+                (None, _) => None,
+                (Some(_), None) => return Ok(0),
+                (Some(timeout), Some(start)) => {
+                    let elapsed = fail!(from self, when start.elapsed(),
+                        with IoUringWaitError::UnknownError(0),
+                        "{msg} since the elapsed time could not be acquired.");
+                    if elapsed >= timeout {
+                        return Ok(0);
+                    }
+                    Some(timeout - elapsed)
+                }
+            };
+
+            self.wait_for_completion(remaining)?;
+        }
+    }
+
+    fn wait_for_completion(&self, timeout: Option<Duration>) -> Result<(), IoUringWaitError> {
+        let mut timespec = posix::__kernel_timespec::new_zeroed();
+        let mut arg = posix::io_uring_getevents_arg::new_zeroed();
+        let (flags, arg_ptr, arg_len) = match timeout {
+            None => (posix::IORING_ENTER_GETEVENTS, core::ptr::null(), 0),
+            Some(timeout) => {
+                timespec.tv_sec = timeout.as_secs().min(i64::MAX as u64) as i64;
+                timespec.tv_nsec = timeout.subsec_nanos() as i64;
+                arg.sigmask_sz = 8;
+                arg.ts = (&timespec as *const posix::__kernel_timespec) as u64;
+                (
+                    posix::IORING_ENTER_GETEVENTS | posix::IORING_ENTER_EXT_ARG,
+                    (&arg as *const posix::io_uring_getevents_arg).cast(),
+                    size_of::<posix::io_uring_getevents_arg>(),
+                )
+            }
+        };
+
+        if self.enter(1, flags, arg_ptr, arg_len) >= 0 {
+            return Ok(());
+        }
+
+        let msg = "Failure while waiting on IoUring";
+        handle_errno!(IoUringWaitError, from self,
+            success Errno::ETIME => ();
+            success Errno::EBUSY => ();
+            success Errno::EAGAIN => (),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+
+    /// Moves all attachments with a completion into the readable set.
+    fn reap(&self) {
+        let internals = self.internals_mut();
+        let completion_queue_head = self.ring_u32(self.params.cq_off.head);
+        let completion_queue_tail = self.ring_u32(self.params.cq_off.tail);
+        let completions = unsafe {
+            self.rings
+                .at::<posix::io_uring_cqe>(self.params.cq_off.cqes)
+        };
+
+        let mut head = completion_queue_head.load(Ordering::Relaxed);
+        let tail = completion_queue_tail.load(Ordering::Acquire);
+        while head != tail {
+            let completion =
+                unsafe { *completions.add((head & self.completion_queue_mask) as usize) };
+            head = head.wrapping_add(1);
+
+            if completion.user_data == REMOVAL_USER_DATA {
+                continue;
+            }
+
+            let fd = completion.user_data as u32 as i32;
+            let attachment = match internals.attachments.binary_search_by_key(&fd, |a| a.fd) {
+                Ok(index) if user_data(&internals.attachments[index]) == completion.user_data => {
+                    internals.attachments[index]
+                }
+                // completion of a detached attachment
+                _ => continue,
+            };
+
+            if completion.res >= 0 && !internals.readable.contains(&fd) {
+                internals.readable.push(fd);
+            }
+
+            if completion.flags & posix::IORING_CQE_F_MORE == 0 {
+                if completion.res >= 0 {
+                    // the kernel terminates multishot polls for instance when the completion
+                    // queue overflows
+                    internals.rearm.push(attachment);
+                } else {
+                    warn!(from self,
+                        "The poll request of the file descriptor {} failed ({}), it will not be reported anymore.",
+                        fd, -completion.res);
+                }
+            }
+        }
+
+        completion_queue_head.store(head, Ordering::Release);
+    }
+
+    fn rearm(&self) {
+        while let Some(attachment) = self.internals_mut().rearm.pop() {
+            if let Err(e) = self.push(&Self::poll_add_request(&attachment)) {
+                warn!(from self,
+                    "Unable to renew the poll request of the file descriptor {} ({:?}), it will not be reported anymore.",
+                    attachment.fd, e);
+            }
+        }
+    }
+
+    /// Removes all attachments from the readable set that are not readable anymore and returns
+    /// the number of remaining ones.
+    fn update_readable(&self) -> usize {
+        let Internals {
+            readable, poll_fds, ..
+        } = self.internals_mut();
+
+        if readable.is_empty() {
+            return 0;
+        }
+
+        poll_fds.clear();
+        for fd in readable.iter() {
+            let mut poll_fd = posix::pollfd::new_zeroed();
+            poll_fd.fd = *fd;
+            poll_fd.events = posix::POLLIN;
+            poll_fds.push(poll_fd);
+        }
+
+        // on failure the readable set stays untouched, a spurious wakeup is reported
+        if unsafe { posix::poll(poll_fds.as_mut_ptr(), poll_fds.len() as _, 0) } >= 0 {
+            readable.clear();
+            for poll_fd in poll_fds.iter() {
+                if poll_fd.revents & (posix::POLLIN | posix::POLLERR | posix::POLLHUP) != 0 {
+                    readable.push(poll_fd.fd);
+                }
+            }
+        }
+
+        readable.len()
+    }
+
+    fn poll_add_request(attachment: &Attachment) -> posix::io_uring_sqe {
+        let events = posix::POLLIN as u16 as u32;
+        // the kernel swaps the half-words of poll32_events on big endian machines
+        #[cfg(target_endian = "big")]
+        let events = events.rotate_left(16);
+
+        let mut request = posix::io_uring_sqe::new_zeroed();
+        request.opcode = posix::IORING_OP_POLL_ADD;
+        request.fd = attachment.fd;
+        request.len = posix::IORING_POLL_ADD_MULTI;
+        request.op_flags = events;
+        request.user_data = user_data(attachment);
+        request
+    }
+
+    /// Appends the request to the submission queue and submits it.
+    fn push(&self, request: &posix::io_uring_sqe) -> Result<(), Errno> {
+        let submission_queue_head = self.ring_u32(self.params.sq_off.head);
+        let submission_queue_tail = self.ring_u32(self.params.sq_off.tail);
+
+        let tail = submission_queue_tail.load(Ordering::Relaxed);
+        if tail.wrapping_sub(submission_queue_head.load(Ordering::Acquire))
+            >= self.submission_queue_entries
+        {
+            if self.has_submission_queue_polling {
+                self.wait_for_submission_queue_space()?;
+            } else {
+                self.submit()?;
+            }
+        }
+
+        let index = tail & self.submission_queue_mask;
+        unsafe {
+            self.sqes
+                .address
+                .cast::<posix::io_uring_sqe>()
+                .add(index as usize)
+                .write(*request);
+            self.rings
+                .at::<u32>(self.params.sq_off.array)
+                .add(index as usize)
+                .write(index);
+        }
+        submission_queue_tail.store(tail.wrapping_add(1), Ordering::Release);
+
+        self.submit()
+    }
+
+    /// Blocks in the kernel until the submission queue polling thread consumed at least one
+    /// request of a full submission queue.
+    fn wait_for_submission_queue_space(&self) -> Result<(), Errno> {
+        loop {
+            if self.enter(0, posix::IORING_ENTER_SQ_WAIT, core::ptr::null(), 0) >= 0 {
+                return Ok(());
+            }
+
+            match Errno::get() {
+                Errno::EINTR => (),
+                e => return Err(e),
+            }
+        }
+    }
+
+    /// Hands all queued requests to the kernel. With submission queue polling, the kernel thread
+    /// is only woken up when it sleeps and consumes the requests asynchronously. A poll request
+    /// that is armed after [`IoUring::attach()`] returned still reports an attachment that
+    /// became readable before.
+    fn submit(&self) -> Result<(), Errno> {
+        if self.has_submission_queue_polling {
+            return match self.enter(0, 0, core::ptr::null(), 0) {
+                v if v >= 0 => Ok(()),
+                _ => Err(Errno::get()),
+            };
+        }
+
+        let submission_queue_head = self.ring_u32(self.params.sq_off.head);
+        let submission_queue_tail = self.ring_u32(self.params.sq_off.tail);
+
+        let mut retries = 0;
+        loop {
+            let pending = submission_queue_tail
+                .load(Ordering::Relaxed)
+                .wrapping_sub(submission_queue_head.load(Ordering::Acquire));
+            if pending == 0 {
+                return Ok(());
+            }
+
+            if self.enter(0, 0, core::ptr::null(), 0) >= 0 {
+                continue;
+            }
+
+            match Errno::get() {
+                Errno::EINTR => (),
+                // the completion queue overflowed, reaping makes room for new completions
+                Errno::EBUSY | Errno::EAGAIN if retries < MAX_SUBMISSION_RETRIES => {
+                    retries += 1;
+                    self.reap();
+                }
+                e => return Err(e),
+            }
+        }
+    }
+
+    /// Calls `io_uring_enter` with all pending submissions. With submission queue polling, the
+    /// system call is skipped when neither completions are awaited nor the kernel thread has
+    /// to be woken up.
+    fn enter(&self, min_complete: u32, flags: u32, arg: *const posix::void, argsz: usize) -> i32 {
+        let mut flags = flags;
+        let to_submit = if self.has_submission_queue_polling {
+            // orders the write of the submission queue tail before the read of the flags
+            fence(Ordering::SeqCst);
+            if self
+                .ring_u32(self.params.sq_off.flags)
+                .load(Ordering::Relaxed)
+                & posix::IORING_SQ_NEED_WAKEUP
+                != 0
+            {
+                flags |= posix::IORING_ENTER_SQ_WAKEUP;
+            }
+
+            if flags == 0 {
+                return 0;
+            }
+            0
+        } else {
+            self.ring_u32(self.params.sq_off.tail)
+                .load(Ordering::Relaxed)
+                .wrapping_sub(
+                    self.ring_u32(self.params.sq_off.head)
+                        .load(Ordering::Acquire),
+                )
+        };
+
+        unsafe {
+            posix::io_uring_enter(
+                self.file_descriptor.native_handle(),
+                to_submit,
+                min_complete,
+                flags,
+                arg,
+                argsz,
+            )
+        }
+    }
+}
@@ -46,14 +46,22 @@ pub mod udp_socket;
 pub mod handle_errno;
 pub mod deadline_queue;
 pub mod directory;
+#[cfg(target_os = "linux")]
+pub mod epoll;
+#[cfg(target_os = "linux")]
+pub mod event_fd;
 pub mod file;
 pub mod file_descriptor;
 pub mod file_descriptor_set;
 pub mod file_lock;
 pub mod file_type;
 pub mod group;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod ipc_capable;
 pub mod memory;
+pub mod memory_advice;
+pub mod memory_fd;
 pub mod memory_lock;
 pub mod metadata;
 pub mod mutex;
@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Returns the physical pages of a mapped memory range to the operating system while the range
+//! stays mapped. The next access of a released page maps a zeroed page again.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::memory_advice::*;
+//!
+//! let mut some_memory = vec![0u8; 65536];
+//!
+//! let released_bytes =
+//!     unsafe { release_pages(some_memory.as_mut_ptr(), some_memory.len()) }.unwrap();
+//! println!("released {} bytes", released_bytes);
+//! ```
+
+use crate::handle_errno;
+use crate::system_configuration::SystemInfo;
+use iceoryx2_bb_elementary::math::align;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum MemoryAdviceError {
+    InvalidAddressRange,
+    InsufficientPermissions,
+    UnknownError(i32),
+}
+
+/// Releases all pages that are completely contained in the memory range starting at `address`
+/// with a length of `size`. Partially covered pages at the beginning and the end are not
+/// touched. Shared mappings release the pages of the underlying shared memory so that they no
+/// longer count to the resident memory of any process that maps them. Returns the number of
+/// released bytes, which is zero on platforms that cannot release pages.
+///
+/// # Safety
+///
+///  * the memory range must be mapped in the address space of the process
+///  * the content of the released pages must no longer be required, it reads as zero afterwards
+///
+pub unsafe fn release_pages(address: *mut u8, size: usize) -> Result<usize, MemoryAdviceError> {
+    let page_size = SystemInfo::PageSize.value();
+    let start = align(address as usize, page_size);
+    let end = (address as usize + size) / page_size * page_size;
+    if end <= start {
+        return Ok(0);
+    }
+
+    let len = end - start;
+    if advise_release(start as *mut posix::void, len) == 0 {
+        return Ok(len);
+    }
+
+    let msg = "Unable to release the pages";
+    handle_errno!(MemoryAdviceError, from "release_pages",
+        success Errno::ENOSYS => 0,
+        Errno::ENOMEM => (InvalidAddressRange, "{} since the range beginning from {:#16X} with a length of {} is not completely mapped.", msg, start, len),
+        Errno::EINVAL => (InvalidAddressRange, "{} since the range beginning from {:#16X} with a length of {} cannot be released.", msg, start, len),
+        Errno::EACCES => (InsufficientPermissions, "{} due to insufficient permissions.", msg),
+        Errno::EPERM => (InsufficientPermissions, "{} due to insufficient permissions.", msg),
+        v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+    );
+}
+
+#[cfg(target_os = "linux")]
+unsafe fn advise_release(address: *mut posix::void, len: usize) -> posix::int {
+    // MADV_DONTNEED only drops the mapping of a shared page, the page itself stays in the
+    // shared memory, MADV_REMOVE frees it but is not supported for private mappings
+    if posix::madvise(address, len, posix::MADV_REMOVE) == 0 {
+        return 0;
+    }
+
+    match Errno::get() {
+        Errno::EINVAL | Errno::ENOTSUP => posix::madvise(address, len, posix::MADV_DONTNEED),
+        _ => -1,
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+unsafe fn advise_release(address: *mut posix::void, len: usize) -> posix::int {
+    posix::madvise(address, len, posix::MADV_DONTNEED)
+}
@@ -0,0 +1,305 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Abstraction of file descriptor based memory like a Linux memfd. A [`MemoryFd`] is a shared
+//! mapping of the whole memory region of a [`FileDescriptor`]. It can be created as new
+//! anonymous memfd with the [`MemoryFdBuilder`], on platforms that support it, or it can map a
+//! region that was allocated by
+//! someone else, like a driver or another process that transferred the [`FileDescriptor`] via
+//! [`crate::socket_ancillary::SocketAncillary`], with [`MemoryFd::from_file_descriptor()`].
+//!
+//! In contrast to the [`crate::shared_memory::SharedMemory`] the region has no name in the file
+//! system, it exists as long as a [`FileDescriptor`] or a mapping refers to it.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::memory_fd::*;
+//! use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+//! use iceoryx2_bb_system_types::file_name::FileName;
+//! use iceoryx2_bb_container::semantic_string::*;
+//!
+//! let name = FileName::new(b"frame_buffers").unwrap();
+//! let mut memory = MemoryFdBuilder::new(&name).size(4096).create().unwrap();
+//! memory.as_mut_slice()[0] = 123;
+//!
+//! // a second mapping of the same region, for instance in another process
+//! let view = MemoryFd::from_file_descriptor(
+//!     memory.file_descriptor().clone(),
+//!     AccessMode::Read,
+//! )
+//! .unwrap();
+//! assert_eq!(view.size(), 4096);
+//! assert_eq!(view.as_slice()[0], 123);
+//! ```
+
+use core::ptr::NonNull;
+
+use crate::file::{FileStatError, FileTruncateError};
+use crate::file_descriptor::*;
+use crate::handle_errno;
+use iceoryx2_bb_container::semantic_string::*;
+use iceoryx2_bb_elementary::enum_gen;
+use iceoryx2_bb_log::{fail, fatal_panic, trace};
+use iceoryx2_bb_system_types::file_name::*;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+pub use crate::access_mode::AccessMode;
+
+enum_gen! {
+    /// Defines the errors that can occur when an existing memory region is mapped with
+    /// [`MemoryFd::from_file_descriptor()`].
+    MemoryFdMapError
+  entry:
+    UnsupportedSizeOfZero,
+    UnsupportedFileDescriptor,
+    InsufficientPermissions,
+    InsufficientMemory,
+    MappedRegionLimitReached,
+    UnknownError(i32)
+  mapping:
+    FileStatError
+}
+
+enum_gen! {
+    /// Defines the errors that can occur when a new memfd is created with
+    /// [`MemoryFdBuilder::create()`].
+    MemoryFdCreationError
+  entry:
+    NotSupportedByPlatform,
+    InvalidName,
+    InsufficientMemory,
+    InsufficientPermissions,
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    FileDescriptorBroken,
+    UnknownError(i32)
+  mapping:
+    FileTruncateError,
+    MemoryFdMapError
+}
+
+enum_gen! {
+    /// Defines the errors that can occur when a read-only [`FileDescriptor`] of a [`MemoryFd`]
+    /// is acquired with [`MemoryFd::read_only_file_descriptor()`].
+    MemoryFdReopenError
+  entry:
+    NotSupportedByPlatform,
+    InsufficientPermissions,
+    UnsupportedFileDescriptor,
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    FileDescriptorBroken,
+    UnknownError(i32)
+}
+
+/// Creates a new anonymous memfd and maps it, see [`MemoryFd`].
+#[derive(Debug)]
+pub struct MemoryFdBuilder {
+    name: FileName,
+    size: usize,
+}
+
+impl MemoryFdBuilder {
+    /// The name is only used for debugging purposes, like in `/proc/self/fd`, and does not
+    /// need to be unique.
+    pub fn new(name: &FileName) -> Self {
+        Self {
+            name: name.clone(),
+            size: 0,
+        }
+    }
+
+    /// Defines the size of the memory region.
+    pub fn size(mut self, value: usize) -> Self {
+        self.size = value;
+        self
+    }
+
+    /// Creates a new memfd of the given size that is mapped read-write.
+    pub fn create(self) -> Result<MemoryFd, MemoryFdCreationError> {
+        let msg = "Unable to create MemoryFd";
+        let raw_fd = unsafe { posix::memfd_create(self.name.as_c_str(), posix::MFD_CLOEXEC) };
+
+        if raw_fd < 0 {
+            handle_errno!(MemoryFdCreationError, from self,
+                fatal Errno::EFAULT => ("This should never happen! {msg} since the name points to invalid memory."),
+                Errno::EINVAL => (InvalidName, "{msg} since the name \"{}\" is too long.", self.name),
+                Errno::EMFILE => (PerProcessFileHandleLimitReached, "{msg} since the processes file descriptor limit was reached."),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{msg} since the system wide file descriptor limit was reached."),
+                Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+                Errno::EPERM => (InsufficientPermissions, "{msg} due to insufficient permissions."),
+                Errno::ENOSYS => (NotSupportedByPlatform, "{msg} since the platform does not support memfds."),
+                v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+            );
+        }
+
+        let mut file_descriptor = match FileDescriptor::new(raw_fd) {
+            Some(file_descriptor) => file_descriptor,
+            None => {
+                fail!(from self, with MemoryFdCreationError::FileDescriptorBroken,
+                    "This should never happen! {msg} since memfd_create returned a broken file descriptor.");
+            }
+        };
+
+        fail!(from self, when file_descriptor.truncate(self.size),
+            "{msg} since the memory region could not be resized to {} bytes.", self.size);
+
+        let memory = fail!(from self,
+            when MemoryFd::from_file_descriptor(file_descriptor, AccessMode::ReadWrite),
+            "{msg} since the memory region could not be mapped.");
+
+        trace!(from memory, "created");
+        Ok(memory)
+    }
+}
+
+/// A shared mapping of the memory region of a [`FileDescriptor`], see the module documentation
+/// for details.
+#[derive(Debug)]
+pub struct MemoryFd {
+    file_descriptor: FileDescriptor,
+    base_address: *mut u8,
+    size: usize,
+}
+
+unsafe impl Send for MemoryFd {}
+unsafe impl Sync for MemoryFd {}
+
+impl Drop for MemoryFd {
+    fn drop(&mut self) {
+        if unsafe { posix::munmap(self.base_address as *mut posix::void, self.size) } != 0 {
+            fatal_panic!(from self, "This should never happen! Unable to unmap since the base address or range is invalid.");
+        }
+        trace!(from self, "close");
+    }
+}
+
+impl FileDescriptorBased for MemoryFd {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl MemoryFd {
+    /// Takes ownership of a [`FileDescriptor`] that refers to a memory region, like a memfd, a
+    /// POSIX shared memory object or a dma-buf, and maps the whole region with the given
+    /// [`AccessMode`]. The size of the region is acquired from the [`FileDescriptor`].
+    pub fn from_file_descriptor(
+        file_descriptor: FileDescriptor,
+        access_mode: AccessMode,
+    ) -> Result<Self, MemoryFdMapError> {
+        let msg = "Unable to map MemoryFd";
+        let origin = "MemoryFd::from_file_descriptor()";
+        let size = fail!(from origin, when file_descriptor.metadata(),
+            "{msg} since the size of the memory region could not be acquired.")
+        .size() as usize;
+
+        if size == 0 {
+            fail!(from origin, with MemoryFdMapError::UnsupportedSizeOfZero,
+                "{msg} since the memory region of {:?} has a size of zero.", file_descriptor);
+        }
+
+        let base_address = unsafe {
+            posix::mmap(
+                core::ptr::null_mut::<posix::void>(),
+                size,
+                access_mode.as_protflag(),
+                posix::MAP_SHARED,
+                file_descriptor.native_handle(),
+                0,
+            )
+        };
+
+        if !core::ptr::eq(base_address, posix::MAP_FAILED) {
+            let memory = Self {
+                file_descriptor,
+                base_address: base_address as *mut u8,
+                size,
+            };
+            trace!(from memory, "mapped");
+            return Ok(memory);
+        }
+
+        handle_errno!(MemoryFdMapError, from origin,
+            Errno::EACCES => (InsufficientPermissions, "{msg} since the file descriptor was not opened with the access mode {:?}.", access_mode),
+            Errno::ENODEV => (UnsupportedFileDescriptor, "{msg} since the file descriptor does not support memory mapping."),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} since the system is out-of-memory or does not support a mapping with the size of {size}."),
+            Errno::EMFILE => (MappedRegionLimitReached, "{msg} since the number of mapped regions would exceed the process or system limit."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        );
+    }
+
+    /// Returns the start address of the mapping. It is aligned to the page size.
+    pub fn base_address(&self) -> NonNull<u8> {
+        match NonNull::new(self.base_address) {
+            Some(v) => v,
+            None => {
+                fatal_panic!(from self,
+                    "This should never happen! A valid memory mapping should never have a base address with null value.");
+            }
+        }
+    }
+
+    /// Returns the size of the memory region.
+    pub fn size(&self) -> usize {
+        self.size
+    }
+
+    /// Opens the memory region again via `/proc/self/fd` and returns a [`FileDescriptor`] that
+    /// permits only reading. A process that is given this [`FileDescriptor`] can neither write
+    /// into the region nor map it writable. Fails with
+    /// [`MemoryFdReopenError::NotSupportedByPlatform`] on platforms without `/proc/self/fd`.
+    pub fn read_only_file_descriptor(&self) -> Result<FileDescriptor, MemoryFdReopenError> {
+        let msg = "Unable to acquire a read-only file descriptor of the MemoryFd";
+        let path = format!("/proc/self/fd/{}\0", unsafe {
+            self.file_descriptor.native_handle()
+        });
+        let raw_fd = unsafe {
+            posix::open(
+                path.as_ptr() as *const posix::c_char,
+                AccessMode::Read.as_oflag(),
+            )
+        };
+
+        if raw_fd < 0 {
+            handle_errno!(MemoryFdReopenError, from self,
+                Errno::ENOENT => (NotSupportedByPlatform, "{msg} since the platform does not provide /proc/self/fd."),
+                Errno::EACCES => (InsufficientPermissions, "{msg} due to insufficient permissions."),
+                Errno::ENXIO => (UnsupportedFileDescriptor, "{msg} since the file descriptor cannot be opened again, like a dma-buf."),
+                Errno::EMFILE => (PerProcessFileHandleLimitReached, "{msg} since the processes file descriptor limit was reached."),
+                Errno::ENFILE => (SystemWideFileHandleLimitReached, "{msg} since the system wide file descriptor limit was reached."),
+                v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+            );
+        }
+
+        match FileDescriptor::new(raw_fd) {
+            Some(file_descriptor) => Ok(file_descriptor),
+            None => {
+                fail!(from self, with MemoryFdReopenError::FileDescriptorBroken,
+                    "This should never happen! {msg} since open returned a broken file descriptor.");
+            }
+        }
+    }
+
+    /// Returns a slice to the memory.
+    pub fn as_slice(&self) -> &[u8] {
+        unsafe { core::slice::from_raw_parts(self.base_address, self.size) }
+    }
+
+    /// Returns a mutable slice to the memory. Must only be used when the memory was mapped
+    /// with [`AccessMode::Write`] or [`AccessMode::ReadWrite`].
+    pub fn as_mut_slice(&mut self) -> &mut [u8] {
+        unsafe { core::slice::from_raw_parts_mut(self.base_address, self.size) }
+    }
+}
@@ -12,7 +12,9 @@
 
 //! Provides a POSIX [`Scheduler`] abstraction.
 
+use crate::handle_errno;
 use iceoryx2_bb_log::{fail, fatal_panic, warn};
+use iceoryx2_pal_posix::posix::errno::Errno;
 use iceoryx2_pal_posix::*;
 
 use crate::config::DEFAULT_SCHEDULER;
@@ -22,6 +24,13 @@ pub enum SchedulerConversionError {
     UnknownScheduler,
 }
 
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum SchedulerApplyError {
+    InsufficientPermissions,
+    InvalidPriority,
+    UnknownError(i32),
+}
+
 /// Represents the scheduler in a POSIX system.
 #[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
 #[repr(i32)]
@@ -54,6 +63,29 @@ impl Scheduler {
         (self.max_priority() - self.min_priority()).unsigned_abs() as u8
     }
 
+    /// Applies the [`Scheduler`] with the given priority to the calling thread whereby `0`
+    /// represents the lowest and `255` the highest priority. The priority is mapped to the
+    /// scheduler dependent priority range.
+    ///
+    /// On Linux only the calling thread is affected, on other platforms the setting may apply
+    /// to the whole process. Realtime schedulers like [`Scheduler::Fifo`] usually require
+    /// elevated privileges, e.g. `CAP_SYS_NICE`.
+    pub fn apply_to_calling_thread(&self, priority: u8) -> Result<(), SchedulerApplyError> {
+        let msg = "Unable to apply scheduler to the calling thread";
+        let mut param = posix::sched_param::new_zeroed();
+        param.sched_priority = self.policy_specific_priority(priority);
+
+        if unsafe { posix::sched_setscheduler(0, *self as i32, &param) } != -1 {
+            return Ok(());
+        }
+
+        handle_errno!(SchedulerApplyError, from self,
+            Errno::EPERM => (InsufficientPermissions, "{} {:?} with priority {} due to insufficient permissions.", msg, self, priority),
+            Errno::EINVAL => (InvalidPriority, "{} {:?} since the priority {} is not supported by the scheduler.", msg, self, priority),
+            v => (UnknownError(v as i32), "{} {:?} since an unknown error occurred ({}).", msg, self, v)
+        );
+    }
+
     fn min_priority(&self) -> i32 {
         match unsafe { posix::sched_get_priority_min(*self as i32) } {
             -1 => {
@@ -64,7 +96,7 @@ impl Scheduler {
     }
 
     fn max_priority(&self) -> i32 {
-        match unsafe { posix::sched_get_priority_min(*self as i32) } {
+        match unsafe { posix::sched_get_priority_max(*self as i32) } {
             -1 => {
                 fatal_panic!("This should never happen! Unable to acquire maximum priority for scheduler {:#?}.", self);
             }
@@ -71,10 +71,11 @@
 //! // cleanup
 //! File::remove(&file_name);
 //! ```
-use crate::{
-    file_descriptor::FileDescriptor, process::*, unix_datagram_socket::UnixDatagramReceiver,
+use crate::{file_descriptor::FileDescriptor, process::*};
+use core::{
+    fmt::{Debug, Display},
+    marker::PhantomPinned,
 };
-use core::{fmt::Display, marker::PhantomPinned};
 use iceoryx2_bb_log::warn;
 use iceoryx2_pal_posix::{posix::MemZeroedStruct, *};
 
@@ -165,8 +166,10 @@ impl Display for SocketCred {
 }
 
 /// Represents a message which can be sent or received via
-/// [`crate::unix_datagram_socket::UnixDatagramSender::try_send_msg()`] or
-/// [`crate::unix_datagram_socket::UnixDatagramReceiver::try_receive_msg()`].
+/// [`crate::unix_datagram_socket::UnixDatagramSender::try_send_msg()`],
+/// [`crate::unix_datagram_socket::UnixDatagramReceiver::try_receive_msg()`],
+/// [`crate::socket_pair::StreamingSocket::try_send_msg()`] or
+/// [`crate::socket_pair::StreamingSocket::try_receive_msg()`].
 pub struct SocketAncillary {
     message_buffer: [u8; BUFFER_CAPACITY],
     iovec_buffer: [u8; IOVEC_BUFFER_CAPACITY],
@@ -332,7 +335,7 @@ impl SocketAncillary {
         self.message.msg_controllen as _
     }
 
-    pub(crate) fn extract_received_data(&mut self, receiver: &UnixDatagramReceiver) {
+    pub(crate) fn extract_received_data<T: Debug>(&mut self, receiver: &T) {
         let mut cmsghdr = unsafe { posix::CMSG_FIRSTHDR(&self.message) };
 
         loop {
@@ -37,6 +37,7 @@ use crate::{
     file_descriptor::{FileDescriptor, FileDescriptorBased},
     file_descriptor_set::SynchronousMultiplexing,
     handle_errno,
+    socket_ancillary::SocketAncillary,
 };
 
 const BLOCKING_TIMEOUT: Duration = Duration::from_secs(i16::MAX as _);
@@ -244,6 +245,17 @@ impl StreamingSocket {
         )
     }
 
+    /// Takes ownership of a [`FileDescriptor`] that refers to one end of a streaming socket
+    /// pair, for instance one that was received from another process via
+    /// [`StreamingSocket::try_receive_msg()`]. When [`StreamingSocket`] goes out of scope the
+    /// file descriptor is closed.
+    pub fn from_file_descriptor(file_descriptor: FileDescriptor) -> StreamingSocket {
+        StreamingSocket {
+            file_descriptor,
+            is_non_blocking: IoxAtomicBool::new(false),
+        }
+    }
+
     /// Duplicates a [`StreamingSocket`]. It is connected to all existing sockets.
     pub fn duplicate(&self) -> Result<StreamingSocket, StreamingSocketDuplicateError> {
         let origin = "StreamingSocket::duplicate()";
@@ -482,6 +494,77 @@ impl StreamingSocket {
         self.receive_impl("Unable to try receiving message", buf, 0)
     }
 
+    /// Tries to send a [`SocketAncillary`] message that can contain [`FileDescriptor`]s. It does
+    /// not block, when the buffer is full it returns `false`, otherwise `true`.
+    pub fn try_send_msg(
+        &self,
+        socket_msg: &mut SocketAncillary,
+    ) -> Result<bool, StreamingSocketPairSendError> {
+        let msg = "Unable to try sending ancillary message";
+        fail!(from self, when self.set_non_blocking(true),
+            "{msg} since the socket could not be set into non-blocking mode");
+
+        socket_msg.prepare_for_send();
+        let bytes_sent =
+            unsafe { posix::sendmsg(self.file_descriptor.native_handle(), socket_msg.get(), 0) };
+
+        if 0 < bytes_sent {
+            return Ok(true);
+        }
+
+        handle_errno!(StreamingSocketPairSendError, from self,
+            success Errno::EAGAIN => false,
+            fatal Errno::EBADF => ("This should never happen! {msg} since the internal file descriptor was invalid..");
+            fatal Errno::EINVAL => ("This should never happen! {msg} since an internal argument was invalid."),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            Errno::ECONNRESET => (ConnectionReset, "{msg} since the connection was reset."),
+            Errno::EPIPE => (Disconnected, "{msg} since the socket is no longer connected."),
+            Errno::ENOBUFS => (InsufficientResources, "{msg} due to insufficient resources."),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+
+    /// Tries to receive a [`SocketAncillary`] message that can contain [`FileDescriptor`]s. It
+    /// does not block, when no message is available it returns `false`, otherwise `true`.
+    pub fn try_receive_msg(
+        &self,
+        socket_msg: &mut SocketAncillary,
+    ) -> Result<bool, StreamingSocketPairReceiveError> {
+        let msg = "Unable to try receiving ancillary message";
+        fail!(from self, when self.set_non_blocking(true),
+            "{msg} since the socket could not be set into non-blocking mode");
+
+        socket_msg.clear();
+        let bytes_received = unsafe {
+            posix::recvmsg(
+                self.file_descriptor.native_handle(),
+                socket_msg.get_mut(),
+                0,
+            )
+        };
+
+        if 0 < bytes_received {
+            socket_msg.extract_received_data(self);
+            return Ok(true);
+        }
+
+        if bytes_received == 0 {
+            return Ok(false);
+        }
+
+        handle_errno!(StreamingSocketPairReceiveError, from self,
+            success Errno::EAGAIN => false,
+            fatal Errno::EBADF => ("This should never happen! {msg} since the internal file descriptor was invalid.");
+            fatal Errno::EINVAL => ("This should never happen! {msg} since an internal argument was invalid."),
+            Errno::EINTR => (Interrupt, "{msg} since an interrupt signal was received."),
+            Errno::ECONNRESET => (ConnectionReset, "{msg} since the connection was reset."),
+            Errno::ENOBUFS => (InsufficientResources, "{msg} due to insufficient resources."),
+            Errno::ENOMEM => (InsufficientMemory, "{msg} due to insufficient memory."),
+            v => (UnknownError(v as i32), "{msg} since an unknown error occurred ({v}).")
+        )
+    }
+
     /// Tries to peek date without removing it from the internal buffer. It does not block, when
     /// the buffer is empty it returns `0`, otherwise it returns the number of bytes that were
     /// received.
@@ -133,6 +133,10 @@ pub enum UdpSendError {
     UnknownError(i32),
 }
 
+/// The maximum number of datagrams that are handed to the operating system with one call.
+#[cfg(target_os = "linux")]
+const MAX_BATCH_SIZE: usize = 64;
+
 fn create_sockaddr(address: Ipv4Address, port: Port) -> posix::sockaddr_in {
     let mut addr = posix::sockaddr_in::new_zeroed();
     addr.sin_family = posix::AF_INET as _;
@@ -460,6 +464,42 @@ impl UdpServer {
         self.socket.send_to(buffer, address, port)
     }
 
+    /// Sends multiple datagrams to a specific [`UdpClient`]. On Linux the datagrams are sent
+    /// in batches with `sendmmsg`, on all other platforms one by one. Returns the number of
+    /// datagrams sent.
+    pub fn send_batch_to(
+        &self,
+        datagrams: &[&[u8]],
+        address: Ipv4Address,
+        port: Port,
+    ) -> Result<usize, UdpSendError> {
+        self.socket.send_batch_to(datagrams, address, port)
+    }
+
+    /// Tries to receive multiple messages from any UDP client. The `buffer` is divided into
+    /// chunks of `datagram_capacity` bytes and every message is stored in the next chunk. The
+    /// [`ReceiveDetails`] of the messages are stored in `details`. On Linux the messages are
+    /// received in batches with `recvmmsg`, on all other platforms one by one. Returns the
+    /// number of messages received.
+    pub fn try_receive_batch_from(
+        &self,
+        buffer: &mut [u8],
+        datagram_capacity: usize,
+        details: &mut Vec<ReceiveDetails>,
+    ) -> Result<usize, UdpReceiveError> {
+        fail!(from self, when self.socket.set_non_blocking(true),
+            "Unable to try receive a batch from socket since the socket could not activate the non-blocking mode.");
+
+        details.clear();
+        if datagram_capacity == 0 {
+            return Ok(0);
+        }
+
+        self.socket
+            .receive_batch_from(buffer, datagram_capacity, details)?;
+        Ok(details.len())
+    }
+
     /// Tries to receive a message from any UDP client. If no message was received
     /// the method returns [`None`] otherwise [`ReceiveDetails`] that contain the number of bytes
     /// received as well as the origin of the data.
@@ -694,6 +734,162 @@ impl UdpSocket {
         );
     }
 
+    #[cfg(target_os = "linux")]
+    fn receive_batch_from(
+        &self,
+        buffer: &mut [u8],
+        datagram_capacity: usize,
+        details: &mut Vec<ReceiveDetails>,
+    ) -> Result<(), UdpReceiveError> {
+        for batch in buffer.chunks_mut(datagram_capacity * MAX_BATCH_SIZE) {
+            let mut sources = [posix::sockaddr_in::new_zeroed(); MAX_BATCH_SIZE];
+            let mut iovecs = [posix::iovec::new_zeroed(); MAX_BATCH_SIZE];
+            let mut messages = [posix::mmsghdr::new_zeroed(); MAX_BATCH_SIZE];
+
+            let mut number_of_datagrams = 0;
+            for (i, datagram) in batch.chunks_exact_mut(datagram_capacity).enumerate() {
+                iovecs[i].iov_base = datagram.as_mut_ptr() as *mut posix::void;
+                iovecs[i].iov_len = datagram.len();
+                messages[i].msg_hdr.msg_name =
+                    (&mut sources[i] as *mut posix::sockaddr_in) as *mut posix::void;
+                messages[i].msg_hdr.msg_namelen = core::mem::size_of::<posix::sockaddr_in>() as _;
+                messages[i].msg_hdr.msg_iov = &mut iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                number_of_datagrams += 1;
+            }
+
+            if number_of_datagrams == 0 {
+                return Ok(());
+            }
+
+            let number_of_received_datagrams = unsafe {
+                posix::recvmmsg(
+                    self.socket_fd.native_handle(),
+                    messages.as_mut_ptr(),
+                    number_of_datagrams as _,
+                    0,
+                    core::ptr::null_mut(),
+                )
+            };
+
+            if number_of_received_datagrams < 0 {
+                let msg = "Unable to receive a batch of data";
+                handle_errno!(UdpReceiveError, from self,
+                    success Errno::EAGAIN => (),
+                    Errno::ECONNRESET => (ConnectionReset, "{} since connection was forcibly closed.", msg),
+                    Errno::EINTR => (Interrupt, "{} since an interrupt signal was received.", msg),
+                    Errno::ENOTCONN => (NotConnected, "{} since the socket is not connected.", msg),
+                    Errno::EIO => (IOerror, "{} since an I/O error occurred while reading from the file system.", msg),
+                    Errno::ENOBUFS => (InsufficientResources, "{} due to insufficient resources.", msg),
+                    Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                    v => (UnknownError(v as i32), "{} due to an unknown error({}).", msg, v)
+                );
+            }
+
+            let number_of_received_datagrams = number_of_received_datagrams as usize;
+            for i in 0..number_of_received_datagrams {
+                details.push(ReceiveDetails::new(
+                    messages[i].msg_len as usize,
+                    sources[i],
+                ));
+            }
+
+            if number_of_received_datagrams < number_of_datagrams {
+                return Ok(());
+            }
+        }
+
+        Ok(())
+    }
+
+    #[cfg(not(target_os = "linux"))]
+    fn receive_batch_from(
+        &self,
+        buffer: &mut [u8],
+        datagram_capacity: usize,
+        details: &mut Vec<ReceiveDetails>,
+    ) -> Result<(), UdpReceiveError> {
+        for datagram in buffer.chunks_exact_mut(datagram_capacity) {
+            match self.receive_from(datagram)? {
+                Some(received) => details.push(received),
+                None => return Ok(()),
+            }
+        }
+
+        Ok(())
+    }
+
+    #[cfg(target_os = "linux")]
+    fn send_batch_to(
+        &self,
+        datagrams: &[&[u8]],
+        address: Ipv4Address,
+        port: Port,
+    ) -> Result<usize, UdpSendError> {
+        let addr = create_sockaddr(address, port);
+        for batch in datagrams.chunks(MAX_BATCH_SIZE) {
+            let mut iovecs = [posix::iovec::new_zeroed(); MAX_BATCH_SIZE];
+            let mut messages = [posix::mmsghdr::new_zeroed(); MAX_BATCH_SIZE];
+            for (i, datagram) in batch.iter().enumerate() {
+                iovecs[i].iov_base = datagram.as_ptr() as *mut posix::void;
+                iovecs[i].iov_len = datagram.len();
+                messages[i].msg_hdr.msg_name =
+                    (&addr as *const posix::sockaddr_in) as *mut posix::void;
+                messages[i].msg_hdr.msg_namelen = core::mem::size_of::<posix::sockaddr_in>() as _;
+                messages[i].msg_hdr.msg_iov = &mut iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            // sendmmsg may send only a part of the batch, the rest is sent with the next call
+            let mut number_of_sent_datagrams = 0;
+            while number_of_sent_datagrams < batch.len() {
+                let result = unsafe {
+                    posix::sendmmsg(
+                        self.socket_fd.native_handle(),
+                        messages.as_mut_ptr().add(number_of_sent_datagrams),
+                        (batch.len() - number_of_sent_datagrams) as _,
+                        0,
+                    )
+                };
+
+                if result >= 0 {
+                    number_of_sent_datagrams += result as usize;
+                    continue;
+                }
+
+                let msg = format!("Unable to send a batch of messages to {}:{}", address, port);
+                handle_errno!(UdpSendError, from self,
+                    Errno::ECONNRESET => (ConnectionReset, "{} since the connection was reset.", msg),
+                    Errno::EINTR => (Interrupt, "{} due to an interrupt signal.", msg),
+                    Errno::EMSGSIZE => (MessageTooLarge, "{} since the message is too large to be sent.", msg),
+                    Errno::EHOSTUNREACH => (HostUnreachable, "{} since the host is unreachable.", msg),
+                    Errno::EIO => (IOerror, "{} due to an IO failure.", msg),
+                    Errno::ENETDOWN => (NetworkInterfaceDown, "{} since the required network interface is down.", msg),
+                    Errno::ENETUNREACH => (NoRouteToHost, "{} since there is no route to the specified host.", msg),
+                    Errno::ENOBUFS => (InsufficientResources, "{} due to insufficient resources.", msg),
+                    Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                    v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+                );
+            }
+        }
+
+        Ok(datagrams.len())
+    }
+
+    #[cfg(not(target_os = "linux"))]
+    fn send_batch_to(
+        &self,
+        datagrams: &[&[u8]],
+        address: Ipv4Address,
+        port: Port,
+    ) -> Result<usize, UdpSendError> {
+        for datagram in datagrams {
+            self.send_to(datagram, address, port)?;
+        }
+
+        Ok(datagrams.len())
+    }
+
     fn send(&self, data: &[u8]) -> Result<usize, UdpSendError> {
         let number_of_bytes_sent = unsafe {
             posix::send(
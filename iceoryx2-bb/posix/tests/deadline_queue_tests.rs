@@ -224,4 +224,92 @@ mod deadline_queue {
         let next_deadline = sut.duration_until_next_deadline().unwrap();
         assert_that!(next_deadline, ne Duration::ZERO);
     }
+
+    #[test]
+    fn missed_deadlines_are_reported_in_the_order_they_were_missed() {
+        let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+        let guard_1 = sut
+            .add_deadline_interval(Duration::from_millis(30))
+            .unwrap();
+        let guard_2 = sut
+            .add_deadline_interval(Duration::from_millis(10))
+            .unwrap();
+        let guard_3 = sut
+            .add_deadline_interval(Duration::from_millis(20))
+            .unwrap();
+        let _guard_4 = sut
+            .add_deadline_interval(Duration::from_secs(1000))
+            .unwrap();
+
+        std::thread::sleep(Duration::from_millis(40));
+
+        let mut missed_deadlines = vec![];
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(missed_deadlines, eq vec![guard_2.index(), guard_3.index(), guard_1.index()]);
+    }
+
+    #[test]
+    fn reset_deadline_is_not_missed() {
+        let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+        let guard_1 = sut
+            .add_deadline_interval(Duration::from_millis(100))
+            .unwrap();
+        let guard_2 = sut
+            .add_deadline_interval(Duration::from_millis(100))
+            .unwrap();
+
+        std::thread::sleep(Duration::from_millis(60));
+        guard_1.reset().unwrap();
+        std::thread::sleep(Duration::from_millis(60));
+
+        let mut missed_deadlines = vec![];
+        sut.missed_deadlines(|idx| {
+            missed_deadlines.push(idx);
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(missed_deadlines, eq vec![guard_2.index()]);
+        assert_that!(sut.duration_until_next_deadline().unwrap(), le Duration::from_millis(100));
+    }
+
+    #[test]
+    fn removing_many_deadlines_in_arbitrary_order_works() {
+        const NUMBER_OF_DEADLINES: u64 = 128;
+        let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+        let mut guards = vec![];
+        for n in 0..NUMBER_OF_DEADLINES {
+            guards.push(Some(
+                sut.add_deadline_interval(Duration::from_secs(1000 + (n * 7919) % 97))
+                    .unwrap(),
+            ));
+        }
+        let guard_with_smallest_deadline =
+            sut.add_deadline_interval(Duration::from_secs(100)).unwrap();
+
+        for n in (0..NUMBER_OF_DEADLINES as usize).step_by(3) {
+            guards[n] = None;
+        }
+        for n in (1..NUMBER_OF_DEADLINES as usize).step_by(5) {
+            guards[n] = None;
+        }
+
+        let number_of_remaining_guards = guards.iter().filter(|g| g.is_some()).count();
+        assert_that!(sut.len(), eq number_of_remaining_guards + 1);
+        assert_that!(sut.duration_until_next_deadline().unwrap(), le Duration::from_secs(100));
+
+        drop(guard_with_smallest_deadline);
+        assert_that!(sut.duration_until_next_deadline().unwrap(), ge Duration::from_secs(999));
+
+        guards.clear();
+        assert_that!(sut.is_empty(), eq true);
+    }
 }
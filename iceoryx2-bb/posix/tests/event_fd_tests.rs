@@ -0,0 +1,318 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![cfg(target_os = "linux")]
+
+use core::time::Duration;
+use iceoryx2_bb_posix::epoll::*;
+use iceoryx2_bb_posix::event_fd::*;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+use iceoryx2_bb_posix::file_descriptor_set::*;
+use iceoryx2_bb_posix::io_uring::*;
+use iceoryx2_bb_testing::{assert_that, watchdog::Watchdog};
+use std::{sync::Barrier, time::Instant};
+
+const TIMEOUT: Duration = Duration::from_millis(50);
+
+#[test]
+fn event_fd_try_wait_does_not_block() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new().create().unwrap();
+
+    assert_that!(sut.try_wait(), eq Ok(None));
+}
+
+#[test]
+fn event_fd_accumulates_notifications() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new().create().unwrap();
+
+    for _ in 0..5 {
+        assert_that!(sut.notify(), is_ok);
+    }
+
+    assert_that!(sut.try_wait(), eq Ok(Some(5)));
+    assert_that!(sut.try_wait(), eq Ok(None));
+}
+
+#[test]
+fn event_fd_in_semaphore_mode_decrements_by_one() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new()
+        .semaphore_mode(true)
+        .initial_value(2)
+        .create()
+        .unwrap();
+
+    assert_that!(sut.try_wait(), eq Ok(Some(1)));
+    assert_that!(sut.try_wait(), eq Ok(Some(1)));
+    assert_that!(sut.try_wait(), eq Ok(None));
+}
+
+#[test]
+fn event_fd_timed_wait_blocks_at_least_for_timeout() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new().create().unwrap();
+
+    let start = Instant::now();
+    assert_that!(sut.timed_wait(TIMEOUT), eq Ok(None));
+    assert_that!(start.elapsed(), time_at_least TIMEOUT);
+}
+
+#[test]
+fn event_fd_blocking_wait_wakes_up_on_notify() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new().create().unwrap();
+    let barrier = Barrier::new(2);
+
+    std::thread::scope(|s| {
+        s.spawn(|| {
+            barrier.wait();
+            assert_that!(sut.blocking_wait(), eq Ok(Some(1)));
+        });
+
+        barrier.wait();
+        std::thread::sleep(TIMEOUT);
+        assert_that!(sut.notify(), is_ok);
+    });
+}
+
+#[test]
+fn event_fd_from_file_descriptor_shares_the_counter() {
+    let _watchdog = Watchdog::new();
+    let sut = EventFdBuilder::new().create().unwrap();
+    let sut_clone = EventFd::from_file_descriptor(sut.file_descriptor().clone());
+
+    assert_that!(sut_clone.notify(), is_ok);
+    assert_that!(sut.try_wait(), eq Ok(Some(1)));
+}
+
+#[test]
+fn epoll_becomes_readable_when_attachment_is_readable() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd), is_ok);
+
+    let fd_set = FileDescriptorSet::new();
+    let _guard = fd_set.add(&sut).unwrap();
+
+    let result = fd_set.timed_wait(Duration::ZERO, FileEvent::Read, |_| {});
+    assert_that!(result, eq Ok(0));
+
+    assert_that!(event_fd.notify(), is_ok);
+    let result = fd_set.timed_wait(TIMEOUT, FileEvent::Read, |_| {});
+    assert_that!(result, eq Ok(1));
+
+    assert_that!(event_fd.try_wait(), eq Ok(Some(1)));
+    let result = fd_set.timed_wait(Duration::ZERO, FileEvent::Read, |_| {});
+    assert_that!(result, eq Ok(0));
+}
+
+#[test]
+fn epoll_attach_twice_fails() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd = EventFdBuilder::new().create().unwrap();
+
+    assert_that!(sut.attach(&event_fd), is_ok);
+    assert_that!(sut.attach(&event_fd).err(), eq Some(EpollAttachmentError::AlreadyAttached));
+}
+
+#[test]
+fn epoll_detach_works() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd = EventFdBuilder::new().create().unwrap();
+
+    assert_that!(sut.attach(&event_fd), is_ok);
+    assert_that!(sut.detach(&event_fd), is_ok);
+    assert_that!(sut.detach(&event_fd).err(), eq Some(EpollDetachmentError::NotAttached));
+
+    assert_that!(event_fd.notify(), is_ok);
+    let fd_set = FileDescriptorSet::new();
+    let _guard = fd_set.add(&sut).unwrap();
+    let result = fd_set.timed_wait(Duration::ZERO, FileEvent::Read, |_| {});
+    assert_that!(result, eq Ok(0));
+}
+
+#[test]
+fn epoll_try_wait_reports_only_readable_attachments() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd_1 = EventFdBuilder::new().create().unwrap();
+    let event_fd_2 = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd_1), is_ok);
+    assert_that!(sut.attach(&event_fd_2), is_ok);
+
+    assert_that!(sut.try_wait(|_| {}), eq Ok(0));
+
+    assert_that!(event_fd_2.notify(), is_ok);
+    let mut triggered_fds = vec![];
+    let result = sut.try_wait(|fd| triggered_fds.push(unsafe { fd.native_handle() }));
+    assert_that!(result, eq Ok(1));
+    assert_that!(triggered_fds, len 1);
+    assert_that!(triggered_fds[0], eq unsafe { event_fd_2.file_descriptor().native_handle() });
+}
+
+#[test]
+fn epoll_timed_wait_blocks_at_least_for_timeout() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd), is_ok);
+
+    let start = Instant::now();
+    assert_that!(sut.timed_wait(TIMEOUT, |_| {}), eq Ok(0));
+    assert_that!(start.elapsed(), time_at_least TIMEOUT);
+}
+
+#[test]
+fn epoll_blocking_wait_wakes_up_on_notify() {
+    let _watchdog = Watchdog::new();
+    let sut = EpollBuilder::new().create().unwrap();
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd), is_ok);
+    let barrier = Barrier::new(2);
+
+    std::thread::scope(|s| {
+        s.spawn(|| {
+            barrier.wait();
+            assert_that!(sut.blocking_wait(|_| {}), eq Ok(1));
+        });
+
+        barrier.wait();
+        std::thread::sleep(TIMEOUT);
+        assert_that!(event_fd.notify(), is_ok);
+    });
+}
+
+/// io_uring may be disabled by the kernel configuration or a seccomp filter, the tests are
+/// skipped in this case.
+fn io_uring() -> Option<IoUring> {
+    match IoUringBuilder::new().create() {
+        Ok(io_uring) => Some(io_uring),
+        Err(IoUringCreationError::NotSupported)
+        | Err(IoUringCreationError::InsufficientPermissions) => None,
+        Err(e) => panic!("Unable to create IoUring ({:?}).", e),
+    }
+}
+
+#[test]
+fn io_uring_attach_twice_fails() {
+    let _watchdog = Watchdog::new();
+    let Some(sut) = io_uring() else { return };
+    let event_fd = EventFdBuilder::new().create().unwrap();
+
+    assert_that!(sut.attach(&event_fd), is_ok);
+    assert_that!(sut.attach(&event_fd).err(), eq Some(IoUringAttachmentError::AlreadyAttached));
+    assert_that!(sut.len(), eq 1);
+}
+
+#[test]
+fn io_uring_detach_works() {
+    let _watchdog = Watchdog::new();
+    let Some(sut) = io_uring() else { return };
+    let event_fd = EventFdBuilder::new().create().unwrap();
+
+    assert_that!(sut.attach(&event_fd), is_ok);
+    assert_that!(sut.detach(&event_fd), is_ok);
+    assert_that!(sut.detach(&event_fd).err(), eq Some(IoUringDetachmentError::NotAttached));
+    assert_that!(sut.is_empty(), eq true);
+
+    assert_that!(event_fd.notify(), is_ok);
+    assert_that!(sut.try_wait(|_| {}), eq Ok(0));
+}
+
+#[test]
+fn io_uring_reports_readable_attachments_until_they_are_drained() {
+    let _watchdog = Watchdog::new();
+    let Some(sut) = io_uring() else { return };
+    let event_fd_1 = EventFdBuilder::new().create().unwrap();
+    let event_fd_2 = EventFdBuilder::new().create().unwrap();
+    assert_that!(event_fd_1.notify(), is_ok);
+    assert_that!(sut.attach(&event_fd_1), is_ok);
+    assert_that!(sut.attach(&event_fd_2), is_ok);
+
+    for _ in 0..3 {
+        let mut triggered_fds = vec![];
+        let result = sut.try_wait(|fd| triggered_fds.push(unsafe { fd.native_handle() }));
+        assert_that!(result, eq Ok(1));
+        assert_that!(triggered_fds[0], eq unsafe { event_fd_1.file_descriptor().native_handle() });
+    }
+
+    assert_that!(event_fd_1.try_wait(), eq Ok(Some(1)));
+    assert_that!(sut.try_wait(|_| {}), eq Ok(0));
+
+    assert_that!(event_fd_2.notify(), is_ok);
+    let mut triggered_fds = vec![];
+    let result = sut.try_wait(|fd| triggered_fds.push(unsafe { fd.native_handle() }));
+    assert_that!(result, eq Ok(1));
+    assert_that!(triggered_fds[0], eq unsafe { event_fd_2.file_descriptor().native_handle() });
+}
+
+#[test]
+fn io_uring_timed_wait_blocks_at_least_for_timeout() {
+    let _watchdog = Watchdog::new();
+    let Some(sut) = io_uring() else { return };
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd), is_ok);
+
+    let start = Instant::now();
+    assert_that!(sut.timed_wait(TIMEOUT, |_| {}), eq Ok(0));
+    assert_that!(start.elapsed(), time_at_least TIMEOUT);
+}
+
+#[test]
+fn io_uring_blocking_wait_wakes_up_on_notify() {
+    let _watchdog = Watchdog::new();
+    let Some(sut) = io_uring() else { return };
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(sut.attach(&event_fd), is_ok);
+    let barrier = Barrier::new(2);
+
+    // the IoUring is not Sync, therefore it is moved into the waiting thread
+    std::thread::scope(|s| {
+        let barrier = &barrier;
+        let t = s.spawn(move || {
+            barrier.wait();
+            assert_that!(sut.blocking_wait(|_| {}), eq Ok(1));
+        });
+
+        barrier.wait();
+        std::thread::sleep(TIMEOUT);
+        assert_that!(event_fd.notify(), is_ok);
+        t.join().unwrap();
+    });
+}
+
+#[test]
+fn io_uring_with_submission_queue_polling_reports_readable_attachments() {
+    let _watchdog = Watchdog::new();
+    let sut = match IoUringBuilder::new()
+        .submission_queue_polling(Duration::from_millis(10))
+        .create()
+    {
+        Ok(sut) => sut,
+        Err(IoUringCreationError::NotSupported)
+        | Err(IoUringCreationError::InsufficientPermissions) => return,
+        Err(e) => panic!("Unable to create IoUring ({:?}).", e),
+    };
+    assert_that!(sut.has_submission_queue_polling(), eq true);
+    let event_fd = EventFdBuilder::new().create().unwrap();
+    assert_that!(event_fd.notify(), is_ok);
+    assert_that!(sut.attach(&event_fd), is_ok);
+
+    assert_that!(sut.timed_wait(TIMEOUT, |_| {}), eq Ok(1));
+    assert_that!(event_fd.try_wait(), eq Ok(Some(1)));
+    assert_that!(sut.try_wait(|_| {}), eq Ok(0));
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_posix::memory_advice::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_testing::assert_that;
+
+#[test]
+fn release_pages_of_range_smaller_than_a_page_releases_nothing() {
+    let page_size = SystemInfo::PageSize.value();
+    let mut some_memory = vec![0xffu8; page_size - 1];
+
+    let sut = unsafe { release_pages(some_memory.as_mut_ptr(), some_memory.len()) };
+
+    assert_that!(sut, eq Ok(0));
+    assert_that!(some_memory.iter().all(|v| *v == 0xff), eq true);
+}
+
+#[test]
+fn release_pages_releases_only_completely_covered_pages() {
+    const NUMBER_OF_PAGES: usize = 8;
+    let page_size = SystemInfo::PageSize.value();
+    let mut some_memory = vec![0xffu8; page_size * NUMBER_OF_PAGES];
+    let start = some_memory.as_mut_ptr() as usize;
+    // start and end in the middle of a page
+    let offset = page_size / 2;
+    let len = page_size * (NUMBER_OF_PAGES - 1);
+
+    let sut = unsafe { release_pages(some_memory.as_mut_ptr().add(offset), len) }.unwrap();
+
+    // windows cannot release the pages of a mapping
+    if cfg!(target_os = "windows") {
+        assert_that!(sut, eq 0);
+        return;
+    }
+
+    assert_that!(sut, mod page_size, is 0);
+    assert_that!(sut, le len);
+    assert_that!(sut, ge len - 2 * page_size);
+
+    // the partially covered pages keep their content
+    let first_released = (start + offset).div_ceil(page_size) * page_size - start;
+    let end_of_released = first_released + sut;
+    for (n, value) in some_memory.iter().enumerate() {
+        if n < first_released || n >= end_of_released {
+            assert_that!(*value, eq 0xff);
+        }
+    }
+}
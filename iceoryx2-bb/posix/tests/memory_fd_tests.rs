@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![cfg(target_os = "linux")]
+
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+use iceoryx2_bb_posix::memory_fd::*;
+use iceoryx2_bb_posix::socket_ancillary::SocketAncillary;
+use iceoryx2_bb_posix::socket_pair::StreamingSocket;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_testing::assert_that;
+
+fn name() -> FileName {
+    FileName::new(b"memory_fd_tests").unwrap()
+}
+
+#[test]
+fn memory_fd_create_works() {
+    let sut = MemoryFdBuilder::new(&name()).size(8192).create().unwrap();
+
+    assert_that!(sut.size(), eq 8192);
+    assert_that!(sut.as_slice().iter().all(|v| *v == 0), eq true);
+}
+
+#[test]
+fn memory_fd_with_size_zero_fails() {
+    let sut = MemoryFdBuilder::new(&name()).create();
+
+    assert_that!(sut.err(), eq Some(MemoryFdCreationError::MemoryFdMapError(
+        MemoryFdMapError::UnsupportedSizeOfZero
+    )));
+}
+
+#[test]
+fn memory_fd_mappings_of_the_same_file_descriptor_share_the_memory() {
+    let mut sut = MemoryFdBuilder::new(&name()).size(4096).create().unwrap();
+    let view =
+        MemoryFd::from_file_descriptor(sut.file_descriptor().clone(), AccessMode::Read).unwrap();
+
+    assert_that!(view.size(), eq sut.size());
+    assert_that!(view.base_address(), ne sut.base_address());
+
+    sut.as_mut_slice()[4095] = 42;
+    assert_that!(view.as_slice()[4095], eq 42);
+}
+
+#[test]
+fn memory_fd_can_be_mapped_after_it_was_transferred_via_a_socket() {
+    let mut sut = MemoryFdBuilder::new(&name()).size(1024).create().unwrap();
+    sut.as_mut_slice()[7] = 99;
+    let (sender, receiver) = StreamingSocket::create_pair().unwrap();
+
+    let mut msg = SocketAncillary::new();
+    msg.add_fd(sut.file_descriptor().clone());
+    assert_that!(sender.try_send_msg(&mut msg), eq Ok(true));
+    drop(msg);
+
+    let mut msg = SocketAncillary::new();
+    assert_that!(receiver.try_receive_msg(&mut msg), eq Ok(true));
+    let fd = msg.extract_fds().into_iter().next().unwrap();
+    drop(sut);
+
+    let view = MemoryFd::from_file_descriptor(fd, AccessMode::ReadWrite).unwrap();
+    assert_that!(view.size(), eq 1024);
+    assert_that!(view.as_slice()[7], eq 99);
+}
+
+#[test]
+fn memory_fd_read_only_file_descriptor_cannot_be_mapped_writable() {
+    let mut sut = MemoryFdBuilder::new(&name()).size(4096).create().unwrap();
+    let fd = sut.read_only_file_descriptor().unwrap();
+
+    let result = MemoryFd::from_file_descriptor(fd.clone(), AccessMode::ReadWrite);
+    assert_that!(result.err(), eq Some(MemoryFdMapError::InsufficientPermissions));
+
+    let view = MemoryFd::from_file_descriptor(fd, AccessMode::Read).unwrap();
+    sut.as_mut_slice()[13] = 37;
+    assert_that!(view.size(), eq 4096);
+    assert_that!(view.as_slice()[13], eq 37);
+}
@@ -11,9 +11,12 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use core::time::Duration;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+use iceoryx2_bb_posix::socket_ancillary::SocketAncillary;
 use iceoryx2_bb_posix::socket_pair::*;
-use iceoryx2_bb_testing::{assert_that, watchdog::Watchdog};
+use iceoryx2_bb_testing::{assert_that, test_requires, watchdog::Watchdog};
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_UNIX_DATAGRAM_SOCKETS_ANCILLARY_DATA;
 use std::{
     sync::{atomic::Ordering, Barrier},
     time::Instant,
@@ -415,3 +418,43 @@ fn multiple_duplicated_sockets_can_send() {
     assert_that!(result.unwrap(), eq send_data_3.len());
     assert_that!(send_data_3, eq received_data);
 }
+
+#[test]
+fn file_descriptors_can_be_transferred() {
+    test_requires!(POSIX_SUPPORT_UNIX_DATAGRAM_SOCKETS_ANCILLARY_DATA);
+    let _watchdog = Watchdog::new();
+
+    let (sut_lhs, sut_rhs) = StreamingSocket::create_pair().unwrap();
+    let (transferred_lhs, transferred_rhs) = StreamingSocket::create_pair().unwrap();
+
+    let mut msg = SocketAncillary::new();
+    assert_that!(msg.add_fd(transferred_rhs.file_descriptor().clone()), eq true);
+    assert_that!(sut_lhs.try_send_msg(&mut msg), eq Ok(true));
+
+    let mut received_msg = SocketAncillary::new();
+    assert_that!(sut_rhs.try_receive_msg(&mut received_msg), eq Ok(true));
+    let mut fds = received_msg.extract_fds();
+    assert_that!(fds, len 1);
+    let received_socket = StreamingSocket::from_file_descriptor(fds.remove(0));
+
+    let send_data = Vec::from(b"!hello hypnotoad!");
+    let result = received_socket.try_send(&send_data);
+    assert_that!(result, eq Ok(send_data.len()));
+
+    let mut received_data = vec![];
+    received_data.resize(send_data.len(), 0);
+    let result = transferred_lhs.try_receive(&mut received_data);
+    assert_that!(result, eq Ok(send_data.len()));
+    assert_that!(send_data, eq received_data);
+}
+
+#[test]
+fn try_receive_msg_never_blocks() {
+    let _watchdog = Watchdog::new();
+
+    let (sut_lhs, _sut_rhs) = StreamingSocket::create_pair().unwrap();
+
+    let mut received_msg = SocketAncillary::new();
+    assert_that!(sut_lhs.try_receive_msg(&mut received_msg), eq Ok(false));
+    assert_that!(received_msg.is_empty(), eq true);
+}
@@ -405,3 +405,38 @@ fn udp_socket_server_timed_receive_from_does_block() {
         assert_that!(send_result, is_ok);
     });
 }
+
+#[test]
+fn udp_socket_server_can_send_and_receive_batches() {
+    const NUMBER_OF_DATAGRAMS: usize = 100;
+    const DATAGRAM_CAPACITY: usize = 16;
+
+    let sut_sender = UdpServerBuilder::new().listen().unwrap();
+    let sut_receiver = UdpServerBuilder::new().listen().unwrap();
+
+    let payloads: Vec<Vec<u8>> = (0..NUMBER_OF_DATAGRAMS)
+        .map(|i| vec![i as u8; i % DATAGRAM_CAPACITY + 1])
+        .collect();
+    let datagrams: Vec<&[u8]> = payloads.iter().map(|p| p.as_slice()).collect();
+    assert_that!(sut_sender.send_batch_to(&datagrams, ipv4_address::LOCALHOST, sut_receiver.port()),
+        eq Ok(NUMBER_OF_DATAGRAMS));
+
+    let mut buffer = vec![0u8; NUMBER_OF_DATAGRAMS * DATAGRAM_CAPACITY];
+    let mut details = vec![];
+    let mut received = vec![];
+    let start = Instant::now();
+    while received.len() < NUMBER_OF_DATAGRAMS && start.elapsed() < TIMEOUT * 40 {
+        let number_of_datagrams = sut_receiver
+            .try_receive_batch_from(&mut buffer, DATAGRAM_CAPACITY, &mut details)
+            .unwrap();
+        assert_that!(details, len number_of_datagrams);
+
+        for (i, detail) in details.iter().enumerate() {
+            assert_that!(detail.source_port, eq sut_sender.port());
+            let offset = i * DATAGRAM_CAPACITY;
+            received.push(buffer[offset..offset + detail.number_of_bytes].to_vec());
+        }
+    }
+
+    assert_that!(received, eq payloads);
+}
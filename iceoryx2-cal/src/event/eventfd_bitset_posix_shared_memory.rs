@@ -0,0 +1,725 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Event`](crate::event::Event) implementation based on a Linux eventfd. The
+//! [`TriggerId`]s are tracked in a bitset in POSIX shared memory and the [`Listener`] is woken up
+//! by an eventfd, so that notifying a connected [`Listener`] costs one atomic operation and a
+//! single `write` syscall.
+//!
+//! The [`Listener`] owns the eventfd and hands it out to every [`Notifier`] via `SCM_RIGHTS`.
+//! A [`Notifier`] sends one end of a socket pair to the unix datagram socket of the
+//! [`Listener`] when it is opened and picks up the eventfd on that socket pair on its first
+//! notifications. The pending request itself wakes up the [`Listener`], therefore
+//! notifications are never lost while the eventfd is still in transit.
+//!
+//! [`Listener::file_descriptor()`](iceoryx2_bb_posix::file_descriptor::FileDescriptorBased)
+//! returns an epoll file descriptor that combines the eventfd and the request socket. It can be
+//! attached to any external epoll or io_uring event loop; whenever it becomes readable one of
+//! the `wait` calls of the [`Listener`] has to be called.
+
+use core::{sync::atomic::Ordering, time::Duration};
+use std::sync::{Mutex, OnceLock};
+
+use crate::dynamic_storage::{
+    self, DynamicStorage, DynamicStorageBuilder, DynamicStorageCreateError, DynamicStorageOpenError,
+};
+use crate::event::id_tracker::IdTracker;
+pub use crate::event::*;
+use crate::static_storage::file::NamedConceptConfiguration;
+use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_lock_free::mpmc::bit_set::RelocatableBitSet;
+use iceoryx2_bb_log::{debug, fail, fatal_panic, warn};
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_posix::{
+    clock::Time,
+    epoll::{Epoll, EpollBuilder},
+    event_fd::{EventFd, EventFdBuilder},
+    file::File,
+    file_descriptor::{FileDescriptor, FileDescriptorBased},
+    file_descriptor_set::{
+        FileDescriptorSet, FileDescriptorSetWaitError, FileEvent, SynchronousMultiplexing,
+    },
+    socket_ancillary::SocketAncillary,
+    socket_pair::StreamingSocket,
+    unix_datagram_socket::*,
+};
+pub use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicUsize};
+
+type SharedMemory = dynamic_storage::posix_shared_memory::Storage<Management>;
+type SharedMemoryBuilder<'builder> =
+    <SharedMemory as DynamicStorage<Management>>::Builder<'builder>;
+
+const TRIGGER_ID_DEFAULT_MAX: TriggerId = TriggerId::new(u16::MAX as _);
+
+#[doc(hidden)]
+#[derive(Debug)]
+#[repr(C)]
+pub struct Management {
+    id_tracker: RelocatableBitSet,
+    reference_counter: IoxAtomicUsize,
+    has_listener: IoxAtomicBool,
+}
+
+#[derive(Clone, PartialEq, Eq, Debug)]
+pub struct Configuration {
+    suffix: FileName,
+    prefix: FileName,
+    path: Path,
+}
+
+impl Default for Configuration {
+    fn default() -> Self {
+        Self {
+            path: Event::default_path_hint(),
+            suffix: Event::default_suffix(),
+            prefix: Event::default_prefix(),
+        }
+    }
+}
+
+impl Configuration {
+    fn convert(&self) -> <SharedMemory as NamedConceptMgmt>::Configuration {
+        <SharedMemory as NamedConceptMgmt>::Configuration::default()
+            .prefix(&self.prefix)
+            .suffix(&self.suffix)
+            .path_hint(&self.path)
+    }
+}
+
+impl NamedConceptConfiguration for Configuration {
+    fn prefix(mut self, value: &FileName) -> Self {
+        self.prefix = value.clone();
+        self
+    }
+
+    fn get_prefix(&self) -> &FileName {
+        &self.prefix
+    }
+
+    fn suffix(mut self, value: &FileName) -> Self {
+        self.suffix = value.clone();
+        self
+    }
+
+    fn path_hint(mut self, value: &Path) -> Self {
+        self.path = value.clone();
+        self
+    }
+
+    fn get_suffix(&self) -> &FileName {
+        &self.suffix
+    }
+
+    fn get_path_hint(&self) -> &Path {
+        &self.path
+    }
+}
+
+#[derive(Debug)]
+pub struct Event {}
+
+impl NamedConceptMgmt for Event {
+    type Configuration = Configuration;
+
+    fn does_exist_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+    ) -> Result<bool, crate::static_storage::file::NamedConceptDoesExistError> {
+        Ok(fail!(from "Event::does_exist_cfg()",
+                when SharedMemory::does_exist_cfg(name, &cfg.convert()),
+                "Failed to check if Event \"{}\" exists.",
+                name))
+    }
+
+    fn list_cfg(
+        cfg: &Self::Configuration,
+    ) -> Result<Vec<FileName>, crate::static_storage::file::NamedConceptListError> {
+        Ok(fail!(from "Event::list_cfg()",
+                when SharedMemory::list_cfg(&cfg.convert()),
+                "Failed to list all Events."))
+    }
+
+    unsafe fn remove_cfg(
+        name: &FileName,
+        cfg: &Self::Configuration,
+    ) -> Result<bool, crate::static_storage::file::NamedConceptRemoveError> {
+        if let Err(e) = File::remove(&cfg.path_for(name)) {
+            debug!(from "Event::remove_cfg()",
+                "Unable to remove the request socket of Event \"{}\" ({:?}).", name, e);
+        }
+
+        Ok(fail!(from "Event::remove_cfg()",
+                when SharedMemory::remove_cfg(name, &cfg.convert()),
+                "Failed to remove Event \"{}\".", name))
+    }
+
+    fn remove_path_hint(
+        value: &Path,
+    ) -> Result<(), crate::named_concept::NamedConceptPathHintRemoveError> {
+        crate::named_concept::remove_path_hint(value)
+    }
+}
+
+impl crate::event::Event for Event {
+    type Notifier = Notifier;
+    type NotifierBuilder = NotifierBuilder;
+    type Listener = Listener;
+    type ListenerBuilder = ListenerBuilder;
+
+    fn has_trigger_id_limit() -> bool {
+        true
+    }
+}
+
+#[derive(Debug)]
+pub struct Notifier {
+    storage: SharedMemory,
+    reply_socket: StreamingSocket,
+    event_fd: OnceLock<EventFd>,
+    event_fd_reception: Mutex<()>,
+}
+
+impl Drop for Notifier {
+    fn drop(&mut self) {
+        if self
+            .storage
+            .get()
+            .reference_counter
+            .fetch_sub(1, Ordering::Relaxed)
+            == 1
+        {
+            self.storage.acquire_ownership();
+        }
+    }
+}
+
+impl NamedConcept for Notifier {
+    fn name(&self) -> &FileName {
+        self.storage.name()
+    }
+}
+
+impl Notifier {
+    fn event_fd(&self) -> Option<&EventFd> {
+        if let Some(event_fd) = self.event_fd.get() {
+            return Some(event_fd);
+        }
+
+        // Serialize the reception, otherwise a concurrent notify could miss the eventfd
+        // although the listener already served the request and checked the trigger ids.
+        let _guard = self.event_fd_reception.lock();
+        if let Some(event_fd) = self.event_fd.get() {
+            return Some(event_fd);
+        }
+
+        let mut reply = SocketAncillary::new();
+        match self.reply_socket.try_receive_msg(&mut reply) {
+            Ok(true) => match reply.extract_fds().into_iter().next() {
+                Some(fd) => Some(
+                    self.event_fd
+                        .get_or_init(|| EventFd::from_file_descriptor(fd)),
+                ),
+                None => {
+                    warn!(from self, "The listener replied without an eventfd.");
+                    None
+                }
+            },
+            Ok(false) => None,
+            Err(e) => {
+                warn!(from self, "Unable to receive the eventfd from the listener ({:?}).", e);
+                None
+            }
+        }
+    }
+}
+
+impl crate::event::Notifier for Notifier {
+    fn trigger_id_max(&self) -> TriggerId {
+        self.storage.get().id_tracker.trigger_id_max()
+    }
+
+    fn notify(&self, id: TriggerId) -> Result<(), NotifierNotifyError> {
+        let msg = "Failed to notify listener";
+        if !self.storage.get().has_listener.load(Ordering::Relaxed) {
+            fail!(from self, with NotifierNotifyError::Disconnected,
+                "{} since the listener is no longer connected.", msg);
+        }
+
+        if self.storage.get().id_tracker.trigger_id_max() < id {
+            fail!(from self, with NotifierNotifyError::TriggerIdOutOfBounds,
+                "{} since the TriggerId {:?} is greater than the max supported TriggerId {:?}.",
+                msg, id, self.storage.get().id_tracker.trigger_id_max());
+        }
+
+        unsafe { self.storage.get().id_tracker.add(id)? };
+
+        // Without the eventfd the still pending request wakes up the listener which serves it
+        // before it collects the trigger ids.
+        if let Some(event_fd) = self.event_fd() {
+            if let Err(e) = event_fd.notify() {
+                fail!(from self, with NotifierNotifyError::FailedToDeliverSignal,
+                    "{} since the eventfd could not be signaled ({:?}).", msg, e);
+            }
+        }
+
+        Ok(())
+    }
+}
+
+#[derive(Debug)]
+pub struct NotifierBuilder {
+    name: FileName,
+    config: Configuration,
+    creation_timeout: Duration,
+}
+
+impl NamedConceptBuilder<Event> for NotifierBuilder {
+    fn new(name: &FileName) -> Self {
+        Self {
+            name: name.clone(),
+            creation_timeout: Duration::ZERO,
+            config: Configuration::default(),
+        }
+    }
+
+    fn config(mut self, config: &Configuration) -> Self {
+        self.config = config.clone();
+        self
+    }
+}
+
+impl NotifierBuilder {
+    fn request_event_fd(&self, notifier: &Notifier, request_socket: &StreamingSocket) -> bool {
+        let sender = match UnixDatagramSenderBuilder::new(&self.config.path_for(&self.name))
+            .create()
+        {
+            Ok(sender) => sender,
+            Err(e) => {
+                debug!(from self, "Unable to connect to the request socket of the listener ({:?}).", e);
+                return false;
+            }
+        };
+
+        let mut request = SocketAncillary::new();
+        request.add_fd(request_socket.file_descriptor().clone());
+        match sender.try_send_msg(&mut request) {
+            Ok(true) => true,
+            Ok(false) => {
+                debug!(from notifier, "Unable to request the eventfd since the request queue of the listener is full.");
+                false
+            }
+            Err(e) => {
+                debug!(from notifier, "Unable to request the eventfd ({:?}).", e);
+                false
+            }
+        }
+    }
+}
+
+impl crate::event::NotifierBuilder<Event> for NotifierBuilder {
+    fn timeout(mut self, timeout: Duration) -> Self {
+        self.creation_timeout = timeout;
+        self
+    }
+
+    fn open(self) -> Result<Notifier, NotifierCreateError> {
+        let msg = "Failed to open event::eventfd_bitset_posix_shared_memory::Notifier";
+
+        let (reply_socket, request_socket) = match StreamingSocket::create_pair() {
+            Ok(pair) => pair,
+            Err(e) => {
+                fail!(from self, with NotifierCreateError::InternalFailure,
+                    "{} since the socket pair to receive the eventfd could not be created ({:?}).", msg, e);
+            }
+        };
+
+        let storage = match SharedMemoryBuilder::new(&self.name)
+            .config(&self.config.convert())
+            .timeout(self.creation_timeout)
+            .open()
+        {
+            Ok(storage) => storage,
+            Err(DynamicStorageOpenError::DoesNotExist) => {
+                fail!(from self, with NotifierCreateError::DoesNotExist,
+                    "{} since it does not exist.", msg);
+            }
+            Err(DynamicStorageOpenError::VersionMismatch) => {
+                fail!(from self, with NotifierCreateError::VersionMismatch,
+                    "{} since the version of the existing construct does not match.", msg);
+            }
+            Err(DynamicStorageOpenError::InitializationNotYetFinalized) => {
+                fail!(from self, with NotifierCreateError::InitializationNotYetFinalized,
+                    "{} since the initialization is after a timeout of {:?} still not finalized..",
+                    msg, self.creation_timeout);
+            }
+            Err(e) => {
+                fail!(from self, with NotifierCreateError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        };
+
+        let mut ref_count = storage.get().reference_counter.load(Ordering::Relaxed);
+        loop {
+            if !storage.get().has_listener.load(Ordering::Relaxed) || ref_count == 0 {
+                fail!(from self, with NotifierCreateError::DoesNotExist,
+                    "{} since it has no listener and will no longer exist.", msg);
+            }
+
+            match storage.get().reference_counter.compare_exchange(
+                ref_count,
+                ref_count + 1,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => break,
+                Err(v) => ref_count = v,
+            };
+        }
+
+        let notifier = Notifier {
+            storage,
+            reply_socket,
+            event_fd: OnceLock::new(),
+            event_fd_reception: Mutex::new(()),
+        };
+
+        if !self.request_event_fd(&notifier, &request_socket) {
+            if !notifier.storage.get().has_listener.load(Ordering::Relaxed) {
+                fail!(from self, with NotifierCreateError::DoesNotExist,
+                    "{} since the listener no longer exists.", msg);
+            }
+
+            fail!(from self, with NotifierCreateError::InternalFailure,
+                "{} since the eventfd could not be requested from the listener.", msg);
+        }
+
+        Ok(notifier)
+    }
+}
+
+#[derive(Debug)]
+pub struct Listener {
+    storage: SharedMemory,
+    epoll: Epoll,
+    request_receiver: UnixDatagramReceiver,
+    event_fd: EventFd,
+}
+
+impl Drop for Listener {
+    fn drop(&mut self) {
+        self.storage
+            .get()
+            .has_listener
+            .store(false, Ordering::Relaxed);
+
+        if self
+            .storage
+            .get()
+            .reference_counter
+            .fetch_sub(1, Ordering::Relaxed)
+            == 1
+        {
+            self.storage.acquire_ownership();
+        }
+    }
+}
+
+impl FileDescriptorBased for Listener {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        self.epoll.file_descriptor()
+    }
+}
+
+impl SynchronousMultiplexing for Listener {}
+
+impl NamedConcept for Listener {
+    fn name(&self) -> &FileName {
+        self.storage.name()
+    }
+}
+
+impl Listener {
+    fn serve_event_fd_requests(&self) {
+        loop {
+            let mut request = SocketAncillary::new();
+            match self.request_receiver.try_receive_msg(&mut request) {
+                Ok(true) => (),
+                Ok(false) => return,
+                Err(e) => {
+                    warn!(from self, "Unable to receive eventfd requests ({:?}).", e);
+                    return;
+                }
+            }
+
+            for fd in request.extract_fds() {
+                let reply_socket = StreamingSocket::from_file_descriptor(fd);
+                let mut reply = SocketAncillary::new();
+                reply.add_fd(self.event_fd.file_descriptor().clone());
+                match reply_socket.try_send_msg(&mut reply) {
+                    Ok(true) => (),
+                    Ok(false) => {
+                        warn!(from self, "Unable to deliver the eventfd since the reply socket is full.")
+                    }
+                    Err(e) => warn!(from self, "Unable to deliver the eventfd ({:?}).", e),
+                }
+            }
+        }
+    }
+
+    fn acquire_signals(&self) -> Result<(), ListenerWaitError> {
+        self.serve_event_fd_requests();
+        // We have to collect the signal first, otherwise timed or blocking waits could miss a
+        // notification whose id was acquired already. This may lead to spurious wakeups.
+        match self.event_fd.try_wait() {
+            Ok(_) => Ok(()),
+            Err(e) => {
+                fail!(from self, with ListenerWaitError::InternalFailure,
+                    "Unable to reset the eventfd ({:?}).", e);
+            }
+        }
+    }
+
+    fn wait_for_activity(&self, timeout: Option<Duration>) -> Result<(), ListenerWaitError> {
+        let msg = "Unable to wait for notifications";
+        let fd_set = FileDescriptorSet::new();
+        let _guard = fatal_panic!(from self, when fd_set.add(&self.epoll),
+            "This should never happen! {} since the epoll could not be attached to a fd set.", msg);
+
+        let result = match timeout {
+            Some(timeout) => fd_set.timed_wait(timeout, FileEvent::Read, |_| {}),
+            None => fd_set.blocking_wait(FileEvent::Read, |_| {}),
+        };
+
+        match result {
+            Ok(_) => Ok(()),
+            Err(FileDescriptorSetWaitError::Interrupt) => {
+                fail!(from self, with ListenerWaitError::InterruptSignal,
+                    "{} since an interrupt signal was received.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with ListenerWaitError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        }
+    }
+
+    /// Waits until `try_acquire` returns a value or the timeout has passed. Wakeups caused by
+    /// eventfd requests of new notifiers are served and do not end the wait.
+    fn wait<R, F: FnMut() -> Result<Option<R>, ListenerWaitError>>(
+        &self,
+        timeout: Option<Duration>,
+        mut try_acquire: F,
+    ) -> Result<Option<R>, ListenerWaitError> {
+        let msg = "Unable to wait for notifications";
+        let start = fail!(from self, when Time::now(),
+            with ListenerWaitError::InternalFailure,
+            "{} since the current time could not be acquired.", msg);
+
+        loop {
+            if let Some(value) = try_acquire()? {
+                return Ok(Some(value));
+            }
+
+            let remaining_time = match timeout {
+                Some(timeout) => {
+                    let elapsed = fail!(from self, when start.elapsed(),
+                        with ListenerWaitError::InternalFailure,
+                        "{} since the elapsed time could not be acquired.", msg);
+                    if timeout <= elapsed {
+                        return Ok(None);
+                    }
+                    Some(timeout - elapsed)
+                }
+                None => None,
+            };
+
+            self.wait_for_activity(remaining_time)?;
+        }
+    }
+
+    fn wait_all<F: FnMut(TriggerId)>(
+        &self,
+        mut callback: F,
+        timeout: Option<Duration>,
+    ) -> Result<(), ListenerWaitError> {
+        self.wait(timeout, || {
+            let mut has_received_ids = false;
+            self.try_wait_all(|id| {
+                has_received_ids = true;
+                callback(id)
+            })?;
+            Ok(has_received_ids.then_some(()))
+        })?;
+
+        Ok(())
+    }
+}
+
+impl crate::event::Listener for Listener {
+    const IS_FILE_DESCRIPTOR_BASED: bool = true;
+
+    fn try_wait_one(&self) -> Result<Option<TriggerId>, ListenerWaitError> {
+        self.acquire_signals()?;
+        Ok(unsafe { self.storage.get().id_tracker.acquire() })
+    }
+
+    fn timed_wait_one(&self, timeout: Duration) -> Result<Option<TriggerId>, ListenerWaitError> {
+        self.wait(Some(timeout), || self.try_wait_one())
+    }
+
+    fn blocking_wait_one(&self) -> Result<Option<TriggerId>, ListenerWaitError> {
+        self.wait(None, || self.try_wait_one())
+    }
+
+    fn try_wait_all<F: FnMut(TriggerId)>(&self, callback: F) -> Result<(), ListenerWaitError> {
+        self.acquire_signals()?;
+        unsafe { self.storage.get().id_tracker.acquire_all(callback) };
+        Ok(())
+    }
+
+    fn timed_wait_all<F: FnMut(TriggerId)>(
+        &self,
+        callback: F,
+        timeout: Duration,
+    ) -> Result<(), ListenerWaitError> {
+        self.wait_all(callback, Some(timeout))
+    }
+
+    fn blocking_wait_all<F: FnMut(TriggerId)>(&self, callback: F) -> Result<(), ListenerWaitError> {
+        self.wait_all(callback, None)
+    }
+}
+
+#[derive(Debug)]
+pub struct ListenerBuilder {
+    name: FileName,
+    config: Configuration,
+    trigger_id_max: TriggerId,
+}
+
+impl NamedConceptBuilder<Event> for ListenerBuilder {
+    fn new(name: &FileName) -> Self {
+        Self {
+            name: name.clone(),
+            config: Configuration::default(),
+            trigger_id_max: TRIGGER_ID_DEFAULT_MAX,
+        }
+    }
+
+    fn config(mut self, config: &Configuration) -> Self {
+        self.config = config.clone();
+        self
+    }
+}
+
+impl ListenerBuilder {
+    fn init(mgmt: &mut Management, allocator: &mut BumpAllocator) -> bool {
+        if unsafe { mgmt.id_tracker.init(allocator).is_err() } {
+            debug!(from "init()", "Unable to initialize IdTracker.");
+            return false;
+        }
+
+        true
+    }
+
+    fn create_wakeup_mechanism(
+        &self,
+        msg: &str,
+    ) -> Result<(Epoll, UnixDatagramReceiver, EventFd), ListenerCreateError> {
+        let event_fd = fail!(from self, when EventFdBuilder::new().create(),
+            with ListenerCreateError::InternalFailure,
+            "{} since the eventfd could not be created.", msg);
+
+        let request_receiver = match UnixDatagramReceiverBuilder::new(
+            &self.config.path_for(&self.name),
+        )
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .create()
+        {
+            Ok(receiver) => receiver,
+            Err(UnixDatagramReceiverCreationError::InsufficientPermissions)
+            | Err(UnixDatagramReceiverCreationError::UnixDatagramCreationError(
+                UnixDatagramCreationError::InsufficientPermissions,
+            )) => {
+                fail!(from self, with ListenerCreateError::InsufficientPermissions,
+                        "{} since the request socket could not be created due to insufficient permissions.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with ListenerCreateError::InternalFailure,
+                        "{} since the request socket could not be created ({:?}).", msg, e);
+            }
+        };
+
+        let epoll = fail!(from self, when EpollBuilder::new().create(),
+            with ListenerCreateError::InternalFailure,
+            "{} since the epoll could not be created.", msg);
+        fail!(from self, when epoll.attach(&event_fd),
+            with ListenerCreateError::InternalFailure,
+            "{} since the eventfd could not be attached to the epoll.", msg);
+        fail!(from self, when epoll.attach(&request_receiver),
+            with ListenerCreateError::InternalFailure,
+            "{} since the request socket could not be attached to the epoll.", msg);
+
+        Ok((epoll, request_receiver, event_fd))
+    }
+}
+
+impl crate::event::ListenerBuilder<Event> for ListenerBuilder {
+    fn trigger_id_max(mut self, id: TriggerId) -> Self {
+        self.trigger_id_max = id;
+        self
+    }
+
+    fn create(self) -> Result<Listener, ListenerCreateError> {
+        let msg = "Failed to create event::eventfd_bitset_posix_shared_memory::Listener";
+        let id_tracker_capacity = self.trigger_id_max.as_value() + 1;
+
+        let storage = match SharedMemoryBuilder::new(&self.name)
+            .config(&self.config.convert())
+            .supplementary_size(RelocatableBitSet::memory_size(id_tracker_capacity))
+            .initializer(Self::init)
+            .has_ownership(false)
+            .create(Management {
+                id_tracker: unsafe { RelocatableBitSet::new_uninit(id_tracker_capacity) },
+                reference_counter: IoxAtomicUsize::new(1),
+                has_listener: IoxAtomicBool::new(true),
+            }) {
+            Ok(storage) => storage,
+            Err(DynamicStorageCreateError::AlreadyExists) => {
+                fail!(from self, with ListenerCreateError::AlreadyExists,
+                    "{} since it already exists.", msg);
+            }
+            Err(DynamicStorageCreateError::InsufficientPermissions) => {
+                fail!(from self, with ListenerCreateError::InsufficientPermissions,
+                    "{} due to insufficient permissions.", msg);
+            }
+            Err(e) => {
+                fail!(from self, with ListenerCreateError::InternalFailure,
+                    "{} due to an internal failure ({:?}).", msg, e);
+            }
+        };
+
+        match self.create_wakeup_mechanism(msg) {
+            Ok((epoll, request_receiver, event_fd)) => Ok(Listener {
+                storage,
+                epoll,
+                request_receiver,
+                event_fd,
+            }),
+            Err(e) => {
+                storage.acquire_ownership();
+                Err(e)
+            }
+        }
+    }
+}
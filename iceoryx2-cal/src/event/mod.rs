@@ -11,6 +11,8 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 pub mod common;
+#[cfg(target_os = "linux")]
+pub mod eventfd_bitset_posix_shared_memory;
 pub mod id_tracker;
 pub mod process_local_socketpair;
 pub mod recommended;
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Reactor`](crate::reactor::Reactor) whose [`ReactorMechanism`] is selected at runtime with
+//! [`ReactorBuilder::mechanism()`](crate::reactor::ReactorBuilder::mechanism()). The
+//! [`ReactorMechanism::Native`] mechanism is [`ReactorMechanism::Select`].
+//!
+//! When [`ReactorMechanism::IoUring`] or [`ReactorMechanism::IoUringSqPoll`] is requested but
+//! io_uring is not available at runtime, the [`Reactor`] falls back to
+//! [`ReactorMechanism::Epoll`].
+
+use core::{fmt::Debug, time::Duration};
+
+#[cfg(not(target_os = "linux"))]
+use iceoryx2_bb_log::fail;
+#[cfg(target_os = "linux")]
+use iceoryx2_bb_log::warn;
+use iceoryx2_bb_posix::{
+    file_descriptor::FileDescriptor, file_descriptor_set::SynchronousMultiplexing,
+};
+
+use crate::reactor::{
+    posix_select, ReactorAttachError, ReactorCreateError, ReactorGuard, ReactorMechanism,
+    ReactorWaitError,
+};
+
+#[cfg(target_os = "linux")]
+use crate::reactor::{epoll, io_uring};
+
+use crate::reactor::Reactor as ReactorConcept;
+use crate::reactor::ReactorBuilder as ReactorBuilderConcept;
+
+pub enum Guard<'reactor, 'attachment> {
+    Select(<posix_select::Reactor as ReactorConcept>::Guard<'reactor, 'attachment>),
+    #[cfg(target_os = "linux")]
+    Epoll(<epoll::Reactor as ReactorConcept>::Guard<'reactor, 'attachment>),
+    #[cfg(target_os = "linux")]
+    IoUring(<io_uring::Reactor as ReactorConcept>::Guard<'reactor, 'attachment>),
+}
+
+impl<'reactor, 'attachment> ReactorGuard<'reactor, 'attachment> for Guard<'reactor, 'attachment> {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        match self {
+            Guard::Select(guard) => guard.file_descriptor(),
+            #[cfg(target_os = "linux")]
+            Guard::Epoll(guard) => guard.file_descriptor(),
+            #[cfg(target_os = "linux")]
+            Guard::IoUring(guard) => guard.file_descriptor(),
+        }
+    }
+}
+
+#[derive(Debug)]
+pub enum Reactor {
+    Select(posix_select::Reactor),
+    #[cfg(target_os = "linux")]
+    Epoll(epoll::Reactor),
+    #[cfg(target_os = "linux")]
+    IoUring(io_uring::Reactor),
+}
+
+impl ReactorConcept for Reactor {
+    type Guard<'reactor, 'attachment> = Guard<'reactor, 'attachment>;
+    type Builder = ReactorBuilder;
+
+    fn capacity(&self) -> usize {
+        match self {
+            Reactor::Select(reactor) => reactor.capacity(),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.capacity(),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.capacity(),
+        }
+    }
+
+    fn len(&self) -> usize {
+        match self {
+            Reactor::Select(reactor) => reactor.len(),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.len(),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.len(),
+        }
+    }
+
+    fn is_empty(&self) -> bool {
+        match self {
+            Reactor::Select(reactor) => reactor.is_empty(),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.is_empty(),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.is_empty(),
+        }
+    }
+
+    fn attach<'reactor, 'attachment, F: SynchronousMultiplexing + Debug>(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        match self {
+            Reactor::Select(reactor) => Ok(Guard::Select(reactor.attach(value)?)),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => Ok(Guard::Epoll(reactor.attach(value)?)),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => Ok(Guard::IoUring(reactor.attach(value)?)),
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Select(reactor) => reactor.try_wait(fn_call),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.try_wait(fn_call),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.try_wait(fn_call),
+        }
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Select(reactor) => reactor.timed_wait(fn_call, timeout),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.timed_wait(fn_call, timeout),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.timed_wait(fn_call, timeout),
+        }
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Select(reactor) => reactor.blocking_wait(fn_call),
+            #[cfg(target_os = "linux")]
+            Reactor::Epoll(reactor) => reactor.blocking_wait(fn_call),
+            #[cfg(target_os = "linux")]
+            Reactor::IoUring(reactor) => reactor.blocking_wait(fn_call),
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct ReactorBuilder {
+    mechanism: ReactorMechanism,
+}
+
+impl ReactorBuilderConcept<Reactor> for ReactorBuilder {
+    fn new() -> Self {
+        Self {
+            mechanism: ReactorMechanism::Native,
+        }
+    }
+
+    fn mechanism(mut self, value: ReactorMechanism) -> Self {
+        self.mechanism = value;
+        self
+    }
+
+    fn create(self) -> Result<Reactor, ReactorCreateError> {
+        match self.mechanism {
+            ReactorMechanism::Native | ReactorMechanism::Select => Ok(Reactor::Select(
+                <posix_select::Reactor as ReactorConcept>::Builder::new().create()?,
+            )),
+            #[cfg(target_os = "linux")]
+            ReactorMechanism::Epoll => Ok(Reactor::Epoll(
+                <epoll::Reactor as ReactorConcept>::Builder::new().create()?,
+            )),
+            #[cfg(target_os = "linux")]
+            ReactorMechanism::IoUring | ReactorMechanism::IoUringSqPoll => {
+                match <io_uring::Reactor as ReactorConcept>::Builder::new()
+                    .mechanism(self.mechanism)
+                    .create()
+                {
+                    Ok(reactor) => Ok(Reactor::IoUring(reactor)),
+                    Err(ReactorCreateError::UnsupportedMechanism) => {
+                        warn!(from self,
+                            "The mechanism {:?} is not available, falling back to {:?}.",
+                            self.mechanism, ReactorMechanism::Epoll);
+                        Ok(Reactor::Epoll(
+                            <epoll::Reactor as ReactorConcept>::Builder::new().create()?,
+                        ))
+                    }
+                    Err(e) => Err(e),
+                }
+            }
+            #[cfg(not(target_os = "linux"))]
+            ReactorMechanism::Epoll
+            | ReactorMechanism::IoUring
+            | ReactorMechanism::IoUringSqPoll => {
+                fail!(from self, with ReactorCreateError::UnsupportedMechanism,
+                    "Unable to create Reactor since the mechanism {:?} is not supported on this platform.",
+                    self.mechanism);
+            }
+        }
+    }
+}
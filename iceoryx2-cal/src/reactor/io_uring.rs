@@ -0,0 +1,239 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`Reactor`](crate::reactor::Reactor) based on Linux `io_uring`. Every attachment is
+//! registered once as multishot poll request and a wait call reaps the completions of the
+//! readable attachments from the completion queue that is shared with the kernel. With
+//! [`ReactorMechanism::IoUringSqPoll`] a kernel thread polls the submission queue. See
+//! [`IoUring`] for details.
+//!
+//! When io_uring is not available, for instance on kernels older than 5.13 or when it is
+//! disabled by a seccomp filter, [`ReactorBuilder::create()`](crate::reactor::ReactorBuilder::create())
+//! fails with [`ReactorCreateError::UnsupportedMechanism`].
+
+use core::{fmt::Debug, sync::atomic::Ordering, time::Duration};
+
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_posix::{
+    clock::{nanosleep, NanosleepError},
+    file_descriptor::{FileDescriptor, FileDescriptorBased},
+    file_descriptor_set::SynchronousMultiplexing,
+    io_uring::{
+        IoUring, IoUringAttachmentError, IoUringBuilder, IoUringCreationError, IoUringWaitError,
+    },
+};
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
+
+use crate::reactor::{
+    ReactorAttachError, ReactorCreateError, ReactorGuard, ReactorMechanism, ReactorWaitError,
+};
+
+const CAPACITY: usize = 4096;
+/// The time after which the submission queue polling thread goes to sleep.
+const SUBMISSION_QUEUE_POLLING_IDLE_TIME: Duration = Duration::from_millis(10);
+
+pub struct Guard<'reactor, 'attachment> {
+    reactor: &'reactor Reactor,
+    attachment: &'attachment dyn SynchronousMultiplexing,
+}
+
+impl<'reactor, 'attachment> ReactorGuard<'reactor, 'attachment> for Guard<'reactor, 'attachment> {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        self.attachment.file_descriptor()
+    }
+}
+
+impl Drop for Guard<'_, '_> {
+    fn drop(&mut self) {
+        if let Err(e) = self.reactor.io_uring.detach(self.attachment) {
+            warn!(from self.reactor,
+                "Unable to detach {:?} from the reactor ({:?}). This may lead to spurious wakeups.",
+                self.attachment.file_descriptor(), e);
+        }
+        self.reactor.len.fetch_sub(1, Ordering::Relaxed);
+    }
+}
+
+#[derive(Debug)]
+pub struct Reactor {
+    io_uring: IoUring,
+    len: IoxAtomicUsize,
+}
+
+impl Reactor {
+    fn wait<F: FnMut(&FileDescriptor), W: FnMut(F) -> Result<usize, IoUringWaitError>>(
+        &self,
+        fn_call: F,
+        mut wait_call: W,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        let msg = "Unable to wait on Reactor";
+        if self.len.load(Ordering::Relaxed) == 0 {
+            match nanosleep(timeout) {
+                Ok(()) => Ok(0),
+                Err(NanosleepError::InterruptedBySignal(_)) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred while waiting ({:?}).",
+                        msg, v);
+                }
+            }
+        } else {
+            match wait_call(fn_call) {
+                Ok(number_of_notifications) => Ok(number_of_notifications),
+                Err(IoUringWaitError::Interrupt) => {
+                    fail!(from self, with ReactorWaitError::Interrupt,
+                        "{} since an interrupt signal was received while waiting.",
+                        msg);
+                }
+                Err(v) => {
+                    fail!(from self, with ReactorWaitError::UnknownError,
+                        "{} since an unknown failure occurred in the underlying IoUring ({:?}).",
+                        msg, v);
+                }
+            }
+        }
+    }
+}
+
+impl crate::reactor::Reactor for Reactor {
+    type Guard<'reactor, 'attachment> = Guard<'reactor, 'attachment>;
+    type Builder = ReactorBuilder;
+
+    fn capacity(&self) -> usize {
+        CAPACITY
+    }
+
+    fn len(&self) -> usize {
+        self.len.load(Ordering::Relaxed)
+    }
+
+    fn is_empty(&self) -> bool {
+        self.len.load(Ordering::Relaxed) == 0
+    }
+
+    fn attach<'reactor, 'attachment, F: SynchronousMultiplexing + Debug>(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        let msg = format!("Unable to attach {:?} to the reactor", value);
+        if self.len.load(Ordering::Relaxed) >= CAPACITY {
+            fail!(from self, with ReactorAttachError::CapacityExceeded,
+                "{msg} since the capacity of {} attachments is exceeded.", CAPACITY);
+        }
+
+        match self.io_uring.attach(value) {
+            Ok(()) => {
+                self.len.fetch_add(1, Ordering::Relaxed);
+                Ok(Guard {
+                    reactor: self,
+                    attachment: value,
+                })
+            }
+            Err(IoUringAttachmentError::AlreadyAttached) => {
+                fail!(from self, with ReactorAttachError::AlreadyAttached,
+                    "{msg} since it is already attached.");
+            }
+            Err(IoUringAttachmentError::UnknownError(e)) => {
+                fail!(from self, with ReactorAttachError::UnknownError(e),
+                    "{msg} due to an unknown failure in the underlying IoUring.");
+            }
+            Err(e) => {
+                fail!(from self, with ReactorAttachError::UnknownError(0),
+                    "{msg} due to an internal failure in the underlying IoUring ({:?}).", e);
+            }
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        self.wait(fn_call, |f: F| self.io_uring.try_wait(f), Duration::ZERO)
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        self.wait(
+            fn_call,
+            |f: F| self.io_uring.timed_wait(timeout, f),
+            timeout,
+        )
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        self.wait(
+            fn_call,
+            |f: F| self.io_uring.blocking_wait(f),
+            Duration::MAX,
+        )
+    }
+}
+
+#[derive(Debug)]
+pub struct ReactorBuilder {
+    mechanism: ReactorMechanism,
+}
+
+impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
+    fn new() -> Self {
+        Self {
+            mechanism: ReactorMechanism::Native,
+        }
+    }
+
+    fn mechanism(mut self, value: ReactorMechanism) -> Self {
+        self.mechanism = value;
+        self
+    }
+
+    fn create(self) -> Result<Reactor, ReactorCreateError> {
+        let msg = "Unable to create Reactor";
+        let builder = match self.mechanism {
+            ReactorMechanism::Native | ReactorMechanism::IoUring => IoUringBuilder::new(),
+            ReactorMechanism::IoUringSqPoll => {
+                IoUringBuilder::new().submission_queue_polling(SUBMISSION_QUEUE_POLLING_IDLE_TIME)
+            }
+            _ => {
+                fail!(from self, with ReactorCreateError::UnsupportedMechanism,
+                    "{msg} since the mechanism {:?} is not supported.", self.mechanism);
+            }
+        };
+
+        match builder.create() {
+            Ok(io_uring) => Ok(Reactor {
+                io_uring,
+                len: IoxAtomicUsize::new(0),
+            }),
+            Err(IoUringCreationError::NotSupported)
+            | Err(IoUringCreationError::InsufficientPermissions) => {
+                fail!(from self, with ReactorCreateError::UnsupportedMechanism,
+                    "{msg} since io_uring with multishot polls is not available for the process.");
+            }
+            Err(IoUringCreationError::UnknownError(e)) => {
+                fail!(from self, with ReactorCreateError::UnknownError(e),
+                    "{msg} since an unknown failure occurred in the underlying IoUring.");
+            }
+            Err(e) => {
+                fail!(from self, with ReactorCreateError::UnknownError(0),
+                    "{msg} since the underlying IoUring could not be created ({:?}).", e);
+            }
+        }
+    }
+}
@@ -10,6 +10,11 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub mod configurable;
+#[cfg(target_os = "linux")]
+pub mod epoll;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod posix_select;
 pub mod recommended;
 
@@ -19,8 +24,31 @@ use iceoryx2_bb_posix::{
     file_descriptor::FileDescriptor, file_descriptor_set::SynchronousMultiplexing,
 };
 
+/// Defines the mechanism a [`Reactor`] uses to wait on its attachments.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub enum ReactorMechanism {
+    /// The default mechanism of the [`Reactor`] implementation.
+    #[default]
+    Native,
+    /// Uses `select`. Every wait call passes all attachments to the kernel and scans all of
+    /// them afterwards. Available on all platforms.
+    Select,
+    /// Uses `epoll`. The attachments are registered once and a wait call returns only the
+    /// ready ones. Available on Linux only.
+    Epoll,
+    /// Uses `io_uring` with one multishot poll request per attachment. A wait call reaps the
+    /// completions of the ready attachments from a ring that is shared with the kernel.
+    /// Requires Linux 5.13 or newer.
+    IoUring,
+    /// Like [`ReactorMechanism::IoUring`] but a kernel thread polls the submission queue so
+    /// that attaching and detaching do not require a system call while the thread is awake.
+    /// Requires Linux 5.13 or newer.
+    IoUringSqPoll,
+}
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ReactorCreateError {
+    UnsupportedMechanism,
     UnknownError(i32),
 }
 
@@ -71,5 +99,10 @@ pub trait Reactor: Sized + Debug {
 
 pub trait ReactorBuilder<T: Reactor> {
     fn new() -> Self;
+
+    /// Defines the [`ReactorMechanism`]. When the [`Reactor`] does not support it,
+    /// [`ReactorBuilder::create()`] fails with [`ReactorCreateError::UnsupportedMechanism`].
+    fn mechanism(self, value: ReactorMechanism) -> Self;
+
     fn create(self) -> Result<T, ReactorCreateError>;
 }
@@ -22,7 +22,7 @@ use iceoryx2_bb_posix::{
     },
 };
 
-use crate::reactor::{ReactorAttachError, ReactorWaitError};
+use crate::reactor::{ReactorAttachError, ReactorCreateError, ReactorMechanism, ReactorWaitError};
 
 impl crate::reactor::ReactorGuard<'_, '_> for FileDescriptorSetGuard<'_, '_> {
     fn file_descriptor(&self) -> &FileDescriptor {
@@ -162,14 +162,30 @@ impl crate::reactor::Reactor for Reactor {
     }
 }
 
-pub struct ReactorBuilder {}
+#[derive(Debug)]
+pub struct ReactorBuilder {
+    mechanism: ReactorMechanism,
+}
 
 impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
     fn new() -> Self {
-        Self {}
+        Self {
+            mechanism: ReactorMechanism::Native,
+        }
+    }
+
+    fn mechanism(mut self, value: ReactorMechanism) -> Self {
+        self.mechanism = value;
+        self
     }
 
     fn create(self) -> Result<Reactor, super::ReactorCreateError> {
-        Ok(Reactor::new())
+        match self.mechanism {
+            ReactorMechanism::Native | ReactorMechanism::Select => Ok(Reactor::new()),
+            _ => {
+                fail!(from self, with ReactorCreateError::UnsupportedMechanism,
+                    "Unable to create Reactor since the mechanism {:?} is not supported.", self.mechanism);
+            }
+        }
     }
 }
@@ -13,9 +13,9 @@
 /// Provides the recommended inter-process
 /// [`Reactor`](crate::reactor::Reactor) concept
 /// implementation for the target.
-pub type Ipc = crate::reactor::posix_select::Reactor;
+pub type Ipc = crate::reactor::configurable::Reactor;
 
 /// Provides the recommended process-local
 /// [`Reactor`](crate::reactor::Reactor) concept
 /// implementation for the target.
-pub type Local = crate::reactor::posix_select::Reactor;
+pub type Local = crate::reactor::configurable::Reactor;
@@ -29,7 +29,7 @@ use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_container::slotmap::{SlotMap, SlotMapKey};
 use iceoryx2_bb_elementary_traits::allocator::AllocationError;
 use iceoryx2_bb_log::fatal_panic;
-use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_log::{debug, fail, warn};
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicU64, IoxAtomicUsize};
@@ -38,10 +38,14 @@ use super::{
     NamedConcept, NamedConceptBuilder, NamedConceptDoesExistError, NamedConceptListError,
     NamedConceptMgmt, NamedConceptRemoveError, ResizableSharedMemory, ResizableSharedMemoryBuilder,
     ResizableSharedMemoryForPoolAllocator, ResizableSharedMemoryView,
-    ResizableSharedMemoryViewBuilder, ResizableShmAllocationError,
+    ResizableSharedMemoryViewBuilder, ResizableShmAllocationError, ResizableShmShrinkError,
 };
 
 const MAX_NUMBER_OF_REALLOCATIONS: usize = SegmentId::max_segment_id() as usize + 1;
+/// [`ResizableSharedMemory::shrink()`] stops replacing the segment when less reallocations
+/// remain so that the memory is still able to grow afterwards. Segment ids cannot be reused
+/// since a view may still map the segment of an older id.
+const RESERVED_REALLOCATIONS_FOR_GROWTH: usize = 32;
 const SEGMENT_ID_SEPARATOR: &[u8] = b"__";
 const MANAGEMENT_SUFFIX: &[u8] = b"mgmt";
 const INVALID_KEY: usize = usize::MAX;
@@ -60,6 +64,8 @@ struct MemoryConfig<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     base_name: FileName,
     shm: Shm::Configuration,
     allocator_config_hint: Allocator::Configuration,
+    initial_allocator_config: Allocator::Configuration,
+    initial_payload_size: usize,
 }
 
 #[derive(Debug)]
@@ -197,6 +203,8 @@ where
             config: MemoryConfig {
                 base_name: name.clone(),
                 allocator_config_hint: Allocator::Configuration::default(),
+                initial_allocator_config: Allocator::Configuration::default(),
+                initial_payload_size: 0,
                 shm: Shm::Configuration::default(),
             },
             shared_state: SharedState {
@@ -273,6 +281,8 @@ where
                 .load(Ordering::Relaxed) as usize,
         );
         self.config.allocator_config_hint = hint.config;
+        self.config.initial_allocator_config = hint.config;
+        self.config.initial_payload_size = hint.payload_size;
 
         let shm = fail!(from origin, when DynamicMemory::create_segment(&self.config, SegmentId::new(0), hint.payload_size),
             "Unable to create ResizableSharedMemory since the underlying shared memory could not be created.");
@@ -388,6 +398,14 @@ where
         let shared_memory_map = unsafe { &mut *self.shared_memory_map.get() };
         shared_memory_map.len()
     }
+
+    fn size(&self) -> usize {
+        let shared_memory_map = unsafe { &*self.shared_memory_map.get() };
+        shared_memory_map
+            .iter()
+            .map(|(_, entry)| entry.shm.size())
+            .sum()
+    }
 }
 
 #[derive(Debug)]
@@ -710,6 +728,14 @@ where
                         segment_id),
         }
     }
+
+    fn release_unused_pages(&self) -> usize {
+        self.state()
+            .shared_memory_map
+            .iter()
+            .map(|(_, entry)| entry.shm.release_unused_pages())
+            .sum()
+    }
 }
 
 impl<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> ResizableSharedMemory<Allocator, Shm>
@@ -729,6 +755,14 @@ where
         self.state().shared_memory_map.len()
     }
 
+    fn size(&self) -> usize {
+        self.state()
+            .shared_memory_map
+            .iter()
+            .map(|(_, entry)| entry.shm.size())
+            .sum()
+    }
+
     fn allocate(&self, layout: Layout) -> Result<ShmPointer, ResizableShmAllocationError> {
         let msg = "Unable to allocate memory";
         let state = self.state_mut();
@@ -753,4 +787,53 @@ where
     unsafe fn deallocate(&self, offset: PointerOffset, layout: Layout) {
         self.perform_deallocation(offset, |entry| entry.shm.deallocate(offset, layout));
     }
+
+    fn shrink(&self) -> Result<bool, ResizableShmShrinkError> {
+        let msg = "Unable to shrink the memory";
+        let state = self.state_mut();
+        match state.shared_memory_map.get(state.current_idx) {
+            Some(entry) => {
+                if entry.chunk_count.load(Ordering::Relaxed) != 0
+                    || entry.shm.size() <= state.builder_config.initial_payload_size
+                {
+                    return Ok(false);
+                }
+            }
+            None => fatal_panic!(from self,
+                        "This should never happen! {msg} since the current shared memory segment is not available!"),
+        }
+
+        let new_number_of_reallocations = state.current_idx.value() + 1;
+        if new_number_of_reallocations + RESERVED_REALLOCATIONS_FOR_GROWTH
+            >= MAX_NUMBER_OF_REALLOCATIONS
+        {
+            debug!(from self,
+                "The memory is not shrunk since only {} of {} reallocations remain and they are reserved for growing the memory.",
+                MAX_NUMBER_OF_REALLOCATIONS - new_number_of_reallocations,
+                Self::max_number_of_reallocations());
+            return Ok(false);
+        }
+
+        let segment_id = SlotMapKey::new(new_number_of_reallocations);
+        state.builder_config.allocator_config_hint = state.builder_config.initial_allocator_config;
+        let shm = match Self::create_segment(
+            &state.builder_config,
+            SegmentId::new(segment_id.value() as u8),
+            state.builder_config.initial_payload_size,
+        ) {
+            Ok(shm) => shm,
+            Err(e) => {
+                fail!(from self, with e.into(),
+                    "{msg} since the segment with the initial size could not be created ({:?}).", e);
+            }
+        };
+
+        state.shared_memory_map.remove(state.current_idx);
+        state
+            .shared_memory_map
+            .insert_at(segment_id, ShmEntry::new(shm));
+        state.current_idx = segment_id;
+
+        Ok(true)
+    }
 }
@@ -118,6 +118,15 @@ enum_gen! {
     SharedMemoryCreateError
 }
 
+enum_gen! {
+/// Defines all errors that can occur when calling [`ResizableSharedMemory::shrink()`]
+    ResizableShmShrinkError
+  entry:
+    MaxReallocationsReached
+  mapping:
+    SharedMemoryCreateError
+}
+
 /// Creates a [`ResizableSharedMemoryView`] to an existing [`ResizableSharedMemory`] and maps the
 /// [`ResizableSharedMemory`] read-only into the process space.
 pub trait ResizableSharedMemoryViewBuilder<
@@ -196,6 +205,9 @@ pub trait ResizableSharedMemoryView<Allocator: ShmAllocator, Shm: SharedMemory<A
 
     /// Returns the number of active [`SharedMemory`] segments.
     fn number_of_active_segments(&self) -> usize;
+
+    /// Returns the sum of the sizes of all mapped [`SharedMemory`] segments.
+    fn size(&self) -> usize;
 }
 
 /// The [`ResizableSharedMemory`] can be only owned by exactly one process that is allowed to
@@ -223,6 +235,9 @@ pub trait ResizableSharedMemory<Allocator: ShmAllocator, Shm: SharedMemory<Alloc
     /// Returns the number of active [`SharedMemory`] segments.
     fn number_of_active_segments(&self) -> usize;
 
+    /// Returns the sum of the sizes of all active [`SharedMemory`] segments.
+    fn size(&self) -> usize;
+
     /// Allocates a new piece of [`SharedMemory`] if the provided [`Layout`] exceeds the current
     /// supported [`Layout`], the memory would be out-of-memory or the number of chunks exceeds the
     /// current supported amount of chunks, a new [`SharedMemory`] segment will be created. If this
@@ -240,6 +255,15 @@ pub trait ResizableSharedMemory<Allocator: ShmAllocator, Shm: SharedMemory<Alloc
     ///    [`ShmPointer`]
     ///  * the layout must be identical to the one used in [`SharedMemory::allocate()`]
     unsafe fn deallocate(&self, offset: PointerOffset, layout: core::alloc::Layout);
+
+    /// Replaces the current [`SharedMemory`] segment with a segment of the initial size when
+    /// it was enlarged by previous reallocations and none of its memory is allocated anymore.
+    /// Older segments are already released as soon as their last chunk is deallocated. Every
+    /// shrink consumes one reallocation, see
+    /// [`ResizableSharedMemory::max_number_of_reallocations()`]. An implementation may keep
+    /// the enlarged segment when the remaining reallocations are required to grow the memory
+    /// again. Returns true when the segment was replaced.
+    fn shrink(&self) -> Result<bool, ResizableShmShrinkError>;
 }
 
 pub trait ResizableSharedMemoryForPoolAllocator<Shm: SharedMemory<PoolAllocator>>:
@@ -255,4 +279,10 @@ pub trait ResizableSharedMemoryForPoolAllocator<Shm: SharedMemory<PoolAllocator>
 
     /// Returns the bucket size of the corresponding [`PoolAllocator`]
     fn bucket_size(&self, segment_id: SegmentId) -> usize;
+
+    /// Returns the physical memory of all currently unallocated buckets of all segments to the
+    /// operating system, see
+    /// [`SharedMemoryForPoolAllocator::release_unused_pages()`](crate::shared_memory::SharedMemoryForPoolAllocator::release_unused_pages()).
+    /// Returns the number of released bytes.
+    fn release_unused_pages(&self) -> usize;
 }
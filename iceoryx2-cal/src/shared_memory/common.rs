@@ -18,6 +18,7 @@ use crate::dynamic_storage::*;
 pub use crate::shared_memory::*;
 use iceoryx2_bb_elementary_traits::allocator::BaseAllocator;
 use iceoryx2_bb_log::{debug, fail};
+use iceoryx2_bb_posix::memory_advice::release_pages;
 use iceoryx2_bb_posix::system_configuration::SystemInfo;
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_bb_system_types::file_path::FilePath;
@@ -459,5 +460,46 @@ pub mod details {
         fn bucket_size(&self) -> usize {
             unsafe { self.storage.get().allocator.assume_init_ref().bucket_size() }
         }
+
+        fn release_unused_pages(&self) -> usize {
+            let allocator = unsafe { self.storage.get().allocator.assume_init_ref() };
+            let bucket_size = allocator.bucket_size();
+            let layout = unsafe { Layout::from_size_align_unchecked(bucket_size, 1) };
+
+            let mut free_buckets = Vec::with_capacity(allocator.number_of_buckets() as usize);
+            while let Ok(offset) = unsafe { allocator.allocate(layout) } {
+                free_buckets.push(offset.offset());
+            }
+            free_buckets.sort_unstable();
+
+            // adjacent free buckets are released together so that pages spanning multiple
+            // buckets are released as well
+            let mut released_bytes = 0;
+            let mut n = 0;
+            while n < free_buckets.len() {
+                let start = free_buckets[n];
+                let mut end = start + bucket_size;
+                n += 1;
+                while n < free_buckets.len() && free_buckets[n] == end {
+                    end += bucket_size;
+                    n += 1;
+                }
+
+                match unsafe {
+                    release_pages((self.payload_start_address + start) as *mut u8, end - start)
+                } {
+                    Ok(bytes) => released_bytes += bytes,
+                    Err(e) => {
+                        debug!(from self, "Unable to release the pages of the unused buckets ({:?}).", e)
+                    }
+                }
+            }
+
+            for offset in free_buckets {
+                unsafe { allocator.deallocate_bucket(PointerOffset::new(offset)) };
+            }
+
+            released_bytes
+        }
     }
 }
@@ -198,4 +198,13 @@ pub trait SharedMemoryForPoolAllocator: SharedMemory<PoolAllocator> {
 
     /// Returns the bucket size of the [`PoolAllocator`]
     fn bucket_size(&self) -> usize;
+
+    /// Returns the physical memory of all buckets that are currently not allocated to the
+    /// operating system, only the pages that are completely covered by free buckets are
+    /// released. A released bucket is backed by memory again on its next use. Returns the
+    /// number of released bytes.
+    ///
+    /// The free buckets are acquired for the duration of the call, therefore a concurrent
+    /// [`SharedMemory::allocate()`] may fail with an out-of-memory error.
+    fn release_unused_pages(&self) -> usize;
 }
@@ -225,6 +225,17 @@ pub mod details {
             }
         }
 
+        fn memory_size(&self) -> usize {
+            core::mem::size_of::<Self>()
+                + Self::const_memory_size(
+                    self.channels[0].submission_queue.capacity(),
+                    self.channels[0].completion_queue.capacity(),
+                    self.number_of_samples_per_segment,
+                    self.number_of_segments,
+                    self.channels.capacity(),
+                )
+        }
+
         fn get_segment_details(&self, segment_id: usize, channel_id: usize) -> &SegmentDetails {
             let idx = channel_id * self.number_of_segments as usize + segment_id;
             &self.segment_details[idx]
@@ -527,6 +538,17 @@ pub mod details {
     impl<Storage: DynamicStorage<SharedManagementData>>
         ZeroCopyConnectionBuilder<Connection<Storage>> for Builder<Storage>
     {
+        fn memory_size(&self) -> usize {
+            core::mem::size_of::<SharedManagementData>()
+                + SharedManagementData::const_memory_size(
+                    self.submission_queue_size(),
+                    self.completion_queue_size(),
+                    self.number_of_samples_per_segment,
+                    self.number_of_segments,
+                    self.number_of_channels,
+                )
+        }
+
         fn max_supported_shared_memory_segments(mut self, value: u8) -> Self {
             self.number_of_segments = value.clamp(1, u8::MAX);
             self
@@ -650,6 +672,10 @@ pub mod details {
             debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
             &self.storage.get().channels[channel_id.value()].state
         }
+
+        fn memory_size(&self) -> usize {
+            self.storage.get().memory_size()
+        }
     }
 
     impl<Storage: DynamicStorage<SharedManagementData>> ZeroCopySender for Sender<Storage> {
@@ -739,6 +765,13 @@ pub mod details {
             self.try_send(ptr, sample_size, channel_id)
         }
 
+        fn number_of_queued_samples(&self, channel_id: ChannelId) -> usize {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+            self.storage.get().channels[channel_id.value()]
+                .submission_queue
+                .len()
+        }
+
         fn reclaim(
             &self,
             channel_id: ChannelId,
@@ -782,6 +815,17 @@ pub mod details {
             }
         }
 
+        fn used_offsets<F: FnMut(PointerOffset)>(&self, mut callback: F) {
+            for (n, segment_details) in self.storage.get().segment_details.iter().enumerate() {
+                segment_details.used_chunk_list.for_each(|index| {
+                    callback(PointerOffset::from_offset_and_segment_id(
+                        index * segment_details.sample_size.load(Ordering::Relaxed),
+                        self.segment_id_from_index(n),
+                    ))
+                });
+            }
+        }
+
         unsafe fn acquire_used_offsets<F: FnMut(PointerOffset)>(&self, mut callback: F) {
             for (n, segment_details) in self.storage.get().segment_details.iter().enumerate() {
                 segment_details.used_chunk_list.remove_all(|index| {
@@ -886,6 +930,10 @@ pub mod details {
             debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
             &self.storage.get().channels[channel_id.value()].state
         }
+
+        fn memory_size(&self) -> usize {
+            self.storage.get().memory_size()
+        }
     }
 
     impl<Storage: DynamicStorage<SharedManagementData>> ZeroCopyReceiver for Receiver<Storage> {
@@ -152,6 +152,10 @@ pub trait ZeroCopyConnectionBuilder<C: ZeroCopyConnection>: NamedConceptBuilder<
     /// By default it is set to [`Duration::ZERO`] for no timeout.
     fn timeout(self, value: Duration) -> Self;
 
+    /// Returns the number of bytes the shared management data of a connection with the
+    /// current settings would occupy.
+    fn memory_size(&self) -> usize;
+
     fn create_sender(self) -> Result<C::Sender, ZeroCopyCreationError>;
     fn create_receiver(self) -> Result<C::Receiver, ZeroCopyCreationError>;
 }
@@ -164,6 +168,9 @@ pub trait ZeroCopyPortDetails {
     fn max_supported_shared_memory_segments(&self) -> u8;
     fn is_connected(&self) -> bool;
     fn channel_state(&self, channel_id: ChannelId) -> &IoxAtomicU64;
+    /// Returns the number of bytes the shared management data of the connection, including
+    /// all queues, occupies.
+    fn memory_size(&self) -> usize;
 }
 
 pub trait ZeroCopySender: Debug + ZeroCopyPortDetails + NamedConcept {
@@ -184,6 +191,16 @@ pub trait ZeroCopySender: Debug + ZeroCopyPortDetails + NamedConcept {
     fn reclaim(&self, channel_id: ChannelId)
         -> Result<Option<PointerOffset>, ZeroCopyReclaimError>;
 
+    /// Returns the number of samples that were sent but not yet received. The value can be
+    /// out-of-date as soon as it is acquired since the receiver may receive concurrently.
+    fn number_of_queued_samples(&self, channel_id: ChannelId) -> usize;
+
+    /// Calls the callback for every offset that was sent and not yet reclaimed, including the
+    /// offsets that were sent by a previous sender of the same connection. Used by a sender
+    /// that takes over the connection of a dead sender to restore which samples are still in
+    /// use by the receiver.
+    fn used_offsets<F: FnMut(PointerOffset)>(&self, callback: F);
+
     /// # Safety
     ///
     /// * must ensure that no receiver is still holding data, otherwise data races may occur on
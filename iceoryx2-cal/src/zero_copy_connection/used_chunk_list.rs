@@ -148,6 +148,16 @@ pub mod details {
             self.set(value, false)
         }
 
+        pub fn for_each<F: FnMut(usize)>(&self, mut callback: F) {
+            self.verify_init("for_each");
+
+            for i in 0..self.capacity {
+                if unsafe { (*self.data_ptr.as_ptr().add(i)).load(Ordering::Relaxed) } {
+                    callback(i);
+                }
+            }
+        }
+
         pub fn remove_all<F: FnMut(usize)>(&self, mut callback: F) {
             self.verify_init("pop");
 
@@ -573,4 +573,77 @@ mod reactor {
 
     #[instantiate_tests(<iceoryx2_cal::reactor::posix_select::Reactor>)]
     mod posix_select {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2_cal::reactor::epoll::Reactor>)]
+    mod epoll {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2_cal::reactor::io_uring::Reactor>)]
+    mod io_uring {}
+
+    #[instantiate_tests(<iceoryx2_cal::reactor::configurable::Reactor>)]
+    mod configurable {}
+}
+
+mod reactor_mechanism {
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_cal::reactor::*;
+
+    #[test]
+    fn posix_select_reactor_supports_only_select() {
+        type Sut = posix_select::Reactor;
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::Select)
+            .create();
+        assert_that!(sut, is_ok);
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::Epoll)
+            .create();
+        assert_that!(sut.err(), eq Some(ReactorCreateError::UnsupportedMechanism));
+    }
+
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn configurable_reactor_uses_the_selected_mechanism() {
+        type Sut = configurable::Reactor;
+
+        let sut = <Sut as Reactor>::Builder::new().create().unwrap();
+        assert_that!(matches!(sut, configurable::Reactor::Select(_)), eq true);
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::Epoll)
+            .create()
+            .unwrap();
+        assert_that!(matches!(sut, configurable::Reactor::Epoll(_)), eq true);
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::IoUring)
+            .create()
+            .unwrap();
+        assert_that!(matches!(sut, configurable::Reactor::IoUring(_)), eq true);
+    }
+
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn io_uring_reactor_supports_only_io_uring() {
+        type Sut = io_uring::Reactor;
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::IoUring)
+            .create();
+        assert_that!(sut, is_ok);
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::IoUringSqPoll)
+            .create();
+        assert_that!(sut, is_ok);
+
+        let sut = <Sut as Reactor>::Builder::new()
+            .mechanism(ReactorMechanism::Epoll)
+            .create();
+        assert_that!(sut.err(), eq Some(ReactorCreateError::UnsupportedMechanism));
+    }
 }
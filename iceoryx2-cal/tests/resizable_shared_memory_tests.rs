@@ -436,6 +436,72 @@ mod resizable_shared_memory {
         assert_that!(result.err().unwrap(), eq ResizableShmAllocationError::ShmAllocationError(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
     }
 
+    #[test]
+    fn shrink_replaces_enlarged_unused_segment_with_initial_one<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .create()
+            .unwrap();
+
+        let initial_size = sut.size();
+        assert_that!(sut.shrink(), eq Ok(false));
+
+        let layout = Layout::from_size_align(1024, 1).unwrap();
+        let ptr = sut.allocate(layout).unwrap();
+        assert_that!(sut.size(), gt initial_size);
+        assert_that!(sut.shrink(), eq Ok(false));
+
+        unsafe { sut.deallocate(ptr.offset, layout) };
+        assert_that!(sut.shrink(), eq Ok(true));
+        assert_that!(sut.number_of_active_segments(), eq 1);
+        assert_that!(sut.size(), eq initial_size);
+        assert_that!(sut.shrink(), eq Ok(false));
+
+        assert_that!(sut.allocate(Layout::new::<u8>()), is_ok);
+    }
+
+    #[test]
+    fn repeated_grow_and_shrink_keeps_the_memory_able_to_grow<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .create()
+            .unwrap();
+
+        let layout = Layout::from_size_align(1024, 1).unwrap();
+        let mut number_of_shrinks = 0;
+        for _ in 0..Sut::max_number_of_reallocations() {
+            let ptr = sut.allocate(layout).unwrap();
+            unsafe { sut.deallocate(ptr.offset, layout) };
+            if sut.shrink() == Ok(true) {
+                number_of_shrinks += 1;
+            }
+        }
+
+        assert_that!(number_of_shrinks, gt 0);
+        assert_that!(number_of_shrinks, lt Sut::max_number_of_reallocations() / 2);
+
+        let larger_layout = Layout::from_size_align(8192, 1).unwrap();
+        assert_that!(sut.allocate(larger_layout), is_ok);
+    }
+
     #[test]
     fn static_allocation_strategy_does_not_resize_available_chunks<
         Shm: SharedMemory<DefaultAllocator>,
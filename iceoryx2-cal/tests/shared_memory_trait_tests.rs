@@ -202,6 +202,44 @@ mod shared_memory {
         assert_that!(chunk, is_ok);
     }
 
+    #[test]
+    fn release_unused_pages_keeps_allocated_chunks_and_free_buckets<
+        Sut: SharedMemoryForPoolAllocator,
+    >() {
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+        let mut chunks = vec![];
+
+        let sut = Sut::Builder::new(&name)
+            .size(DEFAULT_SIZE)
+            .config(&config)
+            .create(&SHM_CONFIG)
+            .unwrap();
+
+        for n in 0..NUMBER_OF_CHUNKS / 2 {
+            let chunk = sut.allocate(DEFAULT_LAYOUT).unwrap();
+            unsafe { chunk.data_ptr.write_bytes(n as u8, CHUNK_SIZE) };
+            chunks.push(chunk);
+        }
+
+        let released_bytes = sut.release_unused_pages();
+        assert_that!(released_bytes, le CHUNK_SIZE * NUMBER_OF_CHUNKS / 2);
+
+        for (n, chunk) in chunks.iter().enumerate() {
+            let data = unsafe { core::slice::from_raw_parts(chunk.data_ptr, CHUNK_SIZE) };
+            assert_that!(data.iter().all(|v| *v == n as u8), eq true);
+        }
+
+        for _ in 0..NUMBER_OF_CHUNKS / 2 {
+            let chunk = sut.allocate(DEFAULT_LAYOUT);
+            assert_that!(chunk, is_ok);
+            // released pages are usable again
+            unsafe { chunk.unwrap().data_ptr.write_bytes(0xff, CHUNK_SIZE) };
+        }
+
+        assert_that!(sut.allocate(DEFAULT_LAYOUT), is_err);
+    }
+
     #[test]
     fn allocated_chunks_have_correct_alignment<Sut: SharedMemory<DefaultAllocator>>() {
         let name = generate_name();
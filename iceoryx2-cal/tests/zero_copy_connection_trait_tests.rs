@@ -639,6 +639,44 @@ mod zero_copy_connection {
         assert_that!(result.err().unwrap(), eq ZeroCopySendError::ReceiveBufferFull);
     }
 
+    #[test]
+    fn number_of_queued_samples_tracks_sent_and_received_samples<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+        const BUFFER_SIZE: usize = 5;
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .receiver_max_borrowed_samples_per_channel(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .receiver_max_borrowed_samples_per_channel(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_sender.number_of_queued_samples(id), eq 0);
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * i), SAMPLE_SIZE, id),
+                is_ok
+            );
+            assert_that!(sut_sender.number_of_queued_samples(id), eq i + 1);
+        }
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(sut_receiver.receive(id).unwrap(), is_some);
+            assert_that!(sut_sender.number_of_queued_samples(id), eq BUFFER_SIZE - i - 1);
+        }
+    }
+
     #[test]
     fn send_until_overflow_works<Sut: ZeroCopyConnection>() {
         let id = ChannelId::new(0);
@@ -889,6 +927,65 @@ mod zero_copy_connection {
         };
     }
 
+    #[test]
+    fn used_offsets_of_dead_sender_are_available_to_its_successor<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        const BUFFER_SIZE: usize = 10;
+        let name = generate_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_sender = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(BUFFER_SIZE)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(BUFFER_SIZE)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        let mut offsets = HashSet::new();
+        for i in 0..3 {
+            let sample_offset = SAMPLE_SIZE * i;
+            offsets.insert(sample_offset);
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(sample_offset), SAMPLE_SIZE, id),
+                is_ok
+            );
+        }
+
+        let received_offset = sut_receiver.receive(id).unwrap().unwrap();
+        assert_that!(sut_receiver.release(received_offset, id), is_ok);
+
+        // the sender dies and a successor takes over the connection
+        core::mem::forget(sut_sender);
+        assert_that!(unsafe { Sut::remove_sender(&name, &config) }, is_ok);
+        let sut_successor = Sut::Builder::new(&name)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .buffer_size(BUFFER_SIZE)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+
+        let mut used_offsets = HashSet::new();
+        sut_successor.used_offsets(|offset| {
+            used_offsets.insert(offset.offset());
+        });
+        assert_that!(used_offsets, eq offsets);
+
+        assert_that!(sut_successor.reclaim(id), eq Ok(Some(received_offset)));
+        offsets.remove(&received_offset.offset());
+
+        let mut used_offsets = HashSet::new();
+        sut_successor.used_offsets(|offset| {
+            used_offsets.insert(offset.offset());
+        });
+        assert_that!(used_offsets, eq offsets);
+    }
+
     #[test]
     fn send_samples_can_be_acquired_with_overflow<Sut: ZeroCopyConnection>() {
         let id = ChannelId::new(0);
@@ -60,10 +60,31 @@ pub struct DetailsOptions {
     pub filter: OutputFilter,
 }
 
+#[derive(Args)]
+pub struct ReapOptions {
+    #[clap(
+        short,
+        long,
+        default_value = "1000",
+        help = "Update rate in milliseconds"
+    )]
+    pub rate: u64,
+
+    #[clap(
+        short,
+        long,
+        default_value = "16",
+        help = "The maximum number of nodes that are probed per update"
+    )]
+    pub nodes_per_cycle: usize,
+}
+
 #[derive(Subcommand)]
 pub enum Action {
     #[clap(about = "List all nodes", help_template = help_template(HelpOptions::DontPrintCommandSection))]
     List(ListOptions),
     #[clap(about = "Show node details", help_template = help_template(HelpOptions::DontPrintCommandSection))]
     Details(DetailsOptions),
+    #[clap(about = "Continuously remove the stale resources of dead nodes", help_template = help_template(HelpOptions::DontPrintCommandSection))]
+    Reap(ReapOptions),
 }
@@ -10,7 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use anyhow::{Context, Error, Result};
+use anyhow::{anyhow, Context, Error, Result};
+use iceoryx2::node::dead_node_reaper::DeadNodeReaper;
 use iceoryx2::prelude::*;
 use iceoryx2_cli::filter::Filter;
 use iceoryx2_cli::filter::NodeIdentifier;
@@ -62,3 +63,36 @@ pub fn details(identifier: NodeIdentifier, filter: OutputFilter, format: Format)
 
     Ok(())
 }
+
+pub fn reap(rate: u64, nodes_per_cycle: usize) -> Result<()> {
+    let mut reaper = DeadNodeReaper::<ipc::Service>::new(Config::global_config())
+        .nodes_per_cycle(nodes_per_cycle);
+
+    println!("=== Reaper Started (rate: {}ms) ===", rate);
+
+    let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+    let guard = waitset
+        .attach_interval(core::time::Duration::from_millis(rate))
+        .map_err(|e| anyhow!("failed to attach interval to waitset: {:?}", e))?;
+    let attachment = WaitSetAttachmentId::from_guard(&guard);
+
+    let on_event = |attachment_id: WaitSetAttachmentId<ipc::Service>| {
+        if attachment_id == attachment {
+            let cleanup_state = reaper.reap();
+            if cleanup_state.cleanups != 0 || cleanup_state.failed_cleanups != 0 {
+                println!(
+                    "removed {} dead nodes, {} dead nodes could not be removed",
+                    cleanup_state.cleanups, cleanup_state.failed_cleanups
+                );
+            }
+        }
+
+        CallbackProgression::Continue
+    };
+
+    waitset
+        .wait_and_process(on_event)
+        .map_err(|e| anyhow!("error waiting on waitset: {:?}", e))?;
+
+    Ok(())
+}
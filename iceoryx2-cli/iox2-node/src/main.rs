@@ -55,6 +55,11 @@ fn main() -> Result<()> {
                     eprintln!("Failed to retrieve node details: {}", e);
                 }
             }
+            Action::Reap(options) => {
+                if let Err(e) = commands::reap(options.rate, options.nodes_per_cycle) {
+                    eprintln!("Failed to reap dead nodes: {}", e);
+                }
+            }
         }
     } else {
         Cli::command().print_help().expect("Failed to print help");
@@ -59,6 +59,12 @@ pub struct DetailsOptions {
     pub filter: OutputFilter,
 }
 
+#[derive(Parser)]
+pub struct MemoryUsageOptions {
+    #[clap(help = "Name of the publish-subscribe service e.g. \"My Service\"")]
+    pub service: String,
+}
+
 #[derive(Parser)]
 pub struct DiscoveryOptions {
     #[clap(
@@ -154,6 +160,11 @@ pub enum Action {
         help_template = help_template(HelpOptions::DontPrintCommandSection)
     )]
     Details(DetailsOptions),
+    #[clap(
+        about = "Show the shared memory usage of a publish-subscribe service",
+        help_template = help_template(HelpOptions::DontPrintCommandSection)
+    )]
+    MemoryUsage(MemoryUsageOptions),
     #[clap(
         about = "Runs the service discovery service within a process",
         help_template = help_template(HelpOptions::DontPrintCommandSection)
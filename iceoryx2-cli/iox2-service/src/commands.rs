@@ -16,6 +16,10 @@ use std::io::Write;
 use anyhow::anyhow;
 use anyhow::{Context, Error, Result};
 use iceoryx2::prelude::*;
+use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
+use iceoryx2::service::memory_usage::MemoryUsage;
+use iceoryx2::service::static_config::message_type_details::MessageTypeDetails;
+use iceoryx2::service::static_config::messaging_pattern::MessagingPattern;
 use iceoryx2_cli::filter::Filter;
 use iceoryx2_cli::output::ServiceDescription;
 use iceoryx2_cli::output::ServiceDescriptor;
@@ -43,6 +47,14 @@ struct EventFeedback {
     event_id: Option<usize>,
 }
 
+#[derive(Serialize)]
+struct ServiceMemoryUsage {
+    service: String,
+    mapped: usize,
+    used: usize,
+    usage: MemoryUsage,
+}
+
 pub fn listen(options: ListenOptions, format: Format) -> Result<()> {
     let node = NodeBuilder::new()
         .name(&NodeName::new(&options.node_name)?)
@@ -178,6 +190,48 @@ pub fn details(service_name: String, filter: OutputFilter, format: Format) -> Re
     Ok(())
 }
 
+pub fn memory_usage(service_name: String, format: Format) -> Result<()> {
+    let mut message_type_details: Option<MessageTypeDetails> = None;
+
+    ipc::Service::list(Config::global_config(), |service| {
+        if service_name == service.static_details.name().to_string() {
+            if let MessagingPattern::PublishSubscribe(config) =
+                service.static_details.messaging_pattern()
+            {
+                message_type_details = Some(config.message_type_details().clone());
+                return CallbackProgression::Stop;
+            }
+        }
+        CallbackProgression::Continue
+    })?;
+
+    let message_type_details = message_type_details
+        .ok_or_else(|| anyhow!("no publish-subscribe service with the name found"))?;
+
+    let node = NodeBuilder::new().create::<ipc::Service>()?;
+    let service = unsafe {
+        node.service_builder(&ServiceName::new(&service_name)?)
+            .publish_subscribe::<[CustomPayloadMarker]>()
+            .user_header::<CustomHeaderMarker>()
+            .__internal_set_payload_type_details(&message_type_details.payload)
+            .__internal_set_user_header_type_details(&message_type_details.user_header)
+    }
+    .open()?;
+
+    let usage = service.memory_usage();
+    print!(
+        "{}",
+        format.as_string(&ServiceMemoryUsage {
+            service: service_name,
+            mapped: usage.mapped(),
+            used: usage.used(),
+            usage,
+        })?
+    );
+
+    Ok(())
+}
+
 pub fn discovery(
     rate: u64,
     publish_events: bool,
@@ -66,6 +66,11 @@ fn main() -> Result<()> {
                     error!("failed to retrieve service details: {}", e);
                 }
             }
+            Action::MemoryUsage(options) => {
+                if let Err(e) = commands::memory_usage(options.service, cli.format) {
+                    error!("failed to retrieve service memory usage: {}", e);
+                }
+            }
             Action::Discovery(options) => {
                 let should_publish = !options.disable_publish;
                 let should_notify = !options.disable_notify;
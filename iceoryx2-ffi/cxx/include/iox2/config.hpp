@@ -18,6 +18,7 @@
 #include "iox/path.hpp"
 #include "iox2/config_creation_error.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/performance_profile.hpp"
 #include "iox2/unable_to_deliver_strategy.hpp"
 
 namespace iox2 {
@@ -421,6 +422,10 @@ class Config {
     /// Returns the [`config::Defaults`] part of the config
     auto defaults() -> config::Defaults;
 
+    /// Replaces the publish-subscribe defaults with the settings of the provided
+    /// [`PerformanceProfile`].
+    void apply_profile(PerformanceProfile profile);
+
     /// Returns a [`ConfigView`] to the current global config.
     static auto global_config() -> ConfigView;
 
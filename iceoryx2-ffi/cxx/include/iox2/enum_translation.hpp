@@ -27,6 +27,7 @@
 #include "iox2/node_failure_enums.hpp"
 #include "iox2/node_wait_failure.hpp"
 #include "iox2/notifier_error.hpp"
+#include "iox2/performance_profile.hpp"
 #include "iox2/port_error.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/semantic_string.hpp"
@@ -566,6 +567,10 @@ constexpr auto from<int, iox2::PublishSubscribeOpenOrCreateError>(const int valu
         return iox2::PublishSubscribeOpenOrCreateError::OpenDoesNotSupportRequestedAmountOfNodes;
     case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR:
         return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleOverflowBehavior;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_DELIVERY_MODE:
+        return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleDeliveryMode;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES:
+        return iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleNumberOfPriorityLanes;
     case iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS:
         return iox2::PublishSubscribeOpenOrCreateError::OpenInsufficientPermissions;
     case iox2_pub_sub_open_or_create_error_e_O_SERVICE_IN_CORRUPTED_STATE:
@@ -628,6 +633,10 @@ constexpr auto from<int, iox2::PublishSubscribeOpenError>(const int value) noexc
         return iox2::PublishSubscribeOpenError::DoesNotSupportRequestedAmountOfNodes;
     case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR:
         return iox2::PublishSubscribeOpenError::IncompatibleOverflowBehavior;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_DELIVERY_MODE:
+        return iox2::PublishSubscribeOpenError::IncompatibleDeliveryMode;
+    case iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES:
+        return iox2::PublishSubscribeOpenError::IncompatibleNumberOfPriorityLanes;
     case iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS:
         return iox2::PublishSubscribeOpenError::InsufficientPermissions;
     case iox2_pub_sub_open_or_create_error_e_O_SERVICE_IN_CORRUPTED_STATE:
@@ -671,6 +680,10 @@ constexpr auto from<iox2::PublishSubscribeOpenError, iox2_pub_sub_open_or_create
         return iox2_pub_sub_open_or_create_error_e_O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES;
     case iox2::PublishSubscribeOpenError::IncompatibleOverflowBehavior:
         return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR;
+    case iox2::PublishSubscribeOpenError::IncompatibleDeliveryMode:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_DELIVERY_MODE;
+    case iox2::PublishSubscribeOpenError::IncompatibleNumberOfPriorityLanes:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES;
     case iox2::PublishSubscribeOpenError::InsufficientPermissions:
         return iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS;
     case iox2::PublishSubscribeOpenError::ServiceInCorruptedState:
@@ -773,6 +786,10 @@ constexpr auto from<iox2::PublishSubscribeOpenOrCreateError, iox2_pub_sub_open_o
         return iox2_pub_sub_open_or_create_error_e_O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES;
     case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleOverflowBehavior:
         return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_OVERFLOW_BEHAVIOR;
+    case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleDeliveryMode:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_DELIVERY_MODE;
+    case iox2::PublishSubscribeOpenOrCreateError::OpenIncompatibleNumberOfPriorityLanes:
+        return iox2_pub_sub_open_or_create_error_e_O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES;
     case iox2::PublishSubscribeOpenOrCreateError::OpenInsufficientPermissions:
         return iox2_pub_sub_open_or_create_error_e_O_INSUFFICIENT_PERMISSIONS;
     case iox2::PublishSubscribeOpenOrCreateError::OpenServiceInCorruptedState:
@@ -1317,6 +1334,8 @@ constexpr auto from<int, iox2::PublisherCreateError>(const int value) noexcept -
         return iox2::PublisherCreateError::ExceedsMaxSupportedPublishers;
     case iox2_publisher_create_error_e_UNABLE_TO_CREATE_DATA_SEGMENT:
         return iox2::PublisherCreateError::UnableToCreateDataSegment;
+    case iox2_publisher_create_error_e_UNABLE_TO_CREATE_BROADCAST_RING:
+        return iox2::PublisherCreateError::UnableToCreateBroadcastRing;
     }
 
     IOX_UNREACHABLE();
@@ -1331,6 +1350,8 @@ from<iox2::PublisherCreateError, iox2_publisher_create_error_e>(const iox2::Publ
         return iox2_publisher_create_error_e_EXCEEDS_MAX_SUPPORTED_PUBLISHERS;
     case iox2::PublisherCreateError::UnableToCreateDataSegment:
         return iox2_publisher_create_error_e_UNABLE_TO_CREATE_DATA_SEGMENT;
+    case iox2::PublisherCreateError::UnableToCreateBroadcastRing:
+        return iox2_publisher_create_error_e_UNABLE_TO_CREATE_BROADCAST_RING;
     }
 
     IOX_UNREACHABLE();
@@ -1350,6 +1371,16 @@ constexpr auto from<int, iox2::SubscriberCreateError>(const int value) noexcept
         return iox2::SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService;
     case iox2_subscriber_create_error_e_EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS:
         return iox2::SubscriberCreateError::ExceedsMaxSupportedSubscribers;
+    case iox2_subscriber_create_error_e_UNABLE_TO_CREATE_DATA_ARRIVAL_NOTIFICATION:
+        return iox2::SubscriberCreateError::UnableToCreateDataArrivalNotification;
+    case iox2_subscriber_create_error_e_GROUPS_NOT_SUPPORTED_BY_DELIVERY_MODE:
+        return iox2::SubscriberCreateError::GroupsNotSupportedByDeliveryMode;
+    case iox2_subscriber_create_error_e_DOWNSAMPLING_NOT_SUPPORTED_BY_DELIVERY_MODE:
+        return iox2::SubscriberCreateError::DownsamplingNotSupportedByDeliveryMode;
+    case iox2_subscriber_create_error_e_INVALID_CONFLATION_KEY_OFFSET:
+        return iox2::SubscriberCreateError::InvalidConflationKeyOffset;
+    case iox2_subscriber_create_error_e_CONFLATION_CAPACITY_EXCEEDS_MAX_BORROWED_SAMPLES:
+        return iox2::SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples;
     }
 
     IOX_UNREACHABLE();
@@ -1364,6 +1395,16 @@ from<iox2::SubscriberCreateError, iox2_subscriber_create_error_e>(const iox2::Su
         return iox2_subscriber_create_error_e_BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE;
     case iox2::SubscriberCreateError::ExceedsMaxSupportedSubscribers:
         return iox2_subscriber_create_error_e_EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS;
+    case iox2::SubscriberCreateError::UnableToCreateDataArrivalNotification:
+        return iox2_subscriber_create_error_e_UNABLE_TO_CREATE_DATA_ARRIVAL_NOTIFICATION;
+    case iox2::SubscriberCreateError::GroupsNotSupportedByDeliveryMode:
+        return iox2_subscriber_create_error_e_GROUPS_NOT_SUPPORTED_BY_DELIVERY_MODE;
+    case iox2::SubscriberCreateError::DownsamplingNotSupportedByDeliveryMode:
+        return iox2_subscriber_create_error_e_DOWNSAMPLING_NOT_SUPPORTED_BY_DELIVERY_MODE;
+    case iox2::SubscriberCreateError::InvalidConflationKeyOffset:
+        return iox2_subscriber_create_error_e_INVALID_CONFLATION_KEY_OFFSET;
+    case iox2::SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples:
+        return iox2_subscriber_create_error_e_CONFLATION_CAPACITY_EXCEEDS_MAX_BORROWED_SAMPLES;
     }
 
     IOX_UNREACHABLE();
@@ -1637,6 +1678,21 @@ constexpr auto from<iox2::UnableToDeliverStrategy, int>(const iox2::UnableToDeli
     IOX_UNREACHABLE();
 }
 
+template <>
+constexpr auto from<iox2::PerformanceProfile, iox2_performance_profile_e>(const iox2::PerformanceProfile value) noexcept
+    -> iox2_performance_profile_e {
+    switch (value) {
+    case iox2::PerformanceProfile::LowLatency:
+        return iox2_performance_profile_e_LOW_LATENCY;
+    case iox2::PerformanceProfile::HighThroughput:
+        return iox2_performance_profile_e_HIGH_THROUGHPUT;
+    case iox2::PerformanceProfile::LowMemory:
+        return iox2_performance_profile_e_LOW_MEMORY;
+    }
+
+    IOX_UNREACHABLE();
+}
+
 template <>
 constexpr auto from<int, iox2::ConnectionFailure>(const int value) noexcept -> iox2::ConnectionFailure {
     const auto variant = static_cast<iox2_connection_failure_e>(value);
@@ -1762,6 +1818,14 @@ constexpr auto from<int, iox2::WaitSetCreateError>(const int value) noexcept ->
     switch (variant) {
     case iox2_waitset_create_error_e_INTERNAL_ERROR:
         return iox2::WaitSetCreateError::InternalError;
+    case iox2_waitset_create_error_e_INVALID_CPU_CORE:
+        return iox2::WaitSetCreateError::InvalidCpuCore;
+    case iox2_waitset_create_error_e_INSUFFICIENT_PERMISSIONS:
+        return iox2::WaitSetCreateError::InsufficientPermissions;
+    case iox2_waitset_create_error_e_UNABLE_TO_LOCK_MEMORY:
+        return iox2::WaitSetCreateError::UnableToLockMemory;
+    case iox2_waitset_create_error_e_UNSUPPORTED_REACTOR_MECHANISM:
+        return iox2::WaitSetCreateError::UnsupportedReactorMechanism;
     }
 
     IOX_UNREACHABLE();
@@ -1774,6 +1838,33 @@ from<iox2::WaitSetCreateError, iox2_waitset_create_error_e>(const iox2::WaitSetC
     switch (value) {
     case iox2::WaitSetCreateError::InternalError:
         return iox2_waitset_create_error_e_INTERNAL_ERROR;
+    case iox2::WaitSetCreateError::InvalidCpuCore:
+        return iox2_waitset_create_error_e_INVALID_CPU_CORE;
+    case iox2::WaitSetCreateError::InsufficientPermissions:
+        return iox2_waitset_create_error_e_INSUFFICIENT_PERMISSIONS;
+    case iox2::WaitSetCreateError::UnableToLockMemory:
+        return iox2_waitset_create_error_e_UNABLE_TO_LOCK_MEMORY;
+    case iox2::WaitSetCreateError::UnsupportedReactorMechanism:
+        return iox2_waitset_create_error_e_UNSUPPORTED_REACTOR_MECHANISM;
+    }
+
+    IOX_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::ReactorMechanism, iox2_reactor_mechanism_e>(const iox2::ReactorMechanism value) noexcept
+    -> iox2_reactor_mechanism_e {
+    switch (value) {
+    case iox2::ReactorMechanism::Native:
+        return iox2_reactor_mechanism_e_NATIVE;
+    case iox2::ReactorMechanism::Select:
+        return iox2_reactor_mechanism_e_SELECT;
+    case iox2::ReactorMechanism::Epoll:
+        return iox2_reactor_mechanism_e_EPOLL;
+    case iox2::ReactorMechanism::IoUring:
+        return iox2_reactor_mechanism_e_IO_URING;
+    case iox2::ReactorMechanism::IoUringSqPoll:
+        return iox2_reactor_mechanism_e_IO_URING_SQ_POLL;
     }
 
     IOX_UNREACHABLE();
@@ -1828,6 +1919,8 @@ constexpr auto from<int, iox2::WaitSetAttachmentError>(const int value) noexcept
         return iox2::WaitSetAttachmentError::InsufficientCapacity;
     case iox2_waitset_attachment_error_e_INTERNAL_ERROR:
         return iox2::WaitSetAttachmentError::InternalError;
+    case iox2_waitset_attachment_error_e_NOT_MULTIPLEXABLE:
+        return iox2::WaitSetAttachmentError::NotMultiplexable;
     }
 
     IOX_UNREACHABLE();
@@ -1844,6 +1937,8 @@ from<iox2::WaitSetAttachmentError, iox2_waitset_attachment_error_e>(const iox2::
         return iox2_waitset_attachment_error_e_INSUFFICIENT_CAPACITY;
     case iox2::WaitSetAttachmentError::InternalError:
         return iox2_waitset_attachment_error_e_INTERNAL_ERROR;
+    case iox2::WaitSetAttachmentError::NotMultiplexable:
+        return iox2_waitset_attachment_error_e_NOT_MULTIPLEXABLE;
     }
 
     IOX_UNREACHABLE();
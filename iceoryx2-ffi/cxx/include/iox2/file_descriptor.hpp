@@ -55,6 +55,8 @@ class FileDescriptorView : public FileDescriptorBased {
     friend class FileDescriptor;
     template <ServiceType>
     friend class Listener;
+    template <ServiceType, typename, typename>
+    friend class Subscriber;
 
     explicit FileDescriptorView(iox2_file_descriptor_ptr handle);
 
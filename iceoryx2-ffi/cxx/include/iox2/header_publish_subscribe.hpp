@@ -43,6 +43,26 @@ class HeaderPublishSubscribe {
 
     iox2_publish_subscribe_header_h m_handle = nullptr;
 };
+
+/// Trivially copyable copy of the header of a received [`Sample`]. It is read directly from the
+/// header in the shared memory and, in contrast to [`HeaderPublishSubscribe`], it does not
+/// own any resources, so acquiring it on every received [`Sample`] does not allocate.
+class HeaderPublishSubscribeValue {
+  public:
+    /// Returns the [`UniquePublisherIdValue`] of the source [`Publisher`].
+    auto publisher_id() const -> UniquePublisherIdValue;
+
+    /// Returns the number of [`Payload`] elements in the received [`Sample`].
+    auto number_of_elements() const -> uint64_t;
+
+  private:
+    template <ServiceType, typename, typename>
+    friend class Sample;
+
+    explicit HeaderPublishSubscribeValue(const iox2_publish_subscribe_header_value_t& value);
+
+    iox2_publish_subscribe_header_value_t m_value;
+};
 } // namespace iox2
 
 #endif
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_MEMORY_USAGE_HPP
+#define IOX2_MEMORY_USAGE_HPP
+
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/service_type.hpp"
+
+#include <cstdint>
+
+namespace iox2 {
+/// The number of bytes of one category of shared memory.
+struct MemoryRegionUsage {
+    /// The number of bytes that are reserved for the category.
+    uint64_t mapped;
+    /// The number of bytes that are occupied by samples or port entries. Memory that is
+    /// preallocated for exactly one port or connection counts as used as a whole.
+    uint64_t used;
+};
+
+/// The shared memory consumption of a [`Service`] or a port, broken down into the payload
+/// data segments, the connection queues and the management structures.
+class MemoryUsage {
+  public:
+    /// Returns the usage of the data segments that contain the payload of the samples.
+    auto data_segments() const -> MemoryRegionUsage;
+
+    /// Returns the usage of the queues of the connections between the ports.
+    auto connections() const -> MemoryRegionUsage;
+
+    /// Returns the usage of the dynamic configuration of the [`Service`] that tracks
+    /// the nodes and ports.
+    auto management() const -> MemoryRegionUsage;
+
+    /// Returns the sum of the mapped bytes of all categories.
+    auto mapped() const -> uint64_t;
+
+    /// Returns the sum of the used bytes of all categories.
+    auto used() const -> uint64_t;
+
+  private:
+    template <ServiceType, typename, typename>
+    friend class PortFactoryPublishSubscribe;
+    template <ServiceType, typename, typename>
+    friend class Publisher;
+    template <ServiceType, typename, typename>
+    friend class Subscriber;
+
+    explicit MemoryUsage(iox2_memory_usage_t value);
+
+    iox2_memory_usage_t m_value;
+};
+} // namespace iox2
+
+#endif
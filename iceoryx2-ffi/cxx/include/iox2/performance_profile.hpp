@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_PERFORMANCE_PROFILE_HPP
+#define IOX2_PERFORMANCE_PROFILE_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Named presets for the publish-subscribe settings. The settings of every profile are
+/// defined in the `[profiles.*]` sections of the config file. A profile can be applied to
+/// all services with [`Config::apply_profile()`] or to a single service with
+/// [`ServiceBuilderPublishSubscribe::performance_profile()`].
+enum class PerformanceProfile : uint8_t {
+    /// Small buffers that always contain the most recent sample, so that no
+    /// [`Publisher`] ever waits for a [`Subscriber`].
+    LowLatency,
+    /// Large buffers without overflow, so that bursts are absorbed and no [`Sample`]
+    /// is lost.
+    HighThroughput,
+    /// The smallest number of ports and samples, to minimize the size of the data
+    /// segments and connections.
+    LowMemory
+};
+} // namespace iox2
+
+#endif
@@ -20,6 +20,7 @@
 #include "iox2/dynamic_config_publish_subscribe.hpp"
 #include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/memory_usage.hpp"
 #include "iox2/node_failure_enums.hpp"
 #include "iox2/node_state.hpp"
 #include "iox2/port_factory_publisher.hpp"
@@ -60,6 +61,12 @@ class PortFactoryPublishSubscribe {
     /// Contains all dynamic settings, like the current participants etc..
     auto dynamic_config() const -> DynamicConfigPublishSubscribe;
 
+    /// Returns the [`MemoryUsage`] of the [`Service`] with all [`Publisher`]s and
+    /// [`Subscriber`]s of all processes. It is derived from the static and dynamic
+    /// configuration, therefore the used bytes of the data segments are not known and
+    /// reported as zero. They can be acquired with [`Publisher::memory_usage()`].
+    auto memory_usage() const -> MemoryUsage;
+
     /// Iterates over all [`Node`]s of the [`Service`]
     /// and calls for every [`Node`] the provided callback. If an error occurs
     /// while acquiring the [`Node`]s corresponding [`NodeState`] the error is
@@ -153,6 +160,14 @@ inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::dynamic_config(
     return DynamicConfigPublishSubscribe(m_handle);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::memory_usage() const -> MemoryUsage {
+    iox2_memory_usage_t memory_usage {};
+    iox2_port_factory_pub_sub_memory_usage(&m_handle, &memory_usage);
+
+    return MemoryUsage(memory_usage);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::nodes(
     const iox::function<CallbackProgression(NodeState<S>)>& callback) const -> iox::expected<void, NodeListFailure> {
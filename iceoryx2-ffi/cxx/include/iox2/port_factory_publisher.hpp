@@ -14,6 +14,7 @@
 #define IOX2_PORTFACTORY_PUBLISHER_HPP
 
 #include "iox/builder_addendum.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox2/allocation_strategy.hpp"
 #include "iox2/internal/iceoryx2.hpp"
@@ -35,6 +36,19 @@ class PortFactoryPublisher {
     /// [`Publisher::loan()`] or [`Publisher::loan_uninit()`] in parallel.
     IOX_BUILDER_OPTIONAL(uint64_t, max_loaned_samples);
 
+    /// Defines how many chunks that were returned by the [`Subscriber`]s the [`Publisher`]
+    /// keeps in a local cache so that the most recently returned chunk is loaned first.
+    /// `0` disables the cache.
+    IOX_BUILDER_OPTIONAL(uint64_t, chunk_cache_size);
+
+    /// Enables warm restarts. When the process of the [`Publisher`] dies, its data segment and
+    /// connections are retained and adopted by the next [`Publisher`] created with the same key.
+    IOX_BUILDER_OPTIONAL(uint64_t, warm_restart_key);
+
+    /// Defines the time after which the [`Sample`]s sent by the [`Publisher`] expire. It
+    /// overrides the sample time to live of the [`Service`].
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, time_to_live);
+
   public:
     PortFactoryPublisher(const PortFactoryPublisher&) = delete;
     PortFactoryPublisher(PortFactoryPublisher&&) = default;
@@ -54,6 +68,18 @@ class PortFactoryPublisher {
     template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
     auto allocation_strategy(AllocationStrategy value) && -> PortFactoryPublisher&&;
 
+    /// Enables an overflow segment for slices that are larger than
+    /// [`PortFactoryPublisher::initial_max_slice_len()`]. Slices with up to `value` elements
+    /// are served from a separate shared memory segment that is created with the first oversized
+    /// loan. Only supported with [`AllocationStrategy::Static`].
+    template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
+    auto overflow_max_slice_len(uint64_t value) && -> PortFactoryPublisher&&;
+
+    /// Defines how many oversized slices can be in flight at the same time, see
+    /// [`PortFactoryPublisher::overflow_max_slice_len()`].
+    template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
+    auto overflow_number_of_samples(uint64_t value) && -> PortFactoryPublisher&&;
+
     /// Creates a new [`Publisher`] or returns a [`PublisherCreateError`] on failure.
     auto create() && -> iox::expected<Publisher<S, Payload, UserHeader>, PublisherCreateError>;
 
@@ -66,6 +92,8 @@ class PortFactoryPublisher {
     iox2_port_factory_publisher_builder_h m_handle = nullptr;
     iox::optional<uint64_t> m_max_slice_len;
     iox::optional<AllocationStrategy> m_allocation_strategy;
+    iox::optional<uint64_t> m_overflow_max_slice_len;
+    iox::optional<uint64_t> m_overflow_number_of_samples;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -89,6 +117,22 @@ inline auto PortFactoryPublisher<S, Payload, UserHeader>::allocation_strategy(
     return std::move(*this);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename T, typename>
+inline auto
+PortFactoryPublisher<S, Payload, UserHeader>::overflow_max_slice_len(uint64_t value) && -> PortFactoryPublisher&& {
+    m_overflow_max_slice_len.emplace(value);
+    return std::move(*this);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename T, typename>
+inline auto
+PortFactoryPublisher<S, Payload, UserHeader>::overflow_number_of_samples(uint64_t value) && -> PortFactoryPublisher&& {
+    m_overflow_number_of_samples.emplace(value);
+    return std::move(*this);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto
 PortFactoryPublisher<S, Payload, UserHeader>::create() && -> iox::expected<Publisher<S, Payload, UserHeader>,
@@ -102,10 +146,24 @@ PortFactoryPublisher<S, Payload, UserHeader>::create() && -> iox::expected<Publi
         .or_else([&]() { iox2_port_factory_publisher_builder_set_initial_max_slice_len(&m_handle, 1); });
     m_max_loaned_samples.and_then(
         [&](auto value) { iox2_port_factory_publisher_builder_set_max_loaned_samples(&m_handle, value); });
+    m_chunk_cache_size.and_then(
+        [&](auto value) { iox2_port_factory_publisher_builder_set_chunk_cache_size(&m_handle, value); });
+    m_warm_restart_key.and_then(
+        [&](auto value) { iox2_port_factory_publisher_builder_set_warm_restart_key(&m_handle, value); });
+    m_time_to_live.and_then([&](auto value) {
+        iox2_port_factory_publisher_builder_set_time_to_live(
+            &m_handle,
+            value.toSeconds(),
+            value.toNanoseconds() - (value.toSeconds() * iox::units::Duration::NANOSECS_PER_SEC));
+    });
     m_allocation_strategy.and_then([&](auto value) {
         iox2_port_factory_publisher_builder_set_allocation_strategy(&m_handle,
                                                                     iox::into<iox2_allocation_strategy_e>(value));
     });
+    m_overflow_max_slice_len.and_then(
+        [&](auto value) { iox2_port_factory_publisher_builder_set_overflow_max_slice_len(&m_handle, value); });
+    m_overflow_number_of_samples.and_then(
+        [&](auto value) { iox2_port_factory_publisher_builder_set_overflow_number_of_samples(&m_handle, value); });
 
     iox2_publisher_h pub_handle {};
 
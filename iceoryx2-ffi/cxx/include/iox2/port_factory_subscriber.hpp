@@ -14,6 +14,7 @@
 #define IOX2_PORTFACTORY_SUBSCRIBER_HPP
 
 #include "iox/builder_addendum.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/service_type.hpp"
@@ -30,6 +31,41 @@ class PortFactorySubscriber {
     /// Defines the required buffer size of the [`Subscriber`]. Smallest possible value is `1`.
     IOX_BUILDER_OPTIONAL(uint64_t, buffer_size);
 
+    /// Defines if the [`Subscriber`] shall be notified by the [`Publisher`] whenever a new
+    /// [`Sample`] was delivered. When enabled, the [`Subscriber`] can be attached directly to a
+    /// [`WaitSet`] without an additional event service.
+    IOX_BUILDER_OPTIONAL(bool, notify_on_data_arrival);
+
+    /// Adds the [`Subscriber`] to a group of competing consumers. Every [`Sample`] is delivered
+    /// to only one member of the group, the one with the fewest unreceived samples in its buffer.
+    /// Members of a group do not receive the history of the [`Service`].
+    IOX_BUILDER_OPTIONAL(uint64_t, group);
+
+    /// Requests that the [`Publisher`]s deliver only the first and then every n-th [`Sample`].
+    /// The skipped samples never enter the buffer of the [`Subscriber`]. Not supported for
+    /// members of a group or services with a broadcast ring.
+    IOX_BUILDER_OPTIONAL(uint64_t, downsampling_every_nth);
+
+    /// Requests that the [`Publisher`]s deliver a [`Sample`] only when at least the given
+    /// interval has passed since the last delivered one. Not supported for members of a group or
+    /// services with a broadcast ring. When combined with
+    /// [`PortFactorySubscriber::downsampling_every_nth()`] the interval takes precedence.
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, downsampling_min_interval);
+
+    /// Conflates the received [`Sample`]s by a `uint64_t` key in the user header. Whenever the
+    /// [`Subscriber`] receives, it keeps only the newest sample of every key and returns the
+    /// superseded ones to the [`Publisher`]. At most the given number of keys is stored, the
+    /// stored samples count towards the maximum number of borrowed samples. A capacity that
+    /// exceeds this maximum lets [`PortFactorySubscriber::create()`] fail with
+    /// [`SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples`].
+    IOX_BUILDER_OPTIONAL(uint64_t, conflation_capacity);
+
+    /// Defines the offset in bytes of the `uint64_t` conflation key inside the user header,
+    /// see [`PortFactorySubscriber::conflation_capacity()`]. Defaults to 0. When the key is not
+    /// located completely inside the user header, [`PortFactorySubscriber::create()`] fails with
+    /// [`SubscriberCreateError::InvalidConflationKeyOffset`].
+    IOX_BUILDER_OPTIONAL(uint64_t, conflation_key_offset);
+
   public:
     PortFactorySubscriber(const PortFactorySubscriber&) = delete;
     PortFactorySubscriber(PortFactorySubscriber&&) = default;
@@ -60,6 +96,20 @@ inline auto
 PortFactorySubscriber<S, Payload, UserHeader>::create() && -> iox::expected<Subscriber<S, Payload, UserHeader>,
                                                                             SubscriberCreateError> {
     m_buffer_size.and_then([&](auto value) { iox2_port_factory_subscriber_builder_set_buffer_size(&m_handle, value); });
+    m_notify_on_data_arrival.and_then(
+        [&](auto value) { iox2_port_factory_subscriber_builder_set_notify_on_data_arrival(&m_handle, value); });
+    m_group.and_then([&](auto value) { iox2_port_factory_subscriber_builder_set_group(&m_handle, value); });
+    m_downsampling_every_nth.and_then(
+        [&](auto value) { iox2_port_factory_subscriber_builder_set_downsampling_every_nth(&m_handle, value); });
+    m_downsampling_min_interval.and_then([&](auto value) {
+        iox2_port_factory_subscriber_builder_set_downsampling_min_interval(
+            &m_handle,
+            value.toSeconds(),
+            value.toNanoseconds() - (value.toSeconds() * iox::units::Duration::NANOSECS_PER_SEC));
+    });
+    m_conflation_capacity.and_then([&](auto value) {
+        iox2_port_factory_subscriber_builder_set_conflation(&m_handle, value, m_conflation_key_offset.value_or(0));
+    });
 
     iox2_subscriber_h sub_handle {};
     auto result = iox2_port_factory_subscriber_builder_create(m_handle, nullptr, &sub_handle);
@@ -18,6 +18,7 @@
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/memory_usage.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/sample_mut.hpp"
 #include "iox2/sample_mut_uninit.hpp"
@@ -48,6 +49,19 @@ class Publisher {
     /// since the [`Subscriber`]s buffer is full.
     auto unable_to_deliver_strategy() const -> UnableToDeliverStrategy;
 
+    /// Returns the [`MemoryUsage`] of the [`Publisher`]. The used bytes of the data segments
+    /// are the bytes of all samples that are currently loaned or not yet released
+    /// by all [`Subscriber`]s.
+    auto memory_usage() const -> MemoryUsage;
+
+    /// Returns the physical memory of all data segment chunks that are neither loaned nor held
+    /// by any [`Subscriber`] to the operating system and shrinks an enlarged, unused dynamic
+    /// data segment to its initial size. Growing and shrinking the dynamic data segment each
+    /// consume one of its limited reallocations. Once only a reserve of reallocations is left,
+    /// the segment keeps its enlarged size so that it can still grow, and only unused pages are
+    /// released. Returns the number of released bytes.
+    auto release_unused_memory() const -> uint64_t;
+
     /// Returns the maximum number of elements that can be loaned in a slice.
     template <typename T = Payload, typename = std::enable_if_t<iox::IsSlice<T>::VALUE, void>>
     auto initial_max_slice_len() const -> uint64_t;
@@ -149,6 +163,18 @@ inline auto Publisher<S, Payload, UserHeader>::unable_to_deliver_strategy() cons
     return iox::into<UnableToDeliverStrategy>(static_cast<int>(iox2_publisher_unable_to_deliver_strategy(&m_handle)));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Publisher<S, Payload, UserHeader>::memory_usage() const -> MemoryUsage {
+    iox2_memory_usage_t memory_usage {};
+    iox2_publisher_memory_usage(&m_handle, &memory_usage);
+
+    return MemoryUsage(memory_usage);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Publisher<S, Payload, UserHeader>::release_unused_memory() const -> uint64_t {
+    return iox2_publisher_release_unused_memory(&m_handle);
+}
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
@@ -29,6 +29,9 @@ enum class PublisherCreateError : uint8_t {
     /// The datasegment in which the payload of the [`Publisher`] is stored,
     /// could not be created.
     UnableToCreateDataSegment,
+    /// The broadcast ring via which the [`Publisher`] delivers its samples
+    /// could not be created.
+    UnableToCreateBroadcastRing,
 };
 } // namespace iox2
 
@@ -67,9 +67,20 @@ class Sample {
     /// Returns a reference to the [`Header`] of the [`Sample`].
     auto header() const -> HeaderPublishSubscribe;
 
+    /// Returns a copy of the [`Header`] of the [`Sample`]. It is trivially copyable and
+    /// acquiring it does not allocate.
+    auto header_value() const -> HeaderPublishSubscribeValue;
+
     /// Returns the [`UniquePublisherId`] of the [`Publisher`](crate::port::publisher::Publisher)
     auto origin() const -> UniquePublisherId;
 
+    /// Returns the [`UniquePublisherIdValue`] of the [`Publisher`](crate::port::publisher::Publisher).
+    /// Acquiring it does not allocate.
+    auto origin_value() const -> UniquePublisherIdValue;
+
+    /// Returns the priority lane via which the [`Sample`] was delivered.
+    auto priority() const -> uint64_t;
+
   private:
     template <ServiceType, typename, typename>
     friend class Subscriber;
@@ -168,11 +179,29 @@ inline auto Sample<S, Payload, UserHeader>::header() const -> HeaderPublishSubsc
     return HeaderPublishSubscribe { header_handle };
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Sample<S, Payload, UserHeader>::header_value() const -> HeaderPublishSubscribeValue {
+    iox2_publish_subscribe_header_value_t header_value {};
+    iox2_sample_header_value(&m_handle, &header_value);
+
+    return HeaderPublishSubscribeValue { header_value };
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Sample<S, Payload, UserHeader>::origin() const -> UniquePublisherId {
     return header().publisher_id();
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Sample<S, Payload, UserHeader>::origin_value() const -> UniquePublisherIdValue {
+    return header_value().publisher_id();
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Sample<S, Payload, UserHeader>::priority() const -> uint64_t {
+    return iox2_sample_priority(&m_handle);
+}
+
 } // namespace iox2
 
 #endif
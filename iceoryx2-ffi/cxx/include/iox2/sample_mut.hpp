@@ -100,6 +100,9 @@ class SampleMut {
 
     template <ServiceType ST, typename PayloadT, typename UserHeaderT>
     friend auto send(SampleMut<ST, PayloadT, UserHeaderT>&& sample) -> iox::expected<size_t, SendError>;
+    template <ServiceType ST, typename PayloadT, typename UserHeaderT>
+    friend auto send_with_priority(SampleMut<ST, PayloadT, UserHeaderT>&& sample, uint64_t priority)
+        -> iox::expected<size_t, SendError>;
 
     // The sample is defaulted since both members are initialized in Publisher::loan() or
     // Publisher::loan_slice()
@@ -251,6 +254,20 @@ inline auto send(SampleMut<S, Payload, UserHeader>&& sample) -> iox::expected<si
     return iox::err(iox::into<SendError>(result));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto send_with_priority(SampleMut<S, Payload, UserHeader>&& sample, const uint64_t priority)
+    -> iox::expected<size_t, SendError> {
+    size_t number_of_recipients = 0;
+    auto result = iox2_sample_mut_send_with_priority(sample.m_handle, priority, &number_of_recipients);
+    sample.m_handle = nullptr;
+
+    if (result == IOX2_OK) {
+        return iox::ok(number_of_recipients);
+    }
+
+    return iox::err(iox::into<SendError>(result));
+}
+
 } // namespace iox2
 
 #endif
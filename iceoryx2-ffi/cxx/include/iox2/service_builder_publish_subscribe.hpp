@@ -14,6 +14,7 @@
 #define IOX2_SERVICE_BUILDER_PUBLISH_SUBSCRIBE_HPP
 
 #include "iox/builder_addendum.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "iox/layout.hpp"
 #include "iox2/attribute_specifier.hpp"
@@ -21,6 +22,7 @@
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/internal/service_builder_internal.hpp"
 #include "iox2/payload_info.hpp"
+#include "iox2/performance_profile.hpp"
 #include "iox2/port_factory_publish_subscribe.hpp"
 #include "iox2/service_builder_publish_subscribe_error.hpp"
 #include "iox2/service_type.hpp"
@@ -39,6 +41,28 @@ class ServiceBuilderPublishSubscribe {
     /// [`Service`] is opened it requires the service to have the defined overflow behavior.
     IOX_BUILDER_OPTIONAL(bool, enable_safe_overflow);
 
+    /// If the [`Service`] is created with a value greater 0, every [`Publisher`] delivers its
+    /// samples via a broadcast ring with the given number of entries instead of the buffers of
+    /// the [`Subscriber`]s. The ring always overwrites the oldest sample, a slow [`Subscriber`]
+    /// loses samples and can query the number with [`Subscriber::missed_samples()`]. If an
+    /// existing [`Service`] is opened it requires a broadcast ring with at least the given size
+    /// when the value is greater 0 and no broadcast ring otherwise.
+    IOX_BUILDER_OPTIONAL(uint64_t, broadcast_ring_size);
+
+    /// If the [`Service`] is created it defines the number of priority lanes of every
+    /// connection. A [`Publisher`] selects the lane with [`send_with_priority()`] and a
+    /// [`Subscriber`] receives the samples of the highest lane first. The subscriber buffer
+    /// size and the number of borrowed samples apply to every lane. If an existing [`Service`]
+    /// is opened it requires the same number of lanes.
+    IOX_BUILDER_OPTIONAL(uint64_t, number_of_priority_lanes);
+
+    /// If the [`Service`] is created it defines the time after which a sent [`Sample`]
+    /// expires. A [`Subscriber`] discards expired samples while receiving and counts them in
+    /// [`Subscriber::expired_samples()`]. A [`Publisher`] can override it with
+    /// [`PortFactoryPublisher::time_to_live()`]. The value is not considered when an existing
+    /// [`Service`] is opened.
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, sample_time_to_live);
+
     /// If the [`Service`] is created it defines how many [`crate::sample::Sample`] a
     /// [`crate::port::subscriber::Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -69,6 +93,11 @@ class ServiceBuilderPublishSubscribe {
     /// [`Node`](crate::node::Node)s must be at least supported.
     IOX_BUILDER_OPTIONAL(uint64_t, max_nodes);
 
+    /// If the [`Service`] is created it uses the settings of the provided [`PerformanceProfile`]
+    /// from the [`Config`] of the [`Node`] instead of the publish-subscribe defaults. Settings
+    /// that are defined explicitly, like the subscriber max buffer size, always take precedence.
+    IOX_BUILDER_OPTIONAL(PerformanceProfile, performance_profile);
+
   public:
     /// Sets the user header type of the [`Service`].
     template <typename NewHeader>
@@ -121,8 +150,22 @@ inline ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::ServiceBuilderPub
 
 template <typename Payload, typename UserHeader, ServiceType S>
 inline void ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::set_parameters() {
+    m_performance_profile.and_then([&](auto value) {
+        iox2_service_builder_pub_sub_set_performance_profile(&m_handle,
+                                                             iox::into<iox2_performance_profile_e>(value));
+    });
     m_enable_safe_overflow.and_then(
         [&](auto value) { iox2_service_builder_pub_sub_set_enable_safe_overflow(&m_handle, value); });
+    m_broadcast_ring_size.and_then(
+        [&](auto value) { iox2_service_builder_pub_sub_set_broadcast_ring_size(&m_handle, value); });
+    m_number_of_priority_lanes.and_then(
+        [&](auto value) { iox2_service_builder_pub_sub_set_number_of_priority_lanes(&m_handle, value); });
+    m_sample_time_to_live.and_then([&](auto value) {
+        iox2_service_builder_pub_sub_set_sample_time_to_live(
+            &m_handle,
+            value.toSeconds(),
+            value.toNanoseconds() - (value.toSeconds() * iox::units::Duration::NANOSECS_PER_SEC));
+    });
     m_subscriber_max_borrowed_samples.and_then(
         [&](auto value) { iox2_service_builder_pub_sub_set_subscriber_max_borrowed_samples(&m_handle, value); });
     m_history_size.and_then([&](auto value) { iox2_service_builder_pub_sub_set_history_size(&m_handle, value); });
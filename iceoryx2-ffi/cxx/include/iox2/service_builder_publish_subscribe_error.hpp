@@ -49,6 +49,11 @@ enum class PublishSubscribeOpenError : uint8_t {
     DoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     IncompatibleOverflowBehavior,
+    /// The [`Service`] does not deliver the samples via a broadcast ring of
+    /// the requested size or it uses a broadcast ring but none was requested.
+    IncompatibleDeliveryMode,
+    /// The [`Service`] has a different number of priority lanes than requested.
+    IncompatibleNumberOfPriorityLanes,
     /// The process has not enough permissions to open the [`Service`]
     InsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing,
@@ -127,6 +132,11 @@ enum class PublishSubscribeOpenOrCreateError : uint8_t {
     OpenDoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     OpenIncompatibleOverflowBehavior,
+    /// The [`Service`] does not deliver the samples via a broadcast ring of
+    /// the requested size or it uses a broadcast ring but none was requested.
+    OpenIncompatibleDeliveryMode,
+    /// The [`Service`] has a different number of priority lanes than requested.
+    OpenIncompatibleNumberOfPriorityLanes,
     /// The process has not enough permissions to open the [`Service`]
     OpenInsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing,
@@ -13,6 +13,8 @@
 #ifndef IOX2_STATIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 #define IOX2_STATIC_CONFIG_PUBLISH_SUBSCRIBE_HPP
 
+#include "iox/duration.hpp"
+#include "iox/optional.hpp"
 #include "iox2/attribute_set.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/message_type_details.hpp"
@@ -49,6 +51,20 @@ class StaticConfigPublishSubscribe {
     /// [`Sample`] from the [`Subscriber`] when its buffer is full.
     auto has_safe_overflow() const -> bool;
 
+    /// Returns the number of entries of the broadcast ring via which the [`Publisher`]s
+    /// deliver their samples. When it is 0 the samples are delivered into the buffer of every
+    /// [`Subscriber`].
+    auto broadcast_ring_size() const -> uint64_t;
+
+    /// Returns the number of priority lanes of every connection between a [`Publisher`] and a
+    /// [`Subscriber`]. Samples in a higher lane are received first.
+    auto number_of_priority_lanes() const -> uint64_t;
+
+    /// Returns the time after which a sent [`Sample`] expires. Expired samples are discarded
+    /// by the [`Subscriber`] instead of being received. When it is not set the samples never
+    /// expire.
+    auto sample_time_to_live() const -> iox::optional<iox::units::Duration>;
+
     /// Returns the type details of the [`Service`].
     auto message_type_details() const -> MessageTypeDetails;
 
@@ -17,8 +17,10 @@
 #include "iox/expected.hpp"
 #include "iox/optional.hpp"
 #include "iox2/connection_failure.hpp"
+#include "iox2/file_descriptor.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/memory_usage.hpp"
 #include "iox2/sample.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/subscriber_error.hpp"
@@ -42,6 +44,20 @@ class Subscriber {
     /// Returns the internal buffer size of the [`Subscriber`].
     auto buffer_size() const -> uint64_t;
 
+    /// Returns the number of samples the [`Subscriber`] missed since they were overwritten in
+    /// the broadcast ring of a [`Publisher`] before they were received. Only a [`Service`] with
+    /// a broadcast ring can lose samples this way, otherwise it is always 0.
+    auto missed_samples() const -> uint64_t;
+
+    /// Returns the number of samples the [`Subscriber`] discarded while receiving since their
+    /// time to live had expired.
+    auto expired_samples() const -> uint64_t;
+
+    /// Returns the [`MemoryUsage`] of the [`Subscriber`]. It contains the data segments of all
+    /// connected [`Publisher`]s the [`Subscriber`] has mapped and the receiving side of all
+    /// connections.
+    auto memory_usage() const -> MemoryUsage;
+
     /// Receives a [`Sample`] from [`Publisher`]. If no sample could be
     /// received [`None`] is returned. If a failure occurs [`ReceiveError`] is returned.
     auto receive() const -> iox::expected<iox::optional<Sample<S, Payload, UserHeader>>, ReceiveError>;
@@ -50,6 +66,17 @@ class Subscriber {
     /// acquired via [`Subscriber::receive()`], otherwise false.
     auto has_samples() const -> iox::expected<bool, ConnectionFailure>;
 
+    /// Returns true if the [`Subscriber`] was created with
+    /// [`PortFactorySubscriber::notify_on_data_arrival()`] enabled. Only then it can be
+    /// attached to a [`WaitSet`].
+    auto has_data_arrival_notification() const -> bool;
+
+    /// Returns a [`FileDescriptorView`] that signals the arrival of new [`Sample`]s when the
+    /// [`Subscriber`] was created with [`PortFactorySubscriber::notify_on_data_arrival()`]
+    /// enabled, otherwise [`None`]. The signal is consumed when [`Subscriber::receive()`]
+    /// returns no more [`Sample`]s.
+    auto file_descriptor() const -> iox::optional<FileDescriptorView>;
+
   private:
     template <ServiceType, typename, typename>
     friend class PortFactorySubscriber;
@@ -105,6 +132,21 @@ inline auto Subscriber<S, Payload, UserHeader>::has_samples() const -> iox::expe
     return iox::err(iox::into<ConnectionFailure>(result));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::has_data_arrival_notification() const -> bool {
+    return iox2_subscriber_has_data_arrival_notification(&m_handle);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::file_descriptor() const -> iox::optional<FileDescriptorView> {
+    auto* handle = iox2_subscriber_get_file_descriptor(&m_handle);
+    if (handle == nullptr) {
+        return iox::nullopt;
+    }
+
+    return FileDescriptorView(handle);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::id() const -> UniqueSubscriberId {
     iox2_unique_subscriber_id_h id_handle = nullptr;
@@ -118,6 +160,24 @@ inline auto Subscriber<S, Payload, UserHeader>::buffer_size() const -> uint64_t
     return iox2_subscriber_buffer_size(&m_handle);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::missed_samples() const -> uint64_t {
+    return iox2_subscriber_missed_samples(&m_handle);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::expired_samples() const -> uint64_t {
+    return iox2_subscriber_expired_samples(&m_handle);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::memory_usage() const -> MemoryUsage {
+    iox2_memory_usage_t memory_usage {};
+    iox2_subscriber_memory_usage(&m_handle, &memory_usage);
+
+    return MemoryUsage(memory_usage);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::receive() const
     -> iox::expected<iox::optional<Sample<S, Payload, UserHeader>>, ReceiveError> {
@@ -28,6 +28,26 @@ enum class SubscriberCreateError : uint8_t {
     /// When the [`Subscriber`] requires a larger buffer size than the
     /// [`Service`] offers the creation will fail.
     BufferSizeExceedsMaxSupportedBufferSizeOfService,
+
+    /// The [`Subscriber`] was configured to be notified on data arrival but the
+    /// underlying event resource could not be created.
+    UnableToCreateDataArrivalNotification,
+
+    /// The [`Subscriber`] was configured as member of a group but the [`Service`] delivers
+    /// every sample via its broadcast ring to all [`Subscriber`]s.
+    GroupsNotSupportedByDeliveryMode,
+
+    /// The [`Subscriber`] requested downsampling but it is a member of a group or the
+    /// [`Service`] delivers every sample via its broadcast ring to all [`Subscriber`]s.
+    DownsamplingNotSupportedByDeliveryMode,
+
+    /// The conflation key at [`PortFactorySubscriber::conflation_key_offset()`] is not located
+    /// completely inside the user header of the [`Service`].
+    InvalidConflationKeyOffset,
+
+    /// The [`PortFactorySubscriber::conflation_capacity()`] exceeds the maximum number of
+    /// [`Sample`]s a [`Subscriber`] can borrow from the [`Service`].
+    ConflationCapacityExceedsMaxBorrowedSamples,
 };
 
 } // namespace iox2
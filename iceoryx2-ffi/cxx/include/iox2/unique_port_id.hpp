@@ -17,9 +17,11 @@
 #include "iox/vector.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 
+#include <array>
+
 namespace iox2 {
 
-constexpr uint64_t UNIQUE_PORT_ID_LENGTH = 16;
+constexpr uint64_t UNIQUE_PORT_ID_LENGTH = IOX2_UNIQUE_PORT_ID_LENGTH;
 using RawIdType = iox::vector<uint8_t, UNIQUE_PORT_ID_LENGTH>;
 
 /// The system-wide unique id of a [`Publisher`].
@@ -48,6 +50,24 @@ class UniquePublisherId {
     mutable iox::optional<RawIdType> m_raw_id;
 };
 
+/// Trivially copyable value of a [`UniquePublisherId`]. It does not own any resources and
+/// is created without any heap allocation, e.g. from the header of a received [`Sample`].
+class UniquePublisherIdValue {
+  public:
+    /// Creates the value of an existing [`UniquePublisherId`].
+    explicit UniquePublisherIdValue(const UniquePublisherId& id);
+
+    /// Returns the raw bytes of the id, identical to [`UniquePublisherId::bytes()`].
+    auto bytes() const -> const std::array<uint8_t, UNIQUE_PORT_ID_LENGTH>&;
+
+  private:
+    friend class HeaderPublishSubscribeValue;
+
+    explicit UniquePublisherIdValue(const std::array<uint8_t, UNIQUE_PORT_ID_LENGTH>& bytes);
+
+    std::array<uint8_t, UNIQUE_PORT_ID_LENGTH> m_bytes {};
+};
+
 /// The system-wide unique id of a [`Subscriber`].
 class UniqueSubscriberId {
   public:
@@ -177,6 +197,11 @@ class UniqueServerId {
 
 auto operator==(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool;
 auto operator<(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool;
+auto operator==(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool;
+auto operator!=(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool;
+auto operator<(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool;
+auto operator==(const UniquePublisherId& lhs, const UniquePublisherIdValue& rhs) -> bool;
+auto operator==(const UniquePublisherIdValue& lhs, const UniquePublisherId& rhs) -> bool;
 auto operator==(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool;
 auto operator<(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool;
 auto operator==(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool;
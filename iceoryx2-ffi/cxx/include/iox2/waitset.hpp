@@ -22,6 +22,7 @@
 #include "iox2/listener.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/signal_handling_mode.hpp"
+#include "iox2/subscriber.hpp"
 #include "iox2/waitset_enums.hpp"
 
 namespace iox2 {
@@ -40,6 +41,15 @@ class WaitSetGuard {
     WaitSetGuard(const WaitSetGuard&) = delete;
     auto operator=(const WaitSetGuard&) = delete;
 
+    /// Sets the priority of the attachment. When multiple attachments are ready in the same
+    /// wakeup, the attachments with the higher priority are handled first. Attachments with
+    /// the same priority are handled in the order provided by the underlying reactor.
+    /// The default priority is `0`.
+    void set_priority(uint8_t priority) const;
+
+    /// Returns the priority of the attachment.
+    auto priority() const -> uint8_t;
+
   private:
     template <ServiceType>
     friend class WaitSet;
@@ -197,6 +207,20 @@ class WaitSet {
     /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
     auto attach_notification(const Listener<S>& listener) -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
 
+    /// Attaches a [`Subscriber`] as notification to the [`WaitSet`]. Whenever a [`Sample`] arrives
+    /// the [`WaitSet`] informs the user in [`WaitSet::wait_and_process()`] to handle the event.
+    /// The [`Subscriber`] must be created with [`PortFactorySubscriber::notify_on_data_arrival()`],
+    /// otherwise [`WaitSetAttachmentError::NotMultiplexable`] is returned. The notification is
+    /// consumed when [`Subscriber::receive()`] returns no more [`Sample`]s.
+    ///
+    /// # Safety
+    ///
+    /// * The [`Subscriber`] must life at least as long as the returned [`WaitSetGuard`].
+    /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
+    template <typename Payload, typename UserHeader>
+    auto attach_notification(const Subscriber<S, Payload, UserHeader>& subscriber)
+        -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
+
     /// Attaches a [`FileDescriptorBased`] object as notification to the [`WaitSet`]. Whenever an event is received on
     /// the object the [`WaitSet`] informs the user in [`WaitSet::wait_and_process()`] to handle the event. The object
     /// cannot be attached twice and the
@@ -222,6 +246,19 @@ class WaitSet {
     auto attach_deadline(const Listener<S>& listener, iox::units::Duration deadline)
         -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
 
+    /// Attaches a [`Subscriber`] as deadline to the [`WaitSet`]. Whenever a [`Sample`] arrives or the
+    /// deadline is hit, the user is informed in [`WaitSet::wait_and_process()`].
+    /// The [`Subscriber`] must be created with [`PortFactorySubscriber::notify_on_data_arrival()`],
+    /// otherwise [`WaitSetAttachmentError::NotMultiplexable`] is returned.
+    ///
+    /// # Safety
+    ///
+    /// * The [`Subscriber`] must life at least as long as the returned [`WaitSetGuard`].
+    /// * The [`WaitSetGuard`] must life at least as long as the [`WaitsSet`].
+    template <typename Payload, typename UserHeader>
+    auto attach_deadline(const Subscriber<S, Payload, UserHeader>& subscriber, iox::units::Duration deadline)
+        -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError>;
+
     /// Attaches a [`FileDescriptorBased`] object as deadline to the [`WaitSet`]. Whenever the event is received or the
     /// deadline is hit, the user is informed in [`WaitSet::wait_and_process()`].
     /// The object cannot be attached twice and the
@@ -261,6 +298,30 @@ class WaitSetBuilder {
     /// that returns any received [`Signal`] via its [`WaitSetRunResult`] return value.
     IOX_BUILDER_OPTIONAL(SignalHandlingMode, signal_handling_mode);
 
+    /// Defines the maximum time the [`WaitSet`] spends in calling the users callback in one
+    /// wakeup. When the budget is exhausted, the remaining notifications are deferred to the
+    /// next wakeup, low priority notifications first. Missed deadlines and ticks are never
+    /// deferred.
+    IOX_BUILDER_OPTIONAL(iox::units::Duration, processing_budget);
+
+    /// Pins the thread that creates the [`WaitSet`] to the provided CPU core. Since the
+    /// [`WaitSet`] is bound to the thread that created it, the event loop runs on this core.
+    IOX_BUILDER_OPTIONAL(uint64_t, cpu_affinity);
+
+    /// Schedules the thread that creates the [`WaitSet`] with the realtime scheduler
+    /// `SCHED_FIFO` whereby `0` represents the lowest and `255` the highest priority.
+    /// Requires elevated privileges, e.g. `CAP_SYS_NICE`.
+    IOX_BUILDER_OPTIONAL(uint8_t, realtime_priority);
+
+    /// Locks all current and future memory pages of the process into RAM. It affects the
+    /// whole process and requires elevated privileges or a sufficient `RLIMIT_MEMLOCK`.
+    IOX_BUILDER_OPTIONAL(bool, lock_memory);
+
+    /// Defines the [`ReactorMechanism`] the [`WaitSet`] uses to wait on its attachments. With
+    /// many attachments [`ReactorMechanism::Epoll`] and [`ReactorMechanism::IoUring`] scale better than
+    /// [`ReactorMechanism::Select`].
+    IOX_BUILDER_OPTIONAL(ReactorMechanism, reactor_mechanism);
+
   public:
     WaitSetBuilder();
     ~WaitSetBuilder() = default;
@@ -277,5 +338,30 @@ class WaitSetBuilder {
   private:
     iox2_waitset_builder_h m_handle = nullptr;
 };
+
+template <ServiceType S>
+template <typename Payload, typename UserHeader>
+inline auto WaitSet<S>::attach_notification(const Subscriber<S, Payload, UserHeader>& subscriber)
+    -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
+    auto file_descriptor = subscriber.file_descriptor();
+    if (!file_descriptor.has_value()) {
+        return iox::err(WaitSetAttachmentError::NotMultiplexable);
+    }
+
+    return attach_notification(file_descriptor.value());
+}
+
+template <ServiceType S>
+template <typename Payload, typename UserHeader>
+inline auto WaitSet<S>::attach_deadline(const Subscriber<S, Payload, UserHeader>& subscriber,
+                                        const iox::units::Duration deadline)
+    -> iox::expected<WaitSetGuard<S>, WaitSetAttachmentError> {
+    auto file_descriptor = subscriber.file_descriptor();
+    if (!file_descriptor.has_value()) {
+        return iox::err(WaitSetAttachmentError::NotMultiplexable);
+    }
+
+    return attach_deadline(file_descriptor.value(), deadline);
+}
 } // namespace iox2
 #endif
@@ -19,7 +19,33 @@ namespace iox2 {
 /// Defines the failures that can occur when calling [`WaitSetBuilder::create()`].
 enum class WaitSetCreateError : uint8_t {
     /// An internal error has occurred.
-    InternalError
+    InternalError,
+    /// The CPU core provided with [`WaitSetBuilder::cpu_affinity()`] does not exist.
+    InvalidCpuCore,
+    /// The process lacks the privileges to apply the [`WaitSetBuilder::realtime_priority()`]
+    /// or [`WaitSetBuilder::lock_memory()`] setting.
+    InsufficientPermissions,
+    /// The memory of the process could not be locked, see [`WaitSetBuilder::lock_memory()`].
+    UnableToLockMemory,
+    /// The [`ReactorMechanism`] provided with [`WaitSetBuilder::reactor_mechanism()`] is not
+    /// supported on this platform.
+    UnsupportedReactorMechanism
+};
+
+/// Defines the mechanism the [`WaitSet`] uses to wait on its attachments.
+enum class ReactorMechanism : uint8_t {
+    /// The default mechanism of the platform.
+    Native,
+    /// Uses `select`, available on all platforms.
+    Select,
+    /// Uses `epoll`, available on Linux only. The attachments are registered only once and a
+    /// wakeup reports only the ready attachments.
+    Epoll,
+    /// Uses `io_uring` with one multishot poll per attachment, available on Linux 5.13 or newer.
+    /// Falls back to [`ReactorMechanism::Epoll`] when io_uring is not available.
+    IoUring,
+    /// Like [`ReactorMechanism::IoUring`] with a kernel thread that polls the submission queue.
+    IoUringSqPoll
 };
 
 /// States why the [`WaitSet::run()`] method returned.
@@ -41,6 +67,9 @@ enum class WaitSetAttachmentError : uint8_t {
     InsufficientCapacity,
     /// The attachment is already attached.
     AlreadyAttached,
+    /// The attachment does not provide a file descriptor, e.g. a [`Subscriber`] that was created
+    /// without [`PortFactorySubscriber::notify_on_data_arrival()`].
+    NotMultiplexable,
     /// An internal error has occurred.
     InternalError
 };
@@ -99,6 +99,10 @@ auto Config::defaults() -> config::Defaults {
     return config::Defaults(&this->m_handle);
 }
 
+void Config::apply_profile(PerformanceProfile profile) {
+    iox2_config_apply_profile(&m_handle, iox::into<iox2_performance_profile_e>(profile));
+}
+
 auto Config::global_config() -> ConfigView {
     return ConfigView { iox2_config_global_config() };
 }
@@ -12,6 +12,9 @@
 
 #include "iox2/header_publish_subscribe.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace iox2 {
 HeaderPublishSubscribe::HeaderPublishSubscribe(iox2_publish_subscribe_header_h handle)
     : m_handle { handle } {
@@ -53,4 +56,18 @@ auto HeaderPublishSubscribe::publisher_id() const -> UniquePublisherId {
 auto HeaderPublishSubscribe::number_of_elements() const -> uint64_t {
     return iox2_publish_subscribe_header_number_of_elements(&m_handle);
 }
+
+HeaderPublishSubscribeValue::HeaderPublishSubscribeValue(const iox2_publish_subscribe_header_value_t& value)
+    : m_value { value } {
+}
+
+auto HeaderPublishSubscribeValue::publisher_id() const -> UniquePublisherIdValue {
+    std::array<uint8_t, UNIQUE_PORT_ID_LENGTH> bytes {};
+    std::copy(std::begin(m_value.publisher_id), std::end(m_value.publisher_id), bytes.begin());
+    return UniquePublisherIdValue { bytes };
+}
+
+auto HeaderPublishSubscribeValue::number_of_elements() const -> uint64_t {
+    return m_value.number_of_elements;
+}
 } // namespace iox2
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/memory_usage.hpp"
+
+namespace iox2 {
+MemoryUsage::MemoryUsage(iox2_memory_usage_t value)
+    : m_value { value } {
+}
+
+auto MemoryUsage::data_segments() const -> MemoryRegionUsage {
+    return { m_value.data_segments.mapped, m_value.data_segments.used };
+}
+
+auto MemoryUsage::connections() const -> MemoryRegionUsage {
+    return { m_value.connections.mapped, m_value.connections.used };
+}
+
+auto MemoryUsage::management() const -> MemoryRegionUsage {
+    return { m_value.management.mapped, m_value.management.used };
+}
+
+auto MemoryUsage::mapped() const -> uint64_t {
+    return m_value.data_segments.mapped + m_value.connections.mapped + m_value.management.mapped;
+}
+
+auto MemoryUsage::used() const -> uint64_t {
+    return m_value.data_segments.used + m_value.connections.used + m_value.management.used;
+}
+} // namespace iox2
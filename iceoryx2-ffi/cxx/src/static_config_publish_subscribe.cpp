@@ -45,6 +45,23 @@ auto StaticConfigPublishSubscribe::has_safe_overflow() const -> bool {
     return m_value.enable_safe_overflow;
 }
 
+auto StaticConfigPublishSubscribe::broadcast_ring_size() const -> uint64_t {
+    return m_value.broadcast_ring_size;
+}
+
+auto StaticConfigPublishSubscribe::number_of_priority_lanes() const -> uint64_t {
+    return m_value.number_of_priority_lanes;
+}
+
+auto StaticConfigPublishSubscribe::sample_time_to_live() const -> iox::optional<iox::units::Duration> {
+    if (!m_value.has_sample_time_to_live) {
+        return iox::nullopt;
+    }
+
+    return { iox::units::Duration::fromSeconds(m_value.sample_time_to_live_seconds)
+             + iox::units::Duration::fromNanoseconds(m_value.sample_time_to_live_nanoseconds) };
+}
+
 auto StaticConfigPublishSubscribe::message_type_details() const -> MessageTypeDetails {
     return MessageTypeDetails(m_value.message_type_details);
 }
@@ -12,6 +12,8 @@
 
 #include "iox2/unique_port_id.hpp"
 
+#include <algorithm>
+
 namespace iox2 {
 UniquePublisherId::UniquePublisherId(UniquePublisherId&& rhs) noexcept {
     *this = std::move(rhs);
@@ -59,6 +61,41 @@ void UniquePublisherId::drop() {
     }
 }
 
+UniquePublisherIdValue::UniquePublisherIdValue(const UniquePublisherId& id) {
+    const auto& bytes = id.bytes();
+    if (bytes.has_value()) {
+        std::copy(bytes->begin(), bytes->end(), m_bytes.begin());
+    }
+}
+
+UniquePublisherIdValue::UniquePublisherIdValue(const std::array<uint8_t, UNIQUE_PORT_ID_LENGTH>& bytes)
+    : m_bytes { bytes } {
+}
+
+auto UniquePublisherIdValue::bytes() const -> const std::array<uint8_t, UNIQUE_PORT_ID_LENGTH>& {
+    return m_bytes;
+}
+
+auto operator==(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool {
+    return lhs.bytes() == rhs.bytes();
+}
+
+auto operator!=(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool {
+    return !(lhs == rhs);
+}
+
+auto operator<(const UniquePublisherIdValue& lhs, const UniquePublisherIdValue& rhs) -> bool {
+    return lhs.bytes() < rhs.bytes();
+}
+
+auto operator==(const UniquePublisherId& lhs, const UniquePublisherIdValue& rhs) -> bool {
+    return UniquePublisherIdValue { lhs } == rhs;
+}
+
+auto operator==(const UniquePublisherIdValue& lhs, const UniquePublisherId& rhs) -> bool {
+    return lhs == UniquePublisherIdValue { rhs };
+}
+
 UniqueSubscriberId::UniqueSubscriberId(UniqueSubscriberId&& rhs) noexcept {
     *this = std::move(rhs);
 }
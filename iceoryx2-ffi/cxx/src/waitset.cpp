@@ -129,6 +129,16 @@ WaitSetGuard<S>::WaitSetGuard(iox2_waitset_guard_h handle)
     : m_handle { handle } {
 }
 
+template <ServiceType S>
+void WaitSetGuard<S>::set_priority(const uint8_t priority) const {
+    iox2_waitset_guard_set_priority(&m_handle, priority);
+}
+
+template <ServiceType S>
+auto WaitSetGuard<S>::priority() const -> uint8_t {
+    return iox2_waitset_guard_priority(&m_handle);
+}
+
 template <ServiceType S>
 void WaitSetGuard<S>::drop() {
     if (m_handle != nullptr) {
@@ -159,6 +169,22 @@ auto WaitSetBuilder::create() const&& -> iox::expected<WaitSet<S>, WaitSetCreate
             &m_handle, iox::into<iox2_signal_handling_mode_e>(m_signal_handling_mode.value()));
     }
 
+    if (m_processing_budget.has_value()) {
+        const auto& budget = m_processing_budget.value();
+        iox2_waitset_builder_set_processing_budget(
+            &m_handle,
+            budget.toSeconds(),
+            budget.toNanoseconds() - (budget.toSeconds() * iox::units::Duration::NANOSECS_PER_SEC));
+    }
+
+    m_cpu_affinity.and_then(
+        [&](auto value) { iox2_waitset_builder_set_cpu_affinity(&m_handle, static_cast<size_t>(value)); });
+    m_realtime_priority.and_then([&](auto value) { iox2_waitset_builder_set_realtime_priority(&m_handle, value); });
+    m_lock_memory.and_then([&](auto value) { iox2_waitset_builder_set_lock_memory(&m_handle, value); });
+    m_reactor_mechanism.and_then([&](auto value) {
+        iox2_waitset_builder_set_reactor_mechanism(&m_handle, iox::into<iox2_reactor_mechanism_e>(value));
+    });
+
     iox2_waitset_h waitset_handle {};
     auto result = iox2_waitset_builder_create(m_handle, iox::into<iox2_service_type_e>(S), nullptr, &waitset_handle);
 
@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+// The allocations of the Rust and the C++ side both end up in 'malloc'. Interposing it is the only
+// way to observe both. Since the interposition affects the whole executable and relies on glibc
+// internals, these tests are a separate executable that is only built with glibc and without sanitizers.
+
+#include "iox2/header_publish_subscribe.hpp"
+#include "iox2/node.hpp"
+#include "iox2/publisher.hpp"
+#include "iox2/service.hpp"
+#include "iox2/subscriber.hpp"
+#include "iox2/unique_port_id.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cerrno>
+
+namespace {
+std::atomic<bool> COUNT_ALLOCATIONS { false }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<uint64_t> NUMBER_OF_ALLOCATIONS { 0 }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void count_allocation() {
+    if (COUNT_ALLOCATIONS.load(std::memory_order_relaxed)) {
+        NUMBER_OF_ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+} // namespace
+
+// NOLINTBEGIN(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp) interposing libc
+extern "C" {
+auto __libc_malloc(size_t size) -> void*;
+auto __libc_calloc(size_t count, size_t size) -> void*;
+auto __libc_realloc(void* ptr, size_t size) -> void*;
+auto __libc_memalign(size_t alignment, size_t size) -> void*;
+
+auto malloc(size_t size) noexcept -> void* {
+    count_allocation();
+    return __libc_malloc(size);
+}
+
+auto calloc(size_t count, size_t size) noexcept -> void* {
+    count_allocation();
+    return __libc_calloc(count, size);
+}
+
+auto realloc(void* ptr, size_t size) noexcept -> void* {
+    count_allocation();
+    return __libc_realloc(ptr, size);
+}
+
+auto posix_memalign(void** ptr, size_t alignment, size_t size) noexcept -> int {
+    count_allocation();
+    *ptr = __libc_memalign(alignment, size);
+    return *ptr == nullptr ? ENOMEM : 0;
+}
+}
+// NOLINTEND(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+
+namespace {
+using namespace iox2;
+
+template <typename T>
+class AllocationTest : public ::testing::Test {
+  public:
+    static constexpr ServiceType TYPE = T::TYPE;
+};
+
+TYPED_TEST_SUITE(AllocationTest, iox2_testing::ServiceTypes, );
+
+TYPED_TEST(AllocationTest, receiving_sample_and_reading_header_does_not_allocate) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t ITERATIONS = 100;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    // establishes the connection so that only the steady state is measured
+    sut_publisher.send_copy(0).expect("");
+    ASSERT_TRUE(sut_subscriber.receive().expect("").has_value());
+
+    uint64_t sum_of_elements = 0;
+    for (uint64_t i = 0; i < ITERATIONS; ++i) {
+        sut_publisher.send_copy(i).expect("");
+
+        NUMBER_OF_ALLOCATIONS.store(0);
+        COUNT_ALLOCATIONS.store(true);
+        {
+            auto sample = sut_subscriber.receive().expect("");
+            if (sample.has_value()) {
+                auto header = sample->header_value();
+                auto origin = sample->origin_value();
+                sum_of_elements += header.number_of_elements() + origin.bytes().size();
+            }
+        }
+        COUNT_ALLOCATIONS.store(false);
+
+        ASSERT_THAT(NUMBER_OF_ALLOCATIONS.load(), Eq(0));
+    }
+
+    ASSERT_THAT(sum_of_elements, Eq(ITERATIONS * (1 + UNIQUE_PORT_ID_LENGTH)));
+}
+} // namespace
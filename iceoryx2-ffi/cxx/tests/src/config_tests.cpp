@@ -399,4 +399,17 @@ TEST(Config, defaults_request_response_enable_fire_and_forget_requests) {
     config.defaults().request_response().set_enable_fire_and_forget_requests(false);
     ASSERT_THAT(config.defaults().request_response().enable_fire_and_forget_requests(), Eq(false));
 }
+
+TEST(Config, apply_profile_replaces_publish_subscribe_defaults) {
+    auto config = Config();
+
+    config.apply_profile(PerformanceProfile::HighThroughput);
+    ASSERT_THAT(config.defaults().publish_subscribe().enable_safe_overflow(), Eq(false));
+    const auto high_throughput_buffer_size = config.defaults().publish_subscribe().subscriber_max_buffer_size();
+
+    config.apply_profile(PerformanceProfile::LowLatency);
+    ASSERT_THAT(config.defaults().publish_subscribe().enable_safe_overflow(), Eq(true));
+    ASSERT_THAT(config.defaults().publish_subscribe().subscriber_max_buffer_size(),
+                Lt(high_throughput_buffer_size));
+}
 } // namespace
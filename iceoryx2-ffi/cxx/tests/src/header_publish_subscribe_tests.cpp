@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/header_publish_subscribe.hpp"
+#include "iox2/node.hpp"
+#include "iox2/publisher.hpp"
+#include "iox2/service.hpp"
+#include "iox2/subscriber.hpp"
+#include "iox2/unique_port_id.hpp"
+
+#include "test.hpp"
+
+#include <type_traits>
+
+namespace {
+using namespace iox2;
+
+template <typename T>
+class HeaderPublishSubscribeTest : public ::testing::Test {
+  public:
+    static constexpr ServiceType TYPE = T::TYPE;
+};
+
+TYPED_TEST_SUITE(HeaderPublishSubscribeTest, iox2_testing::ServiceTypes, );
+
+TYPED_TEST(HeaderPublishSubscribeTest, header_and_origin_of_sample_are_trivially_copyable) {
+    static_assert(std::is_trivially_copyable_v<HeaderPublishSubscribeValue>,
+                  "the sample header must not own any resources");
+    static_assert(std::is_trivially_copyable_v<UniquePublisherIdValue>, "the sample origin must not own any resources");
+}
+
+TYPED_TEST(HeaderPublishSubscribeTest, header_of_received_sample_contains_origin_and_number_of_elements) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_ELEMENTS = 7;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service =
+        node.service_builder(service_name).template publish_subscribe<iox::Slice<uint64_t>>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder().initial_max_slice_len(NUMBER_OF_ELEMENTS).create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    send(sut_publisher.loan_slice(NUMBER_OF_ELEMENTS).expect("")).expect("");
+
+    auto sample = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(sample.has_value());
+
+    auto header = sample->header_value();
+    auto header_copy = header;
+
+    ASSERT_THAT(header.number_of_elements(), Eq(NUMBER_OF_ELEMENTS));
+    ASSERT_THAT(header_copy.number_of_elements(), Eq(NUMBER_OF_ELEMENTS));
+    ASSERT_TRUE(sut_publisher.id() == header.publisher_id());
+    ASSERT_TRUE(header.publisher_id() == sut_publisher.id());
+    ASSERT_TRUE(header_copy.publisher_id() == sample->origin_value());
+    ASSERT_TRUE(sample->origin_value() == UniquePublisherIdValue(sut_publisher.id()));
+}
+
+TYPED_TEST(HeaderPublishSubscribeTest, header_and_header_value_of_received_sample_are_equal) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    sut_publisher.send_copy(1).expect("");
+
+    auto sample = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(sample.has_value());
+
+    HeaderPublishSubscribe header = sample->header();
+    ASSERT_THAT(header.number_of_elements(), Eq(sample->header_value().number_of_elements()));
+    ASSERT_TRUE(header.publisher_id() == sut_publisher.id());
+    ASSERT_TRUE(sample->origin() == sample->origin_value());
+}
+
+TYPED_TEST(HeaderPublishSubscribeTest, origins_of_different_publishers_differ) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto sut_publisher_1 = service.publisher_builder().create().expect("");
+    auto sut_publisher_2 = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    sut_publisher_1.send_copy(1).expect("");
+    sut_publisher_2.send_copy(2).expect("");
+
+    auto sample_1 = sut_subscriber.receive().expect("");
+    auto sample_2 = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(sample_1.has_value());
+    ASSERT_TRUE(sample_2.has_value());
+
+    ASSERT_TRUE(sample_1->origin_value() != sample_2->origin_value());
+    ASSERT_TRUE(sample_1->origin_value() < sample_2->origin_value()
+                || sample_2->origin_value() < sample_1->origin_value());
+}
+} // namespace
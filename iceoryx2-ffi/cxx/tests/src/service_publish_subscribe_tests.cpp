@@ -314,6 +314,44 @@ TYPED_TEST(ServicePublishSubscribeTest, slice_copy_send_receive_works) {
 }
 // NOLINTEND(readability-function-cognitive-complexity)
 
+TYPED_TEST(ServicePublishSubscribeTest, loan_slice_larger_than_initial_max_slice_len_is_served_from_overflow) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+    constexpr uint64_t OVERFLOW_SLICE_MAX_LENGTH = 1024;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service =
+        node.service_builder(service_name).template publish_subscribe<iox::Slice<uint64_t>>().create().expect("");
+
+    auto sut_publisher = service.publisher_builder()
+                             .initial_max_slice_len(SLICE_MAX_LENGTH)
+                             .overflow_max_slice_len(OVERFLOW_SLICE_MAX_LENGTH)
+                             .create()
+                             .expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+
+    auto sample = sut_publisher.loan_slice_uninit(OVERFLOW_SLICE_MAX_LENGTH).expect("");
+    auto initialized_sample = sample.write_from_fn([](auto index) { return index; });
+    send(std::move(initialized_sample)).expect("");
+
+    auto recv_result = sut_subscriber.receive().expect("");
+    ASSERT_TRUE(recv_result.has_value());
+    auto recv_sample = std::move(recv_result.value());
+
+    ASSERT_THAT(recv_sample.payload().number_of_elements(), Eq(OVERFLOW_SLICE_MAX_LENGTH));
+    uint64_t index = 0;
+    for (const auto& item : recv_sample.payload()) {
+        ASSERT_THAT(item, Eq(index));
+        ++index;
+    }
+
+    auto exceeding_sample = sut_publisher.loan_slice_uninit(OVERFLOW_SLICE_MAX_LENGTH + 1);
+    ASSERT_TRUE(exceeding_sample.has_error());
+    ASSERT_THAT(exceeding_sample.error(), Eq(LoanError::ExceedsMaxLoanSize));
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, loan_slice_send_receive_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
     constexpr uint64_t PAYLOAD_ALIGNMENT = 8;
@@ -375,6 +413,62 @@ TYPED_TEST(ServicePublishSubscribeTest, number_of_publishers_subscribers_works)
     ASSERT_THAT(service.dynamic_config().number_of_subscribers(), Eq(0));
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, performance_profile_defines_service_settings) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t EXPLICIT_BUFFER_SIZE = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto config = Config();
+    config.apply_profile(PerformanceProfile::HighThroughput);
+    const auto expected_max_subscribers = config.defaults().publish_subscribe().max_subscribers();
+    const auto expected_safe_overflow = config.defaults().publish_subscribe().enable_safe_overflow();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .performance_profile(PerformanceProfile::HighThroughput)
+                       .subscriber_max_buffer_size(EXPLICIT_BUFFER_SIZE)
+                       .create()
+                       .expect("");
+
+    ASSERT_THAT(service.static_config().max_subscribers(), Eq(expected_max_subscribers));
+    ASSERT_THAT(service.static_config().has_safe_overflow(), Eq(expected_safe_overflow));
+    ASSERT_THAT(service.static_config().subscriber_max_buffer_size(), Eq(EXPLICIT_BUFFER_SIZE));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, memory_usage_grows_with_ports) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().expect("");
+
+    auto usage_without_ports = service.memory_usage();
+    ASSERT_THAT(usage_without_ports.data_segments().mapped, Eq(0));
+    ASSERT_THAT(usage_without_ports.connections().mapped, Eq(0));
+    ASSERT_THAT(usage_without_ports.management().mapped, Gt(0));
+
+    auto sut_publisher = service.publisher_builder().create().expect("");
+    auto sut_subscriber = service.subscriber_builder().create().expect("");
+    ASSERT_FALSE(sut_publisher.update_connections().has_error());
+    ASSERT_FALSE(sut_subscriber.receive().has_error());
+
+    auto usage = service.memory_usage();
+    ASSERT_THAT(usage.data_segments().mapped, Gt(0));
+    ASSERT_THAT(usage.connections().mapped, Gt(0));
+    ASSERT_THAT(usage.management().used, Gt(usage_without_ports.management().used));
+    ASSERT_THAT(usage.mapped(), Gt(usage_without_ports.mapped()));
+
+    ASSERT_THAT(sut_publisher.memory_usage().data_segments().mapped, Gt(0));
+    ASSERT_THAT(sut_publisher.memory_usage().connections().mapped, Gt(0));
+    ASSERT_THAT(sut_subscriber.memory_usage().connections().mapped, Gt(0));
+
+    ASSERT_THAT(sut_publisher.memory_usage().data_segments().used, Eq(0));
+    auto sample = sut_publisher.loan().expect("");
+    ASSERT_THAT(sut_publisher.memory_usage().data_segments().used, Gt(0));
+}
+
 
 // NOLINTBEGIN(readability-function-cognitive-complexity) : Cognitive complexity of 26 (+1) is OK. Test case is complex.
 TYPED_TEST(ServicePublishSubscribeTest, loan_slice_uninit_send_receive_works) {
@@ -730,6 +824,53 @@ TYPED_TEST(ServicePublishSubscribeTest, send_receive_with_user_header_works) {
     }
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, conflation_key_outside_of_user_header_fails) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t CONFLATION_CAPACITY = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .template user_header<uint64_t>()
+                       .subscriber_max_borrowed_samples(CONFLATION_CAPACITY)
+                       .create()
+                       .expect("");
+
+    auto sut_valid = service.subscriber_builder()
+                         .conflation_capacity(CONFLATION_CAPACITY)
+                         .conflation_key_offset(0)
+                         .create();
+    ASSERT_THAT(sut_valid.has_error(), Eq(false));
+
+    auto sut_invalid = service.subscriber_builder()
+                           .conflation_capacity(CONFLATION_CAPACITY)
+                           .conflation_key_offset(1)
+                           .create();
+    ASSERT_THAT(sut_invalid.has_error(), Eq(true));
+    ASSERT_THAT(sut_invalid.error(), Eq(SubscriberCreateError::InvalidConflationKeyOffset));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, conflation_capacity_exceeding_max_borrowed_samples_fails) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t MAX_BORROWED_SAMPLES = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().expect("");
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .template user_header<uint64_t>()
+                       .subscriber_max_borrowed_samples(MAX_BORROWED_SAMPLES)
+                       .create()
+                       .expect("");
+
+    auto sut = service.subscriber_builder().conflation_capacity(MAX_BORROWED_SAMPLES + 1).create();
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    ASSERT_THAT(sut.error(), Eq(SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples));
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, has_sample_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
@@ -17,6 +17,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <limits>
 #include <vector>
 
 namespace {
@@ -130,6 +131,44 @@ TYPED_TEST(WaitSetTest, attaching_same_notification_twice_fails) {
     ASSERT_THAT(result_2.get_error(), Eq(WaitSetAttachmentError::AlreadyAttached));
 }
 
+TYPED_TEST(WaitSetTest, create_with_non_existing_cpu_core_fails) {
+    constexpr ServiceType TYPE = TestFixture::TYPE;
+    auto sut = WaitSetBuilder().cpu_affinity(std::numeric_limits<uint64_t>::max()).template create<TYPE>();
+
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    ASSERT_THAT(sut.get_error(), Eq(WaitSetCreateError::InvalidCpuCore));
+}
+
+TYPED_TEST(WaitSetTest, create_with_epoll_reactor_mechanism_works_only_on_linux) {
+    constexpr ServiceType TYPE = TestFixture::TYPE;
+    auto sut = WaitSetBuilder().reactor_mechanism(ReactorMechanism::Epoll).template create<TYPE>();
+
+#ifdef __linux__
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto listener = this->create_listener();
+    auto guard = sut.value().attach_notification(listener);
+    ASSERT_THAT(guard.has_error(), Eq(false));
+#else
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    ASSERT_THAT(sut.get_error(), Eq(WaitSetCreateError::UnsupportedReactorMechanism));
+#endif
+}
+
+TYPED_TEST(WaitSetTest, create_with_io_uring_reactor_mechanism_works_only_on_linux) {
+    constexpr ServiceType TYPE = TestFixture::TYPE;
+    auto sut = WaitSetBuilder().reactor_mechanism(ReactorMechanism::IoUring).template create<TYPE>();
+
+#ifdef __linux__
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    auto listener = this->create_listener();
+    auto guard = sut.value().attach_notification(listener);
+    ASSERT_THAT(guard.has_error(), Eq(false));
+#else
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    ASSERT_THAT(sut.get_error(), Eq(WaitSetCreateError::UnsupportedReactorMechanism));
+#endif
+}
+
 TYPED_TEST(WaitSetTest, empty_waitset_returns_error_on_run) {
     auto sut = this->create_sut();
     auto result = sut.wait_and_process([](auto) { return CallbackProgression::Continue; });
@@ -276,6 +315,71 @@ TYPED_TEST(WaitSetTest, notification_attachment_wakes_up_when_notified) {
     ASSERT_THAT(callback_called, Eq(true));
 }
 
+TYPED_TEST(WaitSetTest, subscriber_notification_attachment_wakes_up_when_sample_arrives) {
+    auto service =
+        this->node.service_builder(generate_name()).template publish_subscribe<uint64_t>().create().expect("");
+    auto publisher = service.publisher_builder().create().expect("");
+    auto subscriber = service.subscriber_builder().notify_on_data_arrival(true).create().expect("");
+    ASSERT_THAT(subscriber.has_data_arrival_notification(), Eq(true));
+
+    auto sut = this->create_sut();
+    auto guard = sut.attach_notification(subscriber).expect("");
+
+    auto callback_called = false;
+    std::thread publisher_thread([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.toMilliseconds()));
+        publisher.send_copy(42).expect("");
+    });
+    auto result = sut.wait_and_process([&](auto attachment_id) -> CallbackProgression {
+        callback_called = true;
+        EXPECT_THAT(attachment_id.has_event_from(guard), Eq(true));
+        return CallbackProgression::Stop;
+    });
+
+    publisher_thread.join();
+    ASSERT_THAT(callback_called, Eq(true));
+
+    auto sample = subscriber.receive().expect("");
+    ASSERT_THAT(sample.has_value(), Eq(true));
+    ASSERT_THAT(sample->payload(), Eq(42));
+    ASSERT_THAT(subscriber.receive().expect("").has_value(), Eq(false));
+
+    callback_called = false;
+    auto timeout_result = sut.wait_and_process_once_with_timeout(
+        [&](auto) -> CallbackProgression {
+            callback_called = true;
+            return CallbackProgression::Continue;
+        },
+        TIMEOUT);
+    ASSERT_THAT(timeout_result.has_error(), Eq(false));
+    ASSERT_THAT(callback_called, Eq(false));
+}
+
+TYPED_TEST(WaitSetTest, subscriber_without_data_arrival_notification_has_no_file_descriptor) {
+    auto service =
+        this->node.service_builder(generate_name()).template publish_subscribe<uint64_t>().create().expect("");
+    auto subscriber = service.subscriber_builder().create().expect("");
+
+    ASSERT_THAT(subscriber.has_data_arrival_notification(), Eq(false));
+    ASSERT_THAT(subscriber.file_descriptor().has_value(), Eq(false));
+}
+
+TYPED_TEST(WaitSetTest, attaching_subscriber_without_data_arrival_notification_fails) {
+    auto service =
+        this->node.service_builder(generate_name()).template publish_subscribe<uint64_t>().create().expect("");
+    auto subscriber = service.subscriber_builder().create().expect("");
+    auto sut = this->create_sut();
+
+    auto notification_result = sut.attach_notification(subscriber);
+    ASSERT_THAT(notification_result.has_error(), Eq(true));
+    ASSERT_THAT(notification_result.get_error(), Eq(WaitSetAttachmentError::NotMultiplexable));
+
+    auto deadline_result = sut.attach_deadline(subscriber, TIMEOUT);
+    ASSERT_THAT(deadline_result.has_error(), Eq(true));
+    ASSERT_THAT(deadline_result.get_error(), Eq(WaitSetAttachmentError::NotMultiplexable));
+    ASSERT_THAT(sut.is_empty(), Eq(true));
+}
+
 TYPED_TEST(WaitSetTest, triggering_everything_works) {
     constexpr uint64_t NUMBER_OF_DEADLINES = 3;
     constexpr uint64_t NUMBER_OF_NOTIFICATIONS = 5;
@@ -327,6 +431,72 @@ TYPED_TEST(WaitSetTest, triggering_everything_works) {
     }
 }
 
+TYPED_TEST(WaitSetTest, ready_attachments_are_handled_in_priority_order) {
+    auto sut = this->create_sut();
+    auto listener_low = this->create_listener();
+    auto listener_high = this->create_listener();
+    auto notifier = this->create_notifier();
+
+    auto guard_low = sut.attach_notification(listener_low).expect("");
+    auto guard_high = sut.attach_notification(listener_high).expect("");
+    guard_high.set_priority(7);
+
+    ASSERT_THAT(guard_low.priority(), Eq(0));
+    ASSERT_THAT(guard_high.priority(), Eq(7));
+
+    notifier.notify().expect("");
+
+    std::vector<int> order;
+    sut.wait_and_process_once([&](auto attachment_id) -> CallbackProgression {
+           if (attachment_id.has_event_from(guard_high)) {
+               order.push_back(1);
+           } else if (attachment_id.has_event_from(guard_low)) {
+               order.push_back(2);
+           }
+           return CallbackProgression::Continue;
+       })
+        .expect("");
+
+    ASSERT_THAT(order, Eq(std::vector<int> { 1, 2 }));
+}
+
+TYPED_TEST(WaitSetTest, exhausted_processing_budget_defers_low_priority_notifications) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    auto sut = WaitSetBuilder().processing_budget(Duration::fromNanoseconds(1)).create<SERVICE_TYPE>().expect("");
+    auto listener_low = this->create_listener();
+    auto listener_high = this->create_listener();
+    auto notifier = this->create_notifier();
+
+    auto guard_low = sut.attach_notification(listener_low).expect("");
+    auto guard_high = sut.attach_notification(listener_high).expect("");
+    guard_high.set_priority(1);
+
+    notifier.notify().expect("");
+
+    uint64_t high_priority_calls = 0;
+    uint64_t low_priority_calls = 0;
+    auto on_event = [&](auto attachment_id) -> CallbackProgression {
+        if (attachment_id.has_event_from(guard_high)) {
+            ++high_priority_calls;
+            listener_high.try_wait_all([](auto) {}).expect("");
+        } else if (attachment_id.has_event_from(guard_low)) {
+            ++low_priority_calls;
+            listener_low.try_wait_all([](auto) {}).expect("");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return CallbackProgression::Continue;
+    };
+
+    sut.wait_and_process_once(on_event).expect("");
+    ASSERT_THAT(high_priority_calls, Eq(1));
+    ASSERT_THAT(low_priority_calls, Eq(0));
+
+    sut.wait_and_process_once_with_timeout(on_event, TIMEOUT).expect("");
+    ASSERT_THAT(high_priority_calls, Eq(1));
+    ASSERT_THAT(low_priority_calls, Eq(1));
+}
+
 TYPED_TEST(WaitSetTest, signal_handling_mode_can_be_set) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
@@ -70,7 +70,7 @@ impl ActiveRequestUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<ActiveRequestUnion>
 pub struct iox2_active_request_storage_t {
-    internal: [u8; 128], // magic number obtained with size_of::<Option<ActiveRequestUnion>>()
+    internal: [u8; 160], // magic number obtained with size_of::<Option<ActiveRequestUnion>>()
 }
 
 #[repr(C)]
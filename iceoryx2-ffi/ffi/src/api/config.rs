@@ -16,7 +16,7 @@ use crate::{api::AssertNonNullHandle, c_size_t, iox2_unable_to_deliver_strategy_
 use core::ffi::{c_char, c_int};
 use core::mem::ManuallyDrop;
 use core::time::Duration;
-use iceoryx2::config::{Config, ConfigCreationError};
+use iceoryx2::config::{Config, ConfigCreationError, PerformanceProfile};
 use iceoryx2_bb_container::semantic_string::*;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_bb_elementary_traits::AsCStr;
@@ -50,6 +50,25 @@ pub enum iox2_config_creation_error_e {
     INVALID_FILE_PATH,
 }
 
+/// Named presets for the publish-subscribe settings, see [`iox2_config_apply_profile()`].
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub enum iox2_performance_profile_e {
+    LOW_LATENCY,
+    HIGH_THROUGHPUT,
+    LOW_MEMORY,
+}
+
+impl From<iox2_performance_profile_e> for PerformanceProfile {
+    fn from(value: iox2_performance_profile_e) -> Self {
+        match value {
+            iox2_performance_profile_e::LOW_LATENCY => PerformanceProfile::LowLatency,
+            iox2_performance_profile_e::HIGH_THROUGHPUT => PerformanceProfile::HighThroughput,
+            iox2_performance_profile_e::LOW_MEMORY => PerformanceProfile::LowMemory,
+        }
+    }
+}
+
 impl IntoCInt for ConfigCreationError {
     fn into_c_int(self) -> c_int {
         (match self {
@@ -332,6 +351,23 @@ pub unsafe extern "C" fn iox2_config_clone(
     *handle_ptr = (*struct_ptr).as_handle();
 }
 
+/// Replaces the publish-subscribe defaults of the config with the settings of the provided
+/// [`iox2_performance_profile_e`].
+///
+/// # Safety
+///
+/// * `handle` - A valid non-owning [`iox2_config_h_ref`].
+#[no_mangle]
+pub unsafe extern "C" fn iox2_config_apply_profile(
+    handle: iox2_config_h_ref,
+    profile: iox2_performance_profile_e,
+) {
+    handle.assert_non_null();
+
+    let config = &mut *handle.as_type();
+    config.value.as_mut().value.apply_profile(profile.into());
+}
+
 /// Takes ownership of the handle and releases all underlying resources.
 ///
 /// # Safety
@@ -54,16 +54,16 @@ impl IntoCInt for ListenerWaitError {
     }
 }
 
-trait AcquireFileDescriptor {
+pub(super) trait AcquireFileDescriptor {
     fn acquire_file_descriptor(&self) -> Option<&FileDescriptor>;
 }
 
-struct AcquireFileDescriptorHopper<'a, T> {
+pub(super) struct AcquireFileDescriptorHopper<'a, T> {
     value: &'a T,
 }
 
 impl<'a, T> AcquireFileDescriptorHopper<'a, T> {
-    fn new(value: &'a T) -> Self {
+    pub(super) fn new(value: &'a T) -> Self {
         Self { value }
     }
 }
@@ -75,7 +75,7 @@ impl<T> AcquireFileDescriptor for AcquireFileDescriptorHopper<'_, T> {
 }
 
 impl<T: FileDescriptorBased> AcquireFileDescriptorHopper<'_, T> {
-    fn acquire_file_descriptor(&self) -> Option<&FileDescriptor> {
+    pub(super) fn acquire_file_descriptor(&self) -> Option<&FileDescriptor> {
         Some(self.value.file_descriptor())
     }
 }
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+
+use iceoryx2::service::memory_usage::{MemoryRegionUsage, MemoryUsage};
+
+#[derive(Clone, Copy, Default)]
+#[repr(C)]
+pub struct iox2_memory_region_usage_t {
+    pub mapped: usize,
+    pub used: usize,
+}
+
+impl From<&MemoryRegionUsage> for iox2_memory_region_usage_t {
+    fn from(value: &MemoryRegionUsage) -> Self {
+        Self {
+            mapped: value.mapped,
+            used: value.used,
+        }
+    }
+}
+
+#[derive(Clone, Copy, Default)]
+#[repr(C)]
+pub struct iox2_memory_usage_t {
+    pub data_segments: iox2_memory_region_usage_t,
+    pub connections: iox2_memory_region_usage_t,
+    pub management: iox2_memory_region_usage_t,
+}
+
+impl From<&MemoryUsage> for iox2_memory_usage_t {
+    fn from(value: &MemoryUsage) -> Self {
+        Self {
+            data_segments: (&value.data_segments).into(),
+            connections: (&value.connections).into(),
+            management: (&value.management).into(),
+        }
+    }
+}
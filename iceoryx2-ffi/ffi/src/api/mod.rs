@@ -33,6 +33,7 @@ mod iceoryx2_settings;
 mod listener;
 mod listener_details;
 mod log;
+mod memory_usage;
 mod message_type_details;
 mod node;
 mod node_builder;
@@ -100,6 +101,7 @@ pub use file_descriptor::*;
 pub use iceoryx2_settings::*;
 pub use listener::*;
 pub use listener_details::*;
+pub use memory_usage::*;
 pub use message_type_details::*;
 pub use node::*;
 pub use node_builder::*;
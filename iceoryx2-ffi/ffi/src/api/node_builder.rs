@@ -52,7 +52,7 @@ impl IntoCInt for NodeCreationFailure {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<NodeBuilder>
 pub struct iox2_node_builder_storage_t {
-    internal: [u8; 18696], // magic number obtained with size_of::<NodeBuilder>()
+    internal: [u8; 19200], // magic number obtained with size_of::<NodeBuilder>()
 }
 
 #[repr(C)]
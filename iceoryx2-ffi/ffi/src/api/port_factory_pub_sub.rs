@@ -38,8 +38,8 @@ use core::{
 
 use super::{
     iox2_attribute_set_ptr, iox2_callback_context, iox2_callback_progression_e,
-    iox2_node_list_callback, iox2_publisher_details_ptr, iox2_service_name_ptr,
-    iox2_subscriber_details_ptr,
+    iox2_memory_usage_t, iox2_node_list_callback, iox2_publisher_details_ptr,
+    iox2_service_name_ptr, iox2_subscriber_details_ptr,
 };
 
 // BEGIN types definition
@@ -311,6 +311,32 @@ pub unsafe extern "C" fn iox2_port_factory_pub_sub_static_config(
     *static_config = config.into();
 }
 
+/// Stores the shared memory consumption of the service with all its ports in the provided
+/// [`iox2_memory_usage_t`].
+///
+/// # Safety
+///
+/// * The `port_factory_handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+/// * The `memory_usage` must be a valid pointer and non-null.
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_memory_usage(
+    port_factory_handle: iox2_port_factory_pub_sub_h_ref,
+    memory_usage: *mut iox2_memory_usage_t,
+) {
+    port_factory_handle.assert_non_null();
+    debug_assert!(!memory_usage.is_null());
+
+    let port_factory = &mut *port_factory_handle.as_type();
+
+    let usage = match port_factory.service_type {
+        iox2_service_type_e::IPC => port_factory.value.as_ref().ipc.memory_usage(),
+        iox2_service_type_e::LOCAL => port_factory.value.as_ref().local.memory_usage(),
+    };
+
+    *memory_usage = (&usage).into();
+}
+
 /// Returns how many publisher ports are currently connected.
 ///
 /// # Safety
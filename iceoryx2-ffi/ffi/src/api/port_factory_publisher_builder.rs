@@ -27,6 +27,7 @@ use iceoryx2_ffi_macros::CStrRepr;
 
 use core::ffi::{c_char, c_int};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 // BEGIN types definition
 
@@ -95,6 +96,7 @@ impl IntoCInt for UnableToDeliverStrategy {
 pub enum iox2_publisher_create_error_e {
     EXCEEDS_MAX_SUPPORTED_PUBLISHERS = IOX2_OK as isize + 1,
     UNABLE_TO_CREATE_DATA_SEGMENT,
+    UNABLE_TO_CREATE_BROADCAST_RING,
 }
 
 impl IntoCInt for PublisherCreateError {
@@ -106,6 +108,9 @@ impl IntoCInt for PublisherCreateError {
             PublisherCreateError::UnableToCreateDataSegment => {
                 iox2_publisher_create_error_e::UNABLE_TO_CREATE_DATA_SEGMENT
             }
+            PublisherCreateError::UnableToCreateBroadcastRing => {
+                iox2_publisher_create_error_e::UNABLE_TO_CREATE_BROADCAST_RING
+            }
         }) as c_int
     }
 }
@@ -135,7 +140,7 @@ impl PortFactoryPublisherBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactoryPublisherBuilderUnion>
 pub struct iox2_port_factory_publisher_builder_storage_t {
-    internal: [u8; 128], // magic number obtained with size_of::<Option<PortFactoryPublisherBuilderUnion>>()
+    internal: [u8; 192], // magic number obtained with size_of::<Option<PortFactoryPublisherBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -295,6 +300,120 @@ pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_initial_max_sli
     }
 }
 
+/// Sets the max slice length of the overflow segment of the publisher
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The max slice length that is served from the overflow segment, 0 disables it
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_overflow_max_slice_len(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: c_size_t,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.overflow_max_slice_len(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.overflow_max_slice_len(value),
+            ));
+        }
+    }
+}
+
+/// Sets the number of samples of the overflow segment of the publisher
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The number of oversized samples that can be in flight at the same time
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_overflow_number_of_samples(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: c_size_t,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.overflow_number_of_samples(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.overflow_number_of_samples(value),
+            ));
+        }
+    }
+}
+
+/// Sets the time to live of the samples sent by the publisher
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `seconds` - the second part of the time to live
+/// * `nanoseconds` - the nanosecond part of the time to live
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_time_to_live(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    port_factory_handle.assert_non_null();
+
+    let value = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.time_to_live(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.time_to_live(value),
+            ));
+        }
+    }
+}
+
 /// Sets the max loaned samples for the publisher
 ///
 /// # Arguments
@@ -332,6 +451,81 @@ pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_max_loaned_samp
     }
 }
 
+/// Sets the number of returned chunks the publisher keeps in its local cache
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The number of cached chunks, 0 disables the cache
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_chunk_cache_size(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: c_size_t,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.chunk_cache_size(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.chunk_cache_size(value),
+            ));
+        }
+    }
+}
+
+/// Enables warm restarts for the publisher. A restarted publisher with the same key adopts the
+/// data segment and connections of its dead predecessor.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The warm restart key that identifies the publisher across restarts
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_warm_restart_key(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: u64,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                port_factory.warm_restart_key(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactoryPublisherBuilderUnion::new_local(
+                port_factory.warm_restart_key(value),
+            ));
+        }
+    }
+}
+
 // TODO [#210] add all the other setter methods
 
 /// Sets the unable to deliver strategy for the publisher
@@ -17,6 +17,7 @@ use crate::api::{
     HandleToType, IntoCInt, PayloadFfi, SubscriberUnion, UserHeaderFfi, IOX2_OK,
 };
 
+use iceoryx2::port::downsampling::Downsampling;
 use iceoryx2::port::subscriber::SubscriberCreateError;
 use iceoryx2::prelude::*;
 use iceoryx2::service::port_factory::subscriber::PortFactorySubscriber;
@@ -27,6 +28,7 @@ use iceoryx2_ffi_macros::CStrRepr;
 
 use core::ffi::{c_char, c_int};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 // BEGIN types definition
 
@@ -35,6 +37,11 @@ use core::mem::ManuallyDrop;
 pub enum iox2_subscriber_create_error_e {
     EXCEEDS_MAX_SUPPORTED_SUBSCRIBERS = IOX2_OK as isize + 1,
     BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE,
+    UNABLE_TO_CREATE_DATA_ARRIVAL_NOTIFICATION,
+    GROUPS_NOT_SUPPORTED_BY_DELIVERY_MODE,
+    DOWNSAMPLING_NOT_SUPPORTED_BY_DELIVERY_MODE,
+    INVALID_CONFLATION_KEY_OFFSET,
+    CONFLATION_CAPACITY_EXCEEDS_MAX_BORROWED_SAMPLES,
 }
 
 impl IntoCInt for SubscriberCreateError {
@@ -46,6 +53,21 @@ impl IntoCInt for SubscriberCreateError {
             SubscriberCreateError::BufferSizeExceedsMaxSupportedBufferSizeOfService => {
                 iox2_subscriber_create_error_e::BUFFER_SIZE_EXCEEDS_MAX_SUPPORTED_BUFFER_SIZE_OF_SERVICE
             }
+            SubscriberCreateError::UnableToCreateDataArrivalNotification => {
+                iox2_subscriber_create_error_e::UNABLE_TO_CREATE_DATA_ARRIVAL_NOTIFICATION
+            }
+            SubscriberCreateError::GroupsNotSupportedByDeliveryMode => {
+                iox2_subscriber_create_error_e::GROUPS_NOT_SUPPORTED_BY_DELIVERY_MODE
+            }
+            SubscriberCreateError::DownsamplingNotSupportedByDeliveryMode => {
+                iox2_subscriber_create_error_e::DOWNSAMPLING_NOT_SUPPORTED_BY_DELIVERY_MODE
+            }
+            SubscriberCreateError::InvalidConflationKeyOffset => {
+                iox2_subscriber_create_error_e::INVALID_CONFLATION_KEY_OFFSET
+            }
+            SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples => {
+                iox2_subscriber_create_error_e::CONFLATION_CAPACITY_EXCEEDS_MAX_BORROWED_SAMPLES
+            }
         }) as c_int
     }
 }
@@ -75,7 +97,7 @@ impl PortFactorySubscriberBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactorySubscriberBuilderUnion>
 pub struct iox2_port_factory_subscriber_builder_storage_t {
-    internal: [u8; 112], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
+    internal: [u8; 192], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -198,6 +220,212 @@ pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_buffer_size(
     }
 }
 
+/// Defines if the subscriber shall be notified by the publishers whenever a new sample arrives.
+/// When enabled, the subscriber provides a file descriptor via
+/// [`iox2_subscriber_get_file_descriptor`](crate::iox2_subscriber_get_file_descriptor) and can be
+/// attached to a waitset.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `value` - Enables or disables the data arrival notification
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_notify_on_data_arrival(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    value: bool,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.notify_on_data_arrival(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.notify_on_data_arrival(value),
+            ));
+        }
+    }
+}
+
+/// Adds the subscriber to a group of competing consumers. Every sample is delivered to only one
+/// member of the group, the one with the fewest unreceived samples in its buffer.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `value` - The id of the group
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_group(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    value: u64,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.group(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.group(value),
+            ));
+        }
+    }
+}
+
+/// Requests that the publishers deliver only the first and then every n-th sample to the
+/// subscriber.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `value` - The n, 0 is treated like 1
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_downsampling_every_nth(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    value: u64,
+) {
+    port_factory_handle.assert_non_null();
+
+    let value = Downsampling::EveryNth(value);
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.downsampling(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.downsampling(value),
+            ));
+        }
+    }
+}
+
+/// Requests that the publishers deliver a sample to the subscriber only when at least the
+/// given interval has passed since the last delivered sample.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `seconds` - the second part of the interval
+/// * `nanoseconds` - the nanosecond part of the interval
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_downsampling_min_interval(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    port_factory_handle.assert_non_null();
+
+    let value = Downsampling::MinInterval(
+        Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64),
+    );
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.downsampling(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.downsampling(value),
+            ));
+        }
+    }
+}
+
+/// Conflates the received samples by a key that is stored in the user header. Whenever the
+/// subscriber receives, it keeps only the newest sample of every key.
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_subscriber_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_subscriber_builder`](crate::iox2_port_factory_pub_sub_subscriber_builder).
+/// * `capacity` - The maximum number of keys that are stored. When it exceeds the maximum
+///   number of borrowed samples of the subscriber,
+///   [`iox2_port_factory_subscriber_builder_create()`] fails with
+///   [`iox2_subscriber_create_error_e::CONFLATION_CAPACITY_EXCEEDS_MAX_BORROWED_SAMPLES`].
+/// * `key_offset` - The offset in bytes of the `uint64_t` key inside the user header. When the
+///   key is not located completely inside the user header,
+///   [`iox2_port_factory_subscriber_builder_create()`] fails with
+///   [`iox2_subscriber_create_error_e::INVALID_CONFLATION_KEY_OFFSET`].
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_port_factory_subscriber_builder_set_conflation(
+    port_factory_handle: iox2_port_factory_subscriber_builder_h_ref,
+    capacity: c_size_t,
+    key_offset: c_size_t,
+) {
+    port_factory_handle.assert_non_null();
+
+    let port_factory_struct = unsafe { &mut *port_factory_handle.as_type() };
+    match port_factory_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_ipc(
+                port_factory.__internal_conflate_by_key_at_offset(capacity, key_offset),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+            port_factory_struct.set(PortFactorySubscriberBuilderUnion::new_local(
+                port_factory.__internal_conflate_by_key_at_offset(capacity, key_offset),
+            ));
+        }
+    }
+}
+
 // TODO [#210] add all the other setter methods
 
 /// Creates a subscriber and consumes the builder
@@ -18,7 +18,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 
 use crate::{
     api::AssertNonNullHandle, api::HandleToType, iox2_unique_publisher_id_h,
-    iox2_unique_publisher_id_t,
+    iox2_unique_publisher_id_t, IOX2_UNIQUE_PORT_ID_LENGTH,
 };
 
 // BEGIN types definition
@@ -27,7 +27,7 @@ use crate::{
 #[repr(C)]
 #[repr(align(8))] // core::mem::align_of::<Option<Header>>()
 pub struct iox2_publish_subscribe_header_storage_t {
-    internal: [u8; 32], // core::mem::size_of::<Option<Header>>()
+    internal: [u8; 40], // core::mem::size_of::<Option<Header>>()
 }
 
 #[repr(C)]
@@ -48,6 +48,27 @@ impl iox2_publish_subscribe_header_t {
     }
 }
 
+/// Trivially copyable copy of the sample header used by `MessagingPattern::PublishSubscribe`.
+/// It is filled directly from the header in the shared memory, does not own any resources
+/// and therefore requires neither a heap allocation nor a drop call.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct iox2_publish_subscribe_header_value_t {
+    /// The native endian bytes of the `UniquePublisherId` of the source publisher
+    pub publisher_id: [u8; IOX2_UNIQUE_PORT_ID_LENGTH],
+    /// The number of payload elements stored in the sample
+    pub number_of_elements: u64,
+}
+
+impl From<&Header> for iox2_publish_subscribe_header_value_t {
+    fn from(header: &Header) -> Self {
+        Self {
+            publisher_id: header.publisher_id().value().to_ne_bytes(),
+            number_of_elements: header.number_of_elements(),
+        }
+    }
+}
+
 pub struct iox2_publish_subscribe_header_h_t;
 /// The owning handle for [`iox2_publish_subscribe_header_t`]. Passing the handle to an function transfers the ownership.
 pub type iox2_publish_subscribe_header_h = *mut iox2_publish_subscribe_header_h_t;
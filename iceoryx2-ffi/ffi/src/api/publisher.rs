@@ -28,7 +28,7 @@ use iceoryx2_bb_elementary_traits::AsCStr;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
 use iceoryx2_ffi_macros::CStrRepr;
 
-use super::{iox2_sample_mut_h, iox2_sample_mut_t, IntoCInt};
+use super::{iox2_memory_usage_t, iox2_sample_mut_h, iox2_sample_mut_t, IntoCInt};
 
 use core::ffi::{c_char, c_int, c_void};
 use core::mem::ManuallyDrop;
@@ -343,6 +343,60 @@ pub unsafe extern "C" fn iox2_publisher_initial_max_slice_len(
     }
 }
 
+/// Stores the shared memory consumption of the publisher in the provided
+/// [`iox2_memory_usage_t`].
+///
+/// # Arguments
+///
+/// * `publisher_handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+/// * `memory_usage` - Must be a valid pointer to a [`iox2_memory_usage_t`].
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+/// * `memory_usage` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publisher_memory_usage(
+    publisher_handle: iox2_publisher_h_ref,
+    memory_usage: *mut iox2_memory_usage_t,
+) {
+    publisher_handle.assert_non_null();
+    debug_assert!(!memory_usage.is_null());
+
+    let publisher = &mut *publisher_handle.as_type();
+    let usage = match publisher.service_type {
+        iox2_service_type_e::IPC => publisher.value.as_ref().ipc.memory_usage(),
+        iox2_service_type_e::LOCAL => publisher.value.as_ref().local.memory_usage(),
+    };
+
+    *memory_usage = (&usage).into();
+}
+
+/// Returns the physical memory of all unused data segment chunks of the publisher to the
+/// operating system and shrinks an enlarged, unused dynamic data segment to its initial size.
+///
+/// # Arguments
+///
+/// * `publisher_handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+///
+/// Returns the number of released bytes.
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_publisher_release_unused_memory(
+    publisher_handle: iox2_publisher_h_ref,
+) -> u64 {
+    publisher_handle.assert_non_null();
+
+    let publisher = &mut *publisher_handle.as_type();
+    match publisher.service_type {
+        iox2_service_type_e::IPC => publisher.value.as_ref().ipc.release_unused_memory() as u64,
+        iox2_service_type_e::LOCAL => publisher.value.as_ref().local.release_unused_memory() as u64,
+    }
+}
+
 /// Returns the unique port id of the publisher.
 ///
 /// # Arguments
@@ -46,7 +46,7 @@ impl ResponseUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<ResponseUnion>
 pub struct iox2_response_storage_t {
-    internal: [u8; 96], // magic number obtained with size_of::<Option<ResponseUnion>>()
+    internal: [u8; 128], // magic number obtained with size_of::<Option<ResponseUnion>>()
 }
 
 #[repr(C)]
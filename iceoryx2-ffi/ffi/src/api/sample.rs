@@ -14,7 +14,8 @@
 
 use crate::api::{
     c_size_t, iox2_publish_subscribe_header_h, iox2_publish_subscribe_header_t,
-    iox2_service_type_e, AssertNonNullHandle, HandleToType, PayloadFfi, UserHeaderFfi,
+    iox2_publish_subscribe_header_value_t, iox2_service_type_e, AssertNonNullHandle, HandleToType,
+    PayloadFfi, UserHeaderFfi,
 };
 
 use iceoryx2::prelude::*;
@@ -48,7 +49,7 @@ impl SampleUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<SampleUnion>
 pub struct iox2_sample_storage_t {
-    internal: [u8; 80], // magic number obtained with size_of::<Option<SampleUnion>>()
+    internal: [u8; 112], // magic number obtained with size_of::<Option<SampleUnion>>()
 }
 
 #[repr(C)]
@@ -184,6 +185,32 @@ pub unsafe extern "C" fn iox2_sample_header(
     *header_handle_ptr = (*storage_ptr).as_handle();
 }
 
+/// Copies the samples header into a trivially copyable [`iox2_publish_subscribe_header_value_t`].
+/// In contrast to [`iox2_sample_header()`] nothing is allocated and nothing must be released,
+/// therefore it is the preferred way to access the header on every received sample.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_subscriber_receive()`](crate::iox2_subscriber_receive())
+/// * `header_value_ptr` valid pointer to a [`iox2_publish_subscribe_header_value_t`].
+#[no_mangle]
+pub unsafe extern "C" fn iox2_sample_header_value(
+    handle: iox2_sample_h_ref,
+    header_value_ptr: *mut iox2_publish_subscribe_header_value_t,
+) {
+    handle.assert_non_null();
+    debug_assert!(!header_value_ptr.is_null());
+
+    let sample = &mut *handle.as_type();
+
+    let header = match sample.service_type {
+        iox2_service_type_e::IPC => sample.value.as_mut().ipc.header(),
+        iox2_service_type_e::LOCAL => sample.value.as_mut().local.header(),
+    };
+
+    header_value_ptr.write(header.into());
+}
+
 /// Acquires the samples user header.
 ///
 /// # Safety
@@ -242,6 +269,23 @@ pub unsafe extern "C" fn iox2_sample_payload(
     }
 }
 
+/// Returns the priority lane via which the sample was delivered.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_subscriber_receive()`](crate::iox2_subscriber_receive())
+#[no_mangle]
+pub unsafe extern "C" fn iox2_sample_priority(handle: iox2_sample_h_ref) -> c_size_t {
+    handle.assert_non_null();
+
+    let sample = &mut *handle.as_type();
+
+    match sample.service_type {
+        iox2_service_type_e::IPC => sample.value.as_mut().ipc.priority(),
+        iox2_service_type_e::LOCAL => sample.value.as_mut().local.priority(),
+    }
+}
+
 /// This function needs to be called to destroy the sample!
 ///
 /// # Arguments
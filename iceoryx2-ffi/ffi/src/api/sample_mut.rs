@@ -315,6 +315,23 @@ pub unsafe extern "C" fn iox2_sample_mut_payload(
 pub unsafe extern "C" fn iox2_sample_mut_send(
     sample_handle: iox2_sample_mut_h,
     number_of_recipients: *mut c_size_t,
+) -> c_int {
+    iox2_sample_mut_send_with_priority(sample_handle, 0, number_of_recipients)
+}
+
+/// Takes the ownership of the sample and sends it via the given priority lane. Subscribers
+/// receive the samples of a higher lane first.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_publisher_loan_slice_uninit()`](crate::iox2_publisher_loan_slice_uninit())
+/// * `number_of_recipients`, can be null or must point to a valid [`c_size_t`] to store the number
+///   of subscribers that received the sample
+#[no_mangle]
+pub unsafe extern "C" fn iox2_sample_mut_send_with_priority(
+    sample_handle: iox2_sample_mut_h,
+    priority: c_size_t,
+    number_of_recipients: *mut c_size_t,
 ) -> c_int {
     debug_assert!(!sample_handle.is_null());
 
@@ -331,7 +348,7 @@ pub unsafe extern "C" fn iox2_sample_mut_send(
     match service_type {
         iox2_service_type_e::IPC => {
             let sample = ManuallyDrop::into_inner(sample.ipc);
-            match sample.assume_init().send() {
+            match sample.assume_init().send_with_priority(priority) {
                 Ok(v) => {
                     if !number_of_recipients.is_null() {
                         *number_of_recipients = v;
@@ -344,7 +361,7 @@ pub unsafe extern "C" fn iox2_sample_mut_send(
         }
         iox2_service_type_e::LOCAL => {
             let sample = ManuallyDrop::into_inner(sample.local);
-            match sample.assume_init().send() {
+            match sample.assume_init().send_with_priority(priority) {
                 Ok(v) => {
                     if !number_of_recipients.is_null() {
                         *number_of_recipients = v;
@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types)]
 
 use crate::api::{
-    c_size_t, iox2_port_factory_pub_sub_h, iox2_port_factory_pub_sub_t,
+    c_size_t, iox2_performance_profile_e, iox2_port_factory_pub_sub_h, iox2_port_factory_pub_sub_t,
     iox2_service_builder_pub_sub_h, iox2_service_builder_pub_sub_h_ref, iox2_service_type_e,
     AssertNonNullHandle, HandleToType, IntoCInt, PayloadFfi, PortFactoryPubSubUnion,
     ServiceBuilderUnion, UserHeaderFfi, IOX2_OK,
@@ -33,6 +33,7 @@ use iceoryx2_ffi_macros::CStrRepr;
 
 use core::ffi::{c_char, c_int};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 use super::{iox2_attribute_specifier_h_ref, iox2_attribute_verifier_h_ref};
 
@@ -65,6 +66,10 @@ pub enum iox2_pub_sub_open_or_create_error_e {
     O_DOES_NOT_SUPPORT_REQUESTED_AMOUNT_OF_NODES,
     #[CStr = "incompatible overflow behavior"]
     O_INCOMPATIBLE_OVERFLOW_BEHAVIOR,
+    #[CStr = "incompatible delivery mode"]
+    O_INCOMPATIBLE_DELIVERY_MODE,
+    #[CStr = "incompatible number of priority lanes"]
+    O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES,
     #[CStr = "insufficient permissions"]
     O_INSUFFICIENT_PERMISSIONS,
     #[CStr = "service in corrupted state"]
@@ -132,6 +137,12 @@ impl IntoCInt for PublishSubscribeOpenError {
          PublishSubscribeOpenError::IncompatibleOverflowBehavior => {
              iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_OVERFLOW_BEHAVIOR
          }
+         PublishSubscribeOpenError::IncompatibleDeliveryMode => {
+             iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_DELIVERY_MODE
+         }
+         PublishSubscribeOpenError::IncompatibleNumberOfPriorityLanes => {
+             iox2_pub_sub_open_or_create_error_e::O_INCOMPATIBLE_NUMBER_OF_PRIORITY_LANES
+         }
          PublishSubscribeOpenError::InsufficientPermissions => {
              iox2_pub_sub_open_or_create_error_e::O_INSUFFICIENT_PERMISSIONS
          }
@@ -418,6 +429,177 @@ pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_max_nodes(
     }
 }
 
+/// Sets the broadcast ring size for the builder
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `value` - The number of entries of the broadcast ring, 0 disables the broadcast ring
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_broadcast_ring_size(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    value: c_size_t,
+) {
+    service_builder_handle.assert_non_null();
+
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.broadcast_ring_size(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.broadcast_ring_size(value),
+            ));
+        }
+    }
+}
+
+/// Sets the number of priority lanes for the builder
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `value` - The number of priority lanes of every connection
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_number_of_priority_lanes(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    value: c_size_t,
+) {
+    service_builder_handle.assert_non_null();
+
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.number_of_priority_lanes(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.number_of_priority_lanes(value),
+            ));
+        }
+    }
+}
+
+/// Sets the time to live of the samples for the builder
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `seconds` - the second part of the time to live
+/// * `nanoseconds` - the nanosecond part of the time to live
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_sample_time_to_live(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    service_builder_handle.assert_non_null();
+
+    let value = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.sample_time_to_live(value),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.sample_time_to_live(value),
+            ));
+        }
+    }
+}
+
+/// Sets the performance profile for the builder
+///
+/// # Arguments
+///
+/// * `service_builder_handle` - Must be a valid [`iox2_service_builder_pub_sub_h_ref`]
+///   obtained by [`iox2_service_builder_pub_sub`](crate::iox2_service_builder_pub_sub).
+/// * `value` - The [`iox2_performance_profile_e`] whose settings shall be used
+///
+/// # Safety
+///
+/// * `service_builder_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_service_builder_pub_sub_set_performance_profile(
+    service_builder_handle: iox2_service_builder_pub_sub_h_ref,
+    value: iox2_performance_profile_e,
+) {
+    service_builder_handle.assert_non_null();
+
+    let service_builder_struct = unsafe { &mut *service_builder_handle.as_type() };
+
+    match service_builder_struct.service_type {
+        iox2_service_type_e::IPC => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().ipc);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_ipc_pub_sub(
+                service_builder.performance_profile(value.into()),
+            ));
+        }
+        iox2_service_type_e::LOCAL => {
+            let service_builder =
+                ManuallyDrop::take(&mut service_builder_struct.value.as_mut().local);
+
+            let service_builder = ManuallyDrop::into_inner(service_builder.pub_sub);
+            service_builder_struct.set(ServiceBuilderUnion::new_local_pub_sub(
+                service_builder.performance_profile(value.into()),
+            ));
+        }
+    }
+}
+
 /// Sets the max publishers for the builder
 ///
 /// # Arguments
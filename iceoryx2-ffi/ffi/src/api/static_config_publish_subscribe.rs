@@ -26,6 +26,11 @@ pub struct iox2_static_config_publish_subscribe_t {
     pub subscriber_max_buffer_size: usize,
     pub subscriber_max_borrowed_samples: usize,
     pub enable_safe_overflow: bool,
+    pub broadcast_ring_size: usize,
+    pub number_of_priority_lanes: usize,
+    pub sample_time_to_live_seconds: u64,
+    pub sample_time_to_live_nanoseconds: u32,
+    pub has_sample_time_to_live: bool,
     pub message_type_details: iox2_message_type_details_t,
 }
 
@@ -39,6 +44,14 @@ impl From<&StaticConfig> for iox2_static_config_publish_subscribe_t {
             subscriber_max_buffer_size: c.subscriber_max_buffer_size(),
             subscriber_max_borrowed_samples: c.subscriber_max_borrowed_samples(),
             enable_safe_overflow: c.has_safe_overflow(),
+            broadcast_ring_size: c.broadcast_ring_size(),
+            number_of_priority_lanes: c.number_of_priority_lanes(),
+            sample_time_to_live_seconds: c.sample_time_to_live().map(|v| v.as_secs()).unwrap_or(0),
+            sample_time_to_live_nanoseconds: c
+                .sample_time_to_live()
+                .map(|v| v.subsec_nanos())
+                .unwrap_or(0),
+            has_sample_time_to_live: c.sample_time_to_live().is_some(),
             message_type_details: c.message_type_details().into(),
         }
     }
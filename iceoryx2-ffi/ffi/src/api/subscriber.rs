@@ -12,11 +12,18 @@
 
 #![allow(non_camel_case_types)]
 
+// the trait is only required when the underlying event concept is not file descriptor based
+#[allow(unused_imports)]
+use crate::api::listener::AcquireFileDescriptor;
+use crate::api::listener::AcquireFileDescriptorHopper;
 use crate::api::{
     c_size_t, iox2_sample_h, iox2_sample_t, iox2_service_type_e, iox2_unique_subscriber_id_h,
     iox2_unique_subscriber_id_t, AssertNonNullHandle, HandleToType, IntoCInt, PayloadFfi,
     SampleUnion, UserHeaderFfi, IOX2_OK,
 };
+use crate::iox2_file_descriptor_ptr;
+
+use super::{iox2_memory_usage_t, CFileDescriptor};
 
 use iceoryx2::port::subscriber::Subscriber;
 use iceoryx2::port::update_connections::ConnectionFailure;
@@ -24,6 +31,7 @@ use iceoryx2::port::ReceiveError;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_bb_elementary_traits::AsCStr;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
 use iceoryx2_ffi_macros::CStrRepr;
 
@@ -97,7 +105,7 @@ impl SubscriberUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<SubscriberUnion>
 pub struct iox2_subscriber_storage_t {
-    internal: [u8; 1232], // magic number obtained with size_of::<Option<SubscriberUnion>>()
+    internal: [u8; 4224], // magic number obtained with size_of::<Option<SubscriberUnion>>()
 }
 
 #[repr(C)]
@@ -226,6 +234,86 @@ pub unsafe extern "C" fn iox2_subscriber_buffer_size(
     }
 }
 
+/// Returns the number of samples the subscriber missed since they were overwritten in the
+/// broadcast ring of a publisher before they were received.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+///
+/// # Safety
+///
+/// * `subscriber_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_missed_samples(
+    subscriber_handle: iox2_subscriber_h_ref,
+) -> u64 {
+    subscriber_handle.assert_non_null();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.missed_samples(),
+        iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.missed_samples(),
+    }
+}
+
+/// Returns the number of samples the subscriber discarded while receiving since their time to
+/// live had expired.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+///
+/// # Safety
+///
+/// * `subscriber_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_expired_samples(
+    subscriber_handle: iox2_subscriber_h_ref,
+) -> u64 {
+    subscriber_handle.assert_non_null();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.expired_samples(),
+        iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.expired_samples(),
+    }
+}
+
+/// Stores the shared memory consumption of the subscriber in the provided
+/// [`iox2_memory_usage_t`].
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+/// * `memory_usage` - Must be a valid pointer to a [`iox2_memory_usage_t`].
+///
+/// # Safety
+///
+/// * `subscriber_handle` must be valid handles
+/// * `memory_usage` is valid and non-null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_memory_usage(
+    subscriber_handle: iox2_subscriber_h_ref,
+    memory_usage: *mut iox2_memory_usage_t,
+) {
+    subscriber_handle.assert_non_null();
+    debug_assert!(!memory_usage.is_null());
+
+    let subscriber = &mut *subscriber_handle.as_type();
+    let usage = match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.memory_usage(),
+        iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.memory_usage(),
+    };
+
+    *memory_usage = (&usage).into();
+}
+
 /// Returns the unique port id of the subscriber.
 ///
 /// # Arguments
@@ -390,6 +478,82 @@ pub unsafe extern "C" fn iox2_subscriber_has_samples(
     }
 }
 
+/// Returns true if the subscriber was created with
+/// [`iox2_port_factory_subscriber_builder_set_notify_on_data_arrival`](crate::iox2_port_factory_subscriber_builder_set_notify_on_data_arrival)
+/// enabled, otherwise false.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+///
+/// # Safety
+///
+/// * `subscriber_handle` must be valid handles
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_has_data_arrival_notification(
+    subscriber_handle: iox2_subscriber_h_ref,
+) -> bool {
+    subscriber_handle.assert_non_null();
+
+    let subscriber = &mut *subscriber_handle.as_type();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => subscriber
+            .value
+            .as_ref()
+            .ipc
+            .has_data_arrival_notification(),
+        iox2_service_type_e::LOCAL => subscriber
+            .value
+            .as_ref()
+            .local
+            .has_data_arrival_notification(),
+    }
+}
+
+/// Returns the underlying non-owning file descriptor of the [`iox2_subscriber_h`] which signals
+/// the arrival of new samples. If the [`iox2_subscriber_h`] was not created with
+/// [`iox2_port_factory_subscriber_builder_set_notify_on_data_arrival`](crate::iox2_port_factory_subscriber_builder_set_notify_on_data_arrival)
+/// enabled or is not file descriptor based, it returns NULL.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - A valid [`iox2_subscriber_h_ref`],
+///
+/// # Safety
+///
+/// * The `subscriber_handle` must be a valid handle.
+#[no_mangle]
+pub unsafe extern "C" fn iox2_subscriber_get_file_descriptor(
+    subscriber_handle: iox2_subscriber_h_ref,
+) -> iox2_file_descriptor_ptr {
+    subscriber_handle.assert_non_null();
+
+    if !iox2_subscriber_has_data_arrival_notification(subscriber_handle) {
+        return core::ptr::null::<CFileDescriptor>();
+    }
+
+    let subscriber = &mut *subscriber_handle.as_type();
+
+    match subscriber.service_type {
+        iox2_service_type_e::IPC => {
+            let hopper = AcquireFileDescriptorHopper::new(&*subscriber.value.as_ref().ipc);
+            match hopper.acquire_file_descriptor() {
+                Some(fd) => (fd as *const FileDescriptor).cast(),
+                None => core::ptr::null::<CFileDescriptor>(),
+            }
+        }
+        iox2_service_type_e::LOCAL => {
+            let hopper = AcquireFileDescriptorHopper::new(&*subscriber.value.as_ref().local);
+            match hopper.acquire_file_descriptor() {
+                Some(fd) => (fd as *const FileDescriptor).cast(),
+                None => core::ptr::null::<CFileDescriptor>(),
+            }
+        }
+    }
+}
+
 /// This function needs to be called to destroy the subscriber!
 ///
 /// # Arguments
@@ -88,6 +88,7 @@ pub enum iox2_waitset_attachment_error_e {
     INSUFFICIENT_CAPACITY = IOX2_OK as isize + 1,
     ALREADY_ATTACHED,
     INTERNAL_ERROR,
+    NOT_MULTIPLEXABLE,
 }
 
 impl IntoCInt for WaitSetAttachmentError {
@@ -102,6 +103,9 @@ impl IntoCInt for WaitSetAttachmentError {
             WaitSetAttachmentError::InternalError => {
                 iox2_waitset_attachment_error_e::INTERNAL_ERROR
             }
+            WaitSetAttachmentError::NotMultiplexable => {
+                iox2_waitset_attachment_error_e::NOT_MULTIPLEXABLE
+            }
         }) as c_int
     }
 }
@@ -110,12 +114,26 @@ impl IntoCInt for WaitSetAttachmentError {
 #[derive(Copy, Clone, CStrRepr)]
 pub enum iox2_waitset_create_error_e {
     INTERNAL_ERROR = IOX2_OK as isize + 1,
+    INVALID_CPU_CORE,
+    INSUFFICIENT_PERMISSIONS,
+    UNABLE_TO_LOCK_MEMORY,
+    UNSUPPORTED_REACTOR_MECHANISM,
 }
 
 impl IntoCInt for WaitSetCreateError {
     fn into_c_int(self) -> c_int {
         (match self {
             WaitSetCreateError::InternalError => iox2_waitset_create_error_e::INTERNAL_ERROR,
+            WaitSetCreateError::InvalidCpuCore => iox2_waitset_create_error_e::INVALID_CPU_CORE,
+            WaitSetCreateError::InsufficientPermissions => {
+                iox2_waitset_create_error_e::INSUFFICIENT_PERMISSIONS
+            }
+            WaitSetCreateError::UnableToLockMemory => {
+                iox2_waitset_create_error_e::UNABLE_TO_LOCK_MEMORY
+            }
+            WaitSetCreateError::UnsupportedReactorMechanism => {
+                iox2_waitset_create_error_e::UNSUPPORTED_REACTOR_MECHANISM
+            }
         }) as c_int
     }
 }
@@ -142,7 +160,7 @@ impl WaitSetUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<WaitSetUnion>
 pub struct iox2_waitset_storage_t {
-    internal: [u8; 784], // magic number obtained with size_of::<Option<WaitSetUnion>>()
+    internal: [u8; 1024], // magic number obtained with size_of::<Option<WaitSetUnion>>()
 }
 
 #[repr(C)]
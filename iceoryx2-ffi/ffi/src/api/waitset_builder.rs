@@ -13,23 +13,55 @@
 #![allow(non_camel_case_types)]
 
 use core::ffi::c_int;
+use core::time::Duration;
 
 use crate::{
     api::IntoCInt, iox2_service_type_e, iox2_waitset_h, iox2_waitset_t, WaitSetUnion, IOX2_OK,
 };
 
-use super::{iox2_signal_handling_mode_e, AssertNonNullHandle, HandleToType};
+use super::{c_size_t, iox2_signal_handling_mode_e, AssertNonNullHandle, HandleToType};
 use iceoryx2::{
     prelude::WaitSetBuilder,
     service::{ipc, local},
+    waitset::ReactorMechanism,
 };
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
 
+/// Defines the mechanism the waitset uses to wait on its attachments.
 #[repr(C)]
-#[repr(align(1))] // alignment of Option<WaitSetBuilder>
+#[derive(Copy, Clone)]
+pub enum iox2_reactor_mechanism_e {
+    /// The default mechanism of the platform.
+    NATIVE,
+    /// Uses `select`, available on all platforms.
+    SELECT,
+    /// Uses `epoll`, available on Linux only.
+    EPOLL,
+    /// Uses `io_uring` with multishot polls, available on Linux 5.13 or newer. Falls back to
+    /// `epoll` when io_uring is not available.
+    IO_URING,
+    /// Like [`iox2_reactor_mechanism_e::IO_URING`] with a kernel thread that polls the
+    /// submission queue.
+    IO_URING_SQ_POLL,
+}
+
+impl From<iox2_reactor_mechanism_e> for ReactorMechanism {
+    fn from(value: iox2_reactor_mechanism_e) -> Self {
+        match value {
+            iox2_reactor_mechanism_e::NATIVE => ReactorMechanism::Native,
+            iox2_reactor_mechanism_e::SELECT => ReactorMechanism::Select,
+            iox2_reactor_mechanism_e::EPOLL => ReactorMechanism::Epoll,
+            iox2_reactor_mechanism_e::IO_URING => ReactorMechanism::IoUring,
+            iox2_reactor_mechanism_e::IO_URING_SQ_POLL => ReactorMechanism::IoUringSqPoll,
+        }
+    }
+}
+
+#[repr(C)]
+#[repr(align(8))] // alignment of Option<WaitSetBuilder>
 pub struct iox2_waitset_builder_storage_t {
-    internal: [u8; 1], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
+    internal: [u8; 64], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
 }
 
 #[repr(C)]
@@ -224,4 +256,131 @@ pub unsafe extern "C" fn iox2_waitset_builder_set_signal_handling_mode(
     waitset_builder_struct.set(waitset_builder);
 }
 
+/// Sets the maximum time the [`iox2_waitset_h`] spends in calling the callbacks in one wakeup.
+/// Notifications that could not be handled within the budget are deferred to the next wakeup.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `seconds` - the seconds of the budget
+/// * `nanoseconds` - the nanoseconds of the budget
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_processing_budget(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder
+        .processing_budget(Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64));
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Pins the thread that calls [`iox2_waitset_builder_create()`] to the provided CPU core.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `cpu_core` - the CPU core, must be in the range `[0, number of cpu cores)`
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_cpu_affinity(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    cpu_core: c_size_t,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.cpu_affinity(cpu_core);
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Schedules the thread that calls [`iox2_waitset_builder_create()`] with `SCHED_FIFO`.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `priority` - `0` is the lowest and `255` the highest priority
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_realtime_priority(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    priority: u8,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.realtime_priority(priority);
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Defines if [`iox2_waitset_builder_create()`] locks all current and future memory pages of
+/// the process.
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `value` - `true` locks the memory
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_lock_memory(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    value: bool,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.lock_memory(value);
+    waitset_builder_struct.set(waitset_builder);
+}
+
+/// Defines the mechanism the waitset uses to wait on its attachments. When it is not
+/// supported on the platform, [`iox2_waitset_builder_create()`] fails with
+/// [`iox2_waitset_create_error_e::UNSUPPORTED_REACTOR_MECHANISM`](crate::iox2_waitset_create_error_e).
+///
+/// # Arguments
+///
+/// * `waitset_builder_handle` - Must be a valid [`iox2_waitset_builder_h_ref`] obtained by [`iox2_waitset_builder_new`].
+/// * `value` - the [`iox2_reactor_mechanism_e`]
+///
+/// # Safety
+///
+/// * `waitset_builder_handle` must be a valid handle
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_builder_set_reactor_mechanism(
+    waitset_builder_handle: iox2_waitset_builder_h_ref,
+    value: iox2_reactor_mechanism_e,
+) {
+    waitset_builder_handle.assert_non_null();
+
+    let waitset_builder_struct = &mut *waitset_builder_handle.as_type();
+
+    let waitset_builder = waitset_builder_struct.take().unwrap();
+    let waitset_builder = waitset_builder.reactor_mechanism(value.into());
+    waitset_builder_struct.set(waitset_builder);
+}
+
 // END C API
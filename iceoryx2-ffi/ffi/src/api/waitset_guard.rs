@@ -132,4 +132,42 @@ pub unsafe extern "C" fn iox2_waitset_guard_drop(handle: iox2_waitset_guard_h) {
     }
     (guard.deleter)(guard);
 }
+
+/// Sets the priority of the attachment. When multiple attachments are ready in the same wakeup,
+/// the attachments with the higher priority are handled first.
+///
+/// # Safety
+///
+/// * `handle` must be valid and non null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_guard_set_priority(
+    handle: iox2_waitset_guard_h_ref,
+    priority: u8,
+) {
+    handle.assert_non_null();
+
+    let guard = &mut *handle.as_type();
+
+    match guard.service_type {
+        iox2_service_type_e::IPC => guard.value.as_ref().ipc.set_priority(priority),
+        iox2_service_type_e::LOCAL => guard.value.as_ref().local.set_priority(priority),
+    }
+}
+
+/// Returns the priority of the attachment.
+///
+/// # Safety
+///
+/// * `handle` must be valid and non null
+#[no_mangle]
+pub unsafe extern "C" fn iox2_waitset_guard_priority(handle: iox2_waitset_guard_h_ref) -> u8 {
+    handle.assert_non_null();
+
+    let guard = &mut *handle.as_type();
+
+    match guard.service_type {
+        iox2_service_type_e::IPC => guard.value.as_ref().ipc.priority(),
+        iox2_service_type_e::LOCAL => guard.value.as_ref().local.priority(),
+    }
+}
 // END C API
@@ -27,4 +27,5 @@ fn ffi_settings_are_equal_to_iceoryx2_settings() {
     assert_that!(IOX2_IS_LOCAL_LISTENER_FD_BASED, eq <<<local::Service as iceoryx2::service::Service>::Event as iceoryx2_cal::event::Event>::Listener as iceoryx2_cal::event::Listener>::IS_FILE_DESCRIPTOR_BASED);
     assert_that!(IOX2_TYPE_NAME_LENGTH, eq TypeNameString::capacity());
     assert_that!(IOX2_NODE_NAME_LENGTH, eq NodeName::max_len());
+    assert_that!(IOX2_UNIQUE_PORT_ID_LENGTH, eq core::mem::size_of::<iceoryx2::port::port_identifiers::UniquePublisherId>());
 }
@@ -21,6 +21,30 @@
 #include <sys/user.h>
 #endif
 
+#ifdef __linux__
+#include <linux/memfd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+
+// declared by sys/mman.h only with _GNU_SOURCE
+int memfd_create(const char* name, unsigned int flags);
+
+#ifndef _GNU_SOURCE
+#include <sys/socket.h>
+#include <time.h>
+
+// declared by sys/socket.h only with _GNU_SOURCE
+struct mmsghdr {
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+
+int sendmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags);
+int recvmmsg(int sockfd, struct mmsghdr* msgvec, unsigned int vlen, int flags, struct timespec* timeout);
+#endif
+#endif
+
 #ifdef __APPLE__
 #include <libproc.h>
 #include <mach-o/dyld.h>
@@ -31,6 +55,7 @@
 #include <dirent.h>
 #include <grp.h>
 #include <netinet/in.h>
+#include <poll.h>
 #include <pthread.h>
 #include <pwd.h>
 #include <sched.h>
@@ -0,0 +1,146 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! The io_uring structures and constants of the Linux kernel ABI, see `linux/io_uring.h`.
+//! Neither glibc nor the libc crate provide them, but they are identical on all
+//! architectures.
+
+#![allow(non_camel_case_types)]
+#![allow(dead_code)]
+
+use crate::posix::{off_t, MemZeroedStruct};
+
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_sqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub flags: u32,
+    pub dropped: u32,
+    pub array: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_cqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub overflow: u32,
+    pub cqes: u32,
+    pub flags: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_uring_params {
+    pub sq_entries: u32,
+    pub cq_entries: u32,
+    pub flags: u32,
+    pub sq_thread_cpu: u32,
+    pub sq_thread_idle: u32,
+    pub features: u32,
+    pub wq_fd: u32,
+    pub resv: [u32; 3],
+    pub sq_off: io_sqring_offsets,
+    pub cq_off: io_cqring_offsets,
+}
+impl MemZeroedStruct for io_uring_params {}
+
+/// Submission queue entry. The unions of the kernel definition are flattened to the members
+/// that are required by the poll operations.
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_uring_sqe {
+    pub opcode: u8,
+    pub flags: u8,
+    pub ioprio: u16,
+    pub fd: i32,
+    pub off: u64,
+    pub addr: u64,
+    pub len: u32,
+    /// `poll32_events` for [`IORING_OP_POLL_ADD`].
+    pub op_flags: u32,
+    pub user_data: u64,
+    pub buf_index: u16,
+    pub personality: u16,
+    pub splice_fd_in: i32,
+    pub addr3: u64,
+    pub __pad2: [u64; 1],
+}
+impl MemZeroedStruct for io_uring_sqe {}
+
+/// Completion queue entry.
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_uring_cqe {
+    pub user_data: u64,
+    pub res: i32,
+    pub flags: u32,
+}
+impl MemZeroedStruct for io_uring_cqe {}
+
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct __kernel_timespec {
+    pub tv_sec: i64,
+    pub tv_nsec: i64,
+}
+impl MemZeroedStruct for __kernel_timespec {}
+
+/// Argument of `io_uring_enter` when [`IORING_ENTER_EXT_ARG`] is set.
+#[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+#[repr(C)]
+pub struct io_uring_getevents_arg {
+    pub sigmask: u64,
+    pub sigmask_sz: u32,
+    pub pad: u32,
+    pub ts: u64,
+}
+impl MemZeroedStruct for io_uring_getevents_arg {}
+
+pub const IORING_SETUP_SQPOLL: u32 = 1 << 1;
+pub const IORING_SETUP_CQSIZE: u32 = 1 << 3;
+pub const IORING_SETUP_CLAMP: u32 = 1 << 4;
+
+pub const IORING_FEAT_SINGLE_MMAP: u32 = 1 << 0;
+pub const IORING_FEAT_NODROP: u32 = 1 << 1;
+pub const IORING_FEAT_EXT_ARG: u32 = 1 << 8;
+/// Introduced with Linux 5.13, the same release that introduced [`IORING_POLL_ADD_MULTI`].
+pub const IORING_FEAT_RSRC_TAGS: u32 = 1 << 10;
+
+pub const IORING_OFF_SQ_RING: off_t = 0;
+pub const IORING_OFF_CQ_RING: off_t = 0x8000000;
+pub const IORING_OFF_SQES: off_t = 0x10000000;
+
+pub const IORING_OP_POLL_ADD: u8 = 6;
+pub const IORING_OP_POLL_REMOVE: u8 = 7;
+
+pub const IORING_POLL_ADD_MULTI: u32 = 1 << 0;
+
+pub const IORING_CQE_F_MORE: u32 = 1 << 1;
+
+pub const IORING_SQ_NEED_WAKEUP: u32 = 1 << 0;
+pub const IORING_SQ_CQ_OVERFLOW: u32 = 1 << 1;
+
+pub const IORING_ENTER_GETEVENTS: u32 = 1 << 0;
+pub const IORING_ENTER_SQ_WAKEUP: u32 = 1 << 1;
+/// Introduced with Linux 5.10.
+pub const IORING_ENTER_SQ_WAIT: u32 = 1 << 2;
+pub const IORING_ENTER_EXT_ARG: u32 = 1 << 3;
@@ -11,7 +11,10 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 pub mod cpu_set_t;
+pub mod epoll_event;
 pub(crate) mod error_enum_generator;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod mem_zeroed_struct;
 pub mod sockaddr_in;
 pub(crate) mod string_operations;
@@ -49,6 +49,8 @@ pub const PROT_EXEC: int = crate::internal::PROT_EXEC as _;
 pub const MCL_CURRENT: int = crate::internal::MCL_CURRENT as _;
 pub const MCL_FUTURE: int = crate::internal::MCL_FUTURE as _;
 pub const MAP_SHARED: int = crate::internal::MAP_SHARED as _;
+pub const MADV_DONTNEED: int = crate::internal::MADV_DONTNEED as _;
+pub const MFD_CLOEXEC: uint = crate::internal::MFD_CLOEXEC as _;
 pub const MAP_FAILED: *mut void = u64::MAX as *mut void;
 
 pub const PTHREAD_BARRIER_SERIAL_THREAD: int = crate::internal::PTHREAD_BARRIER_SERIAL_THREAD as _;
@@ -147,6 +147,14 @@ pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     crate::internal::mprotect(addr, len, prot)
 }
 
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    crate::internal::madvise(addr, len, advice)
+}
+
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    crate::internal::memfd_create(name, flags)
+}
+
 unsafe fn trim_ascii(value: &[i8]) -> &[u8] {
     let length = value.iter().position(|&c| c == 0).unwrap_or(value.len());
     core::slice::from_raw_parts(value.as_ptr().cast(), length)
@@ -62,6 +62,9 @@ pub mod posix {
     use super::*;
 
     pub use common::cpu_set_t::cpu_set_t;
+    pub use common::epoll_event::EpollEventData;
+    #[cfg(target_os = "linux")]
+    pub use common::io_uring::*;
     pub use common::mem_zeroed_struct::MemZeroedStruct;
     pub use common::sockaddr_in::SockAddrIn;
     pub(crate) use common::string_operations::*;
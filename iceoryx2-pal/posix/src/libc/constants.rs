@@ -54,6 +54,13 @@ pub const PROT_EXEC: int = libc::PROT_EXEC as _;
 pub const MCL_CURRENT: int = libc::MCL_CURRENT as _;
 pub const MCL_FUTURE: int = libc::MCL_FUTURE as _;
 pub const MAP_SHARED: int = libc::MAP_SHARED as _;
+pub const MADV_DONTNEED: int = libc::MADV_DONTNEED as _;
+#[cfg(target_os = "linux")]
+pub const MFD_CLOEXEC: uint = libc::MFD_CLOEXEC as _;
+#[cfg(not(target_os = "linux"))]
+pub const MFD_CLOEXEC: uint = 1;
+#[cfg(target_os = "linux")]
+pub const MADV_REMOVE: int = libc::MADV_REMOVE as _;
 pub const MAP_FAILED: *mut void = u64::MAX as *mut void;
 
 pub const PTHREAD_BARRIER_SERIAL_THREAD: int = libc::PTHREAD_BARRIER_SERIAL_THREAD as _;
@@ -185,6 +192,34 @@ pub const MSG_PEEK: int = libc::MSG_PEEK as _;
 pub const SCM_MAX_FD: u32 = 253;
 pub const SCM_RIGHTS: int = libc::SCM_RIGHTS as _;
 pub const SOL_SOCKET: int = libc::SOL_SOCKET as _;
+
+#[cfg(target_os = "linux")]
+pub const EFD_CLOEXEC: int = libc::EFD_CLOEXEC as _;
+#[cfg(target_os = "linux")]
+pub const EFD_NONBLOCK: int = libc::EFD_NONBLOCK as _;
+#[cfg(target_os = "linux")]
+pub const EFD_SEMAPHORE: int = libc::EFD_SEMAPHORE as _;
+
+#[cfg(target_os = "linux")]
+pub const EPOLL_CLOEXEC: int = libc::EPOLL_CLOEXEC as _;
+#[cfg(target_os = "linux")]
+pub const EPOLL_CTL_ADD: int = libc::EPOLL_CTL_ADD as _;
+#[cfg(target_os = "linux")]
+pub const EPOLL_CTL_MOD: int = libc::EPOLL_CTL_MOD as _;
+#[cfg(target_os = "linux")]
+pub const EPOLL_CTL_DEL: int = libc::EPOLL_CTL_DEL as _;
+#[cfg(target_os = "linux")]
+pub const EPOLLIN: u32 = libc::EPOLLIN as _;
+#[cfg(target_os = "linux")]
+pub const EPOLLOUT: u32 = libc::EPOLLOUT as _;
+#[cfg(target_os = "linux")]
+pub const EPOLLERR: u32 = libc::EPOLLERR as _;
+#[cfg(target_os = "linux")]
+pub const EPOLLHUP: u32 = libc::EPOLLHUP as _;
+
+pub const POLLIN: short = libc::POLLIN as _;
+pub const POLLERR: short = libc::POLLERR as _;
+pub const POLLHUP: short = libc::POLLHUP as _;
 pub const SUN_PATH_LEN: usize = 108;
 pub const SA_DATA_LEN: usize = 14;
 
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::types::*;
+
+pub unsafe fn epoll_create1(flags: int) -> int {
+    libc::epoll_create1(flags)
+}
+
+pub unsafe fn epoll_ctl(epfd: int, op: int, fd: int, event: *mut epoll_event) -> int {
+    libc::epoll_ctl(epfd, op, fd, event)
+}
+
+pub unsafe fn epoll_wait(epfd: int, events: *mut epoll_event, maxevents: int, timeout: int) -> int {
+    libc::epoll_wait(epfd, events, maxevents, timeout)
+}
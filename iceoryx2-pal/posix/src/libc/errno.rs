@@ -79,6 +79,7 @@ ErrnoEnumGenerator!(
     // ENOANO,
     // EBADRQC,
     // EBADSLT,
+    ETIME,
     EMULTIHOP,
     EOVERFLOW,
     // ENOTUNIQ,
@@ -94,3 +94,18 @@ pub unsafe fn munmap(addr: *mut void, len: size_t) -> int {
 pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     libc::mprotect(addr, len, prot)
 }
+
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    libc::madvise(addr, len, advice)
+}
+
+#[cfg(target_os = "linux")]
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    libc::memfd_create(name, flags)
+}
+
+#[cfg(not(target_os = "linux"))]
+pub unsafe fn memfd_create(_name: *const c_char, _flags: uint) -> int {
+    crate::posix::Errno::set(crate::posix::Errno::ENOSYS);
+    -1
+}
@@ -12,9 +12,16 @@
 
 pub mod constants;
 pub mod dirent;
+#[cfg(target_os = "linux")]
+pub mod epoll;
 pub mod errno;
+#[cfg(target_os = "linux")]
+pub mod eventfd;
 pub mod fcntl;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
 pub mod mman;
+pub mod poll;
 pub mod pthread;
 pub mod pwd;
 pub mod resource;
@@ -34,9 +41,16 @@ pub mod unistd;
 
 pub use constants::*;
 pub use dirent::*;
+#[cfg(target_os = "linux")]
+pub use epoll::*;
 pub use errno::*;
+#[cfg(target_os = "linux")]
+pub use eventfd::*;
 pub use fcntl::*;
+#[cfg(target_os = "linux")]
+pub use io_uring::*;
 pub use mman::*;
+pub use poll::*;
 pub use pthread::*;
 pub use pwd::*;
 pub use resource::*;
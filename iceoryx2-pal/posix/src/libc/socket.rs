@@ -64,6 +64,11 @@ pub unsafe fn sendmsg(socket: int, message: *const msghdr, flags: int) -> ssize_
     libc::sendmsg(socket, message, flags)
 }
 
+#[cfg(target_os = "linux")]
+pub unsafe fn sendmmsg(socket: int, messages: *mut mmsghdr, length: uint, flags: int) -> int {
+    libc::sendmmsg(socket, messages, length, flags as _)
+}
+
 pub unsafe fn sendto(
     socket: int,
     message: *const void,
@@ -83,6 +88,17 @@ pub unsafe fn recvmsg(socket: int, message: *mut msghdr, flags: int) -> ssize_t
     libc::recvmsg(socket, message, flags)
 }
 
+#[cfg(target_os = "linux")]
+pub unsafe fn recvmmsg(
+    socket: int,
+    messages: *mut mmsghdr,
+    length: uint,
+    flags: int,
+    timeout: *mut timespec,
+) -> int {
+    libc::recvmmsg(socket, messages, length, flags as _, timeout)
+}
+
 pub unsafe fn recvfrom(
     socket: int,
     buffer: *mut void,
@@ -14,6 +14,8 @@
 #![allow(clippy::missing_safety_doc)]
 
 use crate::common::mem_zeroed_struct::MemZeroedStruct;
+#[cfg(target_os = "linux")]
+use crate::posix::EpollEventData;
 use crate::posix::SockAddrIn;
 pub type ulong = libc::c_ulong;
 
@@ -40,6 +42,7 @@ pub type in_port_t = u16;
 pub type in_addr_t = u32;
 pub type long = core::ffi::c_long;
 pub type mode_t = libc::mode_t;
+pub type nfds_t = libc::nfds_t;
 pub type nlink_t = libc::nlink_t;
 pub type off_t = libc::off_t;
 pub type pid_t = libc::pid_t;
@@ -159,6 +162,11 @@ impl MemZeroedStruct for msghdr {}
 pub type cmsghdr = libc::cmsghdr;
 impl MemZeroedStruct for cmsghdr {}
 
+#[cfg(target_os = "linux")]
+pub type mmsghdr = libc::mmsghdr;
+#[cfg(target_os = "linux")]
+impl MemZeroedStruct for mmsghdr {}
+
 pub type iovec = libc::iovec;
 impl MemZeroedStruct for iovec {}
 
@@ -171,6 +179,25 @@ impl MemZeroedStruct for sockaddr_un {}
 pub type sockaddr_in = libc::sockaddr_in;
 impl MemZeroedStruct for sockaddr_in {}
 
+#[cfg(target_os = "linux")]
+pub type epoll_event = libc::epoll_event;
+#[cfg(target_os = "linux")]
+impl MemZeroedStruct for epoll_event {}
+
+#[cfg(target_os = "linux")]
+impl EpollEventData for epoll_event {
+    fn set_data_u64(&mut self, value: u64) {
+        self.u64 = value;
+    }
+
+    fn get_data_u64(&self) -> u64 {
+        self.u64
+    }
+}
+
+pub type pollfd = libc::pollfd;
+impl MemZeroedStruct for pollfd {}
+
 impl SockAddrIn for sockaddr_in {
     fn set_s_addr(&mut self, value: u32) {
         self.sin_addr.s_addr = value;
@@ -49,6 +49,9 @@ pub const PROT_EXEC: int = crate::internal::PROT_EXEC as _;
 pub const MCL_CURRENT: int = crate::internal::MCL_CURRENT as _;
 pub const MCL_FUTURE: int = crate::internal::MCL_FUTURE as _;
 pub const MAP_SHARED: int = crate::internal::MAP_SHARED as _;
+pub const MADV_DONTNEED: int = crate::internal::MADV_DONTNEED as _;
+pub const MFD_CLOEXEC: uint = crate::internal::MFD_CLOEXEC as _;
+pub const MADV_REMOVE: int = crate::internal::MADV_REMOVE as _;
 pub const MAP_FAILED: *mut void = u64::MAX as *mut void;
 
 pub const PTHREAD_BARRIER_SERIAL_THREAD: int = crate::internal::PTHREAD_BARRIER_SERIAL_THREAD as _;
@@ -188,6 +191,23 @@ pub const MSG_PEEK: int = crate::internal::MSG_PEEK as _;
 pub const SCM_MAX_FD: u32 = 253;
 pub const SCM_RIGHTS: int = crate::internal::SCM_RIGHTS as _;
 pub const SOL_SOCKET: int = crate::internal::SOL_SOCKET as _;
+
+pub const EFD_CLOEXEC: int = crate::internal::EFD_CLOEXEC as _;
+pub const EFD_NONBLOCK: int = crate::internal::EFD_NONBLOCK as _;
+pub const EFD_SEMAPHORE: int = crate::internal::EFD_SEMAPHORE as _;
+
+pub const EPOLL_CLOEXEC: int = crate::internal::EPOLL_CLOEXEC as _;
+pub const EPOLL_CTL_ADD: int = crate::internal::EPOLL_CTL_ADD as _;
+pub const EPOLL_CTL_MOD: int = crate::internal::EPOLL_CTL_MOD as _;
+pub const EPOLL_CTL_DEL: int = crate::internal::EPOLL_CTL_DEL as _;
+pub const EPOLLIN: u32 = crate::internal::EPOLL_EVENTS_EPOLLIN as _;
+pub const EPOLLOUT: u32 = crate::internal::EPOLL_EVENTS_EPOLLOUT as _;
+pub const EPOLLERR: u32 = crate::internal::EPOLL_EVENTS_EPOLLERR as _;
+pub const EPOLLHUP: u32 = crate::internal::EPOLL_EVENTS_EPOLLHUP as _;
+
+pub const POLLIN: short = crate::internal::POLLIN as _;
+pub const POLLERR: short = crate::internal::POLLERR as _;
+pub const POLLHUP: short = crate::internal::POLLHUP as _;
 pub const SUN_PATH_LEN: usize = 108;
 pub const SA_DATA_LEN: usize = 14;
 
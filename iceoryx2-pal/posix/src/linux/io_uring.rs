@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use crate::posix::io_uring_params;
+use crate::posix::types::*;
+
+pub unsafe fn io_uring_setup(entries: u32, params: *mut io_uring_params) -> int {
+    crate::internal::syscall(
+        crate::internal::SYS_io_uring_setup as _,
+        entries as long,
+        params,
+    ) as _
+}
+
+pub unsafe fn io_uring_enter(
+    fd: int,
+    to_submit: u32,
+    min_complete: u32,
+    flags: u32,
+    arg: *const void,
+    argsz: size_t,
+) -> int {
+    crate::internal::syscall(
+        crate::internal::SYS_io_uring_enter as _,
+        fd as long,
+        to_submit as long,
+        min_complete as long,
+        flags as long,
+        arg,
+        argsz,
+    ) as _
+}
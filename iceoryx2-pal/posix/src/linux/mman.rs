@@ -94,3 +94,11 @@ pub unsafe fn munmap(addr: *mut void, len: size_t) -> int {
 pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     crate::internal::mprotect(addr, len, prot)
 }
+
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    crate::internal::madvise(addr, len, advice)
+}
+
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    crate::internal::memfd_create(name, flags)
+}
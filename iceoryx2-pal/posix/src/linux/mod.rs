@@ -12,9 +12,13 @@
 
 pub mod constants;
 pub mod dirent;
+pub mod epoll;
 pub mod errno;
+pub mod eventfd;
 pub mod fcntl;
+pub mod io_uring;
 pub mod mman;
+pub mod poll;
 pub mod pthread;
 pub mod pwd;
 pub mod resource;
@@ -34,9 +38,13 @@ pub mod unistd;
 
 pub use constants::*;
 pub use dirent::*;
+pub use epoll::*;
 pub use errno::*;
+pub use eventfd::*;
 pub use fcntl::*;
+pub use io_uring::*;
 pub use mman::*;
+pub use poll::*;
 pub use pthread::*;
 pub use pwd::*;
 pub use resource::*;
@@ -64,6 +64,10 @@ pub unsafe fn sendmsg(socket: int, message: *const msghdr, flags: int) -> ssize_
     crate::internal::sendmsg(socket, message, flags)
 }
 
+pub unsafe fn sendmmsg(socket: int, messages: *mut mmsghdr, length: uint, flags: int) -> int {
+    crate::internal::sendmmsg(socket, messages, length, flags)
+}
+
 pub unsafe fn sendto(
     socket: int,
     message: *const void,
@@ -83,6 +87,16 @@ pub unsafe fn recvmsg(socket: int, message: *mut msghdr, flags: int) -> ssize_t
     crate::internal::recvmsg(socket, message, flags)
 }
 
+pub unsafe fn recvmmsg(
+    socket: int,
+    messages: *mut mmsghdr,
+    length: uint,
+    flags: int,
+    timeout: *mut timespec,
+) -> int {
+    crate::internal::recvmmsg(socket, messages, length, flags, timeout)
+}
+
 pub unsafe fn recvfrom(
     socket: int,
     buffer: *mut void,
@@ -14,6 +14,7 @@
 #![allow(clippy::missing_safety_doc)]
 
 use crate::common::mem_zeroed_struct::MemZeroedStruct;
+use crate::posix::EpollEventData;
 use crate::posix::SockAddrIn;
 
 pub type ulong = crate::internal::ulong;
@@ -41,6 +42,7 @@ pub type in_port_t = u16;
 pub type in_addr_t = u32;
 pub type long = core::ffi::c_long;
 pub type mode_t = crate::internal::mode_t;
+pub type nfds_t = crate::internal::nfds_t;
 pub type nlink_t = crate::internal::nlink_t;
 pub type off_t = crate::internal::off_t;
 pub type pid_t = crate::internal::pid_t;
@@ -160,6 +162,9 @@ impl MemZeroedStruct for msghdr {}
 pub type cmsghdr = crate::internal::cmsghdr;
 impl MemZeroedStruct for cmsghdr {}
 
+pub type mmsghdr = crate::internal::mmsghdr;
+impl MemZeroedStruct for mmsghdr {}
+
 pub type iovec = crate::internal::iovec;
 impl MemZeroedStruct for iovec {}
 
@@ -172,6 +177,22 @@ impl MemZeroedStruct for sockaddr_un {}
 pub type sockaddr_in = crate::internal::sockaddr_in;
 impl MemZeroedStruct for sockaddr_in {}
 
+pub type epoll_event = crate::internal::epoll_event;
+impl MemZeroedStruct for epoll_event {}
+
+impl EpollEventData for epoll_event {
+    fn set_data_u64(&mut self, value: u64) {
+        self.data.u64 = value;
+    }
+
+    fn get_data_u64(&self) -> u64 {
+        unsafe { self.data.u64 }
+    }
+}
+
+pub type pollfd = crate::internal::pollfd;
+impl MemZeroedStruct for pollfd {}
+
 impl SockAddrIn for sockaddr_in {
     fn set_s_addr(&mut self, value: u32) {
         self.sin_addr.s_addr = value;
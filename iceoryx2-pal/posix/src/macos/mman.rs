@@ -208,6 +208,15 @@ pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     crate::internal::mprotect(addr, len, prot)
 }
 
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    crate::internal::madvise(addr, len, advice)
+}
+
+pub unsafe fn memfd_create(_name: *const c_char, _flags: uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
 unsafe fn trim_ascii(value: &[i8]) -> &[u8] {
     for i in 0..value.len() {
         if value[i] == 0 {
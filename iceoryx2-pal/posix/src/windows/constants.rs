@@ -50,6 +50,8 @@ pub const PROT_EXEC: int = 8;
 pub const MCL_CURRENT: int = 16;
 pub const MCL_FUTURE: int = 32;
 pub const MAP_SHARED: int = 64;
+pub const MADV_DONTNEED: int = 4;
+pub const MFD_CLOEXEC: uint = 1;
 pub const MAP_FAILED: *mut void = 0 as *mut void;
 
 pub const PTHREAD_MUTEX_NORMAL: int = 1;
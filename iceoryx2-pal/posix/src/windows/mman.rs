@@ -382,3 +382,14 @@ pub unsafe fn munmap(addr: *mut void, len: size_t) -> int {
 pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     -1
 }
+
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    // file mappings keep their pages committed on windows, nothing can be released
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Tunnel
+//!
+//! The `iceoryx2-services-tunnel` crate bridges the publish-subscribe services of two hosts
+//! via UDP. A [`Tunnel`](tunnel::Tunnel) discovers the local services, forwards the samples
+//! of the local publishers to its peer and republishes the samples it receives from the peer.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2::service::ipc;
+//! use iceoryx2_bb_system_types::ipv4_address::Ipv4Address;
+//! use iceoryx2_bb_system_types::port::Port;
+//! use iceoryx2_services_tunnel::tunnel::{Config, Tunnel};
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let tunnel_config = Config {
+//!     bind_port: Port::new(7450),
+//!     ..Default::default()
+//! };
+//!
+//! let mut tunnel = Tunnel::<ipc::Service>::create(
+//!     &tunnel_config,
+//!     iceoryx2::config::Config::global_config(),
+//! )?;
+//! tunnel.connect(Ipv4Address::new(192, 168, 0, 2), Port::new(7450));
+//!
+//! loop {
+//!     tunnel.spin()?;
+//!     std::thread::sleep(core::time::Duration::from_millis(1));
+//! }
+//! # }
+//! ```
+
+#![warn(missing_docs)]
+
+/// The wire format of the tunnel
+pub mod protocol;
+
+/// Mirroring of publish-subscribe services between two hosts
+pub mod tunnel;
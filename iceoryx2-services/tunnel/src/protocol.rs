@@ -0,0 +1,440 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! The wire format of the tunnel.
+//!
+//! Every UDP datagram starts with a [`DATAGRAM_HEADER_SIZE`] byte header followed by an
+//! arbitrary number of [`Frame`]s. Small samples of many services are coalesced into one
+//! datagram, large samples are split into [`Frame::Fragment`]s that fit into one datagram
+//! each. All integers are encoded in little endian.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_services_tunnel::protocol::*;
+//!
+//! let mut writer = DatagramWriter::new(1472);
+//! assert!(writer.push(&Frame::Withdraw { channel: 42 }));
+//!
+//! DatagramReader::new(writer.as_bytes())
+//!     .expect("valid datagram")
+//!     .for_each_frame(|frame| assert_eq!(frame, Frame::Withdraw { channel: 42 }))
+//!     .expect("valid frames");
+//! ```
+
+use iceoryx2::service::static_config::message_type_details::{
+    TypeDetail, TypeNameString, TypeVariant,
+};
+
+/// Identifies a datagram of the tunnel.
+pub const MAGIC: u16 = 0x1c32;
+
+/// The version of the wire format. Datagrams of other versions are discarded.
+pub const VERSION: u8 = 1;
+
+/// The size of the header that precedes the frames of a datagram.
+pub const DATAGRAM_HEADER_SIZE: usize = 4;
+
+/// The size of the header that precedes the body of every frame.
+pub const FRAME_HEADER_SIZE: usize = 12;
+
+/// The size of the fields of a [`Frame::Fragment`] that precede the data.
+pub const FRAGMENT_HEADER_SIZE: usize = 28;
+
+/// The largest datagram that can be sent via UDP over IPv4.
+pub const MAX_DATAGRAM_SIZE: usize = 65507;
+
+const KIND_ANNOUNCE: u8 = 1;
+const KIND_WITHDRAW: u8 = 2;
+const KIND_FRAGMENT: u8 = 3;
+
+/// Errors that can occur while decoding a datagram.
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum ProtocolError {
+    /// The datagram does not start with [`MAGIC`].
+    NotATunnelDatagram,
+    /// The datagram was encoded with another [`VERSION`].
+    VersionMismatch,
+    /// A frame is shorter than its header claims or contains an unknown kind.
+    MalformedFrame,
+}
+
+impl core::fmt::Display for ProtocolError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        std::write!(f, "ProtocolError::{:?}", self)
+    }
+}
+
+impl core::error::Error for ProtocolError {}
+
+/// The settings of an announced service that are required to create an equivalent service on
+/// the peer.
+#[derive(Debug, Default, Eq, PartialEq, Clone, Copy)]
+pub struct ServiceSettings {
+    /// The maximum number of publishers of the service.
+    pub max_publishers: u64,
+    /// The maximum number of subscribers of the service.
+    pub max_subscribers: u64,
+    /// The number of samples a late-joining subscriber receives.
+    pub history_size: u64,
+    /// The maximum buffer size of a subscriber.
+    pub subscriber_max_buffer_size: u64,
+    /// The maximum number of samples a subscriber can borrow.
+    pub subscriber_max_borrowed_samples: u64,
+    /// Whether the oldest sample is overridden when a subscriber buffer is full.
+    pub enable_safe_overflow: bool,
+}
+
+const ENCODED_SERVICE_SETTINGS_LEN: usize = 5 * 8 + 1;
+
+/// A single message inside a datagram. The `channel` identifies the service on both sides of
+/// the tunnel, see [`channel_of()`].
+#[derive(Debug, Eq, PartialEq, Clone)]
+pub enum Frame<'a> {
+    /// Announces a publish-subscribe service that is mirrored to the peer.
+    Announce {
+        /// The channel of the service.
+        channel: u64,
+        /// The name of the service.
+        service_name: &'a str,
+        /// The type of the user header.
+        user_header: TypeDetail,
+        /// The type of the payload.
+        payload: TypeDetail,
+        /// The settings of the service.
+        settings: ServiceSettings,
+    },
+    /// The announced service does not exist anymore.
+    Withdraw {
+        /// The channel of the service.
+        channel: u64,
+    },
+    /// A part of a sample. The user header and the payload are treated as one contiguous
+    /// sequence of `total_len` bytes, `offset` is the position of `data` in this sequence.
+    Fragment {
+        /// The channel of the service.
+        channel: u64,
+        /// The per-channel sequence number of the sample the fragment belongs to.
+        sequence: u64,
+        /// The number of payload elements of the sample.
+        number_of_elements: u64,
+        /// The number of bytes of the user header and the payload.
+        total_len: u32,
+        /// The position of `data` in the sample.
+        offset: u32,
+        /// The number of bytes of the user header.
+        user_header_len: u32,
+        /// The bytes of the fragment.
+        data: &'a [u8],
+    },
+}
+
+/// Returns the channel of a service. The service id is identical on all hosts, therefore the
+/// channel is identical as well.
+pub fn channel_of(service_id: &str) -> u64 {
+    // FNV-1a
+    service_id
+        .as_bytes()
+        .iter()
+        .fold(0xcbf29ce484222325u64, |hash, byte| {
+            (hash ^ *byte as u64).wrapping_mul(0x100000001b3)
+        })
+}
+
+/// Returns the number of bytes of fragment data that fit into one datagram of `datagram_size`
+/// bytes.
+pub const fn max_fragment_data_len(datagram_size: usize) -> usize {
+    datagram_size.saturating_sub(DATAGRAM_HEADER_SIZE + FRAME_HEADER_SIZE + FRAGMENT_HEADER_SIZE)
+}
+
+fn encoded_type_detail_len(detail: &TypeDetail) -> usize {
+    1 + 8 + 8 + 2 + detail.type_name.len()
+}
+
+fn encode_type_detail(buffer: &mut Vec<u8>, detail: &TypeDetail) {
+    buffer.push(match detail.variant {
+        TypeVariant::FixedSize => 0,
+        TypeVariant::Dynamic => 1,
+    });
+    buffer.extend_from_slice(&(detail.size as u64).to_le_bytes());
+    buffer.extend_from_slice(&(detail.alignment as u64).to_le_bytes());
+    buffer.extend_from_slice(&(detail.type_name.len() as u16).to_le_bytes());
+    buffer.extend_from_slice(detail.type_name.as_bytes());
+}
+
+impl Frame<'_> {
+    fn encoded_len(&self) -> usize {
+        FRAME_HEADER_SIZE
+            + match self {
+                Frame::Announce {
+                    service_name,
+                    user_header,
+                    payload,
+                    ..
+                } => {
+                    encoded_type_detail_len(user_header)
+                        + encoded_type_detail_len(payload)
+                        + ENCODED_SERVICE_SETTINGS_LEN
+                        + 2
+                        + service_name.len()
+                }
+                Frame::Withdraw { .. } => 0,
+                Frame::Fragment { data, .. } => FRAGMENT_HEADER_SIZE + data.len(),
+            }
+    }
+
+    fn encode(&self, buffer: &mut Vec<u8>) {
+        let body_len = (self.encoded_len() - FRAME_HEADER_SIZE) as u16;
+        let (kind, channel) = match self {
+            Frame::Announce { channel, .. } => (KIND_ANNOUNCE, channel),
+            Frame::Withdraw { channel } => (KIND_WITHDRAW, channel),
+            Frame::Fragment { channel, .. } => (KIND_FRAGMENT, channel),
+        };
+
+        buffer.push(kind);
+        buffer.push(0);
+        buffer.extend_from_slice(&body_len.to_le_bytes());
+        buffer.extend_from_slice(&channel.to_le_bytes());
+
+        match self {
+            Frame::Announce {
+                service_name,
+                user_header,
+                payload,
+                settings,
+                ..
+            } => {
+                encode_type_detail(buffer, user_header);
+                encode_type_detail(buffer, payload);
+                for value in [
+                    settings.max_publishers,
+                    settings.max_subscribers,
+                    settings.history_size,
+                    settings.subscriber_max_buffer_size,
+                    settings.subscriber_max_borrowed_samples,
+                ] {
+                    buffer.extend_from_slice(&value.to_le_bytes());
+                }
+                buffer.push(settings.enable_safe_overflow as u8);
+                buffer.extend_from_slice(&(service_name.len() as u16).to_le_bytes());
+                buffer.extend_from_slice(service_name.as_bytes());
+            }
+            Frame::Withdraw { .. } => (),
+            Frame::Fragment {
+                sequence,
+                number_of_elements,
+                total_len,
+                offset,
+                user_header_len,
+                data,
+                ..
+            } => {
+                buffer.extend_from_slice(&sequence.to_le_bytes());
+                buffer.extend_from_slice(&number_of_elements.to_le_bytes());
+                buffer.extend_from_slice(&total_len.to_le_bytes());
+                buffer.extend_from_slice(&offset.to_le_bytes());
+                buffer.extend_from_slice(&user_header_len.to_le_bytes());
+                buffer.extend_from_slice(data);
+            }
+        }
+    }
+}
+
+/// Coalesces [`Frame`]s into one datagram of at most `capacity` bytes.
+#[derive(Debug)]
+pub struct DatagramWriter {
+    buffer: Vec<u8>,
+    capacity: usize,
+}
+
+impl DatagramWriter {
+    /// Creates an empty datagram. The `capacity` is clamped to [`MAX_DATAGRAM_SIZE`].
+    pub fn new(capacity: usize) -> Self {
+        let capacity = capacity.min(MAX_DATAGRAM_SIZE);
+        let mut buffer = Vec::with_capacity(capacity);
+        Self::write_header(&mut buffer);
+
+        Self { buffer, capacity }
+    }
+
+    fn write_header(buffer: &mut Vec<u8>) {
+        buffer.extend_from_slice(&MAGIC.to_le_bytes());
+        buffer.push(VERSION);
+        buffer.push(0);
+    }
+
+    /// Appends the frame when it fits into the remaining space. Returns false otherwise.
+    pub fn push(&mut self, frame: &Frame) -> bool {
+        if self.remaining() < frame.encoded_len() {
+            return false;
+        }
+
+        frame.encode(&mut self.buffer);
+        true
+    }
+
+    /// Returns the number of bytes that can still be appended.
+    pub fn remaining(&self) -> usize {
+        self.capacity - self.buffer.len()
+    }
+
+    /// Returns true when the datagram does not contain any frame.
+    pub fn is_empty(&self) -> bool {
+        self.buffer.len() == DATAGRAM_HEADER_SIZE
+    }
+
+    /// Returns the encoded datagram.
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.buffer
+    }
+
+    /// Removes all frames so that the datagram can be reused.
+    pub fn clear(&mut self) {
+        self.buffer.truncate(DATAGRAM_HEADER_SIZE);
+    }
+}
+
+struct Cursor<'a> {
+    bytes: &'a [u8],
+}
+
+impl<'a> Cursor<'a> {
+    fn take(&mut self, len: usize) -> Result<&'a [u8], ProtocolError> {
+        if self.bytes.len() < len {
+            return Err(ProtocolError::MalformedFrame);
+        }
+
+        let (value, rest) = self.bytes.split_at(len);
+        self.bytes = rest;
+        Ok(value)
+    }
+
+    fn u8(&mut self) -> Result<u8, ProtocolError> {
+        Ok(self.take(1)?[0])
+    }
+
+    fn u16(&mut self) -> Result<u16, ProtocolError> {
+        Ok(u16::from_le_bytes(self.take(2)?.try_into().unwrap()))
+    }
+
+    fn u32(&mut self) -> Result<u32, ProtocolError> {
+        Ok(u32::from_le_bytes(self.take(4)?.try_into().unwrap()))
+    }
+
+    fn u64(&mut self) -> Result<u64, ProtocolError> {
+        Ok(u64::from_le_bytes(self.take(8)?.try_into().unwrap()))
+    }
+
+    fn type_detail(&mut self) -> Result<TypeDetail, ProtocolError> {
+        let variant = match self.u8()? {
+            0 => TypeVariant::FixedSize,
+            1 => TypeVariant::Dynamic,
+            _ => return Err(ProtocolError::MalformedFrame),
+        };
+        let size = self.u64()? as usize;
+        let alignment = self.u64()? as usize;
+        let name_len = self.u16()? as usize;
+        let type_name = TypeNameString::from_bytes(self.take(name_len)?)
+            .map_err(|_| ProtocolError::MalformedFrame)?;
+
+        Ok(TypeDetail {
+            variant,
+            type_name,
+            size,
+            alignment,
+        })
+    }
+}
+
+/// Decodes the [`Frame`]s of a received datagram.
+#[derive(Debug)]
+pub struct DatagramReader<'a> {
+    frames: &'a [u8],
+}
+
+impl<'a> DatagramReader<'a> {
+    /// Verifies the datagram header.
+    pub fn new(datagram: &'a [u8]) -> Result<Self, ProtocolError> {
+        if datagram.len() < DATAGRAM_HEADER_SIZE
+            || u16::from_le_bytes([datagram[0], datagram[1]]) != MAGIC
+        {
+            return Err(ProtocolError::NotATunnelDatagram);
+        }
+
+        if datagram[2] != VERSION {
+            return Err(ProtocolError::VersionMismatch);
+        }
+
+        Ok(Self {
+            frames: &datagram[DATAGRAM_HEADER_SIZE..],
+        })
+    }
+
+    /// Calls `callback` for every frame of the datagram. Stops at the first malformed frame,
+    /// the frames before it were already handed to the callback.
+    pub fn for_each_frame<F: FnMut(Frame<'a>)>(
+        &self,
+        mut callback: F,
+    ) -> Result<(), ProtocolError> {
+        let mut cursor = Cursor { bytes: self.frames };
+
+        while !cursor.bytes.is_empty() {
+            let kind = cursor.u8()?;
+            cursor.u8()?;
+            let body_len = cursor.u16()? as usize;
+            let channel = cursor.u64()?;
+            let mut body = Cursor {
+                bytes: cursor.take(body_len)?,
+            };
+
+            let frame = match kind {
+                KIND_ANNOUNCE => {
+                    let user_header = body.type_detail()?;
+                    let payload = body.type_detail()?;
+                    let settings = ServiceSettings {
+                        max_publishers: body.u64()?,
+                        max_subscribers: body.u64()?,
+                        history_size: body.u64()?,
+                        subscriber_max_buffer_size: body.u64()?,
+                        subscriber_max_borrowed_samples: body.u64()?,
+                        enable_safe_overflow: body.u8()? != 0,
+                    };
+                    let name_len = body.u16()? as usize;
+                    let service_name = core::str::from_utf8(body.take(name_len)?)
+                        .map_err(|_| ProtocolError::MalformedFrame)?;
+                    Frame::Announce {
+                        channel,
+                        service_name,
+                        user_header,
+                        payload,
+                        settings,
+                    }
+                }
+                KIND_WITHDRAW => Frame::Withdraw { channel },
+                KIND_FRAGMENT => Frame::Fragment {
+                    channel,
+                    sequence: body.u64()?,
+                    number_of_elements: body.u64()?,
+                    total_len: body.u32()?,
+                    offset: body.u32()?,
+                    user_header_len: body.u32()?,
+                    data: body.bytes,
+                },
+                _ => return Err(ProtocolError::MalformedFrame),
+            };
+
+            callback(frame);
+        }
+
+        Ok(())
+    }
+}
@@ -0,0 +1,904 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::mem::MaybeUninit;
+use core::ops::Range;
+use core::time::Duration;
+use std::collections::HashMap;
+
+use iceoryx2::config::Config as IceoryxConfig;
+use iceoryx2::port::publisher::Publisher;
+use iceoryx2::port::subscriber::Subscriber;
+use iceoryx2::prelude::*;
+use iceoryx2::sample_mut_uninit::SampleMutUninit;
+use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
+use iceoryx2::service::port_factory::publish_subscribe::PortFactory;
+use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
+use iceoryx2::service::ServiceDetails;
+use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::udp_socket::{ReceiveDetails, UdpServer, UdpServerBuilder};
+use iceoryx2_bb_system_types::ipv4_address::{self, Ipv4Address};
+use iceoryx2_bb_system_types::port::{self, Port};
+use iceoryx2_services_discovery::service_discovery::{SyncError, Tracker};
+
+use crate::protocol::{
+    channel_of, max_fragment_data_len, DatagramReader, DatagramWriter, Frame, ServiceSettings,
+    FRAGMENT_HEADER_SIZE, FRAME_HEADER_SIZE, MAX_DATAGRAM_SIZE,
+};
+
+/// Fragments smaller than this are not appended to a partially filled datagram, the datagram
+/// is sent first instead.
+const MIN_FRAGMENT_DATA_LEN: usize = 256;
+
+/// Every IPv4 host must be able to receive datagrams of this size.
+const MIN_DATAGRAM_SIZE: usize = 576;
+
+/// The maximum number of datagrams that are sent or received with one call to the socket.
+const DATAGRAMS_PER_BATCH: usize = 16;
+
+type TunnelPublisher<S> = Publisher<S, [CustomPayloadMarker], CustomHeaderMarker>;
+type TunnelSubscriber<S> = Subscriber<S, [CustomPayloadMarker], CustomHeaderMarker>;
+type LoanedSample<S> = SampleMutUninit<S, [MaybeUninit<CustomPayloadMarker>], CustomHeaderMarker>;
+
+/// Errors that can occur when a [`Tunnel`] is created.
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum CreationError {
+    /// The node of the tunnel could not be created.
+    NodeCreationFailure,
+
+    /// The UDP socket could not be bound to the configured address and port.
+    SocketCreationFailure,
+}
+
+impl core::fmt::Display for CreationError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        std::write!(f, "CreationError::{:?}", self)
+    }
+}
+
+impl core::error::Error for CreationError {}
+
+/// Errors that can occur during the spin operation of the [`Tunnel`].
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum SpinError {
+    /// The caller does not have sufficient permissions to discover services.
+    InsufficientPermissions,
+
+    /// Failed to sync services with the iceoryx2 system.
+    SyncFailure,
+
+    /// A datagram could not be sent to the peer.
+    SendFailure,
+
+    /// Datagrams could not be received from the peer.
+    ReceiveFailure,
+}
+
+impl core::fmt::Display for SpinError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        std::write!(f, "SpinError::{:?}", self)
+    }
+}
+
+impl core::error::Error for SpinError {}
+
+impl From<SyncError> for SpinError {
+    fn from(error: SyncError) -> Self {
+        match error {
+            SyncError::InsufficientPermissions => SpinError::InsufficientPermissions,
+            SyncError::ServiceLookupFailure => SpinError::SyncFailure,
+        }
+    }
+}
+
+/// Configuration of the [`Tunnel`].
+#[derive(Debug, Clone)]
+pub struct Config {
+    /// The address the UDP socket of the tunnel is bound to.
+    pub bind_address: Ipv4Address,
+
+    /// The port the UDP socket of the tunnel is bound to. When it is unspecified the operating
+    /// system chooses a free port, see [`Tunnel::local_port()`].
+    pub bind_port: Port,
+
+    /// The maximum size of a datagram. Samples of multiple services are coalesced into one
+    /// datagram, larger samples are fragmented. Should not exceed the MTU of the network.
+    pub max_datagram_size: usize,
+
+    /// The maximum number of datagrams that are received in one [`Tunnel::spin()`]. They are
+    /// received in batches, on Linux with one `recvmmsg` call per batch.
+    pub max_datagrams_per_spin: usize,
+
+    /// The interval in which the local services are discovered. Listing the services is
+    /// expensive, therefore it is not done in every [`Tunnel::spin()`].
+    pub discovery_interval: Duration,
+
+    /// The interval in which all mirrored services are announced again so that a peer that
+    /// started later or lost an announcement mirrors them as well.
+    pub announcement_interval: Duration,
+}
+
+impl Default for Config {
+    fn default() -> Self {
+        Self {
+            bind_address: ipv4_address::UNSPECIFIED,
+            bind_port: port::UNSPECIFIED,
+            max_datagram_size: 1472,
+            max_datagrams_per_spin: 64,
+            discovery_interval: Duration::from_millis(500),
+            announcement_interval: Duration::from_secs(1),
+        }
+    }
+}
+
+#[derive(Debug)]
+struct Transport {
+    socket: UdpServer,
+    peer: Option<(Ipv4Address, Port)>,
+    writer: DatagramWriter,
+    max_fragment_data_len: usize,
+    /// The completed datagrams that were not yet sent, stored back to back.
+    batch: Vec<u8>,
+    /// The end of every datagram in `batch`.
+    batch_ends: Vec<usize>,
+}
+
+impl Transport {
+    fn push(&mut self, frame: &Frame) -> Result<(), SpinError> {
+        if self.writer.push(frame) {
+            return Ok(());
+        }
+
+        self.finish_datagram()?;
+        if !self.writer.push(frame) {
+            warn!(from self, "Dropping frame {:?} since it exceeds the max datagram size.", frame);
+        }
+
+        Ok(())
+    }
+
+    /// Returns how many of the `wanted` bytes of the next fragment fit into the datagram.
+    /// Sends the datagram first when only a small fragment would fit.
+    fn fragment_space(&mut self, wanted: usize) -> Result<usize, SpinError> {
+        let space = self
+            .writer
+            .remaining()
+            .saturating_sub(FRAME_HEADER_SIZE + FRAGMENT_HEADER_SIZE);
+        if space >= wanted.min(MIN_FRAGMENT_DATA_LEN) {
+            return Ok(space.min(wanted));
+        }
+
+        self.finish_datagram()?;
+        Ok(self.max_fragment_data_len.min(wanted))
+    }
+
+    /// Moves the datagram of the writer into the batch and sends the batch when it is full.
+    fn finish_datagram(&mut self) -> Result<(), SpinError> {
+        if self.writer.is_empty() {
+            return Ok(());
+        }
+
+        if self.peer.is_some() {
+            self.batch.extend_from_slice(self.writer.as_bytes());
+            self.batch_ends.push(self.batch.len());
+        }
+        self.writer.clear();
+
+        if self.batch_ends.len() < DATAGRAMS_PER_BATCH {
+            return Ok(());
+        }
+
+        self.send_batch()
+    }
+
+    /// Sends all pending datagrams, including the one of the writer.
+    fn flush(&mut self) -> Result<(), SpinError> {
+        self.finish_datagram()?;
+        self.send_batch()
+    }
+
+    fn send_batch(&mut self) -> Result<(), SpinError> {
+        if self.batch_ends.is_empty() {
+            return Ok(());
+        }
+
+        let mut result = Ok(0);
+        if let Some((address, port)) = self.peer {
+            let mut start = 0;
+            let datagrams: Vec<&[u8]> = self
+                .batch_ends
+                .iter()
+                .map(|&end| {
+                    let datagram = &self.batch[start..end];
+                    start = end;
+                    datagram
+                })
+                .collect();
+            result = self.socket.send_batch_to(&datagrams, address, port);
+        }
+
+        let number_of_datagrams = self.batch_ends.len();
+        self.batch.clear();
+        self.batch_ends.clear();
+
+        fail!(from self, when result,
+            with SpinError::SendFailure,
+            "Unable to send {} datagrams to the peer.", number_of_datagrams);
+        Ok(())
+    }
+}
+
+struct PendingSample<S: Service> {
+    sequence: u64,
+    total_len: usize,
+    received_bytes: usize,
+    /// The sorted and disjoint byte ranges of the sample that were already received.
+    received_ranges: Vec<Range<usize>>,
+    sample: LoanedSample<S>,
+}
+
+impl<S: Service> PendingSample<S> {
+    /// Records that the bytes of `range` were received. Returns false when a part of `range`
+    /// was already received.
+    fn insert(&mut self, range: Range<usize>) -> bool {
+        let index = self
+            .received_ranges
+            .partition_point(|received| received.end <= range.start);
+        if self
+            .received_ranges
+            .get(index)
+            .is_some_and(|received| received.start < range.end)
+        {
+            return false;
+        }
+
+        if range.is_empty() {
+            return true;
+        }
+
+        self.received_bytes += range.len();
+        let merges_previous = index > 0 && self.received_ranges[index - 1].end == range.start;
+        let merges_next = self
+            .received_ranges
+            .get(index)
+            .is_some_and(|received| received.start == range.end);
+        match (merges_previous, merges_next) {
+            (true, true) => {
+                let next = self.received_ranges.remove(index);
+                self.received_ranges[index - 1].end = next.end;
+            }
+            (true, false) => self.received_ranges[index - 1].end = range.end,
+            (false, true) => self.received_ranges[index].start = range.start,
+            (false, false) => self.received_ranges.insert(index, range),
+        }
+
+        true
+    }
+}
+
+struct Channel<S: Service> {
+    service_name: String,
+    user_header: TypeDetail,
+    payload: TypeDetail,
+    settings: ServiceSettings,
+    service: PortFactory<S, [CustomPayloadMarker], CustomHeaderMarker>,
+    /// Receives the samples of the local publishers that are forwarded to the peer.
+    subscriber: Option<TunnelSubscriber<S>>,
+    /// Publishes the samples that were received from the peer.
+    publisher: Option<TunnelPublisher<S>>,
+    pending: Option<PendingSample<S>>,
+    next_sequence: u64,
+}
+
+impl<S: Service> Channel<S> {
+    /// Opens the service or creates it with the announced `settings` when it does not exist
+    /// in the local domain.
+    fn open(
+        node: &Node<S>,
+        service_name: &str,
+        user_header: &TypeDetail,
+        payload: &TypeDetail,
+        settings: &ServiceSettings,
+    ) -> Option<Self> {
+        let origin = "Channel::open()";
+        let name = match ServiceName::new(service_name) {
+            Ok(name) => name,
+            Err(e) => {
+                warn!(from origin, "Unable to mirror the service \"{}\" since the name is invalid ({:?}).", service_name, e);
+                return None;
+            }
+        };
+
+        let builder = || unsafe {
+            node.service_builder(&name)
+                .publish_subscribe::<[CustomPayloadMarker]>()
+                .user_header::<CustomHeaderMarker>()
+                .__internal_set_payload_type_details(payload)
+                .__internal_set_user_header_type_details(user_header)
+        };
+
+        let service = match builder().open() {
+            Ok(service) => service,
+            Err(_) => match builder()
+                .max_publishers(settings.max_publishers as usize)
+                .max_subscribers(settings.max_subscribers as usize)
+                .history_size(settings.history_size as usize)
+                .subscriber_max_buffer_size(settings.subscriber_max_buffer_size as usize)
+                .subscriber_max_borrowed_samples(settings.subscriber_max_borrowed_samples as usize)
+                .enable_safe_overflow(settings.enable_safe_overflow)
+                .create()
+            {
+                Ok(service) => service,
+                Err(e) => {
+                    warn!(from origin, "Unable to mirror the service \"{}\" since it could not be opened or created ({:?}).", service_name, e);
+                    return None;
+                }
+            },
+        };
+
+        Some(Self {
+            service_name: service_name.to_string(),
+            user_header: user_header.clone(),
+            payload: payload.clone(),
+            settings: *settings,
+            service,
+            subscriber: None,
+            publisher: None,
+            pending: None,
+            next_sequence: 0,
+        })
+    }
+
+    fn announcement(&self, channel: u64) -> Frame<'_> {
+        Frame::Announce {
+            channel,
+            service_name: &self.service_name,
+            user_header: self.user_header.clone(),
+            payload: self.payload.clone(),
+            settings: self.settings,
+        }
+    }
+
+    fn forward(&mut self, channel: u64, transport: &mut Transport) -> Result<(), SpinError> {
+        let subscriber = match &self.subscriber {
+            Some(subscriber) => subscriber,
+            None => return Ok(()),
+        };
+
+        loop {
+            let sample = match unsafe { subscriber.receive_custom_payload() } {
+                Ok(Some(sample)) => sample,
+                Ok(None) => return Ok(()),
+                Err(e) => {
+                    warn!(from "Channel::forward()", "Unable to receive samples of the service \"{}\" ({:?}).", self.service_name, e);
+                    return Ok(());
+                }
+            };
+
+            // samples that were received from the peer are not sent back
+            if let Some(publisher) = &self.publisher {
+                if sample.header().publisher_id() == publisher.id() {
+                    continue;
+                }
+            }
+
+            let user_header = unsafe {
+                core::slice::from_raw_parts(
+                    (sample.user_header() as *const CustomHeaderMarker).cast::<u8>(),
+                    self.user_header.size,
+                )
+            };
+            let payload = unsafe {
+                core::slice::from_raw_parts(
+                    sample.payload().as_ptr().cast::<u8>(),
+                    sample.payload().len(),
+                )
+            };
+            let total_len = user_header.len() + payload.len();
+            if total_len > u32::MAX as usize {
+                warn!(from "Channel::forward()", "Dropping sample of the service \"{}\" since its size of {} bytes cannot be tunneled.", self.service_name, total_len);
+                continue;
+            }
+
+            let sequence = self.next_sequence;
+            self.next_sequence += 1;
+
+            for (region, region_offset) in [(user_header, 0), (payload, user_header.len())] {
+                let mut position = 0;
+                while position < region.len() {
+                    let len = transport.fragment_space(region.len() - position)?;
+                    transport.push(&Frame::Fragment {
+                        channel,
+                        sequence,
+                        number_of_elements: sample.header().number_of_elements(),
+                        total_len: total_len as u32,
+                        offset: (region_offset + position) as u32,
+                        user_header_len: user_header.len() as u32,
+                        data: &region[position..position + len],
+                    })?;
+                    position += len;
+                }
+            }
+
+            // samples without user header and payload consist of a single empty fragment
+            if total_len == 0 {
+                transport.push(&Frame::Fragment {
+                    channel,
+                    sequence,
+                    number_of_elements: sample.header().number_of_elements(),
+                    total_len: 0,
+                    offset: 0,
+                    user_header_len: 0,
+                    data: &[],
+                })?;
+            }
+        }
+    }
+
+    fn receive_fragment(
+        &mut self,
+        sequence: u64,
+        number_of_elements: u64,
+        total_len: usize,
+        offset: usize,
+        user_header_len: usize,
+        data: &[u8],
+    ) {
+        let publisher = match &self.publisher {
+            Some(publisher) => publisher,
+            None => return,
+        };
+
+        let expected_len = usize::try_from(number_of_elements)
+            .ok()
+            .and_then(|n| n.checked_mul(self.payload.size))
+            .and_then(|len| len.checked_add(user_header_len));
+        let end = offset.checked_add(data.len());
+        if user_header_len != self.user_header.size
+            || expected_len != Some(total_len)
+            || end.map_or(true, |end| end > total_len)
+            || (self.payload.variant == TypeVariant::FixedSize && number_of_elements != 1)
+        {
+            warn!(from "Channel::receive_fragment()", "Dropping fragment of the service \"{}\" since it does not match the type of the service.", self.service_name);
+            return;
+        }
+        let range = offset..offset + data.len();
+
+        // a newer sample arrived before all fragments of the pending one, the pending one is
+        // incomplete and discarded
+        if self
+            .pending
+            .as_ref()
+            .is_some_and(|pending| pending.sequence != sequence)
+        {
+            self.pending = None;
+        }
+
+        if self.pending.is_none() {
+            match unsafe { publisher.loan_custom_payload(number_of_elements as usize) } {
+                Ok(sample) => {
+                    self.pending = Some(PendingSample {
+                        sequence,
+                        total_len,
+                        received_bytes: 0,
+                        received_ranges: Vec::new(),
+                        sample,
+                    })
+                }
+                Err(e) => {
+                    warn!(from "Channel::receive_fragment()", "Dropping sample of the service \"{}\" since no memory could be loaned ({:?}).", self.service_name, e);
+                    return;
+                }
+            }
+        }
+
+        let pending = self.pending.as_mut().unwrap();
+        if pending.total_len != total_len {
+            warn!(from "Channel::receive_fragment()", "Dropping fragment of the service \"{}\" since its size differs from the size of the other fragments of the sample.", self.service_name);
+            return;
+        }
+
+        if !pending.insert(range) {
+            warn!(from "Channel::receive_fragment()", "Dropping fragment of the service \"{}\" since it overlaps with an already received fragment.", self.service_name);
+            return;
+        }
+
+        let user_header =
+            (pending.sample.user_header_mut() as *mut CustomHeaderMarker).cast::<u8>();
+        let payload = pending.sample.payload_mut().as_mut_ptr().cast::<u8>();
+        let header_part = data.len().min(user_header_len.saturating_sub(offset));
+        unsafe {
+            if header_part > 0 {
+                core::ptr::copy_nonoverlapping(data.as_ptr(), user_header.add(offset), header_part);
+            }
+            if header_part < data.len() {
+                core::ptr::copy_nonoverlapping(
+                    data.as_ptr().add(header_part),
+                    payload.add(offset + header_part - user_header_len),
+                    data.len() - header_part,
+                );
+            }
+        }
+        // the received ranges are disjoint, every byte of the sample is initialized once they
+        // cover the whole sample
+        if pending.received_bytes < total_len {
+            return;
+        }
+
+        let pending = self.pending.take().unwrap();
+        if let Err(e) = unsafe { pending.sample.assume_init() }.send() {
+            warn!(from "Channel::receive_fragment()", "Unable to publish sample of the service \"{}\" ({:?}).", self.service_name, e);
+        }
+    }
+}
+
+/// Bridges the publish-subscribe services of two hosts.
+///
+/// The tunnel discovers the local publish-subscribe services, subscribes to them and forwards
+/// every sample via UDP to the peer. The peer creates the announced services, publishes the
+/// received samples and forwards the samples of its own local publishers in the opposite
+/// direction.
+///
+/// # Type Parameters
+///
+/// * `S` - The service type of the mirrored services.
+pub struct Tunnel<S: Service> {
+    config: Config,
+    iceoryx_config: IceoryxConfig,
+    node: Node<S>,
+    tracker: Tracker<S>,
+    channels: HashMap<u64, Channel<S>>,
+    transport: Transport,
+    receive_buffer: Vec<u8>,
+    receive_details: Vec<ReceiveDetails>,
+    last_discovery: Option<Time>,
+    last_announcement: Option<Time>,
+}
+
+impl<S: Service> core::fmt::Debug for Tunnel<S> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "Tunnel<{}> {{ config: {:?}, transport: {:?}, number_of_channels: {} }}",
+            core::any::type_name::<S>(),
+            self.config,
+            self.transport,
+            self.channels.len()
+        )
+    }
+}
+
+impl<S: Service> Tunnel<S> {
+    /// Creates the tunnel and binds its UDP socket. Samples are forwarded as soon as a peer
+    /// is set with [`Tunnel::connect()`].
+    ///
+    /// # Parameters
+    ///
+    /// * `tunnel_config` - Configuration of the tunnel.
+    /// * `iceoryx_config` - Configuration of the iceoryx2 system whose services are mirrored.
+    pub fn create(
+        tunnel_config: &Config,
+        iceoryx_config: &IceoryxConfig,
+    ) -> Result<Self, CreationError> {
+        let origin = "Tunnel::create()";
+        let node = fail!(from origin,
+            when NodeBuilder::new().config(iceoryx_config).create::<S>(),
+            with CreationError::NodeCreationFailure,
+            "Unable to create the tunnel since the node could not be created.");
+
+        let socket = fail!(from origin,
+            when UdpServerBuilder::new()
+                .address(tunnel_config.bind_address)
+                .port(tunnel_config.bind_port)
+                .listen(),
+            with CreationError::SocketCreationFailure,
+            "Unable to create the tunnel since the socket could not be bound to {}:{}.",
+            tunnel_config.bind_address, tunnel_config.bind_port.as_u16());
+
+        let max_datagram_size = tunnel_config
+            .max_datagram_size
+            .clamp(MIN_DATAGRAM_SIZE, MAX_DATAGRAM_SIZE);
+
+        Ok(Self {
+            config: tunnel_config.clone(),
+            iceoryx_config: iceoryx_config.clone(),
+            node,
+            tracker: Tracker::new(),
+            channels: HashMap::new(),
+            transport: Transport {
+                socket,
+                peer: None,
+                writer: DatagramWriter::new(max_datagram_size),
+                max_fragment_data_len: max_fragment_data_len(max_datagram_size),
+                batch: Vec::with_capacity(DATAGRAMS_PER_BATCH * max_datagram_size),
+                batch_ends: Vec::with_capacity(DATAGRAMS_PER_BATCH),
+            },
+            // the peer may be configured with a larger max datagram size
+            receive_buffer: vec![0; DATAGRAMS_PER_BATCH * MAX_DATAGRAM_SIZE],
+            receive_details: Vec::with_capacity(DATAGRAMS_PER_BATCH),
+            last_discovery: None,
+            last_announcement: None,
+        })
+    }
+
+    /// Returns the port the UDP socket of the tunnel is bound to.
+    pub fn local_port(&self) -> Port {
+        self.transport.socket.port()
+    }
+
+    /// Sets the peer to which the samples are forwarded. All mirrored services are announced
+    /// with the next [`Tunnel::spin()`].
+    pub fn connect(&mut self, address: Ipv4Address, port: Port) {
+        self.transport.peer = Some((address, port));
+        self.last_announcement = None;
+    }
+
+    /// Returns the number of services that are mirrored in at least one direction.
+    pub fn number_of_channels(&self) -> usize {
+        self.channels.len()
+    }
+
+    /// Discovers services, forwards the samples of the local publishers to the peer and
+    /// publishes the samples that were received from the peer.
+    ///
+    /// This function must be called periodically, the rate determines the latency of the
+    /// tunnel.
+    pub fn spin(&mut self) -> Result<(), SpinError> {
+        if Self::is_due(&mut self.last_discovery, self.config.discovery_interval) {
+            self.discover()?;
+        }
+
+        if Self::is_due(
+            &mut self.last_announcement,
+            self.config.announcement_interval,
+        ) {
+            for (channel, c) in self.channels.iter().filter(|(_, c)| c.subscriber.is_some()) {
+                self.transport.push(&c.announcement(*channel))?;
+            }
+        }
+
+        for (channel, c) in self.channels.iter_mut() {
+            c.forward(*channel, &mut self.transport)?;
+        }
+        self.transport.flush()?;
+
+        self.receive()
+    }
+
+    fn is_due(last: &mut Option<Time>, interval: Duration) -> bool {
+        let is_due = match last {
+            None => true,
+            Some(last) => last.elapsed().map(|e| e >= interval).unwrap_or(true),
+        };
+
+        if is_due {
+            *last = Time::now().ok();
+        }
+
+        is_due
+    }
+
+    fn discover(&mut self) -> Result<(), SpinError> {
+        let (added_ids, removed_services) = self.tracker.sync(&self.iceoryx_config)?;
+
+        for id in &added_ids {
+            let (service_name, user_header, payload, settings) = match self.tracker.get(id) {
+                Some(service) => match Self::mirrorable(service) {
+                    Some(details) => details,
+                    None => continue,
+                },
+                None => continue,
+            };
+
+            let channel = channel_of(id.as_str());
+            if !self.channels.contains_key(&channel) {
+                match Channel::open(&self.node, &service_name, &user_header, &payload, &settings) {
+                    Some(c) => self.channels.insert(channel, c),
+                    None => continue,
+                };
+            }
+
+            let c = self.channels.get_mut(&channel).unwrap();
+            let subscriber = c
+                .service
+                .subscriber_builder()
+                .buffer_size(settings.subscriber_max_buffer_size as usize)
+                .create();
+            match subscriber {
+                Ok(subscriber) => {
+                    c.subscriber = Some(subscriber);
+                    self.transport.push(&c.announcement(channel))?;
+                }
+                Err(e) => {
+                    warn!(from self, "Unable to forward the service \"{}\" since the subscriber could not be created ({:?}).", service_name, e);
+                }
+            }
+        }
+
+        for service in &removed_services {
+            let channel = channel_of(service.static_details.service_id().as_str());
+            if let Some(c) = self.channels.get_mut(&channel) {
+                c.subscriber = None;
+                self.transport.push(&Frame::Withdraw { channel })?;
+                if c.publisher.is_none() {
+                    self.channels.remove(&channel);
+                }
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Returns the name, the user header type, the payload type and the settings of a
+    /// publish-subscribe service that can be mirrored.
+    fn mirrorable(
+        service: &ServiceDetails<S>,
+    ) -> Option<(String, TypeDetail, TypeDetail, ServiceSettings)> {
+        let name = service.static_details.name();
+        if ServiceName::has_iox2_prefix(name) {
+            return None;
+        }
+
+        match service.static_details.messaging_pattern() {
+            MessagingPattern::PublishSubscribe(config) => Some((
+                name.to_string(),
+                config.message_type_details().user_header.clone(),
+                config.message_type_details().payload.clone(),
+                ServiceSettings {
+                    max_publishers: config.max_publishers() as u64,
+                    max_subscribers: config.max_subscribers() as u64,
+                    history_size: config.history_size() as u64,
+                    subscriber_max_buffer_size: config.subscriber_max_buffer_size() as u64,
+                    subscriber_max_borrowed_samples: config.subscriber_max_borrowed_samples()
+                        as u64,
+                    enable_safe_overflow: config.has_safe_overflow(),
+                },
+            )),
+            _ => None,
+        }
+    }
+
+    fn receive(&mut self) -> Result<(), SpinError> {
+        let mut buffer = core::mem::take(&mut self.receive_buffer);
+        let mut details = core::mem::take(&mut self.receive_details);
+        let result = self.receive_into(&mut buffer, &mut details);
+        self.receive_buffer = buffer;
+        self.receive_details = details;
+        result
+    }
+
+    fn receive_into(
+        &mut self,
+        buffer: &mut [u8],
+        details: &mut Vec<ReceiveDetails>,
+    ) -> Result<(), SpinError> {
+        let mut number_of_received_datagrams = 0;
+        while number_of_received_datagrams < self.config.max_datagrams_per_spin {
+            let batch_size = (self.config.max_datagrams_per_spin - number_of_received_datagrams)
+                .min(DATAGRAMS_PER_BATCH);
+            let batch = &mut buffer[..batch_size * MAX_DATAGRAM_SIZE];
+            let number_of_datagrams = match self.transport.socket.try_receive_batch_from(
+                batch,
+                MAX_DATAGRAM_SIZE,
+                details,
+            ) {
+                Ok(number_of_datagrams) => number_of_datagrams,
+                Err(e) => {
+                    fail!(from self, with SpinError::ReceiveFailure,
+                        "Unable to receive datagrams from the peer ({:?}).", e);
+                }
+            };
+
+            for (i, detail) in details.iter().enumerate() {
+                let start = i * MAX_DATAGRAM_SIZE;
+                self.handle_datagram(&buffer[start..start + detail.number_of_bytes], detail);
+            }
+
+            number_of_received_datagrams += number_of_datagrams;
+            if number_of_datagrams < batch_size {
+                return Ok(());
+            }
+        }
+
+        Ok(())
+    }
+
+    fn handle_datagram(&mut self, datagram: &[u8], details: &ReceiveDetails) {
+        // only the configured peer may publish samples via the tunnel
+        if self.transport.peer != Some((details.source_ip, details.source_port)) {
+            warn!(from self, "Discarding datagram from {}:{} since it was not sent by the peer.", details.source_ip, details.source_port.as_u16());
+            return;
+        }
+
+        let reader = match DatagramReader::new(datagram) {
+            Ok(reader) => reader,
+            Err(e) => {
+                warn!(from self, "Discarding datagram from {}:{} ({:?}).", details.source_ip, details.source_port.as_u16(), e);
+                return;
+            }
+        };
+
+        if let Err(e) = reader.for_each_frame(|frame| self.handle_frame(frame)) {
+            warn!(from self, "Discarding the rest of a datagram from {}:{} ({:?}).", details.source_ip, details.source_port.as_u16(), e);
+        }
+    }
+
+    fn handle_frame(&mut self, frame: Frame) {
+        match frame {
+            Frame::Announce {
+                channel,
+                service_name,
+                user_header,
+                payload,
+                settings,
+            } => {
+                if !self.channels.contains_key(&channel) {
+                    match Channel::open(&self.node, service_name, &user_header, &payload, &settings)
+                    {
+                        Some(c) => self.channels.insert(channel, c),
+                        None => return,
+                    };
+                }
+
+                let c = self.channels.get_mut(&channel).unwrap();
+                if c.publisher.is_some() {
+                    return;
+                }
+
+                let publisher = c
+                    .service
+                    .publisher_builder()
+                    .allocation_strategy(match payload.variant {
+                        TypeVariant::FixedSize => AllocationStrategy::Static,
+                        TypeVariant::Dynamic => AllocationStrategy::PowerOfTwo,
+                    })
+                    .create();
+                match publisher {
+                    Ok(publisher) => c.publisher = Some(publisher),
+                    Err(e) => {
+                        warn!(from self, "Unable to mirror the service \"{}\" since the publisher could not be created ({:?}).", service_name, e);
+                    }
+                }
+            }
+            Frame::Withdraw { channel } => {
+                if let Some(c) = self.channels.get_mut(&channel) {
+                    c.publisher = None;
+                    c.pending = None;
+                    if c.subscriber.is_none() {
+                        self.channels.remove(&channel);
+                    }
+                }
+            }
+            Frame::Fragment {
+                channel,
+                sequence,
+                number_of_elements,
+                total_len,
+                offset,
+                user_header_len,
+                data,
+            } => {
+                if let Some(c) = self.channels.get_mut(&channel) {
+                    c.receive_fragment(
+                        sequence,
+                        number_of_elements,
+                        total_len as usize,
+                        offset as usize,
+                        user_header_len as usize,
+                        data,
+                    );
+                }
+            }
+        }
+    }
+}
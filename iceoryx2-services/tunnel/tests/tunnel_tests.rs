@@ -0,0 +1,346 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[generic_tests::define]
+mod tunnel {
+    use core::time::Duration;
+
+    use iceoryx2::port::subscriber::Subscriber;
+    use iceoryx2::prelude::*;
+    use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
+    use iceoryx2::testing::*;
+    use iceoryx2_bb_posix::clock::Time;
+    use iceoryx2_bb_posix::udp_socket::{UdpServer, UdpServerBuilder};
+    use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+    use iceoryx2_bb_system_types::ipv4_address::LOCALHOST;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_services_tunnel::protocol::{
+        DatagramWriter, Frame, ServiceSettings, MAX_DATAGRAM_SIZE,
+    };
+    use iceoryx2_services_tunnel::tunnel::{Config as TunnelConfig, Tunnel};
+
+    const TIMEOUT: Duration = Duration::from_secs(10);
+
+    fn generate_name() -> ServiceName {
+        ServiceName::new(&format!(
+            "test_tunnel_{}",
+            UniqueSystemId::new().unwrap().value()
+        ))
+        .unwrap()
+    }
+
+    /// Two tunnels on loopback that connect two isolated iceoryx2 domains.
+    fn connected_tunnels<S: Service>(
+        config_a: &Config,
+        config_b: &Config,
+    ) -> (Tunnel<S>, Tunnel<S>) {
+        let tunnel_config = TunnelConfig {
+            bind_address: LOCALHOST,
+            discovery_interval: Duration::ZERO,
+            ..Default::default()
+        };
+
+        let mut tunnel_a = Tunnel::<S>::create(&tunnel_config, config_a).unwrap();
+        let mut tunnel_b = Tunnel::<S>::create(&tunnel_config, config_b).unwrap();
+        tunnel_a.connect(LOCALHOST, tunnel_b.local_port());
+        tunnel_b.connect(LOCALHOST, tunnel_a.local_port());
+
+        (tunnel_a, tunnel_b)
+    }
+
+    /// A tunnel whose peer is a plain UDP socket so that the test controls every datagram.
+    fn tunnel_with_raw_peer<S: Service>(config: &Config) -> (Tunnel<S>, UdpServer) {
+        let tunnel_config = TunnelConfig {
+            bind_address: LOCALHOST,
+            discovery_interval: Duration::ZERO,
+            ..Default::default()
+        };
+
+        let mut tunnel = Tunnel::<S>::create(&tunnel_config, config).unwrap();
+        let peer = UdpServerBuilder::new().address(LOCALHOST).listen().unwrap();
+        tunnel.connect(LOCALHOST, peer.port());
+
+        (tunnel, peer)
+    }
+
+    fn send_frame<S: Service>(socket: &UdpServer, tunnel: &Tunnel<S>, frame: &Frame) {
+        let mut writer = DatagramWriter::new(MAX_DATAGRAM_SIZE);
+        assert_that!(writer.push(frame), eq true);
+        socket
+            .send_to(writer.as_bytes(), LOCALHOST, tunnel.local_port())
+            .unwrap();
+    }
+
+    fn announce_u64_service<S: Service>(
+        socket: &UdpServer,
+        tunnel: &mut Tunnel<S>,
+        node: &Node<S>,
+        service_name: &ServiceName,
+    ) -> Subscriber<S, u64, ()> {
+        send_frame(
+            socket,
+            tunnel,
+            &Frame::Announce {
+                channel: 1,
+                service_name: service_name.as_str(),
+                user_header: TypeDetail::__internal_new::<()>(TypeVariant::FixedSize),
+                payload: TypeDetail::__internal_new::<u64>(TypeVariant::FixedSize),
+                settings: ServiceSettings {
+                    max_publishers: 2,
+                    max_subscribers: 2,
+                    history_size: 0,
+                    subscriber_max_buffer_size: 2,
+                    subscriber_max_borrowed_samples: 2,
+                    enable_safe_overflow: true,
+                },
+            },
+        );
+
+        let start = Time::now().unwrap();
+        loop {
+            assert_that!(start.elapsed().unwrap(), lt TIMEOUT);
+            tunnel.spin().unwrap();
+            if let Ok(service) = node
+                .service_builder(service_name)
+                .publish_subscribe::<u64>()
+                .open()
+            {
+                if service.dynamic_config().number_of_publishers() > 0 {
+                    return service.subscriber_builder().create().unwrap();
+                }
+            }
+            std::thread::sleep(Duration::from_millis(1));
+        }
+    }
+
+    fn fragment(sequence: u64, offset: u32, data: &[u8]) -> Frame<'_> {
+        Frame::Fragment {
+            channel: 1,
+            sequence,
+            number_of_elements: 1,
+            total_len: 8,
+            offset,
+            user_header_len: 0,
+            data,
+        }
+    }
+
+    fn spin_until<S: Service, F: FnMut() -> bool>(
+        tunnel_a: &mut Tunnel<S>,
+        tunnel_b: &mut Tunnel<S>,
+        mut condition: F,
+    ) {
+        let start = Time::now().unwrap();
+        while !condition() {
+            assert_that!(start.elapsed().unwrap(), lt TIMEOUT);
+            tunnel_a.spin().unwrap();
+            tunnel_b.spin().unwrap();
+            std::thread::sleep(Duration::from_millis(1));
+        }
+    }
+
+    #[test]
+    fn forwards_samples_to_the_remote_domain<S: Service>() {
+        const NUMBER_OF_SAMPLES: u64 = 8;
+        let service_name = generate_name();
+        let config_a = generate_isolated_config();
+        let config_b = generate_isolated_config();
+        let (mut tunnel_a, mut tunnel_b) = connected_tunnels::<S>(&config_a, &config_b);
+
+        let node_a = NodeBuilder::new().config(&config_a).create::<S>().unwrap();
+        let node_b = NodeBuilder::new().config(&config_b).create::<S>().unwrap();
+        let service_a = node_a
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()
+            .unwrap();
+        let publisher = service_a.publisher_builder().create().unwrap();
+
+        let mut service_b = None;
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            service_b = node_b
+                .service_builder(&service_name)
+                .publish_subscribe::<u64>()
+                .open()
+                .ok();
+            service_b.is_some()
+        });
+        let subscriber = service_b.unwrap().subscriber_builder().create().unwrap();
+
+        // the tunnel of domain a subscribes on discovery, afterwards samples are forwarded
+        tunnel_a.spin().unwrap();
+        for n in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(n).unwrap();
+        }
+
+        let mut received = vec![];
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            while let Some(sample) = subscriber.receive().unwrap() {
+                received.push(*sample);
+            }
+            received.len() == NUMBER_OF_SAMPLES as usize
+        });
+
+        assert_that!(received, eq(0..NUMBER_OF_SAMPLES).collect::<Vec<_>>());
+    }
+
+    #[test]
+    fn fragments_samples_larger_than_a_datagram<S: Service>() {
+        const SLICE_LEN: usize = 100_000;
+        let service_name = generate_name();
+        let config_a = generate_isolated_config();
+        let config_b = generate_isolated_config();
+        let (mut tunnel_a, mut tunnel_b) = connected_tunnels::<S>(&config_a, &config_b);
+
+        let node_a = NodeBuilder::new().config(&config_a).create::<S>().unwrap();
+        let node_b = NodeBuilder::new().config(&config_b).create::<S>().unwrap();
+        let service_a = node_a
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .user_header::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service_a
+            .publisher_builder()
+            .initial_max_slice_len(SLICE_LEN)
+            .create()
+            .unwrap();
+
+        let mut service_b = None;
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            service_b = node_b
+                .service_builder(&service_name)
+                .publish_subscribe::<[u8]>()
+                .user_header::<u64>()
+                .open()
+                .ok();
+            service_b.is_some()
+        });
+        let subscriber = service_b.unwrap().subscriber_builder().create().unwrap();
+
+        tunnel_a.spin().unwrap();
+        let mut sample = publisher.loan_slice_uninit(SLICE_LEN).unwrap();
+        *sample.user_header_mut() = 0xdeadbeef;
+        let sample = sample.write_from_fn(|n| (n % 251) as u8);
+        sample.send().unwrap();
+
+        let mut received = None;
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            received = subscriber.receive().unwrap();
+            received.is_some()
+        });
+
+        let received = received.unwrap();
+        assert_that!(*received.user_header(), eq 0xdeadbeef);
+        assert_that!(received.payload().len(), eq SLICE_LEN);
+        for (n, byte) in received.payload().iter().enumerate() {
+            assert_that!(*byte, eq(n % 251) as u8);
+        }
+    }
+
+    #[test]
+    fn does_not_send_received_samples_back<S: Service>() {
+        let service_name = generate_name();
+        let config_a = generate_isolated_config();
+        let config_b = generate_isolated_config();
+        let (mut tunnel_a, mut tunnel_b) = connected_tunnels::<S>(&config_a, &config_b);
+
+        let node_a = NodeBuilder::new().config(&config_a).create::<S>().unwrap();
+        let node_b = NodeBuilder::new().config(&config_b).create::<S>().unwrap();
+        let service_a = node_a
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service_a.publisher_builder().create().unwrap();
+        let subscriber_a = service_a.subscriber_builder().create().unwrap();
+
+        let mut service_b = None;
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            service_b = node_b
+                .service_builder(&service_name)
+                .publish_subscribe::<u64>()
+                .open()
+                .ok();
+            service_b.is_some()
+        });
+        let subscriber_b = service_b.unwrap().subscriber_builder().create().unwrap();
+
+        tunnel_a.spin().unwrap();
+        publisher.send_copy(1234).unwrap();
+
+        spin_until(&mut tunnel_a, &mut tunnel_b, || {
+            subscriber_b.receive().unwrap().is_some()
+        });
+        for _ in 0..10 {
+            tunnel_a.spin().unwrap();
+            tunnel_b.spin().unwrap();
+        }
+
+        assert_that!(*subscriber_a.receive().unwrap().unwrap(), eq 1234);
+        assert_that!(subscriber_a.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn duplicate_fragments_do_not_complete_a_sample<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let (mut tunnel, peer) = tunnel_with_raw_peer::<S>(&config);
+        let subscriber = announce_u64_service(&peer, &mut tunnel, &node, &service_name);
+
+        let value = 0x0123456789abcdef_u64.to_ne_bytes();
+        send_frame(&peer, &tunnel, &fragment(0, 0, &value[..4]));
+        send_frame(&peer, &tunnel, &fragment(0, 0, &value[..4]));
+        send_frame(&peer, &tunnel, &fragment(0, 2, &value[2..6]));
+        for _ in 0..10 {
+            tunnel.spin().unwrap();
+            std::thread::sleep(Duration::from_millis(1));
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+
+        send_frame(&peer, &tunnel, &fragment(0, 4, &value[4..]));
+        let start = Time::now().unwrap();
+        let sample = loop {
+            assert_that!(start.elapsed().unwrap(), lt TIMEOUT);
+            tunnel.spin().unwrap();
+            if let Some(sample) = subscriber.receive().unwrap() {
+                break sample;
+            }
+            std::thread::sleep(Duration::from_millis(1));
+        };
+        assert_that!(*sample, eq 0x0123456789abcdef);
+    }
+
+    #[test]
+    fn discards_datagrams_that_were_not_sent_by_the_peer<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let (mut tunnel, peer) = tunnel_with_raw_peer::<S>(&config);
+        let subscriber = announce_u64_service(&peer, &mut tunnel, &node, &service_name);
+
+        let foreigner = UdpServerBuilder::new().address(LOCALHOST).listen().unwrap();
+        let value = 1234_u64.to_ne_bytes();
+        send_frame(&foreigner, &tunnel, &fragment(0, 0, &value));
+        for _ in 0..10 {
+            tunnel.spin().unwrap();
+            std::thread::sleep(Duration::from_millis(1));
+        }
+
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
+    mod ipc {}
+}
@@ -36,6 +36,34 @@
 //! # }
 //! ```
 //!
+//! ## Apply A Performance Profile
+//!
+//! The publish-subscribe defaults can be replaced with one of the named
+//! [`PerformanceProfile`]s. The profiles can be adjusted in the `[profiles.*]` sections of the
+//! config file.
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::config::{Config, PerformanceProfile};
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let mut custom_config = Config::default();
+//! custom_config.apply_profile(PerformanceProfile::HighThroughput);
+//!
+//! let node = NodeBuilder::new()
+//!     .config(&custom_config)
+//!     .create::<ipc::Service>()?;
+//!
+//! // or apply it only to a single service
+//! let service = node.service_builder(&"MyServiceName".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .performance_profile(PerformanceProfile::LowLatency)
+//!     .open_or_create()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
 //! ## Set Global Config From Custom File
 //!
 //! The [`crate::config::Config::setup_global_config_from_file()`] call must be the first
@@ -158,7 +186,8 @@ pub struct Node {
     pub service_tag_suffix: FileName,
     /// When true, the [`NodeBuilder`](crate::node::NodeBuilder) checks for dead nodes and
     /// cleans up all their stale resources whenever a new [`Node`](crate::node::Node) is
-    /// created.
+    /// created. Can be disabled when a
+    /// [`DeadNodeReaper`](crate::node::dead_node_reaper::DeadNodeReaper) is running.
     pub cleanup_dead_nodes_on_creation: bool,
     /// When true, the [`NodeBuilder`](crate::node::NodeBuilder) checks for dead nodes and
     /// cleans up all their stale resources whenever an existing [`Node`](crate::node::Node) is
@@ -369,6 +398,94 @@ pub struct RequestResonse {
     pub server_expired_connection_buffer: usize,
 }
 
+/// Named presets for the publish-subscribe settings. Every profile is defined in [`Profiles`]
+/// and can be applied to all services with [`Config::apply_profile()`] or to a single service
+/// with
+/// [`Builder::performance_profile()`](crate::service::builder::publish_subscribe::Builder::performance_profile()).
+#[derive(Serialize, Deserialize, Debug, Clone, Copy, Eq, Hash, PartialEq)]
+#[serde(rename_all = "kebab-case")]
+pub enum PerformanceProfile {
+    /// Small buffers that always contain the most recent sample, so that no
+    /// [`crate::port::publisher::Publisher`] ever waits for a
+    /// [`crate::port::subscriber::Subscriber`].
+    LowLatency,
+    /// Large buffers without overflow, so that bursts are absorbed and no
+    /// [`crate::sample::Sample`] is lost.
+    HighThroughput,
+    /// The smallest number of ports and samples, to minimize the size of the data segments and
+    /// connections.
+    LowMemory,
+}
+
+/// The publish-subscribe settings of every [`PerformanceProfile`]. Profiles that are missing
+/// in the config file are replaced with the built-in ones.
+#[non_exhaustive]
+#[derive(Serialize, Deserialize, Debug, Clone, Eq, PartialEq)]
+#[serde(rename_all = "kebab-case")]
+#[serde(default)]
+pub struct Profiles {
+    /// The settings of [`PerformanceProfile::LowLatency`]
+    pub low_latency: PublishSubscribe,
+    /// The settings of [`PerformanceProfile::HighThroughput`]
+    pub high_throughput: PublishSubscribe,
+    /// The settings of [`PerformanceProfile::LowMemory`]
+    pub low_memory: PublishSubscribe,
+}
+
+impl Default for Profiles {
+    fn default() -> Self {
+        Self {
+            low_latency: PublishSubscribe {
+                max_subscribers: 8,
+                max_publishers: 2,
+                max_nodes: 20,
+                publisher_history_size: 0,
+                subscriber_max_buffer_size: 1,
+                subscriber_max_borrowed_samples: 1,
+                publisher_max_loaned_samples: 1,
+                enable_safe_overflow: true,
+                unable_to_deliver_strategy: UnableToDeliverStrategy::DiscardSample,
+                subscriber_expired_connection_buffer: 128,
+            },
+            high_throughput: PublishSubscribe {
+                max_subscribers: 8,
+                max_publishers: 2,
+                max_nodes: 20,
+                publisher_history_size: 0,
+                subscriber_max_buffer_size: 64,
+                subscriber_max_borrowed_samples: 16,
+                publisher_max_loaned_samples: 16,
+                enable_safe_overflow: false,
+                unable_to_deliver_strategy: UnableToDeliverStrategy::Block,
+                subscriber_expired_connection_buffer: 128,
+            },
+            low_memory: PublishSubscribe {
+                max_subscribers: 2,
+                max_publishers: 1,
+                max_nodes: 4,
+                publisher_history_size: 0,
+                subscriber_max_buffer_size: 1,
+                subscriber_max_borrowed_samples: 1,
+                publisher_max_loaned_samples: 1,
+                enable_safe_overflow: true,
+                unable_to_deliver_strategy: UnableToDeliverStrategy::Block,
+                subscriber_expired_connection_buffer: 8,
+            },
+        }
+    }
+}
+
+impl Profiles {
+    /// Returns the publish-subscribe settings of the provided [`PerformanceProfile`].
+    pub fn get(&self, profile: PerformanceProfile) -> &PublishSubscribe {
+        match profile {
+            PerformanceProfile::LowLatency => &self.low_latency,
+            PerformanceProfile::HighThroughput => &self.high_throughput,
+            PerformanceProfile::LowMemory => &self.low_memory,
+        }
+    }
+}
+
 /// Represents the configuration that iceoryx2 will utilize. It is divided into two sections:
 /// the [Global] settings, which must align with the iceoryx2 instance the application intends to
 /// join, and the [Defaults] for communication within that iceoryx2 instance. The user has the
@@ -381,6 +498,10 @@ pub struct Config {
     pub global: Global,
     /// Default settings
     pub defaults: Defaults,
+    /// The settings of the [`PerformanceProfile`]s. When the section is missing in the config
+    /// file the built-in profiles are used.
+    #[serde(default)]
+    pub profiles: Profiles,
 }
 
 static ICEORYX2_CONFIG: LazySingleton<Config> = LazySingleton::<Config>::new();
@@ -451,6 +572,7 @@ impl Default for Config {
                     notifier_dead_event: None,
                 },
             },
+            profiles: Profiles::default(),
         }
     }
 }
@@ -564,6 +686,12 @@ impl Config {
         Ok(())
     }
 
+    /// Replaces the publish-subscribe [`Defaults`] with the settings of the provided
+    /// [`PerformanceProfile`].
+    pub fn apply_profile(&mut self, profile: PerformanceProfile) {
+        self.defaults.publish_subscribe = self.profiles.get(profile).clone();
+    }
+
     /// Loads a configuration from a file. On success it returns a [`Config`] object otherwise a
     /// [`ConfigCreationError`] describing the failure.
     pub fn from_file(config_file: &FilePath) -> Result<Config, ConfigCreationError> {
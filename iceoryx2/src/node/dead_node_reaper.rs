@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! The [`DeadNodeReaper`] removes the stale resources of dead [`Node`]s incrementally. Every
+//! [`DeadNodeReaper::reap()`] call probes at most
+//! [`DeadNodeReaper::nodes_per_cycle()`] [`Node`]s, so that the cost of a single call does not
+//! grow with the number of [`Node`]s in the system.
+//!
+//! When one process or one designated [`Node`], see
+//! [`NodeBuilder::dead_node_reaper()`](crate::node::NodeBuilder::dead_node_reaper()), takes
+//! care of the cleanup, all other processes can disable
+//! [`Config::global.node.cleanup_dead_nodes_on_creation`](crate::config::Node) and
+//! [`Config::global.node.cleanup_dead_nodes_on_destruction`](crate::config::Node). The
+//! creation of a [`Node`] does then no longer scan all [`Node`]s of the system.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use core::time::Duration;
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::node::dead_node_reaper::DeadNodeReaper;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! const CYCLE_TIME: Duration = Duration::from_millis(100);
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//!
+//! let mut reaper = DeadNodeReaper::<ipc::Service>::new(node.config()).nodes_per_cycle(8);
+//!
+//! while node.wait(CYCLE_TIME).is_ok() {
+//!     let cleanup_state = reaper.reap();
+//!     if cleanup_state.cleanups != 0 {
+//!         println!("removed {} dead nodes", cleanup_state.cleanups);
+//!     }
+//! }
+//! # Ok(())
+//! # }
+//! ```
+
+use core::marker::PhantomData;
+use core::time::Duration;
+
+extern crate alloc;
+use alloc::collections::VecDeque;
+use alloc::sync::Arc;
+
+use iceoryx2_bb_log::{debug, fail};
+use iceoryx2_bb_posix::thread::{Thread, ThreadBuilder, ThreadName, ThreadSpawnError};
+
+use std::sync::{Condvar, Mutex};
+
+use crate::config::Config;
+use crate::node::{CleanupState, Node, NodeId, NodeState};
+use crate::service;
+
+/// The default number of [`Node`]s that are probed with one [`DeadNodeReaper::reap()`] call.
+pub const DEFAULT_NODES_PER_CYCLE: usize = 16;
+
+/// Removes the stale resources of dead [`Node`]s in small batches. The [`NodeId`]s of all
+/// [`Node`]s are acquired once per pass and then probed [`DeadNodeReaper::nodes_per_cycle()`]
+/// at a time. A new pass starts when all [`NodeId`]s of the previous pass were probed.
+#[derive(Debug)]
+pub struct DeadNodeReaper<Service: service::Service> {
+    config: Config,
+    pending_nodes: VecDeque<NodeId>,
+    nodes_per_cycle: usize,
+    _service: PhantomData<Service>,
+}
+
+impl<Service: service::Service> DeadNodeReaper<Service> {
+    /// Creates a new [`DeadNodeReaper`] that removes the dead [`Node`]s of the provided
+    /// [`Config`].
+    pub fn new(config: &Config) -> Self {
+        Self {
+            config: config.clone(),
+            pending_nodes: VecDeque::new(),
+            nodes_per_cycle: DEFAULT_NODES_PER_CYCLE,
+            _service: PhantomData,
+        }
+    }
+
+    /// Defines how many [`Node`]s are probed at most with one [`DeadNodeReaper::reap()`] call.
+    /// A value of zero is treated as one.
+    pub fn nodes_per_cycle(mut self, value: usize) -> Self {
+        self.nodes_per_cycle = value.max(1);
+        self
+    }
+
+    /// Returns the number of [`Node`]s of the current pass that were not yet probed.
+    pub fn number_of_pending_nodes(&self) -> usize {
+        self.pending_nodes.len()
+    }
+
+    /// Probes the next [`DeadNodeReaper::nodes_per_cycle()`] [`Node`]s and removes the stale
+    /// resources of the dead ones. Returns the [`CleanupState`] of the probed [`Node`]s.
+    pub fn reap(&mut self) -> CleanupState {
+        let mut cleanup_state = CleanupState {
+            cleanups: 0,
+            failed_cleanups: 0,
+        };
+
+        if self.pending_nodes.is_empty() {
+            match Node::<Service>::list_node_ids(&self.config) {
+                Ok(node_ids) => self.pending_nodes.extend(node_ids),
+                Err(e) => {
+                    debug!(from self,
+                        "Unable to start the next pass since the node ids could not be listed ({:?}).", e);
+                    return cleanup_state;
+                }
+            }
+        }
+
+        for _ in 0..self.nodes_per_cycle {
+            let node_id = match self.pending_nodes.pop_front() {
+                Some(node_id) => node_id,
+                None => break,
+            };
+
+            match NodeState::<Service>::new(&node_id, &self.config) {
+                Ok(Some(node_state)) => {
+                    Node::<Service>::cleanup_node_state(node_state, &mut cleanup_state, &*self)
+                }
+                Ok(None) => (),
+                Err(e) => {
+                    debug!(from self,
+                        "Unable to acquire the state of the node {:?} ({:?}).", node_id, e);
+                }
+            }
+        }
+
+        cleanup_state
+    }
+}
+
+#[derive(Debug, Default)]
+struct StopRequest {
+    is_requested: Mutex<bool>,
+    wakeup: Condvar,
+}
+
+/// A thread that calls [`DeadNodeReaper::reap()`] every cycle. It is stopped and joined when
+/// it goes out of scope.
+#[derive(Debug)]
+pub(crate) struct DeadNodeReaperThread {
+    stop_request: Arc<StopRequest>,
+    _thread: Thread,
+}
+
+impl DeadNodeReaperThread {
+    pub(crate) fn spawn<Service: service::Service>(
+        config: &Config,
+        cycle_time: Duration,
+    ) -> Result<Self, ThreadSpawnError> {
+        let stop_request = Arc::new(StopRequest::default());
+        let thread_stop_request = stop_request.clone();
+        let config = config.clone();
+
+        let thread = fail!(from "DeadNodeReaperThread::spawn()",
+            when ThreadBuilder::new()
+                .name(&ThreadName::from(b"iox2-reaper"))
+                .spawn(move || {
+                    let mut reaper = DeadNodeReaper::<Service>::new(&config);
+                    loop {
+                        reaper.reap();
+
+                        let is_requested = thread_stop_request.is_requested.lock().unwrap();
+                        let (is_requested, _) = thread_stop_request
+                            .wakeup
+                            .wait_timeout_while(is_requested, cycle_time, |v| !*v)
+                            .unwrap();
+                        if *is_requested {
+                            break;
+                        }
+                    }
+                }),
+            "Unable to spawn the dead node reaper thread.");
+
+        Ok(Self {
+            stop_request,
+            _thread: thread,
+        })
+    }
+}
+
+impl Drop for DeadNodeReaperThread {
+    fn drop(&mut self) {
+        *self.stop_request.is_requested.lock().unwrap() = true;
+        self.stop_request.wakeup.notify_all();
+    }
+}
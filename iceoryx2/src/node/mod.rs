@@ -142,14 +142,19 @@
 /// The name for a node.
 pub mod node_name;
 
+/// Incremental cleanup of dead nodes.
+pub mod dead_node_reaper;
+
 #[doc(hidden)]
 pub mod testing;
 
+use crate::node::dead_node_reaper::DeadNodeReaperThread;
 use crate::node::node_name::NodeName;
 use crate::service::builder::{Builder, OpenDynamicStorageFailure};
 use crate::service::config_scheme::{
     node_details_path, node_monitoring_config, service_tag_config,
 };
+use crate::service::dynamic_config::NodeHandle;
 use crate::service::service_id::ServiceId;
 use crate::service::service_name::ServiceName;
 use crate::service::{
@@ -163,7 +168,6 @@ use core::sync::atomic::Ordering;
 use core::time::Duration;
 use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_elementary::CallbackProgression;
-use iceoryx2_bb_lock_free::mpmc::container::ContainerHandle;
 use iceoryx2_bb_log::{debug, fail, fatal_panic, trace, warn};
 use iceoryx2_bb_posix::clock::{nanosleep, NanosleepError, Time};
 use iceoryx2_bb_posix::process::{Process, ProcessId};
@@ -724,14 +728,14 @@ fn remove_node<Service: service::Service>(
 
 #[derive(Debug)]
 pub(crate) struct RegisteredServices {
-    data: Mutex<HashMap<ServiceId, (ContainerHandle, u64)>>,
+    data: Mutex<HashMap<ServiceId, (NodeHandle, u64)>>,
 }
 
 unsafe impl Send for RegisteredServices {}
 unsafe impl Sync for RegisteredServices {}
 
 impl RegisteredServices {
-    pub(crate) fn add(&self, service_id: &ServiceId, handle: ContainerHandle) {
+    pub(crate) fn add(&self, service_id: &ServiceId, handle: NodeHandle) {
         if self
             .data
             .lock()
@@ -744,7 +748,7 @@ impl RegisteredServices {
         }
     }
 
-    pub(crate) fn add_or<F: FnMut() -> Result<ContainerHandle, OpenDynamicStorageFailure>>(
+    pub(crate) fn add_or<F: FnMut() -> Result<NodeHandle, OpenDynamicStorageFailure>>(
         &self,
         service_id: &ServiceId,
         mut or_callback: F,
@@ -763,11 +767,7 @@ impl RegisteredServices {
         Ok(())
     }
 
-    pub(crate) fn remove<F: FnMut(ContainerHandle)>(
-        &self,
-        service_id: &ServiceId,
-        mut cleanup_call: F,
-    ) {
+    pub(crate) fn remove<F: FnMut(NodeHandle)>(&self, service_id: &ServiceId, mut cleanup_call: F) {
         let mut data = self.data.lock().unwrap();
         if let Some(entry) = data.get_mut(service_id) {
             entry.1 -= 1;
@@ -832,6 +832,7 @@ impl<Service: service::Service> Drop for SharedNode<Service> {
 #[derive(Debug)]
 pub struct Node<Service: service::Service> {
     shared: Arc<SharedNode<Service>>,
+    _dead_node_reaper: Option<DeadNodeReaperThread>,
 }
 
 unsafe impl<Service: service::Service> Send for Node<Service> {}
@@ -874,14 +875,10 @@ impl<Service: service::Service> Node<Service> {
     ) -> Result<(), NodeListFailure> {
         let msg = "Unable to iterate over Node list";
         let origin = "Node::list()";
-        let monitoring_config = node_monitoring_config::<Service>(config);
 
-        match Self::list_all_nodes(&monitoring_config) {
+        match Self::list_node_ids(config) {
             Ok(node_list) => {
-                for node_name in node_list {
-                    let node_id = core::str::from_utf8(node_name.as_bytes()).unwrap();
-                    let node_id = NodeId(node_id.parse::<u128>().unwrap().into());
-
+                for node_id in node_list {
                     match NodeState::new(&node_id, config) {
                         Ok(Some(node_state)) => {
                             if callback(node_state) == CallbackProgression::Stop {
@@ -965,21 +962,7 @@ impl<Service: service::Service> Node<Service> {
         );
 
         let cleanup_call = |node_state| {
-            if let NodeState::Dead(dead_node) = node_state {
-                let node_id = *dead_node.id();
-                debug!(from origin, "Dead node ({:?}) detected", node_id);
-                match dead_node.remove_stale_resources() {
-                    Ok(_) => {
-                        cleanup_state.cleanups += 1;
-                        trace!(from origin, "The dead node ({:?}) was successfully removed.", node_id)
-                    }
-                    Err(e) => {
-                        cleanup_state.failed_cleanups += 1;
-                        trace!(from origin, "Unable to remove dead node {:?} ({:?}).", node_id, e)
-                    }
-                }
-            }
-
+            Self::cleanup_node_state(node_state, &mut cleanup_state, &origin);
             CallbackProgression::Continue
         };
 
@@ -992,6 +975,38 @@ impl<Service: service::Service> Node<Service> {
         }
     }
 
+    pub(crate) fn cleanup_node_state<Origin: core::fmt::Debug>(
+        node_state: NodeState<Service>,
+        cleanup_state: &mut CleanupState,
+        origin: &Origin,
+    ) {
+        if let NodeState::Dead(dead_node) = node_state {
+            let node_id = *dead_node.id();
+            debug!(from origin, "Dead node ({:?}) detected", node_id);
+            match dead_node.remove_stale_resources() {
+                Ok(_) => {
+                    cleanup_state.cleanups += 1;
+                    trace!(from origin, "The dead node ({:?}) was successfully removed.", node_id)
+                }
+                Err(e) => {
+                    cleanup_state.failed_cleanups += 1;
+                    trace!(from origin, "Unable to remove dead node {:?} ({:?}).", node_id, e)
+                }
+            }
+        }
+    }
+
+    pub(crate) fn list_node_ids(config: &Config) -> Result<Vec<NodeId>, NodeListFailure> {
+        let monitoring_config = node_monitoring_config::<Service>(config);
+        Ok(Self::list_all_nodes(&monitoring_config)?
+            .iter()
+            .map(|node_name| {
+                let node_id = core::str::from_utf8(node_name.as_bytes()).unwrap();
+                NodeId(node_id.parse::<u128>().unwrap().into())
+            })
+            .collect())
+    }
+
     fn list_all_nodes(
         config: &<Service::Monitoring as NamedConceptMgmt>::Configuration,
     ) -> Result<Vec<FileName>, NodeListFailure> {
@@ -1198,6 +1213,7 @@ pub struct NodeBuilder {
     name: Option<NodeName>,
     signal_handling_mode: SignalHandlingMode,
     config: Option<Config>,
+    dead_node_reaper_cycle_time: Option<Duration>,
 }
 
 impl NodeBuilder {
@@ -1227,6 +1243,16 @@ impl NodeBuilder {
         self
     }
 
+    /// Spawns a background thread that is owned by the [`Node`] and removes the stale
+    /// resources of dead [`Node`]s incrementally every `cycle_time`, see
+    /// [`DeadNodeReaper`](crate::node::dead_node_reaper::DeadNodeReaper). It is meant for one
+    /// designated [`Node`] in the system so that all other processes can disable
+    /// [`Config::global.node.cleanup_dead_nodes_on_creation`](crate::config::Node).
+    pub fn dead_node_reaper(mut self, cycle_time: Duration) -> Self {
+        self.dead_node_reaper_cycle_time = Some(cycle_time);
+        self
+    }
+
     /// Creates a new [`Node`] for a specific [`service::Service`]. All entities owned by the
     /// [`Node`] will have the same [`service::Service`].
     pub fn create<Service: service::Service>(self) -> Result<Node<Service>, NodeCreationFailure> {
@@ -1259,17 +1285,28 @@ impl NodeBuilder {
             self.create_node_details_storage::<Service>(&config, &NodeId(node_id))?;
         let monitoring_token = self.create_token::<Service>(&config, &monitor_name)?;
 
+        let shared = Arc::new(SharedNode {
+            id: NodeId(node_id),
+            monitoring_token: UnsafeCell::new(Some(monitoring_token)),
+            registered_services: RegisteredServices {
+                data: Mutex::new(HashMap::new()),
+            },
+            _details_storage: details_storage,
+            signal_handling_mode: self.signal_handling_mode,
+            details,
+        });
+
+        let dead_node_reaper = match self.dead_node_reaper_cycle_time {
+            Some(cycle_time) => Some(fail!(from self,
+                when DeadNodeReaperThread::spawn::<Service>(&config, cycle_time),
+                with NodeCreationFailure::InternalError,
+                "{msg} since the dead node reaper thread could not be spawned.")),
+            None => None,
+        };
+
         Ok(Node {
-            shared: Arc::new(SharedNode {
-                id: NodeId(node_id),
-                monitoring_token: UnsafeCell::new(Some(monitoring_token)),
-                registered_services: RegisteredServices {
-                    data: Mutex::new(HashMap::new()),
-                },
-                _details_storage: details_storage,
-                signal_handling_mode: self.signal_handling_mode,
-                details,
-            }),
+            shared,
+            _dead_node_reaper: dead_node_reaper,
         })
     }
 
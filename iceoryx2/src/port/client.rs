@@ -269,6 +269,8 @@ impl<Service: service::Service> ClientSharedState<Service> {
                     ReceiverDetails {
                         port_id: port.server_id.value(),
                         buffer_size: port.request_buffer_size,
+                        group: None,
+                        downsampling: None,
                     },
                     |_| {},
                 );
@@ -362,13 +364,15 @@ impl<
                 global_config,
                 number_of_requests,
             ),
-            DataSegmentType::Dynamic => DataSegment::<Service>::create_dynamic_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_requests,
-                client_factory.config.allocation_strategy,
-            ),
+            DataSegmentType::Dynamic | DataSegmentType::External => {
+                DataSegment::<Service>::create_dynamic_segment(
+                    &segment_name,
+                    sample_layout,
+                    global_config,
+                    number_of_requests,
+                    client_factory.config.allocation_strategy,
+                )
+            }
         };
 
         let data_segment = fail!(from origin,
@@ -398,9 +402,11 @@ impl<
             },
             sender_port_id: client_id.value(),
             shared_node: service.__internal_state().shared_node.clone(),
-            connections: (0..server_list.capacity())
-                .map(|_| UnsafeCell::new(None))
-                .collect(),
+            connections: UnsafeCell::new(
+                (0..server_list.capacity())
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
             receiver_max_buffer_size: static_config.max_active_requests_per_client,
             receiver_max_borrowed_samples: static_config.max_active_requests_per_client,
             enable_safe_overflow: static_config.enable_safe_overflow_for_requests,
@@ -410,6 +416,8 @@ impl<
             service_state: service.__internal_state().clone(),
             tagger: CyclicTagger::new(),
             loan_counter: IoxAtomicUsize::new(0),
+            group_cursor: IoxAtomicUsize::new(0),
+            group_members: UnsafeCell::new(Vec::new()),
             sender_max_borrowed_samples: static_config.max_loaned_requests,
             unable_to_deliver_strategy: client_factory.config.unable_to_deliver_strategy,
             message_type_details: static_config.request_message_type_details.clone(),
@@ -422,7 +430,11 @@ impl<
         };
 
         let response_receiver = Receiver {
-            connections: Vec::from_fn(server_list.capacity(), |_| UnsafeCell::new(None)),
+            connections: UnsafeCell::new(
+                (0..server_list.capacity())
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
             receiver_port_id: client_id.value(),
             service_state: service.__internal_state().clone(),
             buffer_size: static_config.max_response_buffer_size,
@@ -442,6 +454,8 @@ impl<
                 .max_borrowed_responses_per_pending_response,
             enable_safe_overflow: static_config.enable_safe_overflow_for_responses,
             number_of_channels: number_of_requests,
+            broadcast: None,
+            missed_samples: IoxAtomicU64::new(0),
         };
 
         let new_self = Self {
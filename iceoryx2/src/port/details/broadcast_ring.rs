@@ -0,0 +1,272 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::{alloc::Layout, fmt::Debug, ptr::NonNull, sync::atomic::Ordering};
+
+use iceoryx2_bb_lock_free::spmc::broadcast_ring::{
+    BroadcastRingPinError, PinnedElement, ReaderHandle, RelocatableBroadcastRing,
+};
+use iceoryx2_bb_log::{debug, fail};
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_cal::{
+    named_concept::{NamedConceptBuilder, NamedConceptMgmt},
+    shared_memory::{
+        SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError, SharedMemoryOpenError,
+    },
+    shm_allocator::{self, pool_allocator::PoolAllocator},
+};
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicU64, IoxAtomicUsize};
+
+use crate::{
+    config,
+    service::{
+        self,
+        config_scheme::data_segment_config,
+        naming_scheme::{broadcast_ring_name, data_segment_name},
+    },
+};
+
+/// The shared memory that contains the [`RelocatableBroadcastRing`] of a publisher. The ring is
+/// the one and only bucket of the underlying pool allocator and therefore always located at
+/// the payload start address.
+#[derive(Debug)]
+pub(crate) struct BroadcastRingSegment<Service: service::Service> {
+    memory: Service::SharedMemory,
+}
+
+impl<Service: service::Service> BroadcastRingSegment<Service> {
+    fn layout(capacity: usize, number_of_keys: usize, number_of_readers: usize) -> Layout {
+        unsafe {
+            Layout::from_size_align_unchecked(
+                core::mem::size_of::<RelocatableBroadcastRing>()
+                    + RelocatableBroadcastRing::const_memory_size(
+                        capacity,
+                        number_of_keys,
+                        number_of_readers,
+                    ),
+                core::mem::align_of::<RelocatableBroadcastRing>(),
+            )
+        }
+    }
+
+    pub(crate) fn create(
+        segment_name: &FileName,
+        capacity: usize,
+        number_of_keys: usize,
+        number_of_readers: usize,
+        global_config: &config::Config,
+    ) -> Result<Self, SharedMemoryCreateError> {
+        let msg = "Unable to create the broadcast ring";
+        let origin = "BroadcastRingSegment::create()";
+        let layout = Self::layout(capacity, number_of_keys, number_of_readers);
+        let allocator_config = shm_allocator::pool_allocator::Config {
+            bucket_layout: layout,
+        };
+
+        let memory = fail!(from origin,
+                            when <<Service::SharedMemory as SharedMemory<PoolAllocator>>::Builder as NamedConceptBuilder<
+                            Service::SharedMemory,
+                                >>::new(segment_name)
+                                .config(&data_segment_config::<Service>(global_config))
+                                .size(layout.size() + layout.align() - 1)
+                                .create(&allocator_config),
+                            "{msg} since the underlying shared memory could not be created.");
+
+        let chunk = fail!(from origin, when memory.allocate(layout),
+                            with SharedMemoryCreateError::InternalError,
+                            "{msg} since the memory for the ring could not be allocated.");
+        debug_assert!(chunk.offset.offset() == 0);
+
+        let ring = chunk.data_ptr as *mut RelocatableBroadcastRing;
+        unsafe {
+            ring.write(RelocatableBroadcastRing::new_uninit(
+                capacity,
+                number_of_keys,
+                number_of_readers,
+            ))
+        };
+
+        let allocator = BumpAllocator::new(
+            unsafe {
+                NonNull::new_unchecked(
+                    chunk
+                        .data_ptr
+                        .add(core::mem::size_of::<RelocatableBroadcastRing>()),
+                )
+            },
+            RelocatableBroadcastRing::const_memory_size(
+                capacity,
+                number_of_keys,
+                number_of_readers,
+            ),
+        );
+
+        fail!(from origin, when unsafe { (*ring).init(&allocator) },
+                with SharedMemoryCreateError::InternalError,
+                "{msg} since the ring could not be initialized.");
+
+        Ok(Self { memory })
+    }
+
+    pub(crate) fn open(
+        segment_name: &FileName,
+        global_config: &config::Config,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let origin = "BroadcastRingSegment::open()";
+        let memory = fail!(from origin,
+                            when <Service::SharedMemory as SharedMemory<PoolAllocator>>::
+                                Builder::new(segment_name)
+                                .config(&data_segment_config::<Service>(global_config))
+                                .timeout(global_config.global.service.creation_timeout)
+                                .open(),
+                            "Unable to open the broadcast ring since the underlying shared memory could not be opened.");
+
+        Ok(Self { memory })
+    }
+
+    pub(crate) fn ring(&self) -> &RelocatableBroadcastRing {
+        unsafe { &*(self.memory.payload_start_address() as *const RelocatableBroadcastRing) }
+    }
+
+    pub(crate) fn size(&self) -> usize {
+        self.memory.size()
+    }
+}
+
+/// The receiving side of a [`BroadcastRingSegment`]. Every receiver reads the ring with its own
+/// cursor and pins the elements it has borrowed so that the sender does not reuse them. The pins
+/// are recorded under the port id of the receiver, so that they can be released with
+/// [`remove_receiver_from_broadcast_ring()`] when the receiver dies.
+#[derive(Debug)]
+pub(crate) struct BroadcastRingReader<Service: service::Service> {
+    segment: BroadcastRingSegment<Service>,
+    reader: ReaderHandle,
+    cursor: IoxAtomicU64,
+    borrow_count: IoxAtomicUsize,
+}
+
+impl<Service: service::Service> Drop for BroadcastRingReader<Service> {
+    fn drop(&mut self) {
+        self.segment.ring().unregister_reader(self.reader);
+    }
+}
+
+impl<Service: service::Service> BroadcastRingReader<Service> {
+    /// Opens the ring, registers the receiver as reader and starts reading with the last
+    /// `history_size` elements that are still stored in the ring.
+    pub(crate) fn open(
+        segment_name: &FileName,
+        receiver_port_id: u128,
+        global_config: &config::Config,
+        history_size: usize,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let origin = "BroadcastRingReader::open()";
+        let segment = BroadcastRingSegment::open(segment_name, global_config)?;
+        let ring = segment.ring();
+        let reader = match ring.register_reader(receiver_port_id) {
+            Some(reader) => reader,
+            None => {
+                fail!(from origin, with SharedMemoryOpenError::InternalError,
+                    "Unable to open the broadcast ring since it already has the maximum number of {} readers.",
+                    ring.number_of_readers());
+            }
+        };
+        let cursor = ring
+            .next_sequence_number()
+            .saturating_sub(history_size as u64)
+            .max(ring.oldest_sequence_number());
+
+        Ok(Self {
+            segment,
+            reader,
+            cursor: IoxAtomicU64::new(cursor),
+            borrow_count: IoxAtomicUsize::new(0),
+        })
+    }
+
+    /// Returns true when the ring contains elements that were not yet received.
+    pub(crate) fn has_data(&self) -> bool {
+        self.cursor.load(Ordering::Relaxed) < self.segment.ring().next_sequence_number()
+    }
+
+    pub(crate) fn borrow_count(&self) -> usize {
+        self.borrow_count.load(Ordering::Relaxed)
+    }
+
+    /// Pins the next element. Returns the element and the number of elements that were
+    /// overwritten by the sender before they could be received.
+    pub(crate) fn receive(&self) -> (Option<PinnedElement>, u64) {
+        let ring = self.segment.ring();
+        let mut cursor = self.cursor.load(Ordering::Relaxed);
+        let mut missed_elements = 0;
+
+        loop {
+            match ring.pin(self.reader, cursor) {
+                Ok(Some(element)) => {
+                    self.cursor.store(cursor + 1, Ordering::Relaxed);
+                    self.borrow_count.fetch_add(1, Ordering::Relaxed);
+                    return (Some(element), missed_elements);
+                }
+                Ok(None) => {
+                    self.cursor.store(cursor, Ordering::Relaxed);
+                    return (None, missed_elements);
+                }
+                Err(BroadcastRingPinError::Lapped(oldest)) => {
+                    missed_elements += oldest - cursor;
+                    cursor = oldest;
+                }
+            }
+        }
+    }
+
+    /// Releases an element that was acquired with [`BroadcastRingReader::receive()`].
+    pub(crate) fn release(&self, key: u64) {
+        self.segment.ring().unpin(self.reader, key);
+        self.borrow_count.fetch_sub(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn size(&self) -> usize {
+        self.segment.size()
+    }
+}
+
+/// Releases every sample the dead receiver has pinned in the broadcast ring of the sender. When
+/// the sender does not deliver via a broadcast ring nothing happens.
+///
+/// # Safety
+///
+///  * The receiver must no longer exist.
+pub(crate) unsafe fn remove_receiver_from_broadcast_ring<Service: service::Service>(
+    sender_port_id: u128,
+    receiver_port_id: u128,
+    global_config: &config::Config,
+) -> Result<(), SharedMemoryOpenError> {
+    let origin = "remove_receiver_from_broadcast_ring()";
+    let segment_name = broadcast_ring_name(&data_segment_name(sender_port_id));
+    let does_exist = <Service::SharedMemory as NamedConceptMgmt>::does_exist_cfg(
+        &segment_name,
+        &data_segment_config::<Service>(global_config),
+    );
+
+    if !matches!(does_exist, Ok(true)) {
+        return Ok(());
+    }
+
+    let segment = BroadcastRingSegment::<Service>::open(&segment_name, global_config)?;
+    let number_of_removed_readers = segment.ring().remove_reader(receiver_port_id);
+    debug!(from origin,
+        "Released the pins of {} reader(s) of the receiver ({:?}) in the broadcast ring of the sender ({:?}).",
+        number_of_removed_readers, receiver_port_id, sender_port_id);
+
+    Ok(())
+}
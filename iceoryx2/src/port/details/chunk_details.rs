@@ -13,11 +13,42 @@
 extern crate alloc;
 
 use alloc::sync::Arc;
+use iceoryx2_bb_log::error;
 use iceoryx2_cal::shm_allocator::PointerOffset;
+use iceoryx2_cal::zero_copy_connection::{ChannelId, ZeroCopyReceiver, ZeroCopyReleaseError};
 
 #[derive(Debug)]
 pub(crate) struct ChunkDetails<Service: crate::service::Service> {
     pub(crate) connection: Arc<super::receiver::Connection<Service>>,
     pub(crate) offset: PointerOffset,
     pub(crate) origin: u128,
+    pub(crate) channel_id: ChannelId,
+    /// The key of the pinned broadcast ring element when the chunk was received from a
+    /// broadcast ring, otherwise [`None`].
+    pub(crate) broadcast_key: Option<u64>,
+}
+
+impl<Service: crate::service::Service> ChunkDetails<Service> {
+    /// Returns the chunk to the sender so that it can be reused.
+    pub(crate) fn release(&self) {
+        unsafe { self.connection.data_segment.unregister_offset(self.offset) };
+
+        if let Some(key) = self.broadcast_key {
+            if let Some(broadcast_ring) = &self.connection.broadcast_ring {
+                broadcast_ring.release(key);
+            }
+            return;
+        }
+
+        match self
+            .connection
+            .receiver
+            .release(self.offset, self.channel_id)
+        {
+            Ok(()) => (),
+            Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
+                error!(from self, "This should never happen! The publishers retrieve channel is full and the sample cannot be returned.");
+            }
+        }
+    }
 }
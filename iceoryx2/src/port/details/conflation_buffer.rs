@@ -0,0 +1,118 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::cell::UnsafeCell;
+use core::fmt::Debug;
+use std::collections::{HashMap, VecDeque};
+
+extern crate alloc;
+use alloc::boxed::Box;
+
+use super::chunk::Chunk;
+use super::chunk_details::ChunkDetails;
+
+/// Extracts the conflation key from a pointer to the user header of a received chunk.
+pub(crate) type ConflationKeyFn = Box<dyn Fn(*const u8) -> u64 + Send + Sync>;
+
+pub(crate) struct ConflationConfig {
+    pub(crate) capacity: usize,
+    pub(crate) key_of: ConflationKeyFn,
+    /// The number of user header bytes `key_of` reads. It is verified against the user header
+    /// of the service when the subscriber is created.
+    pub(crate) required_user_header_size: usize,
+}
+
+impl Debug for ConflationConfig {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "ConflationConfig {{ capacity: {}, required_user_header_size: {} }}",
+            self.capacity, self.required_user_header_size
+        )
+    }
+}
+
+/// Stores the newest received chunk of every key. A chunk that is superseded by a newer chunk
+/// with the same key is released immediately, the key keeps its position in the receive order.
+/// When the buffer is full the chunk of the oldest key is released to make room for a new key.
+pub(crate) struct ConflationBuffer<Service: crate::service::Service> {
+    config: ConflationConfig,
+    order: UnsafeCell<VecDeque<u64>>,
+    entries: UnsafeCell<HashMap<u64, (ChunkDetails<Service>, Chunk)>>,
+}
+
+// the chunks point into the data segments that are kept alive by the connections of the stored
+// chunk details and can therefore be moved together with them
+unsafe impl<Service: crate::service::Service> Send for ConflationBuffer<Service> {}
+
+impl<Service: crate::service::Service> Debug for ConflationBuffer<Service> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "ConflationBuffer<{}> {{ config: {:?}, len: {} }}",
+            core::any::type_name::<Service>(),
+            self.config,
+            self.len()
+        )
+    }
+}
+
+impl<Service: crate::service::Service> Drop for ConflationBuffer<Service> {
+    fn drop(&mut self) {
+        for (details, _) in self.entries.get_mut().values() {
+            details.release();
+        }
+    }
+}
+
+impl<Service: crate::service::Service> ConflationBuffer<Service> {
+    pub(crate) fn new(config: ConflationConfig) -> Self {
+        let capacity = config.capacity.max(1);
+        Self {
+            config: ConflationConfig { capacity, ..config },
+            order: UnsafeCell::new(VecDeque::with_capacity(capacity)),
+            entries: UnsafeCell::new(HashMap::with_capacity(capacity)),
+        }
+    }
+
+    pub(crate) fn len(&self) -> usize {
+        unsafe { &*self.entries.get() }.len()
+    }
+
+    pub(crate) fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    pub(crate) fn push(&self, details: ChunkDetails<Service>, chunk: Chunk) {
+        let order = unsafe { &mut *self.order.get() };
+        let entries = unsafe { &mut *self.entries.get() };
+        let key = (self.config.key_of)(chunk.user_header);
+
+        if let Some((superseded, _)) = entries.insert(key, (details, chunk)) {
+            superseded.release();
+            return;
+        }
+
+        if order.len() == self.config.capacity {
+            if let Some((oldest, _)) = order.pop_front().and_then(|k| entries.remove(&k)) {
+                oldest.release();
+            }
+        }
+        order.push_back(key);
+    }
+
+    pub(crate) fn pop(&self) -> Option<(ChunkDetails<Service>, Chunk)> {
+        let order = unsafe { &mut *self.order.get() };
+        let entries = unsafe { &mut *self.entries.get() };
+        order.pop_front().and_then(|key| entries.remove(&key))
+    }
+}
@@ -10,12 +10,29 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use core::alloc::Layout;
+use core::{
+    alloc::Layout,
+    cell::{OnceCell, RefCell},
+};
+
+extern crate alloc;
+use alloc::vec::Vec;
 
-use iceoryx2_bb_log::fail;
+use iceoryx2_bb_log::{debug, fail, warn};
+use iceoryx2_bb_posix::{
+    creation_mode::CreationMode,
+    file_descriptor::{FileDescriptor, FileDescriptorBased},
+    memory_fd::{AccessMode, MemoryFd},
+    socket_ancillary::SocketAncillary,
+    socket_pair::StreamingSocket,
+    unix_datagram_socket::{
+        UnixDatagramReceiver, UnixDatagramReceiverBuilder, UnixDatagramSenderBuilder,
+    },
+};
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_cal::{
     event::NamedConceptBuilder,
+    named_concept::NamedConceptMgmt,
     resizable_shared_memory::*,
     shared_memory::{
         SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError, SharedMemoryForPoolAllocator,
@@ -31,10 +48,17 @@ use crate::{
     config,
     service::{
         self,
-        config_scheme::{data_segment_config, resizable_data_segment_config},
+        config_scheme::{
+            data_segment_config, external_data_segment_request_path, resizable_data_segment_config,
+        },
+        naming_scheme::overflow_data_segment_name,
     },
 };
 
+/// The [`SegmentId`] of the overflow segment of a static data segment, see
+/// [`DataSegment::with_overflow_segment()`].
+pub(crate) const OVERFLOW_SEGMENT_ID: SegmentId = SegmentId::new(1);
+
 /// Defines the data segment type of a zero copy capable sender port.
 #[repr(C)]
 #[derive(Debug, Clone, Copy, Eq, PartialEq)]
@@ -43,6 +67,10 @@ pub enum DataSegmentType {
     Dynamic,
     /// The data segment is allocated once. If it is out-of-memory no reallocation will occur.
     Static,
+    /// The data segment is a memory region that was provided as [`FileDescriptor`], see
+    /// [`PortFactoryPublisher::external_data_segment()`](crate::service::port_factory::publisher::PortFactoryPublisher::external_data_segment()).
+    /// The receivers acquire the [`FileDescriptor`] from the sender and map it.
+    External,
 }
 
 impl DataSegmentType {
@@ -58,11 +86,225 @@ impl DataSegmentType {
 enum MemoryType<Service: service::Service> {
     Static(Service::SharedMemory),
     Dynamic(Service::ResizableSharedMemory),
+    External(ExternalSegment),
+}
+
+/// Memory region that was allocated outside of iceoryx2, like a memfd of a driver,
+/// and is divided into chunks of the sample layout. Since the region has no name, every receiver
+/// writes its port id into one end of a socket pair, sends it to the request socket of the segment
+/// and the sender replies with a read-only [`FileDescriptor`] of the region, see
+/// [`DataSegment::serve_external_segment_requests()`].
+#[derive(Debug)]
+struct ExternalSegment {
+    memory: MemoryFd,
+    read_only_file_descriptor: FileDescriptor,
+    request_receiver: UnixDatagramReceiver,
+    chunk_size: usize,
+    free_chunks: RefCell<Vec<PointerOffset>>,
+    pending_requests: RefCell<Vec<ExternalSegmentRequest>>,
+    served_receivers: RefCell<Vec<u128>>,
+}
+
+/// Request of a receiver for the [`FileDescriptor`] of an [`ExternalSegment`]. The receiver
+/// writes its port id into the socket before it sends the socket to the request socket.
+#[derive(Debug)]
+struct ExternalSegmentRequest {
+    receiver_port_id: u128,
+    reply_socket: StreamingSocket,
+}
+
+impl ExternalSegment {
+    fn allocate(&self, layout: Layout) -> Result<ShmPointer, ShmAllocationError> {
+        if self.chunk_size < layout.size() {
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::SizeTooLarge),
+                "Unable to allocate memory from the external data segment since the requested {:?} exceeds the chunk size of {} bytes.",
+                layout, self.chunk_size);
+        }
+
+        match self.free_chunks.borrow_mut().pop() {
+            Some(offset) => Ok(ShmPointer {
+                offset,
+                data_ptr: unsafe { self.memory.base_address().as_ptr().add(offset.offset()) },
+            }),
+            None => {
+                fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                    "Unable to allocate memory from the external data segment since all chunks are in use.");
+            }
+        }
+    }
+
+    /// Receives all new requests and tries to reply to every request that is still pending.
+    /// Returns true when the reply to the request of `receiver_port_id` was delivered, either
+    /// now or in an earlier call. Replies that cannot be delivered yet are retried with the next
+    /// call.
+    fn serve_requests(&self, receiver_port_id: u128) -> bool {
+        self.receive_requests();
+
+        let mut pending_requests = self.pending_requests.borrow_mut();
+        let mut served_receivers = self.served_receivers.borrow_mut();
+        pending_requests.retain(|request| {
+            let mut reply = SocketAncillary::new();
+            reply.add_fd(self.read_only_file_descriptor.clone());
+            match request.reply_socket.try_send_msg(&mut reply) {
+                Ok(true) => {
+                    served_receivers.push(request.receiver_port_id);
+                    false
+                }
+                Ok(false) => {
+                    debug!(from self,
+                        "Unable to deliver the external data segment to the receiver {:?} since the reply socket is full, retrying later.",
+                        request.receiver_port_id);
+                    true
+                }
+                Err(e) => {
+                    warn!(from self,
+                        "Unable to deliver the external data segment to the receiver {:?} ({:?}).",
+                        request.receiver_port_id, e);
+                    false
+                }
+            }
+        });
+
+        match served_receivers
+            .iter()
+            .position(|id| *id == receiver_port_id)
+        {
+            Some(n) => {
+                served_receivers.swap_remove(n);
+                true
+            }
+            None => false,
+        }
+    }
+
+    /// Forgets the served receivers that are no longer connected. Their reply was delivered but
+    /// the sender never asked for it, like when the receiver was removed right after its request.
+    fn retain_served_receivers<F: Fn(u128) -> bool>(&self, is_connected: F) {
+        self.served_receivers
+            .borrow_mut()
+            .retain(|receiver_port_id| is_connected(*receiver_port_id));
+    }
+
+    fn receive_requests(&self) {
+        loop {
+            let mut request = SocketAncillary::new();
+            match self.request_receiver.try_receive_msg(&mut request) {
+                Ok(true) => (),
+                Ok(false) => return,
+                Err(e) => {
+                    warn!(from self, "Unable to receive external data segment requests ({:?}).", e);
+                    return;
+                }
+            }
+
+            for fd in request.extract_fds() {
+                let reply_socket = StreamingSocket::from_file_descriptor(fd);
+                let mut receiver_port_id = [0u8; core::mem::size_of::<u128>()];
+                match reply_socket.try_receive(&mut receiver_port_id) {
+                    Ok(n) if n == receiver_port_id.len() => self
+                        .pending_requests
+                        .borrow_mut()
+                        .push(ExternalSegmentRequest {
+                            receiver_port_id: u128::from_ne_bytes(receiver_port_id),
+                            reply_socket,
+                        }),
+                    Ok(n) => {
+                        warn!(from self,
+                            "Discarding external data segment request since it contains a receiver port id of {} bytes.", n)
+                    }
+                    Err(e) => {
+                        warn!(from self,
+                            "Discarding external data segment request since the receiver port id could not be received ({:?}).", e)
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Secondary segment of a static data segment that serves the rare allocations that are larger
+/// than the chunks of the static segment. It is created with the first oversized allocation so
+/// that no shared memory is acquired when it is never used.
+#[derive(Debug)]
+struct OverflowSegment<Service: service::Service> {
+    segment_name: FileName,
+    segment_config: <Service::SharedMemory as NamedConceptMgmt>::Configuration,
+    chunk_layout: Layout,
+    number_of_chunks: usize,
+    memory: OnceCell<Service::SharedMemory>,
+}
+
+impl<Service: service::Service> OverflowSegment<Service> {
+    fn memory(&self) -> Result<&Service::SharedMemory, SharedMemoryCreateError> {
+        if let Some(memory) = self.memory.get() {
+            return Ok(memory);
+        }
+
+        let allocator_config = shm_allocator::pool_allocator::Config {
+            bucket_layout: self.chunk_layout,
+        };
+
+        let memory = fail!(from self,
+                        when <<Service::SharedMemory as SharedMemory<PoolAllocator>>::Builder as NamedConceptBuilder<
+                        Service::SharedMemory,
+                            >>::new(&self.segment_name)
+                            .config(&self.segment_config)
+                            .size(self.chunk_layout.size() * self.number_of_chunks + self.chunk_layout.align() - 1)
+                            .create(&allocator_config),
+                        "Unable to create the overflow data segment since the underlying shared memory could not be created.");
+
+        Ok(self.memory.get_or_init(|| memory))
+    }
+
+    fn allocate(&self, layout: Layout) -> Result<ShmPointer, ShmAllocationError> {
+        let msg = "Unable to allocate memory from the overflow data segment";
+        let memory = fail!(from self, when self.memory(),
+                with ShmAllocationError::AllocationError(AllocationError::InternalError),
+                "{msg} since the overflow data segment could not be created.");
+
+        let mut ptr = fail!(from self, when memory.allocate(layout), "{msg}.");
+        ptr.offset.set_segment_id(OVERFLOW_SEGMENT_ID);
+        Ok(ptr)
+    }
+}
+
+/// Keeps the most recently released chunks of a static data segment local to the sender so
+/// that the next allocation reuses the chunk whose cache lines are most likely still hot,
+/// without a round trip through the lock-free index set of the shared pool allocator.
+#[derive(Debug)]
+struct ChunkCache {
+    offsets: RefCell<Vec<PointerOffset>>,
+    capacity: usize,
+}
+
+impl ChunkCache {
+    fn new(capacity: usize) -> Self {
+        Self {
+            offsets: RefCell::new(Vec::with_capacity(capacity)),
+            capacity,
+        }
+    }
+
+    fn pop(&self) -> Option<PointerOffset> {
+        self.offsets.borrow_mut().pop()
+    }
+
+    fn push(&self, offset: PointerOffset) -> bool {
+        let mut offsets = self.offsets.borrow_mut();
+        if offsets.len() == self.capacity {
+            return false;
+        }
+
+        offsets.push(offset);
+        true
+    }
 }
 
 #[derive(Debug)]
 pub(crate) struct DataSegment<Service: service::Service> {
     memory: MemoryType<Service>,
+    overflow: Option<OverflowSegment<Service>>,
+    chunk_cache: Option<ChunkCache>,
 }
 
 impl<Service: service::Service> DataSegment<Service> {
@@ -90,6 +332,134 @@ impl<Service: service::Service> DataSegment<Service> {
 
         Ok(Self {
             memory: MemoryType::Static(memory),
+            overflow: None,
+            chunk_cache: None,
+        })
+    }
+
+    /// Opens the static data segment of a dead sender so that its successor can take it over,
+    /// see [`crate::service::port_factory::publisher::PortFactoryPublisher::warm_restart_key()`].
+    /// The successor becomes the owner of the underlying shared memory.
+    pub(crate) fn adopt_static_segment(
+        segment_name: &FileName,
+        chunk_layout: Layout,
+        global_config: &config::Config,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let msg = "Unable to adopt the static data segment";
+        let origin = "DataSegment::adopt_static_segment()";
+
+        let segment_config = data_segment_config::<Service>(global_config);
+        let memory = fail!(from origin,
+                            when <Service::SharedMemory as SharedMemory<PoolAllocator>>::
+                                Builder::new(segment_name)
+                                .config(&segment_config)
+                                .open(),
+                            "{msg} since the underlying shared memory could not be opened.");
+
+        if memory.bucket_size() < chunk_layout.size() {
+            fail!(from origin, with SharedMemoryOpenError::SizeDoesNotFit,
+                "{msg} since its chunks of {} bytes are smaller than the required {} bytes.",
+                memory.bucket_size(), chunk_layout.size());
+        }
+
+        memory.acquire_ownership();
+
+        Ok(Self {
+            memory: MemoryType::Static(memory),
+            overflow: None,
+            chunk_cache: None,
+        })
+    }
+
+    /// Releases all chunks of an adopted static data segment that are allocated but for which
+    /// `is_referenced` returns false, like the chunks the dead predecessor had loaned or kept in
+    /// its history. Must be called before the first allocation.
+    pub(crate) unsafe fn release_unreferenced_chunks<F: Fn(PointerOffset) -> bool>(
+        &self,
+        number_of_chunks: usize,
+        is_referenced: F,
+    ) -> usize {
+        let memory = match &self.memory {
+            MemoryType::Static(memory) => memory,
+            MemoryType::Dynamic(_) | MemoryType::External(_) => return 0,
+        };
+
+        // every chunk that can still be allocated is free, the remaining ones are in use
+        let bucket_size = memory.bucket_size();
+        let layout = Layout::from_size_align_unchecked(bucket_size, 1);
+        let mut is_free = vec![false; number_of_chunks];
+        let mut free_chunks = Vec::with_capacity(number_of_chunks);
+        while let Ok(ptr) = memory.allocate(layout) {
+            if let Some(entry) = is_free.get_mut(ptr.offset.offset() / bucket_size) {
+                *entry = true;
+            }
+            free_chunks.push(ptr.offset);
+        }
+
+        let mut number_of_released_chunks = 0;
+        for (index, _) in is_free.iter().enumerate().filter(|(_, is_free)| !**is_free) {
+            let offset = PointerOffset::new(index * bucket_size);
+            if !is_referenced(offset) {
+                memory.deallocate_bucket(offset);
+                number_of_released_chunks += 1;
+            }
+        }
+
+        for offset in free_chunks {
+            memory.deallocate_bucket(offset);
+        }
+
+        number_of_released_chunks
+    }
+
+    /// Adds an overflow segment with `number_of_chunks` chunks of `chunk_layout` to a static
+    /// data segment. All allocations that do not fit into the chunks of the static segment are
+    /// served from it. The underlying shared memory is created on the first oversized
+    /// allocation and the receivers map it lazily when they receive the first sample from it.
+    pub(crate) fn with_overflow_segment(
+        mut self,
+        segment_name: &FileName,
+        chunk_layout: Layout,
+        global_config: &config::Config,
+        number_of_chunks: usize,
+    ) -> Self {
+        if let MemoryType::Static(_) = &self.memory {
+            self.overflow = Some(OverflowSegment {
+                segment_name: segment_name.clone(),
+                segment_config: data_segment_config::<Service>(global_config),
+                chunk_layout,
+                number_of_chunks,
+                memory: OnceCell::new(),
+            });
+        }
+
+        self
+    }
+
+    /// Keeps up to `capacity` released chunks of a static data segment in a sender local LIFO
+    /// cache. They are handed out again before the shared pool is touched, so that a steady
+    /// state ping-pong keeps reusing the same cache lines. Chunks of dynamic data segments are
+    /// never cached since they would prevent outdated segments from being released.
+    pub(crate) fn with_chunk_cache(mut self, capacity: usize) -> Self {
+        if let MemoryType::Static(_) = &self.memory {
+            if capacity != 0 {
+                self.chunk_cache = Some(ChunkCache::new(capacity));
+            }
+        }
+
+        self
+    }
+
+    fn cached_chunk(&self, memory: &Service::SharedMemory, layout: Layout) -> Option<ShmPointer> {
+        let cache = self.chunk_cache.as_ref()?;
+        if memory.bucket_size() < layout.size() {
+            return None;
+        }
+
+        let offset = cache.pop()?;
+        Some(ShmPointer {
+            offset,
+            data_ptr: (offset.offset() + memory.payload_start_address()) as *mut u8,
         })
     }
 
@@ -120,14 +490,115 @@ impl<Service: service::Service> DataSegment<Service> {
 
         Ok(Self {
             memory: MemoryType::Dynamic(memory),
+            overflow: None,
+            chunk_cache: None,
         })
     }
 
+    /// Maps the memory region of `file_descriptor` and divides it into `number_of_chunks` chunks
+    /// of `chunk_layout`. Fails when the region is too small. The receivers acquire the
+    /// [`FileDescriptor`] via a request socket that is derived from `segment_name`.
+    pub(crate) fn create_external_segment(
+        segment_name: &FileName,
+        file_descriptor: FileDescriptor,
+        chunk_layout: Layout,
+        global_config: &config::Config,
+        number_of_chunks: usize,
+    ) -> Result<Self, SharedMemoryCreateError> {
+        let msg = "Unable to create the external data segment";
+        let origin = "DataSegment::create_external_segment()";
+
+        let memory = fail!(from origin,
+                when MemoryFd::from_file_descriptor(file_descriptor, AccessMode::ReadWrite),
+                with SharedMemoryCreateError::InternalError,
+                "{msg} since the memory region could not be mapped.");
+
+        // the receivers shall not be able to modify the samples, therefore they get a
+        // file descriptor that was opened read-only instead of the one of the sender
+        let read_only_file_descriptor = fail!(from origin,
+                when memory.read_only_file_descriptor(),
+                with SharedMemoryCreateError::InternalError,
+                "{msg} since a read-only file descriptor of the memory region could not be acquired.");
+
+        let chunk_size = chunk_layout.pad_to_align().size();
+        if memory.size() < chunk_size * number_of_chunks {
+            fail!(from origin, with SharedMemoryCreateError::InternalError,
+                "{msg} since the memory region of {} bytes cannot hold {} chunks of {} bytes.",
+                memory.size(), number_of_chunks, chunk_size);
+        }
+
+        let request_receiver = fail!(from origin,
+                when UnixDatagramReceiverBuilder::new(
+                    &external_data_segment_request_path::<Service>(global_config, segment_name))
+                    .creation_mode(CreationMode::PurgeAndCreate)
+                    .create(),
+                with SharedMemoryCreateError::InternalError,
+                "{msg} since the request socket could not be created.");
+
+        // reversed so that the chunks are loaned in ascending order
+        let free_chunks = (0..number_of_chunks)
+            .rev()
+            .map(|n| PointerOffset::new(n * chunk_size))
+            .collect();
+
+        Ok(Self {
+            memory: MemoryType::External(ExternalSegment {
+                memory,
+                read_only_file_descriptor,
+                request_receiver,
+                chunk_size,
+                free_chunks: RefCell::new(free_chunks),
+                pending_requests: RefCell::new(Vec::new()),
+                served_receivers: RefCell::new(Vec::new()),
+            }),
+            overflow: None,
+            chunk_cache: None,
+        })
+    }
+
+    /// Replies with the [`FileDescriptor`] of an external data segment to all receivers that
+    /// requested it. Returns true when the receiver `receiver_port_id` was given the
+    /// [`FileDescriptor`] or when it is no external data segment.
+    pub(crate) fn serve_external_segment_requests(&self, receiver_port_id: u128) -> bool {
+        match &self.memory {
+            MemoryType::External(memory) => memory.serve_requests(receiver_port_id),
+            _ => true,
+        }
+    }
+
+    /// Forgets all receivers of an external data segment that were given the
+    /// [`FileDescriptor`] but for which `is_connected` returns false.
+    pub(crate) fn retain_external_segment_receivers<F: Fn(u128) -> bool>(&self, is_connected: F) {
+        if let MemoryType::External(memory) = &self.memory {
+            memory.retain_served_receivers(is_connected);
+        }
+    }
+
+    pub(crate) fn is_external(&self) -> bool {
+        matches!(&self.memory, MemoryType::External(_))
+    }
+
+    /// Returns the offset of `ptr` in the memory region of an external data segment or [`None`]
+    /// when it is no external data segment.
+    pub(crate) fn external_offset_of(&self, ptr: *const u8) -> Option<usize> {
+        match &self.memory {
+            MemoryType::External(memory) => {
+                Some(ptr as usize - memory.memory.base_address().as_ptr() as usize)
+            }
+            _ => None,
+        }
+    }
+
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ShmPointer, ShmAllocationError> {
         let msg = "Unable to allocate memory from the data segment";
         match &self.memory {
-            MemoryType::Static(memory) => Ok(fail!(from self, when memory.allocate(layout),
-                                            "{msg}.")),
+            MemoryType::Static(memory) => match &self.overflow {
+                Some(overflow) if memory.bucket_size() < layout.size() => overflow.allocate(layout),
+                _ => match self.cached_chunk(memory, layout) {
+                    Some(ptr) => Ok(ptr),
+                    None => Ok(fail!(from self, when memory.allocate(layout), "{msg}.")),
+                },
+            },
             MemoryType::Dynamic(memory) => match memory.allocate(layout) {
                 Ok(ptr) => Ok(ptr),
                 Err(ResizableShmAllocationError::ShmAllocationError(e)) => {
@@ -145,26 +616,106 @@ impl<Service: service::Service> DataSegment<Service> {
                         "{msg} since the shared memory segment creation failed while resizing the memory due to ({:?}).", e);
                 }
             },
+            MemoryType::External(memory) => memory.allocate(layout),
         }
     }
 
     pub(crate) unsafe fn deallocate_bucket(&self, offset: PointerOffset) {
         match &self.memory {
-            MemoryType::Static(memory) => memory.deallocate_bucket(offset),
+            MemoryType::Static(memory) => match &self.overflow {
+                Some(overflow) if offset.segment_id() == OVERFLOW_SEGMENT_ID => {
+                    if let Some(overflow_memory) = overflow.memory.get() {
+                        overflow_memory.deallocate_bucket(PointerOffset::new(offset.offset()));
+                    }
+                }
+                _ => {
+                    if !self
+                        .chunk_cache
+                        .as_ref()
+                        .is_some_and(|cache| cache.push(offset))
+                    {
+                        memory.deallocate_bucket(offset)
+                    }
+                }
+            },
             MemoryType::Dynamic(memory) => memory.deallocate_bucket(offset),
+            MemoryType::External(memory) => memory.free_chunks.borrow_mut().push(offset),
         }
     }
 
     pub(crate) fn bucket_size(&self, segment_id: SegmentId) -> usize {
         match &self.memory {
-            MemoryType::Static(memory) => memory.bucket_size(),
+            MemoryType::Static(memory) => match &self.overflow {
+                Some(overflow) if segment_id == OVERFLOW_SEGMENT_ID => overflow
+                    .memory
+                    .get()
+                    .map(|memory| memory.bucket_size())
+                    .unwrap_or(overflow.chunk_layout.size()),
+                _ => memory.bucket_size(),
+            },
             MemoryType::Dynamic(memory) => memory.bucket_size(segment_id),
+            MemoryType::External(memory) => memory.chunk_size,
+        }
+    }
+
+    /// Returns the number of bytes of all mapped shared memory segments.
+    pub(crate) fn size(&self) -> usize {
+        match &self.memory {
+            MemoryType::Static(memory) => {
+                memory.size()
+                    + self
+                        .overflow
+                        .as_ref()
+                        .and_then(|overflow| overflow.memory.get())
+                        .map(|memory| memory.size())
+                        .unwrap_or(0)
+            }
+            MemoryType::Dynamic(memory) => memory.size(),
+            MemoryType::External(memory) => memory.memory.size(),
+        }
+    }
+
+    /// Returns the physical memory of all chunks that are currently not loaned, not in
+    /// delivery and not held by the chunk cache to the operating system. A dynamic data
+    /// segment that was enlarged is additionally shrunk back to its initial size when none of
+    /// its chunks is in use anymore. The memory of an external data segment is owned by its
+    /// provider and never released. Returns the number of released bytes.
+    pub(crate) fn release_unused_memory(&self) -> usize {
+        match &self.memory {
+            MemoryType::Static(memory) => {
+                memory.release_unused_pages()
+                    + self
+                        .overflow
+                        .as_ref()
+                        .and_then(|overflow| overflow.memory.get())
+                        .map(|memory| memory.release_unused_pages())
+                        .unwrap_or(0)
+            }
+            MemoryType::Dynamic(memory) => {
+                let size_before_shrink = memory.size();
+                let released_by_shrink = match memory.shrink() {
+                    Ok(true) => size_before_shrink.saturating_sub(memory.size()),
+                    Ok(false) => 0,
+                    Err(e) => {
+                        debug!(from self,
+                            "Unable to shrink the data segment to its initial size ({:?}).", e);
+                        0
+                    }
+                };
+
+                released_by_shrink + memory.release_unused_pages()
+            }
+            MemoryType::External(_) => 0,
         }
     }
 
+    pub(crate) fn has_overflow_segment(&self) -> bool {
+        self.overflow.is_some()
+    }
+
     pub(crate) fn max_number_of_segments(data_segment_type: DataSegmentType) -> u8 {
         match data_segment_type {
-            DataSegmentType::Static => 1,
+            DataSegmentType::Static | DataSegmentType::External => 1,
             DataSegmentType::Dynamic => {
                 (Service::ResizableSharedMemory::max_number_of_reallocations() - 1) as u8
             }
@@ -181,11 +732,83 @@ enum MemoryViewType<Service: service::Service> {
             Service::SharedMemory,
         >>::View,
     ),
+    External(ExternalSegmentView),
+}
+
+/// Receiver side of an [`ExternalSegment`]. The request for the [`FileDescriptor`] is sent when
+/// the view is opened, the reply is picked up and mapped when the first offset is translated.
+#[derive(Debug)]
+struct ExternalSegmentView {
+    reply_socket: StreamingSocket,
+    memory: OnceCell<MemoryFd>,
+}
+
+impl ExternalSegmentView {
+    fn memory(&self) -> Result<&MemoryFd, SharedMemoryOpenError> {
+        if let Some(memory) = self.memory.get() {
+            return Ok(memory);
+        }
+
+        let msg = "Unable to map the external data segment";
+        let mut reply = SocketAncillary::new();
+        match self.reply_socket.try_receive_msg(&mut reply) {
+            Ok(true) => (),
+            Ok(false) => {
+                fail!(from self, with SharedMemoryOpenError::InitializationNotYetFinalized,
+                    "{msg} since the sender has not yet replied with its file descriptor.");
+            }
+            Err(e) => {
+                fail!(from self, with SharedMemoryOpenError::InternalError,
+                    "{msg} since the reply of the sender could not be received ({:?}).", e);
+            }
+        }
+
+        let file_descriptor = match reply.extract_fds().into_iter().next() {
+            Some(file_descriptor) => file_descriptor,
+            None => {
+                fail!(from self, with SharedMemoryOpenError::InternalError,
+                    "{msg} since the sender replied without a file descriptor.");
+            }
+        };
+
+        let memory = fail!(from self,
+                when MemoryFd::from_file_descriptor(file_descriptor, AccessMode::Read),
+                with SharedMemoryOpenError::InternalError,
+                "{msg} since the memory region could not be mapped.");
+
+        Ok(self.memory.get_or_init(|| memory))
+    }
+}
+
+#[derive(Debug)]
+struct OverflowSegmentView<Service: service::Service> {
+    segment_name: FileName,
+    global_config: config::Config,
+    memory: OnceCell<Service::SharedMemory>,
+}
+
+impl<Service: service::Service> OverflowSegmentView<Service> {
+    fn memory(&self) -> Result<&Service::SharedMemory, SharedMemoryOpenError> {
+        if let Some(memory) = self.memory.get() {
+            return Ok(memory);
+        }
+
+        let memory = fail!(from self,
+                            when <Service::SharedMemory as SharedMemory<PoolAllocator>>::
+                                Builder::new(&self.segment_name)
+                                .config(&data_segment_config::<Service>(&self.global_config))
+                                .timeout(self.global_config.global.service.creation_timeout)
+                                .open(),
+                            "Unable to open the overflow data segment since the underlying shared memory could not be opened.");
+
+        Ok(self.memory.get_or_init(|| memory))
+    }
 }
 
 #[derive(Debug)]
 pub(crate) struct DataSegmentView<Service: service::Service> {
     memory: MemoryViewType<Service>,
+    overflow: Option<OverflowSegmentView<Service>>,
 }
 
 impl<Service: service::Service> DataSegmentView<Service> {
@@ -208,6 +831,11 @@ impl<Service: service::Service> DataSegmentView<Service> {
 
         Ok(Self {
             memory: MemoryViewType::Static(memory),
+            overflow: Some(OverflowSegmentView {
+                segment_name: overflow_data_segment_name(segment_name),
+                global_config: global_config.clone(),
+                memory: OnceCell::new(),
+            }),
         })
     }
 
@@ -233,6 +861,68 @@ impl<Service: service::Service> DataSegmentView<Service> {
 
         Ok(Self {
             memory: MemoryViewType::Dynamic(memory),
+            overflow: None,
+        })
+    }
+
+    /// Requests the [`FileDescriptor`] of an external data segment from the sender. Must be
+    /// called before the receiver attaches to the connection since the sender delivers no
+    /// sample before it has served the request.
+    pub(crate) fn open_external_segment(
+        segment_name: &FileName,
+        receiver_port_id: u128,
+        global_config: &config::Config,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let origin = "DataSegment::open()";
+        let msg = "Unable to open the external data segment";
+
+        let (reply_socket, request_socket) = fail!(from origin,
+                when StreamingSocket::create_pair(),
+                with SharedMemoryOpenError::InternalError,
+                "{msg} since the socket pair to receive the file descriptor could not be created.");
+
+        let sender = fail!(from origin,
+                when UnixDatagramSenderBuilder::new(
+                    &external_data_segment_request_path::<Service>(global_config, segment_name))
+                    .create(),
+                with SharedMemoryOpenError::DoesNotExist,
+                "{msg} since the request socket of the sender could not be connected.");
+
+        // identifies the request so that the sender knows which receiver was given the
+        // file descriptor
+        let port_id = receiver_port_id.to_ne_bytes();
+        match reply_socket.try_send(&port_id) {
+            Ok(n) if n == port_id.len() => (),
+            Ok(n) => {
+                fail!(from origin, with SharedMemoryOpenError::InternalError,
+                    "{msg} since only {n} bytes of the receiver port id could be sent.");
+            }
+            Err(e) => {
+                fail!(from origin, with SharedMemoryOpenError::InternalError,
+                    "{msg} since the receiver port id could not be sent ({:?}).", e);
+            }
+        }
+
+        let mut request = SocketAncillary::new();
+        request.add_fd(request_socket.file_descriptor().clone());
+        match sender.try_send_msg(&mut request) {
+            Ok(true) => (),
+            Ok(false) => {
+                fail!(from origin, with SharedMemoryOpenError::InternalError,
+                    "{msg} since the request queue of the sender is full.");
+            }
+            Err(e) => {
+                fail!(from origin, with SharedMemoryOpenError::InternalError,
+                    "{msg} since the file descriptor could not be requested ({:?}).", e);
+            }
+        }
+
+        Ok(Self {
+            memory: MemoryViewType::External(ExternalSegmentView {
+                reply_socket,
+                memory: OnceCell::new(),
+            }),
+            overflow: None,
         })
     }
 
@@ -241,7 +931,14 @@ impl<Service: service::Service> DataSegmentView<Service> {
         offset: PointerOffset,
     ) -> Result<usize, SharedMemoryOpenError> {
         match &self.memory {
-            MemoryViewType::Static(memory) => Ok(offset.offset() + memory.payload_start_address()),
+            MemoryViewType::Static(memory) => match &self.overflow {
+                Some(overflow) if offset.segment_id() == OVERFLOW_SEGMENT_ID => {
+                    let overflow_memory = fail!(from self, when overflow.memory(),
+                            "Failed to translate pointer since the overflow data segment could not be opened.");
+                    Ok(offset.offset() + overflow_memory.payload_start_address())
+                }
+                _ => Ok(offset.offset() + memory.payload_start_address()),
+            },
             MemoryViewType::Dynamic(memory) => unsafe {
                 match memory.register_and_translate_offset(offset) {
                     Ok(ptr) => Ok(ptr as usize),
@@ -252,6 +949,28 @@ impl<Service: service::Service> DataSegmentView<Service> {
                     }
                 }
             },
+            MemoryViewType::External(view) => {
+                let memory = fail!(from self, when view.memory(),
+                        "Failed to translate pointer since the external data segment could not be mapped.");
+                Ok(offset.offset() + memory.base_address().as_ptr() as usize)
+            }
+        }
+    }
+
+    /// Returns the number of bytes of all mapped shared memory segments.
+    pub(crate) fn size(&self) -> usize {
+        match &self.memory {
+            MemoryViewType::Static(memory) => {
+                memory.size()
+                    + self
+                        .overflow
+                        .as_ref()
+                        .and_then(|overflow| overflow.memory.get())
+                        .map(|memory| memory.size())
+                        .unwrap_or(0)
+            }
+            MemoryViewType::Dynamic(memory) => memory.size(),
+            MemoryViewType::External(view) => view.memory.get().map(|m| m.size()).unwrap_or(0),
         }
     }
 
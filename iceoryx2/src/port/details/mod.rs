@@ -10,10 +10,13 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub(crate) mod broadcast_ring;
 pub(crate) mod channel_management;
 pub(crate) mod chunk;
 pub(crate) mod chunk_details;
+pub(crate) mod conflation_buffer;
 pub(crate) mod data_segment;
+pub(crate) mod port_list_state;
 pub(crate) mod receiver;
 pub(crate) mod segment_state;
 pub(crate) mod sender;
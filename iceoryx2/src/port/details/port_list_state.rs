@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::fmt::Debug;
+
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_lock_free::mpmc::container::{Container, ContainerState};
+
+use crate::service::{self, dynamic_config::DynamicConfig, ServiceState};
+
+/// Selects the port list of a segment of the dynamic config.
+pub(crate) type PortListSelector<T> = fn(&DynamicConfig) -> &Container<T>;
+
+/// Tracks one port list in all segments of the dynamic config of a service, see
+/// [`ServiceState::number_of_dynamic_config_segments()`]. A port is addressed with a global
+/// index, its index in the segment plus the capacity of all preceding segments, so that the
+/// indices of already connected ports stay stable when new segments are added.
+#[derive(Debug)]
+pub(crate) struct PortListState<T: Copy + Debug> {
+    states: Vec<ContainerState<T>>,
+    capacities: Vec<usize>,
+    capacity: usize,
+    select: PortListSelector<T>,
+}
+
+impl<T: Copy + Debug> PortListState<T> {
+    pub(crate) fn new<Service: service::Service>(
+        service_state: &ServiceState<Service>,
+        select: PortListSelector<T>,
+    ) -> Self {
+        let mut new_self = Self {
+            states: Vec::new(),
+            capacities: Vec::new(),
+            capacity: 0,
+            select,
+        };
+        new_self.update(service_state);
+        new_self
+    }
+
+    /// Syncs the state with all segments of the dynamic config and adds the segments that were
+    /// added since the last call. Returns true when the state has changed.
+    pub(crate) fn update<Service: service::Service>(
+        &mut self,
+        service_state: &ServiceState<Service>,
+    ) -> bool {
+        let mut has_changed = false;
+        for (n, state) in self.states.iter_mut().enumerate() {
+            has_changed |= unsafe {
+                (self.select)(service_state.dynamic_config_segment(n)).update_state(state)
+            };
+        }
+
+        for n in self.states.len()..service_state.number_of_dynamic_config_segments() {
+            let port_list = (self.select)(service_state.dynamic_config_segment(n));
+            self.states.push(unsafe { port_list.get_state() });
+            self.capacities.push(port_list.capacity());
+            self.capacity += port_list.capacity();
+            has_changed = true;
+        }
+
+        has_changed
+    }
+
+    /// Returns the sum of the capacities of all tracked segments, every global index is smaller.
+    pub(crate) fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    /// Calls the callback with the global index and the details of every port.
+    pub(crate) fn for_each<F: FnMut(usize, &T) -> CallbackProgression>(&self, mut callback: F) {
+        let mut offset = 0;
+        for (state, capacity) in self.states.iter().zip(self.capacities.iter()) {
+            let mut progression = CallbackProgression::Continue;
+            state.for_each(|handle, details| {
+                progression = callback(offset + handle.index() as usize, details);
+                progression
+            });
+
+            if progression == CallbackProgression::Stop {
+                return;
+            }
+            offset += capacity;
+        }
+    }
+}
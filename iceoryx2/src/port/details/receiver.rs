@@ -11,8 +11,10 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use core::cell::UnsafeCell;
+use core::sync::atomic::Ordering;
 
 extern crate alloc;
+use super::broadcast_ring::BroadcastRingReader;
 use super::channel_management::ChannelManagement;
 use super::channel_management::INVALID_CHANNEL_STATE;
 use super::chunk::Chunk;
@@ -20,7 +22,8 @@ use super::chunk_details::ChunkDetails;
 use super::data_segment::{DataSegmentType, DataSegmentView};
 use crate::port::update_connections::ConnectionFailure;
 use crate::port::{DegradationAction, DegradationCallback, ReceiveError};
-use crate::service::naming_scheme::data_segment_name;
+use crate::service::memory_usage::{MemoryRegionUsage, MemoryUsage};
+use crate::service::naming_scheme::{broadcast_ring_name, data_segment_name};
 use crate::service::static_config::message_type_details::MessageTypeDetails;
 use crate::service::ServiceState;
 use crate::service::{self, config_scheme::connection_config, naming_scheme::connection_name};
@@ -29,7 +32,9 @@ use iceoryx2_bb_container::vec::Vec;
 use iceoryx2_bb_elementary::cyclic_tagger::*;
 use iceoryx2_bb_log::{fail, warn};
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
+use iceoryx2_cal::shm_allocator::PointerOffset;
 use iceoryx2_cal::zero_copy_connection::*;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
 
 #[derive(Clone, Copy)]
 pub(crate) struct SenderDetails {
@@ -39,10 +44,22 @@ pub(crate) struct SenderDetails {
     pub(crate) data_segment_type: DataSegmentType,
 }
 
+/// Defines where a [`Receiver`] starts to read the broadcast ring of a sender.
+#[derive(Debug)]
+pub(crate) struct BroadcastSettings {
+    /// The number of already sent samples that are received from a sender that existed when
+    /// the receiver was created.
+    pub(crate) history_size: usize,
+    /// The senders that existed when the receiver was created. Every other sender was created
+    /// afterwards, therefore every sample in its ring is new to the receiver.
+    pub(crate) pre_existing_senders: alloc::vec::Vec<u128>,
+}
+
 #[derive(Debug)]
 pub(crate) struct Connection<Service: service::Service> {
     pub(crate) receiver: <Service::Connection as ZeroCopyConnection>::Receiver,
     pub(crate) data_segment: DataSegmentView<Service>,
+    pub(crate) broadcast_ring: Option<BroadcastRingReader<Service>>,
     pub(crate) sender_port_id: u128,
     tag: Tag,
 }
@@ -68,6 +85,27 @@ impl<Service: service::Service> Connection<Service> {
         );
 
         let global_config = this.service_state.shared_node.config();
+        // opened before the receiver is attached since the sender of an external data segment
+        // serves the request for its file descriptor as soon as the receiver is attached
+        let segment_name = data_segment_name(sender_port_id);
+        let data_segment = match data_segment_type {
+            DataSegmentType::Static => {
+                DataSegmentView::open_static_segment(&segment_name, global_config)
+            }
+            DataSegmentType::Dynamic => {
+                DataSegmentView::open_dynamic_segment(&segment_name, global_config)
+            }
+            DataSegmentType::External => DataSegmentView::open_external_segment(
+                &segment_name,
+                this.receiver_port_id,
+                global_config,
+            ),
+        };
+
+        let data_segment = fail!(from this,
+                                 when data_segment,
+                                "{} since the sender data segment could not be opened.", msg);
+
         let receiver = fail!(from this,
                         when <Service::Connection as ZeroCopyConnection>::
                             Builder::new( &connection_name(sender_port_id, this.receiver_port_id))
@@ -83,32 +121,55 @@ impl<Service: service::Service> Connection<Service> {
                                     .create_receiver(),
                         "{} since the zero copy connection could not be established.", msg);
 
-        let segment_name = data_segment_name(sender_port_id);
-        let data_segment = match data_segment_type {
-            DataSegmentType::Static => {
-                DataSegmentView::open_static_segment(&segment_name, global_config)
-            }
-            DataSegmentType::Dynamic => {
-                DataSegmentView::open_dynamic_segment(&segment_name, global_config)
+        let broadcast_ring = match &this.broadcast {
+            None => None,
+            Some(broadcast) => {
+                // a pre-existing sender is read from its current write position, independent of
+                // how many attempts it took to establish the connection
+                let history_size = if broadcast.pre_existing_senders.contains(&sender_port_id) {
+                    broadcast.history_size
+                } else {
+                    usize::MAX
+                };
+
+                Some(fail!(from this,
+                    when BroadcastRingReader::open(
+                        &broadcast_ring_name(&segment_name),
+                        this.receiver_port_id,
+                        global_config,
+                        history_size),
+                    "{} since the sender broadcast ring could not be opened.", msg))
             }
         };
 
-        let data_segment = fail!(from this,
-                                 when data_segment,
-                                "{} since the sender data segment could not be opened.", msg);
-
         Ok(Self {
             receiver,
             data_segment,
+            broadcast_ring,
             sender_port_id,
             tag: cyclic_tagger.create_tag(),
         })
     }
+
+    pub(crate) fn has_data(&self, channel_id: ChannelId) -> bool {
+        match &self.broadcast_ring {
+            Some(broadcast_ring) => broadcast_ring.has_data(),
+            None => self.receiver.has_data(channel_id),
+        }
+    }
+
+    pub(crate) fn borrow_count(&self, channel_id: ChannelId) -> usize {
+        match &self.broadcast_ring {
+            Some(broadcast_ring) => broadcast_ring.borrow_count(),
+            None => self.receiver.borrow_count(channel_id),
+        }
+    }
 }
 
 #[derive(Debug)]
 pub(crate) struct Receiver<Service: service::Service> {
-    pub(crate) connections: Vec<UnsafeCell<Option<Arc<Connection<Service>>>>>,
+    pub(crate) connections:
+        UnsafeCell<alloc::vec::Vec<UnsafeCell<Option<Arc<Connection<Service>>>>>>,
     pub(crate) receiver_port_id: u128,
     pub(crate) service_state: Arc<ServiceState<Service>>,
     pub(crate) buffer_size: usize,
@@ -119,6 +180,10 @@ pub(crate) struct Receiver<Service: service::Service> {
     pub(crate) receiver_max_borrowed_samples: usize,
     pub(crate) enable_safe_overflow: bool,
     pub(crate) number_of_channels: usize,
+    /// When set, the samples are received from the broadcast ring of the sender instead of the
+    /// connection.
+    pub(crate) broadcast: Option<BroadcastSettings>,
+    pub(crate) missed_samples: IoxAtomicU64,
 }
 
 impl<Service: service::Service> Receiver<Service> {
@@ -154,12 +219,48 @@ impl<Service: service::Service> Receiver<Service> {
         }
     }
 
+    pub(crate) fn memory_usage(&self) -> MemoryUsage {
+        let mut data_segments = 0;
+        let mut connections = 0;
+        for i in 0..self.len() {
+            if let Some(ref connection) = self.get(i) {
+                data_segments += connection.data_segment.size();
+                if let Some(broadcast_ring) = &connection.broadcast_ring {
+                    data_segments += broadcast_ring.size();
+                }
+                connections += connection.receiver.memory_size();
+            }
+        }
+
+        MemoryUsage {
+            data_segments: MemoryRegionUsage {
+                mapped: data_segments,
+                used: 0,
+            },
+            connections: MemoryRegionUsage {
+                mapped: connections,
+                used: connections,
+            },
+            management: MemoryRegionUsage::default(),
+        }
+    }
+
+    /// Returns the number of samples that were overwritten in the broadcast rings of the
+    /// senders before they could be received.
+    pub(crate) fn missed_samples(&self) -> u64 {
+        self.missed_samples.load(Ordering::Relaxed)
+    }
+
     pub(crate) fn receiver_port_id(&self) -> u128 {
         self.receiver_port_id
     }
 
+    fn connections(&self) -> &alloc::vec::Vec<UnsafeCell<Option<Arc<Connection<Service>>>>> {
+        unsafe { &*self.connections.get() }
+    }
+
     pub(crate) fn get(&self, index: usize) -> &Option<Arc<Connection<Service>>> {
-        unsafe { &*self.connections[index].get() }
+        unsafe { &*self.connections()[index].get() }
     }
 
     // only used internally as convinience function
@@ -167,7 +268,20 @@ impl<Service: service::Service> Receiver<Service> {
     pub(crate) fn get_mut(&self, index: usize) -> &mut Option<Arc<Connection<Service>>> {
         #[deny(clippy::mut_from_ref)]
         unsafe {
-            &mut *self.connections[index].get()
+            &mut *self.connections()[index].get()
+        }
+    }
+
+    /// Increases the number of connections when the dynamic config of the service was extended
+    /// with additional sender ports.
+    ///
+    /// # Safety
+    ///
+    ///  * no reference to a connection acquired before the call must be used afterwards
+    pub(crate) unsafe fn grow_connections(&self, number_of_connections: usize) {
+        let connections = &mut *self.connections.get();
+        while connections.len() < number_of_connections {
+            connections.push(UnsafeCell::new(None));
         }
     }
 
@@ -193,7 +307,7 @@ impl<Service: service::Service> Receiver<Service> {
             if let Some(connection) = self.get(index) {
                 let mut keep_connection = false;
                 for id in 0..self.number_of_channels {
-                    if connection.receiver.has_data(ChannelId::new(id)) {
+                    if connection.has_data(ChannelId::new(id)) {
                         keep_connection = true;
                         break;
                     }
@@ -215,13 +329,23 @@ impl<Service: service::Service> Receiver<Service> {
     }
 
     pub(crate) fn len(&self) -> usize {
-        self.connections.len()
+        self.connections().len()
+    }
+
+    fn connection_index_of(&self, sender_port_id: u128, excluded_index: usize) -> Option<usize> {
+        (0..self.len()).find(|&n| {
+            n != excluded_index
+                && self
+                    .get(n)
+                    .as_ref()
+                    .is_some_and(|connection| connection.sender_port_id == sender_port_id)
+        })
     }
 
     pub(crate) fn has_samples(&self, channel_id: ChannelId) -> bool {
         for id in 0..self.len() {
             if let Some(ref connection) = &self.get(id) {
-                if connection.receiver.has_data(channel_id) {
+                if connection.has_data(channel_id) {
                     return true;
                 }
             }
@@ -230,11 +354,78 @@ impl<Service: service::Service> Receiver<Service> {
         false
     }
 
+    fn receive_from_broadcast_ring(
+        &self,
+        connection: &Arc<Connection<Service>>,
+        broadcast_ring: &BroadcastRingReader<Service>,
+    ) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        if broadcast_ring.borrow_count() >= connection.receiver.max_borrowed_samples() {
+            fail!(from self, with ReceiveError::ExceedsMaxBorrows,
+                "Unable to receive another sample since it would exceed the maximum {} of borrowed samples.",
+                connection.receiver.max_borrowed_samples());
+        }
+
+        let (element, missed_samples) = broadcast_ring.receive();
+        if missed_samples != 0 {
+            self.missed_samples
+                .fetch_add(missed_samples, Ordering::Relaxed);
+        }
+
+        match element {
+            None => Ok(None),
+            Some(element) => {
+                let offset = PointerOffset::from_value(element.value);
+                match self.translate_offset(connection, offset) {
+                    Ok(Some(address)) => Ok(Some((
+                        ChunkDetails {
+                            connection: connection.clone(),
+                            offset,
+                            origin: connection.sender_port_id,
+                            channel_id: ChannelId::new(0),
+                            broadcast_key: Some(element.key),
+                        },
+                        Chunk::new(&self.message_type_details, address),
+                    ))),
+                    v => {
+                        broadcast_ring.release(element.key);
+                        v.map(|_| None)
+                    }
+                }
+            }
+        }
+    }
+
+    fn translate_offset(
+        &self,
+        connection: &Arc<Connection<Service>>,
+        offset: PointerOffset,
+    ) -> Result<Option<usize>, ReceiveError> {
+        match connection
+            .data_segment
+            .register_and_translate_offset(offset)
+        {
+            Ok(address) => Ok(Some(address)),
+            Err(e) => {
+                if connection.data_segment.is_dynamic() {
+                    warn!(from self, "Lost a sample. This only happens in the dynamic use case when a sender has reallocated its data segment and gone out of scope before the receiver has mapped the realloacted data segment. To circumvent this, you could either use static memory or increase the initial max slice len.");
+                    return Ok(None);
+                }
+                fail!(from self, with ReceiveError::ConnectionFailure(ConnectionFailure::UnableToMapSendersDataSegment(e)),
+                    "Unable to register and translate offset from sender {:?} since the received offset {:?} could not be registered and translated.",
+                    connection.sender_port_id, offset);
+            }
+        }
+    }
+
     fn receive_from_connection(
         &self,
         connection: &Arc<Connection<Service>>,
         channel_id: ChannelId,
     ) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        if let Some(broadcast_ring) = &connection.broadcast_ring {
+            return self.receive_from_broadcast_ring(connection, broadcast_ring);
+        }
+
         let msg = "Unable to receive another sample";
         match connection.receiver.receive(channel_id) {
             Ok(data) => match data {
@@ -244,22 +435,13 @@ impl<Service: service::Service> Receiver<Service> {
                         connection: connection.clone(),
                         offset,
                         origin: connection.sender_port_id,
+                        channel_id,
+                        broadcast_key: None,
                     };
 
-                    let offset = match connection
-                        .data_segment
-                        .register_and_translate_offset(offset)
-                    {
-                        Ok(offset) => offset,
-                        Err(e) => {
-                            if connection.data_segment.is_dynamic() {
-                                warn!(from self, "Lost a sample. This only happens in the dynamic use case when a sender has reallocated its data segment and gone out of scope before the receiver has mapped the realloacted data segment. To circumvent this, you could either use static memory or increase the initial max slice len.");
-                                return Ok(None);
-                            }
-                            fail!(from self, with ReceiveError::ConnectionFailure(ConnectionFailure::UnableToMapSendersDataSegment(e)),
-                                "Unable to register and translate offset from sender {:?} since the received offset {:?} could not be registered and translated.",
-                                connection.sender_port_id, offset);
-                        }
+                    let offset = match self.translate_offset(connection, offset)? {
+                        Some(offset) => offset,
+                        None => return Ok(None),
                     };
 
                     Ok(Some((
@@ -286,7 +468,7 @@ impl<Service: service::Service> Receiver<Service> {
             if !to_be_removed_connections.is_empty() {
                 let mut clean_connections = Vec::new(to_be_removed_connections.capacity());
                 for (n, connection) in to_be_removed_connections.iter_mut().enumerate() {
-                    if connection.receiver.borrow_count(channel_id)
+                    if connection.borrow_count(channel_id)
                         == connection.receiver.max_borrowed_samples()
                     {
                         continue;
@@ -323,13 +505,12 @@ impl<Service: service::Service> Receiver<Service> {
         let mut all_channels_exceed_max_borrows = true;
         for id in 0..self.len() {
             if let Some(ref mut connection) = &mut self.get_mut(id) {
-                if !connection.receiver.has_data(channel_id) {
+                if !connection.has_data(channel_id) {
                     continue;
                 }
 
                 active_channel_count += 1;
-                if connection.receiver.borrow_count(channel_id)
-                    >= connection.receiver.max_borrowed_samples()
+                if connection.borrow_count(channel_id) >= connection.receiver.max_borrowed_samples()
                 {
                     continue;
                 } else {
@@ -373,6 +554,26 @@ impl<Service: service::Service> Receiver<Service> {
         };
 
         if is_connected {
+            // a sender that adopted the resources of its predecessor, see
+            // PortFactoryPublisher::warm_restart_key(), keeps the port id but is registered
+            // under a different index, therefore the existing connection is moved instead of
+            // being recreated so that no received sample is lost
+            if let Some(previous_index) = self.connection_index_of(sender_details.port_id, index) {
+                if let Some(connection) = self.get(previous_index) {
+                    if connection.was_tagged_by(&self.tagger) {
+                        return Ok(());
+                    }
+                }
+
+                // the connection that occupied the index is kept at the previous index, it is
+                // either moved again or removed at the end of the update cycle
+                core::mem::swap(self.get_mut(index), self.get_mut(previous_index));
+                if let Some(connection) = self.get(index) {
+                    self.tagger.tag(connection.as_ref());
+                }
+                return Ok(());
+            }
+
             self.prepare_connection_removal(index);
 
             match self.create(index, &sender_details) {
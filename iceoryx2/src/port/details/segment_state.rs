@@ -41,6 +41,13 @@ impl SegmentState {
         self.payload_size.load(Ordering::Relaxed)
     }
 
+    pub(crate) fn number_of_used_samples(&self) -> usize {
+        self.sample_reference_counter
+            .iter()
+            .filter(|counter| counter.load(Ordering::Relaxed) != 0)
+            .count()
+    }
+
     pub(crate) fn sample_index(&self, distance_to_chunk: usize) -> usize {
         debug_assert!(distance_to_chunk % self.payload_size() == 0);
         distance_to_chunk / self.payload_size()
@@ -51,6 +58,11 @@ impl SegmentState {
             .fetch_add(1, Ordering::Relaxed)
     }
 
+    pub(crate) fn is_in_use(&self, distance_to_chunk: usize) -> bool {
+        self.sample_reference_counter[self.sample_index(distance_to_chunk)].load(Ordering::Relaxed)
+            != 0
+    }
+
     pub(crate) fn release_sample(&self, distance_to_chunk: usize) -> u64 {
         self.sample_reference_counter[self.sample_index(distance_to_chunk)]
             .fetch_sub(1, Ordering::Relaxed)
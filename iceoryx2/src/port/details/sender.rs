@@ -12,25 +12,28 @@
 
 use core::alloc::Layout;
 use core::cell::UnsafeCell;
-use core::sync::atomic::Ordering;
+use core::sync::atomic::{fence, Ordering};
 
 extern crate alloc;
 use alloc::sync::Arc;
 
 use iceoryx2_bb_elementary::cyclic_tagger::*;
-use iceoryx2_bb_log::{error, fail, fatal_panic, warn};
+use iceoryx2_bb_log::{debug, error, fail, fatal_panic, warn};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
-use iceoryx2_cal::shm_allocator::{AllocationError, PointerOffset, ShmAllocationError};
+use iceoryx2_cal::shm_allocator::{AllocationError, PointerOffset, SegmentId, ShmAllocationError};
 use iceoryx2_cal::zero_copy_connection::{
     ChannelId, ZeroCopyConnection, ZeroCopyConnectionBuilder, ZeroCopyCreationError,
-    ZeroCopySendError, ZeroCopySender,
+    ZeroCopyPortDetails, ZeroCopySendError, ZeroCopySender,
 };
-use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicBool, IoxAtomicU64, IoxAtomicUsize};
 
 use crate::node::SharedNode;
+use crate::port::downsampling::Downsampling;
 use crate::port::{DegradationAction, DegradationCallback, LoanError, SendError};
 use crate::prelude::UnableToDeliverStrategy;
 use crate::service::config_scheme::connection_config;
+use crate::service::memory_usage::{MemoryRegionUsage, MemoryUsage};
 use crate::service::static_config::message_type_details::{MessageTypeDetails, TypeVariant};
 use crate::service::ServiceState;
 use crate::{service, service::naming_scheme::connection_name};
@@ -45,12 +48,56 @@ use super::segment_state::SegmentState;
 pub(crate) struct ReceiverDetails {
     pub(crate) port_id: u128,
     pub(crate) buffer_size: usize,
+    pub(crate) group: Option<u64>,
+    pub(crate) downsampling: Option<Downsampling>,
+}
+
+#[derive(Debug)]
+struct DownsamplingState {
+    policy: Downsampling,
+    // the number of offered samples or the monotonic time in nanoseconds when the next sample
+    // is due, depending on the policy
+    counter: IoxAtomicU64,
+}
+
+impl DownsamplingState {
+    fn is_due(&self, current_time: &mut Option<u64>) -> bool {
+        match self.policy {
+            Downsampling::EveryNth(n) => {
+                self.counter.fetch_add(1, Ordering::Relaxed) % n.max(1) == 0
+            }
+            Downsampling::MinInterval(interval) => {
+                if current_time.is_none() {
+                    *current_time = Time::now_with_clock(ClockType::Monotonic)
+                        .ok()
+                        .map(|time| time.as_duration().as_nanos() as u64);
+                }
+
+                // without a clock the sample is delivered rather than lost
+                let now = match *current_time {
+                    Some(now) => now,
+                    None => return true,
+                };
+
+                if now < self.counter.load(Ordering::Relaxed) {
+                    return false;
+                }
+
+                self.counter
+                    .store(now + interval.as_nanos() as u64, Ordering::Relaxed);
+                true
+            }
+        }
+    }
 }
 
 #[derive(Debug)]
 pub(crate) struct Connection<Service: service::Service> {
     pub(crate) sender: <Service::Connection as ZeroCopyConnection>::Sender,
     pub(crate) receiver_port_id: u128,
+    pub(crate) group: Option<u64>,
+    downsampling: Option<DownsamplingState>,
+    has_data_segment_access: IoxAtomicBool,
     tag: Tag,
 }
 
@@ -63,11 +110,12 @@ impl<Service: service::Service> Taggable for Connection<Service> {
 impl<Service: service::Service> Connection<Service> {
     fn new(
         this: &Sender<Service>,
-        receiver_port_id: u128,
-        buffer_size: usize,
+        receiver_details: ReceiverDetails,
         number_of_samples: usize,
         tag: Tag,
     ) -> Result<Self, ZeroCopyCreationError> {
+        let receiver_port_id = receiver_details.port_id;
+        let buffer_size = receiver_details.buffer_size;
         let msg = format!(
             "Unable to establish connection to receiver port {:?} from sender port {:?}",
             receiver_port_id, this.sender_port_id
@@ -95,16 +143,40 @@ impl<Service: service::Service> Connection<Service> {
         Ok(Self {
             sender,
             receiver_port_id,
+            group: receiver_details.group,
+            downsampling: receiver_details
+                .downsampling
+                .map(|policy| DownsamplingState {
+                    policy,
+                    counter: IoxAtomicU64::new(0),
+                }),
+            has_data_segment_access: IoxAtomicBool::new(!this.data_segment.is_external()),
             tag,
         })
     }
+
+    /// Returns true when the next sample shall be delivered to the receiver.
+    /// `current_time` is acquired on first use so that it is read at most once per delivery.
+    fn is_due(&self, current_time: &mut Option<u64>) -> bool {
+        match &self.downsampling {
+            None => true,
+            Some(downsampling) => downsampling.is_due(current_time),
+        }
+    }
+}
+
+/// The connection ids of all receivers that are members of the same group.
+#[derive(Debug)]
+pub(crate) struct GroupMembers {
+    group: u64,
+    members: Vec<usize>,
 }
 
 #[derive(Debug)]
 pub(crate) struct Sender<Service: service::Service> {
     pub(crate) segment_states: Vec<SegmentState>,
     pub(crate) data_segment: DataSegment<Service>,
-    pub(crate) connections: Vec<UnsafeCell<Option<Connection<Service>>>>,
+    pub(crate) connections: UnsafeCell<Vec<UnsafeCell<Option<Connection<Service>>>>>,
     pub(crate) sender_port_id: u128,
     pub(crate) shared_node: Arc<SharedNode<Service>>,
     pub(crate) receiver_max_buffer_size: usize,
@@ -120,11 +192,17 @@ pub(crate) struct Sender<Service: service::Service> {
     pub(crate) unable_to_deliver_strategy: UnableToDeliverStrategy,
     pub(crate) message_type_details: MessageTypeDetails,
     pub(crate) number_of_channels: usize,
+    pub(crate) group_cursor: IoxAtomicUsize,
+    pub(crate) group_members: UnsafeCell<Vec<GroupMembers>>,
 }
 
 impl<Service: service::Service> Sender<Service> {
+    fn connections(&self) -> &Vec<UnsafeCell<Option<Connection<Service>>>> {
+        unsafe { &*self.connections.get() }
+    }
+
     fn get(&self, index: usize) -> &Option<Connection<Service>> {
-        unsafe { &(*self.connections[index].get()) }
+        unsafe { &(*self.connections()[index].get()) }
     }
 
     // only used internally as convinience function
@@ -132,10 +210,29 @@ impl<Service: service::Service> Sender<Service> {
     fn get_mut(&self, index: usize) -> &mut Option<Connection<Service>> {
         #[deny(clippy::mut_from_ref)]
         unsafe {
-            &mut (*self.connections[index].get())
+            &mut (*self.connections()[index].get())
         }
     }
 
+    /// Increases the number of connections when the dynamic config of the service was extended
+    /// with additional receiver ports.
+    ///
+    /// # Safety
+    ///
+    ///  * no reference to a connection acquired before the call must be used afterwards
+    pub(crate) unsafe fn grow_connections(&self, number_of_connections: usize) {
+        let connections = &mut *self.connections.get();
+        while connections.len() < number_of_connections {
+            connections.push(UnsafeCell::new(None));
+        }
+    }
+
+    pub(crate) fn receiver_port_id_of(&self, connection_id: usize) -> Option<u128> {
+        self.get(connection_id)
+            .as_ref()
+            .map(|connection| connection.receiver_port_id)
+    }
+
     pub(crate) fn get_connection_id_of(&self, receiver_port_id: u128) -> Option<usize> {
         for i in 0..self.len() {
             if let Some(connection) = self.get(i) {
@@ -148,6 +245,34 @@ impl<Service: service::Service> Sender<Service> {
         None
     }
 
+    /// Returns true when the receiver of the connection is able to access the data segment. The
+    /// receiver of an external data segment requests its file descriptor before it attaches to
+    /// the connection, therefore the pending requests are served as soon as it is attached and
+    /// nothing is delivered before the receiver was given the file descriptor. When the reply
+    /// could not be delivered it is retried with the next call.
+    pub(crate) fn has_data_segment_access(&self, connection: &Connection<Service>) -> bool {
+        if connection.has_data_segment_access.load(Ordering::Relaxed) {
+            return true;
+        }
+
+        if !connection.sender.is_connected() {
+            return false;
+        }
+
+        fence(Ordering::Acquire);
+        if !self
+            .data_segment
+            .serve_external_segment_requests(connection.receiver_port_id)
+        {
+            return false;
+        }
+
+        connection
+            .has_data_segment_access
+            .store(true, Ordering::Relaxed);
+        true
+    }
+
     fn deliver_offset_to_connection_impl(
         &self,
         offset: PointerOffset,
@@ -166,6 +291,10 @@ impl<Service: service::Service> Sender<Service> {
 
         let mut number_of_recipients = 0;
         if let Some(ref connection) = self.get(connection_id) {
+            if !self.has_data_segment_access(connection) {
+                return Ok(number_of_recipients);
+            }
+
             match deliver_call(&connection.sender, offset, sample_size, channel_id) {
                 Err(ZeroCopySendError::ReceiveBufferFull)
                 | Err(ZeroCopySendError::UsedChunkListFull) => {
@@ -253,14 +382,85 @@ impl<Service: service::Service> Sender<Service> {
         offset: PointerOffset,
         sample_size: usize,
         channel_id: ChannelId,
+    ) -> Result<usize, SendError> {
+        self.deliver_offset_and_inform(offset, sample_size, channel_id, |_| {})
+    }
+
+    fn group_members(&self) -> &Vec<GroupMembers> {
+        unsafe { &*self.group_members.get() }
+    }
+
+    /// Selects the member of the group with the fewest queued samples. The scan starts at a
+    /// rotating position so that idle members share the samples in turn.
+    fn select_group_member(&self, group: &GroupMembers, channel_id: ChannelId) -> Option<usize> {
+        let len = group.members.len();
+        let start = self.group_cursor.fetch_add(1, Ordering::Relaxed) % len;
+
+        let mut selected = None;
+        let mut fewest_queued_samples = usize::MAX;
+        for n in 0..len {
+            let i = group.members[(start + n) % len];
+            if let Some(connection) = self.get(i) {
+                // the table is rebuilt when the update cycle finishes, until then the
+                // connection could have been replaced by a receiver of another group
+                if connection.group != Some(group.group) {
+                    continue;
+                }
+
+                let queued_samples = connection.sender.number_of_queued_samples(channel_id);
+                if queued_samples < fewest_queued_samples {
+                    fewest_queued_samples = queued_samples;
+                    selected = Some(i);
+                }
+            }
+        }
+
+        selected
+    }
+
+    /// Delivers the offset to all connections and calls `on_delivery` with the connection id of
+    /// every connection that received it. Receivers that are members of a group share the
+    /// samples, every group receives the offset only once via one of its members. Receivers
+    /// with a [`Downsampling`] policy receive only the samples that are due.
+    pub(crate) fn deliver_offset_and_inform<F: FnMut(usize)>(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        channel_id: ChannelId,
+        mut on_delivery: F,
     ) -> Result<usize, SendError> {
         self.retrieve_returned_samples();
 
         let mut number_of_recipients = 0;
+        let mut deliver = |connection_id| -> Result<(), SendError> {
+            let delivered = self.deliver_offset_to_connection_impl(
+                offset,
+                sample_size,
+                channel_id,
+                connection_id,
+            )?;
+            if delivered != 0 {
+                on_delivery(connection_id);
+            }
+            number_of_recipients += delivered;
+            Ok(())
+        };
+
+        let mut current_time = None;
         for i in 0..self.len() {
-            number_of_recipients +=
-                self.deliver_offset_to_connection_impl(offset, sample_size, channel_id, i)?;
+            if let Some(connection) = self.get(i) {
+                if connection.group.is_none() && connection.is_due(&mut current_time) {
+                    deliver(i)?;
+                }
+            }
         }
+
+        for group in self.group_members() {
+            if let Some(member) = self.select_group_member(group, channel_id) {
+                deliver(member)?;
+            }
+        }
+
         Ok(number_of_recipients)
     }
 
@@ -276,8 +476,7 @@ impl<Service: service::Service> Sender<Service> {
     ) -> Result<(), ZeroCopyCreationError> {
         *self.get_mut(index) = Some(Connection::new(
             self,
-            receiver_details.port_id,
-            receiver_details.buffer_size,
+            receiver_details,
             self.number_of_samples,
             self.tagger.create_tag(),
         )?);
@@ -286,7 +485,7 @@ impl<Service: service::Service> Sender<Service> {
     }
 
     fn len(&self) -> usize {
-        self.connections.len()
+        self.connections().len()
     }
 
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
@@ -340,6 +539,82 @@ impl<Service: service::Service> Sender<Service> {
         (segment_state.borrow_sample(offset.offset()), payload_size)
     }
 
+    /// Takes over the chunks that the dead predecessor of an adopted sender had delivered and
+    /// that were not yet returned, see
+    /// [`PortFactoryPublisher::warm_restart_key()`](crate::service::port_factory::publisher::PortFactoryPublisher::warm_restart_key()).
+    /// When the sender is connected to all `number_of_receivers`, every other chunk the
+    /// predecessor held is released.
+    pub(crate) fn adopt_used_chunks(&self, number_of_receivers: usize) {
+        let mut number_of_connections = 0;
+        for i in 0..self.len() {
+            if let Some(ref connection) = self.get(i) {
+                number_of_connections += 1;
+                connection.sender.used_offsets(|offset| {
+                    self.borrow_sample(offset);
+                });
+            }
+        }
+
+        // a receiver without connection may still hold chunks of the predecessor
+        if number_of_connections != number_of_receivers {
+            warn!(from self,
+                "Unable to release the chunks the predecessor held since not all receivers are connected. They stay unavailable until the data segment is released.");
+            return;
+        }
+
+        let segment_state = &self.segment_states[0];
+        if segment_state.payload_size() == 0 {
+            segment_state.set_payload_size(self.data_segment.bucket_size(SegmentId::new(0)));
+        }
+
+        let number_of_released_chunks = unsafe {
+            self.data_segment
+                .release_unreferenced_chunks(self.number_of_samples, |offset| {
+                    segment_state.is_in_use(offset.offset())
+                })
+        };
+
+        debug!(from self,
+            "Released {} chunks that were loaned by the predecessor or part of its history.",
+            number_of_released_chunks);
+    }
+
+    pub(crate) fn memory_usage(&self) -> MemoryUsage {
+        let mut used_data_segment = 0;
+        for segment_state in &self.segment_states {
+            used_data_segment +=
+                segment_state.number_of_used_samples() * segment_state.payload_size();
+        }
+
+        let mut connections = 0;
+        for i in 0..self.len() {
+            if let Some(ref connection) = self.get(i) {
+                connections += connection.sender.memory_size();
+            }
+        }
+
+        MemoryUsage {
+            data_segments: MemoryRegionUsage {
+                mapped: self.data_segment.size(),
+                used: used_data_segment,
+            },
+            connections: MemoryRegionUsage {
+                mapped: connections,
+                used: connections,
+            },
+            management: MemoryRegionUsage::default(),
+        }
+    }
+
+    pub(crate) fn release_unused_memory(&self) -> usize {
+        self.retrieve_returned_samples();
+        let released_bytes = self.data_segment.release_unused_memory();
+
+        debug!(from self,
+            "Released {} bytes of unused data segment memory.", released_bytes);
+        released_bytes
+    }
+
     pub(crate) fn retrieve_returned_samples(&self) {
         for i in 0..self.len() {
             if let Some(ref connection) = self.get(i) {
@@ -454,6 +729,41 @@ impl<Service: service::Service> Sender<Service> {
                 }
             }
         }
+
+        self.data_segment
+            .retain_external_segment_receivers(|receiver_port_id| {
+                self.get_connection_id_of(receiver_port_id).is_some()
+            });
+        self.update_group_members();
+    }
+
+    /// Rebuilds the table that maps every group to the connection ids of its members so that
+    /// the delivery does not have to search the connections for the members of a group.
+    fn update_group_members(&self) {
+        let group_members = unsafe { &mut *self.group_members.get() };
+        for group in group_members.iter_mut() {
+            group.members.clear();
+        }
+
+        for i in 0..self.len() {
+            let group = match self.get(i) {
+                Some(connection) => match connection.group {
+                    Some(group) => group,
+                    None => continue,
+                },
+                None => continue,
+            };
+
+            match group_members.iter_mut().find(|g| g.group == group) {
+                Some(entry) => entry.members.push(i),
+                None => group_members.push(GroupMembers {
+                    group,
+                    members: vec![i],
+                }),
+            }
+        }
+
+        group_members.retain(|g| !g.members.is_empty());
     }
 
     pub(crate) fn payload_size(&self) -> usize {
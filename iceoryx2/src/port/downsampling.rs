@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use core::time::Duration;
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::port::downsampling::Downsampling;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .open_or_create()?;
+//!
+//! // receives at most 10 samples per second
+//! let subscriber = service.subscriber_builder()
+//!     .downsampling(Downsampling::MinInterval(Duration::from_millis(100)))
+//!     .create()?;
+//! # Ok(())
+//! # }
+//! ```
+
+use core::time::Duration;
+
+/// Defines which [`crate::sample::Sample`]s a [`crate::port::publisher::Publisher`] delivers
+/// to a [`crate::port::subscriber::Subscriber`] that does not need every sample. The
+/// [`crate::port::publisher::Publisher`] enforces it, the skipped samples never enter the
+/// buffer of the [`crate::port::subscriber::Subscriber`].
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum Downsampling {
+    /// Delivers only the first and then every n-th sample. A value of 0 is treated like 1.
+    EveryNth(u64),
+    /// Delivers a sample only when at least the given interval has passed since the last
+    /// delivered sample. It limits the rate to `1 / interval`.
+    MinInterval(Duration),
+}
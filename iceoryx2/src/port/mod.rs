@@ -20,6 +20,8 @@ pub use details::data_segment::DataSegmentType;
 
 /// Sends requests to a [`Server`](crate::port::server::Server) and receives responses.
 pub mod client;
+/// Defines which samples a publisher delivers to a subscriber that does not need every sample.
+pub mod downsampling;
 /// Defines the event id used to identify the source of an event.
 pub mod event_id;
 /// Receiving endpoint (port) for event based communication
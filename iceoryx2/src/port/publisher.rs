@@ -101,10 +101,14 @@
 //! # }
 //! ```
 
-use super::details::data_segment::{DataSegment, DataSegmentType};
+use super::details::broadcast_ring::BroadcastRingSegment;
+use super::details::chunk::ChunkMut;
+use super::details::data_segment::{DataSegment, DataSegmentType, OVERFLOW_SEGMENT_ID};
+use super::details::port_list_state::PortListState;
 use super::details::segment_state::SegmentState;
 use super::port_identifiers::UniquePublisherId;
 use super::{LoanError, SendError};
+use crate::node::NodeState;
 use crate::port::details::sender::*;
 use crate::port::update_connections::{ConnectionFailure, UpdateConnections};
 use crate::prelude::UnableToDeliverStrategy;
@@ -112,26 +116,40 @@ use crate::raw_sample::RawSampleMut;
 use crate::sample_mut::SampleMut;
 use crate::sample_mut_uninit::SampleMutUninit;
 use crate::service::builder::CustomPayloadMarker;
+use crate::service::config_scheme::event_config;
 use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, SubscriberDetails};
+use crate::service::dynamic_config::DynamicConfig;
 use crate::service::header::publish_subscribe::Header;
-use crate::service::naming_scheme::data_segment_name;
+use crate::service::memory_usage::MemoryUsage;
+use crate::service::naming_scheme::{
+    broadcast_ring_name, data_arrival_event_concept_name, data_segment_name,
+    overflow_data_segment_name,
+};
 use crate::service::port_factory::publisher::LocalPublisherConfig;
+use crate::service::stale_resource_cleanup::{
+    remove_retained_publisher, remove_sender_port_from_all_connections,
+};
 use crate::service::static_config::message_type_details::TypeVariant;
 use crate::service::static_config::publish_subscribe;
 use crate::service::{self, ServiceState};
+use core::alloc::Layout;
 use core::any::TypeId;
 use core::cell::UnsafeCell;
 use core::fmt::Debug;
 use core::sync::atomic::Ordering;
+use core::time::Duration;
 use core::{marker::PhantomData, mem::MaybeUninit};
 use iceoryx2_bb_container::queue::Queue;
 use iceoryx2_bb_elementary::cyclic_tagger::CyclicTagger;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
-use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
-use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_lock_free::mpmc::container::{Container, ContainerHandle};
+use iceoryx2_bb_lock_free::spmc::broadcast_ring::PinnedElement;
+use iceoryx2_bb_log::{debug, fail, warn};
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::event::{Event, Notifier, NotifierBuilder, NotifierNotifyError, TriggerId};
+use iceoryx2_cal::named_concept::NamedConceptBuilder;
 use iceoryx2_cal::shm_allocator::{AllocationStrategy, PointerOffset};
 use iceoryx2_cal::zero_copy_connection::{
     ChannelId, ZeroCopyCreationError, ZeroCopyPortDetails, ZeroCopySender,
@@ -152,6 +170,8 @@ pub enum PublisherCreateError {
     ExceedsMaxSupportedPublishers,
     /// The datasegment in which the payload of the [`Publisher`] is stored, could not be created.
     UnableToCreateDataSegment,
+    /// The broadcast ring via which the [`Publisher`] delivers its samples could not be created.
+    UnableToCreateBroadcastRing,
 }
 
 impl core::fmt::Display for PublisherCreateError {
@@ -166,6 +186,20 @@ impl core::error::Error for PublisherCreateError {}
 struct OffsetAndSize {
     offset: u64,
     size: usize,
+    priority: usize,
+}
+
+#[derive(Debug)]
+struct DataArrivalNotifier<Service: service::Service> {
+    notifier: <Service::Event as Event>::Notifier,
+    subscriber_id: u128,
+}
+
+#[derive(Debug)]
+struct BroadcastDelivery<Service: service::Service> {
+    segment: BroadcastRingSegment<Service>,
+    // samples that were overwritten in the ring while a subscriber still had them pinned
+    retired_samples: UnsafeCell<Vec<PinnedElement>>,
 }
 
 #[derive(Debug)]
@@ -174,13 +208,30 @@ pub(crate) struct PublisherSharedState<Service: service::Service> {
     service_state: Arc<ServiceState<Service>>,
 
     pub(crate) sender: Sender<Service>,
-    subscriber_list_state: UnsafeCell<ContainerState<SubscriberDetails>>,
+    subscriber_list_state: UnsafeCell<PortListState<SubscriberDetails>>,
+    data_arrival_notifiers: UnsafeCell<Vec<UnsafeCell<Option<DataArrivalNotifier<Service>>>>>,
+    // the indices of all subscribers that requested a data arrival notification, updated
+    // together with the connections so that a broadcast never visits any other subscriber
+    registered_data_arrival_notifiers: UnsafeCell<Vec<usize>>,
     history: Option<UnsafeCell<Queue<OffsetAndSize>>>,
+    broadcast: Option<BroadcastDelivery<Service>>,
+    number_of_subscribers: IoxAtomicUsize,
+    // the samples suffice for that many subscribers, see
+    // StaticConfig::max_additional_subscribers()
+    max_subscribers: usize,
     is_active: IoxAtomicBool,
 }
 
+fn subscriber_list(dynamic_config: &DynamicConfig) -> &Container<SubscriberDetails> {
+    &dynamic_config.publish_subscribe().subscribers
+}
+
 impl<Service: service::Service> PublisherSharedState<Service> {
-    fn add_sample_to_history(&self, offset: PointerOffset, sample_size: usize) {
+    fn data_arrival_notifiers(&self) -> &Vec<UnsafeCell<Option<DataArrivalNotifier<Service>>>> {
+        unsafe { &*self.data_arrival_notifiers.get() }
+    }
+
+    fn add_sample_to_history(&self, offset: PointerOffset, sample_size: usize, priority: usize) {
         match &self.history {
             None => (),
             Some(history) => {
@@ -189,6 +240,7 @@ impl<Service: service::Service> PublisherSharedState<Service> {
                 match history.push_with_overflow(OffsetAndSize {
                     offset: offset.as_value(),
                     size: sample_size,
+                    priority,
                 }) {
                     None => (),
                     Some(old) => self
@@ -199,18 +251,52 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         }
     }
 
+    fn is_connected(&self, index: usize, port: &SubscriberDetails) -> bool {
+        self.sender.receiver_port_id_of(index) == Some(port.subscriber_id.value())
+    }
+
     fn force_update_connections(&self) -> Result<(), ZeroCopyCreationError> {
         let mut result = Ok(());
+        let subscriber_list_state = unsafe { &*self.subscriber_list_state.get() };
+
+        // the existing connections are kept, new subscribers are connected only as long as the
+        // samples suffice. It protects against concurrent calls of
+        // PortFactory::increase_port_capacity() that exceed the additional subscribers together.
+        let mut number_of_subscribers = 0;
+        subscriber_list_state.for_each(|index, port| {
+            if self.is_connected(index, port) {
+                number_of_subscribers += 1;
+            }
+            CallbackProgression::Continue
+        });
+
         self.sender.start_update_connection_cycle();
-        unsafe {
-            (*self.subscriber_list_state.get()).for_each(|h, port| {
+        subscriber_list_state.for_each(|index, port| {
+                if !self.is_connected(index, port) {
+                    if number_of_subscribers >= self.max_subscribers {
+                        warn!(from self,
+                            "Unable to connect to the subscriber {:?} since the samples of the publisher suffice for at most {} subscribers.",
+                            port.subscriber_id, self.max_subscribers);
+                        return CallbackProgression::Continue;
+                    }
+                    number_of_subscribers += 1;
+                }
+
+                self.update_data_arrival_notifier(index, port);
                 let inner_result = self.sender.update_connection(
-                    h.index() as usize,
+                    index,
                     ReceiverDetails {
                         port_id: port.subscriber_id.value(),
                         buffer_size: port.buffer_size,
+                        group: port.group,
+                        downsampling: port.downsampling,
+                    },
+                    |connection| {
+                        // the history was already shared among the existing group members
+                        if connection.group.is_none() && self.deliver_sample_history(connection) {
+                            self.notify_data_arrival(index);
+                        }
                     },
-                    |connection| self.deliver_sample_history(connection),
                 );
 
                 if result.is_ok() {
@@ -218,23 +304,97 @@ impl<Service: service::Service> PublisherSharedState<Service> {
                 }
 
                 CallbackProgression::Continue
-            })
-        };
+            });
 
         self.sender.finish_update_connection_cycle();
+        self.remove_stale_data_arrival_notifiers();
+        self.update_registered_data_arrival_notifiers();
+        self.number_of_subscribers
+            .store(number_of_subscribers, Ordering::Relaxed);
 
         result
     }
 
+    fn update_data_arrival_notifier(&self, index: usize, port: &SubscriberDetails) {
+        let entry = unsafe { &mut *self.data_arrival_notifiers()[index].get() };
+        if let Some(notifier) = entry {
+            if notifier.subscriber_id == port.subscriber_id.value() {
+                return;
+            }
+        }
+        *entry = None;
+
+        if !port.notify_on_data_arrival {
+            return;
+        }
+
+        let event_name = data_arrival_event_concept_name(&port.subscriber_id);
+        match <Service::Event as Event>::NotifierBuilder::new(&event_name)
+            .config(&event_config::<Service>(
+                self.service_state.shared_node.config(),
+            ))
+            .open()
+        {
+            Ok(notifier) => {
+                *entry = Some(DataArrivalNotifier {
+                    notifier,
+                    subscriber_id: port.subscriber_id.value(),
+                })
+            }
+            Err(e) => {
+                warn!(from self,
+                    "Unable to open the data arrival notification of the subscriber {:?} ({:?}). The subscriber will not be woken up on new samples.",
+                    port.subscriber_id, e);
+            }
+        }
+    }
+
+    fn remove_stale_data_arrival_notifiers(&self) {
+        for (index, entry) in self.data_arrival_notifiers().iter().enumerate() {
+            let entry = unsafe { &mut *entry.get() };
+            if let Some(notifier) = entry {
+                if self.sender.receiver_port_id_of(index) != Some(notifier.subscriber_id) {
+                    *entry = None;
+                }
+            }
+        }
+    }
+
+    fn update_registered_data_arrival_notifiers(&self) {
+        let registered_notifiers = unsafe { &mut *self.registered_data_arrival_notifiers.get() };
+        registered_notifiers.clear();
+        for (index, entry) in self.data_arrival_notifiers().iter().enumerate() {
+            if unsafe { &*entry.get() }.is_some() {
+                registered_notifiers.push(index);
+            }
+        }
+    }
+
+    fn notify_data_arrival(&self, index: usize) {
+        if let Some(notifier) = unsafe { &*self.data_arrival_notifiers()[index].get() } {
+            match notifier.notifier.notify(TriggerId::new(0)) {
+                // the subscriber has still unconsumed notifications and will be woken up
+                Ok(()) | Err(NotifierNotifyError::FailedToDeliverSignal) => (),
+                Err(e) => {
+                    warn!(from self,
+                        "Unable to notify the subscriber {:?} about the data arrival ({:?}).",
+                        notifier.subscriber_id, e);
+                }
+            }
+        }
+    }
+
     fn update_connections(&self) -> Result<(), ConnectionFailure> {
-        if unsafe {
-            self.service_state
-                .dynamic_storage
-                .get()
-                .publish_subscribe()
-                .subscribers
-                .update_state(&mut *self.subscriber_list_state.get())
-        } {
+        let (has_changed, number_of_connections) = {
+            let subscriber_list_state = unsafe { &mut *self.subscriber_list_state.get() };
+            (
+                subscriber_list_state.update(&*self.service_state),
+                subscriber_list_state.capacity(),
+            )
+        };
+
+        if has_changed {
+            self.grow_connections(number_of_connections);
             fail!(from self, when self.force_update_connections(),
                 "Connections were updated only partially since at least one connection to a Subscriber port failed.");
         }
@@ -242,7 +402,23 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         Ok(())
     }
 
-    fn deliver_sample_history(&self, connection: &Connection<Service>) {
+    // the dynamic config was extended with additional subscribers
+    fn grow_connections(&self, number_of_connections: usize) {
+        // SAFETY: called before the connections are updated, no connection is referenced
+        unsafe { self.sender.grow_connections(number_of_connections) };
+
+        let data_arrival_notifiers = unsafe { &mut *self.data_arrival_notifiers.get() };
+        while data_arrival_notifiers.len() < number_of_connections {
+            data_arrival_notifiers.push(UnsafeCell::new(None));
+        }
+    }
+
+    fn deliver_sample_history(&self, connection: &Connection<Service>) -> bool {
+        if !self.sender.has_data_segment_access(connection) {
+            return false;
+        }
+
+        let mut has_delivered_samples = false;
         match &self.history {
             None => (),
             Some(history) => {
@@ -255,12 +431,14 @@ impl<Service: service::Service> PublisherSharedState<Service> {
                     self.sender.retrieve_returned_samples();
 
                     let offset = PointerOffset::from_value(old_sample.offset);
-                    match connection
-                        .sender
-                        .try_send(offset, old_sample.size, ChannelId::new(0))
-                    {
+                    match connection.sender.try_send(
+                        offset,
+                        old_sample.size,
+                        ChannelId::new(old_sample.priority),
+                    ) {
                         Ok(overflow) => {
                             self.sender.borrow_sample(offset);
+                            has_delivered_samples = true;
 
                             if let Some(old) = overflow {
                                 self.sender.release_sample(old);
@@ -273,12 +451,65 @@ impl<Service: service::Service> PublisherSharedState<Service> {
                 }
             }
         }
+
+        has_delivered_samples
+    }
+
+    fn broadcast_key(&self, offset: PointerOffset) -> u64 {
+        let segment_id = offset.segment_id();
+        (segment_id.value() as usize * self.sender.number_of_samples
+            + offset.offset() / self.sender.data_segment.bucket_size(segment_id)) as u64
+    }
+
+    fn release_retired_samples(&self) {
+        if let Some(broadcast) = &self.broadcast {
+            let retired_samples = unsafe { &mut *broadcast.retired_samples.get() };
+            retired_samples.retain(|element| {
+                if broadcast.segment.ring().is_pinned(element.key) {
+                    return true;
+                }
+
+                self.sender
+                    .release_sample(PointerOffset::from_value(element.value));
+                false
+            });
+        }
+    }
+
+    fn broadcast_sample(&self, broadcast: &BroadcastDelivery<Service>, offset: PointerOffset) {
+        self.release_retired_samples();
+
+        let ring = broadcast.segment.ring();
+        self.sender.borrow_sample(offset);
+        // SAFETY: the publisher is the only producer of the ring
+        if let Some(old) = unsafe { ring.push(offset.as_value(), self.broadcast_key(offset)) } {
+            if ring.is_pinned(old.key) {
+                unsafe { &mut *broadcast.retired_samples.get() }.push(old);
+            } else {
+                self.sender
+                    .release_sample(PointerOffset::from_value(old.value));
+            }
+        }
+
+        for index in unsafe { &*self.registered_data_arrival_notifiers.get() } {
+            self.notify_data_arrival(*index);
+        }
+    }
+
+    pub(crate) fn time_to_live(&self) -> Option<Duration> {
+        self.config.time_to_live
+    }
+
+    pub(crate) fn allocate(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
+        self.release_retired_samples();
+        self.sender.allocate(layout)
     }
 
     pub(crate) fn send_sample(
         &self,
         offset: PointerOffset,
         sample_size: usize,
+        priority: usize,
     ) -> Result<usize, SendError> {
         let msg = "Unable to send sample";
         if !self.is_active.load(Ordering::Relaxed) {
@@ -289,12 +520,28 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         fail!(from self, when self.update_connections(),
             "{} since the connections could not be updated.", msg);
 
-        self.add_sample_to_history(offset, sample_size);
-        self.sender
-            .deliver_offset(offset, sample_size, ChannelId::new(0))
+        if let Some(broadcast) = &self.broadcast {
+            self.broadcast_sample(broadcast, offset);
+            return Ok(self.number_of_subscribers.load(Ordering::Relaxed));
+        }
+
+        let priority = priority.min(self.sender.number_of_channels - 1);
+        self.add_sample_to_history(offset, sample_size, priority);
+        self.sender.deliver_offset_and_inform(
+            offset,
+            sample_size,
+            ChannelId::new(priority),
+            |connection_id| self.notify_data_arrival(connection_id),
+        )
     }
 }
 
+struct AdoptedPublisher<Service: service::Service> {
+    publisher_id: UniquePublisherId,
+    handle: ContainerHandle,
+    data_segment: DataSegment<Service>,
+}
+
 /// Sending endpoint of a publish-subscriber based communication.
 #[derive(Debug)]
 pub struct Publisher<
@@ -304,6 +551,8 @@ pub struct Publisher<
 > {
     pub(crate) publisher_shared_state: Arc<PublisherSharedState<Service>>,
     dynamic_publisher_handle: Option<ContainerHandle>,
+    // the segment of the dynamic config in which the publisher is registered
+    dynamic_config_segment: usize,
     _payload: PhantomData<Payload>,
     _user_header: PhantomData<UserHeader>,
 }
@@ -321,8 +570,7 @@ impl<
         if let Some(handle) = self.dynamic_publisher_handle {
             self.publisher_shared_state
                 .service_state
-                .dynamic_storage
-                .get()
+                .dynamic_config_segment(self.dynamic_config_segment)
                 .publish_subscribe()
                 .release_publisher_handle(handle)
         }
@@ -338,17 +586,16 @@ impl<
     pub(crate) fn new(
         service: &Service,
         static_config: &publish_subscribe::StaticConfig,
-        config: LocalPublisherConfig,
+        mut config: LocalPublisherConfig,
     ) -> Result<Self, PublisherCreateError> {
         let msg = "Unable to create Publisher port";
+        config.time_to_live = config.time_to_live.or(static_config.sample_time_to_live);
         let origin = "Publisher::new()";
         let port_id = UniquePublisherId::new();
-        let subscriber_list = &service
-            .__internal_state()
-            .dynamic_storage
-            .get()
-            .publish_subscribe()
-            .subscribers;
+        let subscriber_list_state =
+            PortListState::new(&**service.__internal_state(), subscriber_list);
+        let number_of_connections = subscriber_list_state.capacity();
+        let max_subscribers = static_config.max_subscribers_including_additional_ones();
 
         let number_of_samples = unsafe {
             service
@@ -359,40 +606,101 @@ impl<
         }
         .required_amount_of_samples_per_data_segment(config.max_loaned_samples);
 
-        let data_segment_type =
-            DataSegmentType::new_from_allocation_strategy(config.allocation_strategy);
+        let external_data_segment = config.external_data_segment.take();
+        let data_segment_type = match external_data_segment {
+            Some(_) => DataSegmentType::External,
+            None => DataSegmentType::new_from_allocation_strategy(config.allocation_strategy),
+        };
+
+        if data_segment_type == DataSegmentType::External
+            && (static_config.broadcast_ring_size != 0 || config.warm_restart_key.is_some())
+        {
+            fail!(from origin, with PublisherCreateError::UnableToCreateDataSegment,
+                "{} since an external data segment can neither be combined with a broadcast ring nor with a warm restart key.",
+                msg);
+        }
 
         let sample_layout = static_config
             .message_type_details
             .sample_layout(config.initial_max_slice_len);
 
         let max_slice_len = config.initial_max_slice_len;
-        let max_number_of_segments =
-            DataSegment::<Service>::max_number_of_segments(data_segment_type);
-        let publisher_details = PublisherDetails {
+        let has_overflow_segment = data_segment_type == DataSegmentType::Static
+            && config.overflow_max_slice_len > max_slice_len;
+        let max_number_of_segments = match has_overflow_segment {
+            true => OVERFLOW_SEGMENT_ID.value() + 1,
+            false => DataSegment::<Service>::max_number_of_segments(data_segment_type),
+        };
+        let mut publisher_details = PublisherDetails {
             data_segment_type,
             publisher_id: port_id,
             number_of_samples,
             max_slice_len,
             node_id: *service.__internal_state().shared_node.id(),
             max_number_of_segments,
+            warm_restart_key: config.warm_restart_key,
         };
         let global_config = service.__internal_state().shared_node.config();
 
+        let adopted_publisher = Self::adopt_retained_publisher(
+            service,
+            &publisher_details,
+            sample_layout,
+            !has_overflow_segment && static_config.broadcast_ring_size == 0,
+        );
+        if let Some(ref adopted_publisher) = adopted_publisher {
+            publisher_details.publisher_id = adopted_publisher.publisher_id;
+        }
+        let port_id = publisher_details.publisher_id;
+
         let segment_name = data_segment_name(publisher_details.publisher_id.value());
-        let data_segment = match data_segment_type {
-            DataSegmentType::Static => DataSegment::create_static_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_samples,
+        let (dynamic_publisher_handle, data_segment) = match adopted_publisher {
+            Some(adopted_publisher) => (
+                Some(adopted_publisher.handle),
+                Ok(adopted_publisher
+                    .data_segment
+                    .with_chunk_cache(config.chunk_cache_size)),
             ),
-            DataSegmentType::Dynamic => DataSegment::create_dynamic_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_samples,
-                config.allocation_strategy,
+            None => (
+                None,
+                match external_data_segment {
+                    Some(file_descriptor) => DataSegment::create_external_segment(
+                        &segment_name,
+                        file_descriptor,
+                        sample_layout,
+                        global_config,
+                        number_of_samples,
+                    ),
+                    None => match data_segment_type {
+                        DataSegmentType::Static => DataSegment::create_static_segment(
+                            &segment_name,
+                            sample_layout,
+                            global_config,
+                            number_of_samples,
+                        )
+                        .map(|segment| match has_overflow_segment {
+                            true => segment.with_overflow_segment(
+                                &overflow_data_segment_name(&segment_name),
+                                static_config
+                                    .message_type_details
+                                    .sample_layout(config.overflow_max_slice_len),
+                                global_config,
+                                config
+                                    .overflow_number_of_samples
+                                    .clamp(1, number_of_samples),
+                            ),
+                            false => segment,
+                        })
+                        .map(|segment| segment.with_chunk_cache(config.chunk_cache_size)),
+                        _ => DataSegment::create_dynamic_segment(
+                            &segment_name,
+                            sample_layout,
+                            global_config,
+                            number_of_samples,
+                            config.allocation_strategy,
+                        ),
+                    },
+                },
             ),
         };
 
@@ -401,6 +709,28 @@ impl<
                 with PublisherCreateError::UnableToCreateDataSegment,
                 "{} since the data segment could not be acquired.", msg);
 
+        let broadcast = match static_config.broadcast_ring_size {
+            0 => None,
+            broadcast_ring_size => {
+                let segment = fail!(from origin,
+                    when BroadcastRingSegment::create(
+                        &broadcast_ring_name(&segment_name),
+                        broadcast_ring_size,
+                        max_number_of_segments as usize * number_of_samples,
+                        max_subscribers,
+                        global_config),
+                    with PublisherCreateError::UnableToCreateBroadcastRing,
+                    "{} since the broadcast ring could not be created.", msg);
+
+                Some(BroadcastDelivery {
+                    segment,
+                    retired_samples: UnsafeCell::new(Vec::with_capacity(
+                        max_subscribers * static_config.subscriber_max_borrowed_samples,
+                    )),
+                })
+            }
+        };
+
         let publisher_shared_state = Arc::new(PublisherSharedState {
             is_active: IoxAtomicBool::new(true),
             service_state: service.__internal_state().clone(),
@@ -414,9 +744,11 @@ impl<
                     }
                     v
                 },
-                connections: (0..subscriber_list.capacity())
-                    .map(|_| UnsafeCell::new(None))
-                    .collect(),
+                connections: UnsafeCell::new(
+                    (0..number_of_connections)
+                        .map(|_| UnsafeCell::new(None))
+                        .collect(),
+                ),
                 sender_port_id: port_id.value(),
                 shared_node: service.__internal_state().shared_node.clone(),
                 receiver_max_buffer_size: static_config.subscriber_max_buffer_size,
@@ -428,22 +760,36 @@ impl<
                 service_state: service.__internal_state().clone(),
                 tagger: CyclicTagger::new(),
                 loan_counter: IoxAtomicUsize::new(0),
+                group_cursor: IoxAtomicUsize::new(0),
+                group_members: UnsafeCell::new(Vec::new()),
                 sender_max_borrowed_samples: config.max_loaned_samples,
                 unable_to_deliver_strategy: config.unable_to_deliver_strategy,
                 message_type_details: static_config.message_type_details.clone(),
-                number_of_channels: 1,
+                number_of_channels: static_config.number_of_priority_lanes,
             },
             config,
-            subscriber_list_state: UnsafeCell::new(unsafe { subscriber_list.get_state() }),
-            history: match static_config.history_size == 0 {
+            subscriber_list_state: UnsafeCell::new(subscriber_list_state),
+            data_arrival_notifiers: UnsafeCell::new(
+                (0..number_of_connections)
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
+            registered_data_arrival_notifiers: UnsafeCell::new(Vec::new()),
+            // the broadcast ring contains the history, new subscribers start reading it with
+            // the oldest sample of their history
+            history: match static_config.history_size == 0 || broadcast.is_some() {
                 true => None,
                 false => Some(UnsafeCell::new(Queue::new(static_config.history_size))),
             },
+            broadcast,
+            number_of_subscribers: IoxAtomicUsize::new(0),
+            max_subscribers,
         });
 
         let mut new_self = Self {
             publisher_shared_state,
             dynamic_publisher_handle: None,
+            dynamic_config_segment: 0,
             _payload: PhantomData,
             _user_header: PhantomData,
         };
@@ -452,28 +798,179 @@ impl<
             warn!(from new_self, "The new Publisher port is unable to connect to every Subscriber port, caused by {:?}.", e);
         }
 
+        // an adopted publisher is already registered and owns the chunks its predecessor
+        // delivered
+        if let Some(dynamic_publisher_handle) = dynamic_publisher_handle {
+            let publisher_shared_state = &new_self.publisher_shared_state;
+            publisher_shared_state.sender.adopt_used_chunks(
+                publisher_shared_state
+                    .number_of_subscribers
+                    .load(Ordering::Relaxed),
+            );
+            new_self.dynamic_publisher_handle = Some(dynamic_publisher_handle);
+            return Ok(new_self);
+        }
+
         core::sync::atomic::compiler_fence(Ordering::SeqCst);
 
         // !MUST! be the last task otherwise a publisher is added to the dynamic config without the
         // creation of all required resources
-        let dynamic_publisher_handle = match service
+        let service_state = service.__internal_state();
+        let number_of_segments = service_state.number_of_dynamic_config_segments();
+        for n in 0..number_of_segments {
+            // only the publishers of the primary segment are retained for a warm restart
+            let details = match n {
+                0 => publisher_details,
+                _ => PublisherDetails {
+                    warm_restart_key: None,
+                    ..publisher_details
+                },
+            };
+
+            if let Some(handle) = service_state
+                .dynamic_config_segment(n)
+                .publish_subscribe()
+                .add_publisher_id(details)
+            {
+                new_self.dynamic_publisher_handle = Some(handle);
+                new_self.dynamic_config_segment = n;
+                break;
+            }
+        }
+
+        if new_self.dynamic_publisher_handle.is_none() {
+            fail!(from origin, with PublisherCreateError::ExceedsMaxSupportedPublishers,
+                "{} since it would exceed the maximum supported amount of publishers of all {} dynamic config segments.",
+                msg, number_of_segments);
+        }
+
+        Ok(new_self)
+    }
+
+    /// Looks for a publisher with the same warm restart key whose node died and takes over its
+    /// registration and data segment. An incompatible predecessor is removed together with its
+    /// resources. Returns [`None`] when the [`Publisher`] has to start with fresh resources.
+    fn adopt_retained_publisher(
+        service: &Service,
+        publisher_details: &PublisherDetails,
+        chunk_layout: Layout,
+        is_adoptable: bool,
+    ) -> Option<AdoptedPublisher<Service>> {
+        let origin = "Publisher::adopt_retained_publisher()";
+        let key = publisher_details.warm_restart_key?;
+        let dynamic_config = service
             .__internal_state()
             .dynamic_storage
             .get()
-            .publish_subscribe()
-            .add_publisher_id(publisher_details)
-        {
-            Some(unique_index) => unique_index,
+            .publish_subscribe();
+        let global_config = service.__internal_state().shared_node.config();
+
+        let state = dynamic_config.publisher_state();
+        let mut predecessor = None;
+        state.for_each(|handle, details| {
+            if details.warm_restart_key == Some(key)
+                && matches!(
+                    NodeState::<Service>::new(&details.node_id, global_config),
+                    Ok(None) | Ok(Some(NodeState::Dead(_)))
+                )
+            {
+                predecessor = Some((handle, *details));
+                return CallbackProgression::Stop;
+            }
+            CallbackProgression::Continue
+        });
+        let (predecessor_handle, predecessor) = predecessor?;
+        let predecessor_id = predecessor.publisher_id;
+
+        let is_compatible = is_adoptable
+            && predecessor.data_segment_type == DataSegmentType::Static
+            && publisher_details.data_segment_type == DataSegmentType::Static
+            && predecessor.number_of_samples == publisher_details.number_of_samples
+            && predecessor.max_slice_len == publisher_details.max_slice_len
+            && predecessor.max_number_of_segments == publisher_details.max_number_of_segments;
+
+        if !is_compatible {
+            if dynamic_config.claim_retained_publisher(predecessor_handle, &state) {
+                warn!(from origin,
+                    "The retained publisher {:?} with the warm restart key {} has an incompatible configuration and is removed.",
+                    predecessor_id, key);
+                unsafe {
+                    remove_retained_publisher::<Service>(predecessor_id.value(), global_config)
+                };
+            }
+            return None;
+        }
+
+        // the successor is registered before the predecessor is removed so that the subscribers
+        // always see the port and move their connection instead of discarding it
+        let successor = PublisherDetails {
+            publisher_id: predecessor_id,
+            ..*publisher_details
+        };
+        let handle = match dynamic_config.add_publisher_id(successor) {
+            Some(handle) => {
+                if !dynamic_config.claim_retained_publisher(predecessor_handle, &state) {
+                    dynamic_config.release_publisher_handle(handle);
+                    return None;
+                }
+                handle
+            }
             None => {
-                fail!(from origin, with PublisherCreateError::ExceedsMaxSupportedPublishers,
-                            "{} since it would exceed the maximum supported amount of publishers of {}.",
-                            msg, service.__internal_state().static_config.publish_subscribe().max_publishers);
+                if !dynamic_config.claim_retained_publisher(predecessor_handle, &state) {
+                    return None;
+                }
+
+                match dynamic_config.add_publisher_id(successor) {
+                    Some(handle) => handle,
+                    None => {
+                        unsafe {
+                            remove_retained_publisher::<Service>(
+                                predecessor_id.value(),
+                                global_config,
+                            )
+                        };
+                        return None;
+                    }
+                }
             }
         };
 
-        new_self.dynamic_publisher_handle = Some(dynamic_publisher_handle);
+        let data_segment = match unsafe {
+            remove_sender_port_from_all_connections::<Service>(
+                predecessor_id.value(),
+                global_config,
+            )
+        } {
+            Ok(()) => DataSegment::adopt_static_segment(
+                &data_segment_name(predecessor_id.value()),
+                chunk_layout,
+                global_config,
+            )
+            .ok(),
+            Err(_) => None,
+        };
 
-        Ok(new_self)
+        match data_segment {
+            Some(data_segment) => {
+                debug!(from origin, "Adopted the retained publisher {:?} with the warm restart key {}.",
+                    predecessor_id, key);
+                Some(AdoptedPublisher {
+                    publisher_id: predecessor_id,
+                    handle,
+                    data_segment,
+                })
+            }
+            None => {
+                warn!(from origin,
+                    "Unable to adopt the resources of the retained publisher {:?} with the warm restart key {}, starting with new resources.",
+                    predecessor_id, key);
+                dynamic_config.release_publisher_handle(handle);
+                unsafe {
+                    remove_retained_publisher::<Service>(predecessor_id.value(), global_config)
+                };
+                None
+            }
+        }
     }
 
     /// Returns the [`UniquePublisherId`] of the [`Publisher`]
@@ -490,6 +987,27 @@ impl<
             .sender
             .unable_to_deliver_strategy
     }
+
+    /// Returns the [`MemoryUsage`] of the [`Publisher`]. The used bytes of the data segments
+    /// are the bytes of all samples that are currently loaned or not yet released
+    /// by all [`Subscriber`](crate::port::subscriber::Subscriber)s.
+    pub fn memory_usage(&self) -> MemoryUsage {
+        self.publisher_shared_state.sender.memory_usage()
+    }
+
+    /// Returns the physical memory of all data segment chunks that are currently neither
+    /// loaned nor held by any [`Subscriber`](crate::port::subscriber::Subscriber) to the
+    /// operating system and shrinks a dynamic data segment back to its initial size when
+    /// it was enlarged and is unused. The address space stays mapped and released memory is
+    /// provided again, zero-filled, on its next use. Intended to be called after a burst, so
+    /// that a long-running [`Publisher`] does not keep its peak memory resident.
+    /// Growing and shrinking the dynamic data segment each consume one of its limited
+    /// reallocations. Once only a reserve of reallocations is left, the segment keeps its
+    /// enlarged size so that it can still grow, and only unused pages are released.
+    /// Returns the number of released bytes.
+    pub fn release_unused_memory(&self) -> usize {
+        self.publisher_shared_state.sender.release_unused_memory()
+    }
 }
 
 ////////////////////////
@@ -563,7 +1081,6 @@ impl<
     ) -> Result<SampleMutUninit<Service, MaybeUninit<Payload>, UserHeader>, LoanError> {
         let chunk = self
             .publisher_shared_state
-            .sender
             .allocate(self.publisher_shared_state.sender.sample_layout(1))?;
         let header_ptr = chunk.header as *mut Header;
         unsafe { header_ptr.write(Header::new(self.id(), 1)) };
@@ -725,17 +1242,24 @@ impl<
         slice_len: usize,
         underlying_number_of_slice_elements: usize,
     ) -> Result<SampleMutUninit<Service, [MaybeUninit<Payload>], UserHeader>, LoanError> {
-        let max_slice_len = self.publisher_shared_state.config.initial_max_slice_len;
-        if self.publisher_shared_state.config.allocation_strategy == AllocationStrategy::Static
-            && max_slice_len < slice_len
+        let config = &self.publisher_shared_state.config;
+        let max_slice_len = match self
+            .publisher_shared_state
+            .sender
+            .data_segment
+            .has_overflow_segment()
         {
+            true => config.overflow_max_slice_len,
+            false => config.initial_max_slice_len,
+        };
+        if config.allocation_strategy == AllocationStrategy::Static && max_slice_len < slice_len {
             fail!(from self, with LoanError::ExceedsMaxLoanSize,
                 "Unable to loan slice with {} elements since it would exceed the max supported slice length of {}.",
                 slice_len, max_slice_len);
         }
 
         let sample_layout = self.publisher_shared_state.sender.sample_layout(slice_len);
-        let chunk = self.publisher_shared_state.sender.allocate(sample_layout)?;
+        let chunk = self.publisher_shared_state.allocate(sample_layout)?;
         let header_ptr = chunk.header as *mut Header;
         unsafe { header_ptr.write(Header::new(self.id(), slice_len as _)) };
 
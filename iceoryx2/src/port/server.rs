@@ -81,7 +81,7 @@ use core::{fmt::Debug, marker::PhantomData};
 use iceoryx2_bb_container::vec::Vec;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_cal::zero_copy_connection::ChannelId;
-use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
+use iceoryx2_pal_concurrency_sync::iox_atomic::{IoxAtomicU64, IoxAtomicUsize};
 
 use iceoryx2_bb_elementary::{cyclic_tagger::CyclicTagger, CallbackProgression};
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
@@ -188,6 +188,8 @@ impl<Service: service::Service> SharedServerState<Service> {
                     ReceiverDetails {
                         port_id: details.client_id.value(),
                         buffer_size: details.response_buffer_size,
+                        group: None,
+                        downsampling: None,
                     },
                     |_| {},
                 );
@@ -278,7 +280,11 @@ impl<
             .clients;
 
         let request_receiver = Receiver {
-            connections: Vec::from_fn(client_list.capacity(), |_| UnsafeCell::new(None)),
+            connections: UnsafeCell::new(
+                (0..client_list.capacity())
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
             receiver_port_id: server_id.value(),
             service_state: service.__internal_state().clone(),
             message_type_details: static_config.request_message_type_details.clone(),
@@ -301,6 +307,8 @@ impl<
             },
             degradation_callback: server_factory.request_degradation_callback,
             number_of_channels: 1,
+            broadcast: None,
+            missed_samples: IoxAtomicU64::new(0),
         };
 
         let global_config = service.__internal_state().shared_node.config();
@@ -320,13 +328,15 @@ impl<
                 global_config,
                 number_of_responses,
             ),
-            DataSegmentType::Dynamic => DataSegment::<Service>::create_dynamic_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_responses,
-                server_factory.config.allocation_strategy,
-            ),
+            DataSegmentType::Dynamic | DataSegmentType::External => {
+                DataSegment::<Service>::create_dynamic_segment(
+                    &segment_name,
+                    sample_layout,
+                    global_config,
+                    number_of_responses,
+                    server_factory.config.allocation_strategy,
+                )
+            }
         };
 
         let data_segment = fail!(from origin,
@@ -344,9 +354,11 @@ impl<
                 v
             },
             data_segment,
-            connections: (0..client_list.capacity())
-                .map(|_| UnsafeCell::new(None))
-                .collect(),
+            connections: UnsafeCell::new(
+                (0..client_list.capacity())
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
             sender_port_id: server_id.value(),
             shared_node: service.__internal_state().shared_node.clone(),
             receiver_max_buffer_size: static_config.max_response_buffer_size,
@@ -362,6 +374,8 @@ impl<
             service_state: service.__internal_state().clone(),
             tagger: CyclicTagger::new(),
             loan_counter: IoxAtomicUsize::new(0),
+            group_cursor: IoxAtomicUsize::new(0),
+            group_members: UnsafeCell::new(Vec::new()),
             unable_to_deliver_strategy: server_factory.config.unable_to_deliver_strategy,
             message_type_details: static_config.response_message_type_details.clone(),
             number_of_channels: number_of_requests_per_client,
@@ -43,22 +43,35 @@ use iceoryx2_bb_container::vec::Vec;
 use iceoryx2_bb_elementary::cyclic_tagger::CyclicTagger;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
-use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
-use iceoryx2_bb_log::{fail, warn};
+use iceoryx2_bb_lock_free::mpmc::container::{Container, ContainerHandle};
+use iceoryx2_bb_log::{fail, fatal_panic, warn};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_posix::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
-use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::event::{Event, ListenerBuilder, NamedConceptMgmt};
+use iceoryx2_cal::named_concept::{NamedConceptBuilder, NamedConceptRemoveError};
 use iceoryx2_cal::zero_copy_connection::ChannelId;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicU64;
 
+use crate::config::Config;
 use crate::service::builder::CustomPayloadMarker;
+use crate::service::config_scheme::event_config;
 use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, SubscriberDetails};
+use crate::service::dynamic_config::DynamicConfig;
 use crate::service::header::publish_subscribe::Header;
+use crate::service::memory_usage::MemoryUsage;
+use crate::service::naming_scheme::data_arrival_event_concept_name;
 use crate::service::port_factory::subscriber::SubscriberConfig;
 use crate::service::static_config::publish_subscribe::StaticConfig;
 use crate::{raw_sample::RawSample, sample::Sample, service};
 
 use super::details::chunk::Chunk;
 use super::details::chunk_details::ChunkDetails;
+use super::details::conflation_buffer::ConflationBuffer;
+use super::details::port_list_state::PortListState;
 use super::details::receiver::*;
+use super::downsampling::Downsampling;
 use super::port_identifiers::UniqueSubscriberId;
 use super::update_connections::ConnectionFailure;
 use super::ReceiveError;
@@ -75,6 +88,25 @@ pub enum SubscriberCreateError {
     /// When the [`Subscriber`] requires a larger buffer size than the
     /// [`Service`](crate::service::Service) offers the creation will fail.
     BufferSizeExceedsMaxSupportedBufferSizeOfService,
+    /// The [`Subscriber`] was configured to be notified on data arrival but the underlying
+    /// event resource could not be created.
+    UnableToCreateDataArrivalNotification,
+    /// The [`Subscriber`] was configured as member of a group but the
+    /// [`Service`](crate::service::Service) delivers every sample via its broadcast ring to all
+    /// [`Subscriber`]s.
+    GroupsNotSupportedByDeliveryMode,
+    /// The [`Subscriber`] requested a
+    /// [`Downsampling`](crate::port::downsampling::Downsampling) policy but it is a member of a
+    /// group or the [`Service`](crate::service::Service) delivers every sample via its broadcast
+    /// ring to all [`Subscriber`]s.
+    DownsamplingNotSupportedByDeliveryMode,
+    /// The conflation key is not located completely inside the user header of the
+    /// [`Service`](crate::service::Service).
+    InvalidConflationKeyOffset,
+    /// The conflation capacity exceeds the maximum number of samples a [`Subscriber`] can
+    /// borrow from the [`Service`](crate::service::Service). The stored samples are borrowed,
+    /// therefore the [`Subscriber`] would stop draining its buffer before all keys are stored.
+    ConflationCapacityExceedsMaxBorrowedSamples,
 }
 
 impl core::fmt::Display for SubscriberCreateError {
@@ -93,13 +125,24 @@ pub struct Subscriber<
     UserHeader: Debug + ZeroCopySend,
 > {
     dynamic_subscriber_handle: Option<ContainerHandle>,
+    // the segment of the dynamic config in which the subscriber is registered
+    dynamic_config_segment: usize,
     receiver: Receiver<Service>,
+    data_arrival_listener: Option<<Service::Event as Event>::Listener>,
+    group: Option<u64>,
+    downsampling: Option<Downsampling>,
+    expired_samples: IoxAtomicU64,
+    conflation_buffer: Option<ConflationBuffer<Service>>,
 
-    publisher_list_state: UnsafeCell<ContainerState<PublisherDetails>>,
+    publisher_list_state: UnsafeCell<PortListState<PublisherDetails>>,
     _payload: PhantomData<Payload>,
     _user_header: PhantomData<UserHeader>,
 }
 
+fn publisher_list(dynamic_config: &DynamicConfig) -> &Container<PublisherDetails> {
+    &dynamic_config.publish_subscribe().publishers
+}
+
 impl<
         Service: service::Service,
         Payload: Debug + ZeroCopySend + ?Sized,
@@ -110,14 +153,45 @@ impl<
         if let Some(handle) = self.dynamic_subscriber_handle {
             self.receiver
                 .service_state
-                .dynamic_storage
-                .get()
+                .dynamic_config_segment(self.dynamic_config_segment)
                 .publish_subscribe()
                 .release_subscriber_handle(handle)
         }
     }
 }
 
+impl<
+        Service: service::Service,
+        Payload: Debug + ZeroCopySend + ?Sized,
+        UserHeader: Debug + ZeroCopySend,
+    > FileDescriptorBased for Subscriber<Service, Payload, UserHeader>
+where
+    <Service::Event as Event>::Listener: FileDescriptorBased,
+{
+    fn file_descriptor(&self) -> &FileDescriptor {
+        match &self.data_arrival_listener {
+            Some(listener) => listener.file_descriptor(),
+            None => {
+                fatal_panic!(from self,
+                    "The subscriber is only file descriptor based when it was created with \"notify_on_data_arrival\" enabled.");
+            }
+        }
+    }
+}
+
+impl<
+        Service: service::Service,
+        Payload: Debug + ZeroCopySend + ?Sized,
+        UserHeader: Debug + ZeroCopySend,
+    > SynchronousMultiplexing for Subscriber<Service, Payload, UserHeader>
+where
+    <Service::Event as Event>::Listener: SynchronousMultiplexing,
+{
+    fn is_multiplexable(&self) -> bool {
+        self.data_arrival_listener.is_some()
+    }
+}
+
 impl<
         Service: service::Service,
         Payload: Debug + ZeroCopySend + ?Sized,
@@ -133,12 +207,8 @@ impl<
         let origin = "Subscriber::new()";
         let subscriber_id = UniqueSubscriberId::new();
 
-        let publisher_list = &service
-            .__internal_state()
-            .dynamic_storage
-            .get()
-            .publish_subscribe()
-            .publishers;
+        let publisher_list_state =
+            PortListState::new(&**service.__internal_state(), publisher_list);
 
         let buffer_size = match config.buffer_size {
             Some(buffer_size) => {
@@ -152,8 +222,55 @@ impl<
             None => static_config.subscriber_max_buffer_size,
         };
 
+        if config.group.is_some() && static_config.broadcast_ring_size != 0 {
+            fail!(from origin, with SubscriberCreateError::GroupsNotSupportedByDeliveryMode,
+                "{} since the subscriber shall be a member of the group {:?} but the service delivers every sample via a broadcast ring.",
+                msg, config.group);
+        }
+
+        if config.downsampling.is_some()
+            && (config.group.is_some() || static_config.broadcast_ring_size != 0)
+        {
+            fail!(from origin, with SubscriberCreateError::DownsamplingNotSupportedByDeliveryMode,
+                "{} since the subscriber requests the downsampling {:?} but it is a member of the group {:?} or the service delivers every sample via a broadcast ring.",
+                msg, config.downsampling, config.group);
+        }
+
+        if let Some(conflation) = &config.conflation {
+            let user_header_size = static_config.message_type_details.user_header.size;
+            if user_header_size < conflation.required_user_header_size {
+                fail!(from origin, with SubscriberCreateError::InvalidConflationKeyOffset,
+                    "{} since the conflation key requires a user header of at least {} bytes but the user header of the service has only {} bytes.",
+                    msg, conflation.required_user_header_size, user_header_size);
+            }
+
+            if static_config.subscriber_max_borrowed_samples < conflation.capacity {
+                fail!(from origin, with SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples,
+                    "{} since the conflation capacity of {} keys exceeds the {} samples a subscriber can borrow.",
+                    msg, conflation.capacity, static_config.subscriber_max_borrowed_samples);
+            }
+        }
+
+        let data_arrival_listener = if config.notify_on_data_arrival {
+            let event_name = data_arrival_event_concept_name(&subscriber_id);
+            let event_config =
+                event_config::<Service>(service.__internal_state().shared_node.config());
+            Some(fail!(from origin,
+                    when <Service::Event as Event>::ListenerBuilder::new(&event_name)
+                            .config(&event_config)
+                            .create(),
+                    with SubscriberCreateError::UnableToCreateDataArrivalNotification,
+                    "{} since the underlying data arrival event concept \"{}\" could not be created.", msg, event_name))
+        } else {
+            None
+        };
+
         let receiver = Receiver {
-            connections: Vec::from_fn(publisher_list.capacity(), |_| UnsafeCell::new(None)),
+            connections: UnsafeCell::new(
+                (0..publisher_list_state.capacity())
+                    .map(|_| UnsafeCell::new(None))
+                    .collect(),
+            ),
             receiver_port_id: subscriber_id.value(),
             service_state: service.__internal_state().clone(),
             message_type_details: static_config.message_type_details.clone(),
@@ -171,13 +288,35 @@ impl<
                     .subscriber_expired_connection_buffer,
             ))),
             degradation_callback: config.degradation_callback,
-            number_of_channels: 1,
+            number_of_channels: static_config.number_of_priority_lanes,
+            broadcast: match static_config.broadcast_ring_size {
+                0 => None,
+                _ => {
+                    let mut pre_existing_senders = alloc::vec::Vec::new();
+                    publisher_list_state.for_each(|_, details| {
+                        pre_existing_senders.push(details.publisher_id.value());
+                        CallbackProgression::Continue
+                    });
+
+                    Some(BroadcastSettings {
+                        history_size: static_config.history_size.min(buffer_size),
+                        pre_existing_senders,
+                    })
+                }
+            },
+            missed_samples: IoxAtomicU64::new(0),
         };
 
         let mut new_self = Self {
             receiver,
-            publisher_list_state: UnsafeCell::new(unsafe { publisher_list.get_state() }),
+            data_arrival_listener,
+            group: config.group,
+            downsampling: config.downsampling,
+            expired_samples: IoxAtomicU64::new(0),
+            conflation_buffer: config.conflation.map(ConflationBuffer::new),
+            publisher_list_state: UnsafeCell::new(publisher_list_state),
             dynamic_subscriber_handle: None,
+            dynamic_config_segment: 0,
             _payload: PhantomData,
             _user_header: PhantomData,
         };
@@ -190,25 +329,34 @@ impl<
 
         // !MUST! be the last task otherwise a subscriber is added to the dynamic config without
         // the creation of all required channels
-        let dynamic_subscriber_handle = match service
-            .__internal_state()
-            .dynamic_storage
-            .get()
-            .publish_subscribe()
-            .add_subscriber_id(SubscriberDetails {
-                subscriber_id,
-                buffer_size,
-                node_id: *service.__internal_state().shared_node.id(),
-            }) {
-            Some(unique_index) => unique_index,
-            None => {
-                fail!(from new_self, with SubscriberCreateError::ExceedsMaxSupportedSubscribers,
-                                "{} since it would exceed the maximum supported amount of subscribers of {}.",
-                                msg, service.__internal_state().static_config.publish_subscribe().max_subscribers);
-            }
+        let subscriber_details = SubscriberDetails {
+            subscriber_id,
+            buffer_size,
+            node_id: *service.__internal_state().shared_node.id(),
+            notify_on_data_arrival: config.notify_on_data_arrival,
+            group: config.group,
+            downsampling: config.downsampling,
         };
 
-        new_self.dynamic_subscriber_handle = Some(dynamic_subscriber_handle);
+        let service_state = service.__internal_state();
+        let number_of_segments = service_state.number_of_dynamic_config_segments();
+        for n in 0..number_of_segments {
+            if let Some(handle) = service_state
+                .dynamic_config_segment(n)
+                .publish_subscribe()
+                .add_subscriber_id(subscriber_details)
+            {
+                new_self.dynamic_subscriber_handle = Some(handle);
+                new_self.dynamic_config_segment = n;
+                break;
+            }
+        }
+
+        if new_self.dynamic_subscriber_handle.is_none() {
+            fail!(from new_self, with SubscriberCreateError::ExceedsMaxSupportedSubscribers,
+                "{} since it would exceed the maximum supported amount of subscribers of all {} dynamic config segments.",
+                msg, number_of_segments);
+        }
 
         Ok(new_self)
     }
@@ -218,9 +366,9 @@ impl<
 
         let mut result = Ok(());
         unsafe {
-            (*self.publisher_list_state.get()).for_each(|h, details| {
+            (*self.publisher_list_state.get()).for_each(|index, details| {
                 let inner_result = self.receiver.update_connection(
-                    h.index() as usize,
+                    index,
                     SenderDetails {
                         port_id: details.publisher_id.value(),
                         number_of_samples: details.number_of_samples,
@@ -246,35 +394,179 @@ impl<
         UniqueSubscriberId(UniqueSystemId::from(self.receiver.receiver_port_id()))
     }
 
+    /// Returns the [`MemoryUsage`] of the [`Subscriber`]. It contains the data segments of all
+    /// connected [`Publisher`](crate::port::publisher::Publisher)s the [`Subscriber`] has
+    /// mapped and the receiving side of all connections.
+    pub fn memory_usage(&self) -> MemoryUsage {
+        self.receiver.memory_usage()
+    }
+
     /// Returns the internal buffer size of the [`Subscriber`].
     pub fn buffer_size(&self) -> usize {
         self.receiver.buffer_size
     }
 
+    /// Returns the number of samples the [`Subscriber`] missed since they were overwritten in
+    /// the broadcast ring of a [`Publisher`](crate::port::publisher::Publisher) before they
+    /// were received. Only a [`Service`](crate::service::Service) with a
+    /// [`broadcast_ring_size()`](crate::service::builder::publish_subscribe::Builder::broadcast_ring_size())
+    /// can lose samples this way, otherwise it is always 0.
+    pub fn missed_samples(&self) -> u64 {
+        self.receiver.missed_samples()
+    }
+
+    /// Returns the number of samples the [`Subscriber`] discarded while receiving since their
+    /// time to live had expired, see
+    /// [`sample_time_to_live()`](crate::service::builder::publish_subscribe::Builder::sample_time_to_live()).
+    pub fn expired_samples(&self) -> u64 {
+        self.expired_samples.load(Ordering::Relaxed)
+    }
+
+    /// Returns the group of competing consumers the [`Subscriber`] is a member of, see
+    /// [`PortFactorySubscriber::group()`](crate::service::port_factory::subscriber::PortFactorySubscriber::group()).
+    pub fn group(&self) -> Option<u64> {
+        self.group
+    }
+
+    /// Returns the [`Downsampling`] policy the [`Publisher`](crate::port::publisher::Publisher)s
+    /// apply when delivering to the [`Subscriber`], see
+    /// [`PortFactorySubscriber::downsampling()`](crate::service::port_factory::subscriber::PortFactorySubscriber::downsampling()).
+    pub fn downsampling(&self) -> Option<Downsampling> {
+        self.downsampling
+    }
+
+    /// Returns true if the [`Subscriber`] was created with
+    /// [`PortFactorySubscriber::notify_on_data_arrival()`](crate::service::port_factory::subscriber::PortFactorySubscriber::notify_on_data_arrival())
+    /// enabled. Only then it can be attached to a [`WaitSet`](crate::waitset::WaitSet).
+    pub fn has_data_arrival_notification(&self) -> bool {
+        self.data_arrival_listener.is_some()
+    }
+
     /// Returns true if the [`Subscriber`] has samples in the buffer that can be received with [`Subscriber::receive`].
     pub fn has_samples(&self) -> Result<bool, ConnectionFailure> {
         fail!(from self, when self.update_connections(),
                 "Some samples are not being received since not all connections to publishers could be established.");
-        Ok(self.receiver.has_samples(ChannelId::new(0)))
+        let has_conflated_samples = self
+            .conflation_buffer
+            .as_ref()
+            .is_some_and(|conflation_buffer| !conflation_buffer.is_empty());
+        Ok(has_conflated_samples
+            || (0..self.receiver.number_of_channels)
+                .any(|lane| self.receiver.has_samples(ChannelId::new(lane))))
     }
 
     fn receive_impl(&self) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
         fail!(from self, when self.update_connections(),
                 "Some samples are not being received since not all connections to publishers could be established.");
 
-        self.receiver.receive(ChannelId::new(0))
+        match &self.conflation_buffer {
+            None => self.receive_from_buffer(),
+            Some(conflation_buffer) => self.receive_conflated(conflation_buffer),
+        }
+    }
+
+    fn receive_conflated(
+        &self,
+        conflation_buffer: &ConflationBuffer<Service>,
+    ) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        // drains the buffer so that superseded samples are released before the oldest key is
+        // handed out, the drain stops when the borrow limit is reached
+        loop {
+            match self.receive_from_buffer() {
+                Ok(Some((details, chunk))) => conflation_buffer.push(details, chunk),
+                Ok(None) => break,
+                Err(ReceiveError::ExceedsMaxBorrows) if !conflation_buffer.is_empty() => break,
+                Err(e) => return Err(e),
+            }
+        }
+
+        Ok(conflation_buffer.pop())
+    }
+
+    fn receive_from_buffer(&self) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        let sample = self.receive_unexpired()?;
+        match &self.data_arrival_listener {
+            Some(listener) if sample.is_none() => {
+                // The notifications are consumed only when the buffer is drained. The buffer is
+                // checked again afterwards so that a sample which arrived in between is not
+                // missed since its notification was consumed as well.
+                use iceoryx2_cal::event::Listener;
+                if let Err(e) = listener.try_wait_all(|_| {}) {
+                    warn!(from self, "Unable to consume the data arrival notifications ({:?}).", e);
+                }
+                self.receive_unexpired()
+            }
+            _ => Ok(sample),
+        }
+    }
+
+    fn receive_unexpired(&self) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        // the clock is read only once per call and only when a sample with expiration time
+        // arrives, all expired samples are released without creating a sample for them
+        let mut now = None;
+        loop {
+            let (details, chunk) = match self.receive_from_highest_lane()? {
+                Some(sample) => sample,
+                None => return Ok(None),
+            };
+
+            let header = unsafe { &*(chunk.header as *const Header) };
+            if header.expiration_time().is_none() {
+                return Ok(Some((details, chunk)));
+            }
+
+            let current_time = match now {
+                Some(time) => time,
+                None => match Time::now_with_clock(ClockType::Monotonic) {
+                    Ok(time) => time.as_duration(),
+                    Err(e) => {
+                        warn!(from self, "Unable to discard expired samples since the current time could not be acquired ({:?}).", e);
+                        return Ok(Some((details, chunk)));
+                    }
+                },
+            };
+            now = Some(current_time);
+
+            if !header.has_expired(current_time) {
+                return Ok(Some((details, chunk)));
+            }
+
+            details.release();
+            self.expired_samples.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+
+    fn receive_from_highest_lane(
+        &self,
+    ) -> Result<Option<(ChunkDetails<Service>, Chunk)>, ReceiveError> {
+        // a lane whose borrow limit is exhausted does not block the lower lanes
+        let mut result = Ok(None);
+        for lane in (0..self.receiver.number_of_channels).rev() {
+            match self.receiver.receive(ChannelId::new(lane)) {
+                Ok(Some(sample)) => return Ok(Some(sample)),
+                Ok(None) => (),
+                Err(ReceiveError::ExceedsMaxBorrows) => {
+                    result = Err(ReceiveError::ExceedsMaxBorrows)
+                }
+                Err(e) => return Err(e),
+            }
+        }
+
+        result
     }
 
     fn update_connections(&self) -> Result<(), ConnectionFailure> {
-        if unsafe {
-            self.receiver
-                .service_state
-                .dynamic_storage
-                .get()
-                .publish_subscribe()
-                .publishers
-                .update_state(&mut *self.publisher_list_state.get())
-        } {
+        let (has_changed, number_of_connections) = {
+            let publisher_list_state = unsafe { &mut *self.publisher_list_state.get() };
+            (
+                publisher_list_state.update(&*self.receiver.service_state),
+                publisher_list_state.capacity(),
+            )
+        };
+
+        if has_changed {
+            // SAFETY: called before the connections are updated, no connection is referenced
+            unsafe { self.receiver.grow_connections(number_of_connections) };
             fail!(from self, when self.force_update_connections(),
                 "Connections were updated only partially since at least one connection to a publisher failed.");
         }
@@ -283,6 +575,25 @@ impl<
     }
 }
 
+pub(crate) unsafe fn remove_data_arrival_notification_of_subscriber<Service: service::Service>(
+    subscriber_id: &UniqueSubscriberId,
+    config: &Config,
+) -> Result<(), NamedConceptRemoveError> {
+    let origin = format!(
+        "remove_data_arrival_notification_of_subscriber::<{}>({:?})",
+        core::any::type_name::<Service>(),
+        subscriber_id
+    );
+    let msg = "Unable to remove the data arrival notification of the subscriber";
+    let event_name = data_arrival_event_concept_name(subscriber_id);
+    let event_config = event_config::<Service>(config);
+
+    fail!(from origin,
+            when <Service::Event as NamedConceptMgmt>::remove_cfg(&event_name, &event_config),
+            "{} since the underlying concept could not be removed.", msg);
+    Ok(())
+}
+
 impl<
         Service: service::Service,
         Payload: Debug + ZeroCopySend,
@@ -35,9 +35,7 @@ use core::{fmt::Debug, ops::Deref};
 extern crate alloc;
 
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
-use iceoryx2_bb_log::error;
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
-use iceoryx2_cal::zero_copy_connection::{ChannelId, ZeroCopyReceiver, ZeroCopyReleaseError};
 
 use crate::port::details::chunk_details::ChunkDetails;
 use crate::port::port_identifiers::UniquePublisherId;
@@ -93,24 +91,7 @@ impl<
     > Drop for Sample<Service, Payload, UserHeader>
 {
     fn drop(&mut self) {
-        unsafe {
-            self.details
-                .connection
-                .data_segment
-                .unregister_offset(self.details.offset)
-        };
-
-        match self
-            .details
-            .connection
-            .receiver
-            .release(self.details.offset, ChannelId::new(0))
-        {
-            Ok(()) => (),
-            Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
-                error!(from self, "This should never happen! The publishers retrieve channel is full and the sample cannot be returned.");
-            }
-        }
+        self.details.release();
     }
 }
 
@@ -139,4 +120,10 @@ impl<
     pub fn origin(&self) -> UniquePublisherId {
         UniquePublisherId(UniqueSystemId::from(self.details.origin))
     }
+
+    /// Returns the priority lane via which the [`Sample`] was delivered, see
+    /// [`SampleMut::send_with_priority()`](crate::sample_mut::SampleMut::send_with_priority()).
+    pub fn priority(&self) -> usize {
+        self.details.channel_id.value()
+    }
 }
@@ -68,6 +68,8 @@ use crate::{
     service::header::publish_subscribe::Header,
 };
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_log::warn;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
 use iceoryx2_cal::shared_memory::*;
 
 use core::fmt::{Debug, Formatter};
@@ -327,7 +329,49 @@ impl<
     /// # }
     /// ```
     pub fn send(self) -> Result<usize, SendError> {
+        self.send_with_priority(0)
+    }
+
+    /// Sends the [`SampleMut`] like [`SampleMut::send()`] via the given priority lane. The
+    /// [`crate::port::subscriber::Subscriber`]s receive the samples of a higher lane before
+    /// the samples of a lower lane. Priorities beyond the
+    /// [`number_of_priority_lanes()`](crate::service::static_config::publish_subscribe::StaticConfig::number_of_priority_lanes())
+    /// of the service are delivered via the highest lane.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .number_of_priority_lanes(2)
+    ///     .open_or_create()?;
+    /// # let publisher = service.publisher_builder().create()?;
+    ///
+    /// let sample = publisher.loan()?;
+    /// sample.send_with_priority(1)?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_with_priority(mut self, priority: usize) -> Result<usize, SendError> {
+        if let Some(time_to_live) = self.publisher_shared_state.time_to_live() {
+            match Time::now_with_clock(ClockType::Monotonic) {
+                Ok(now) => self
+                    .ptr
+                    .as_header_mut()
+                    .set_expiration_time(now.as_duration() + time_to_live),
+                Err(e) => {
+                    warn!(from self, "The sample is sent without expiration time since the current time could not be acquired ({:?}).", e);
+                }
+            }
+        }
+
         self.publisher_shared_state
-            .send_sample(self.offset_to_chunk, self.sample_size)
+            .send_sample(self.offset_to_chunk, self.sample_size, priority)
     }
 }
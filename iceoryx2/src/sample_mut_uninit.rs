@@ -267,6 +267,19 @@ impl<
     pub fn payload_mut(&mut self) -> &mut Payload {
         self.sample.payload_mut()
     }
+
+    /// Returns the offset of the payload in the memory region that was provided with
+    /// [`PortFactoryPublisher::external_data_segment()`](crate::service::port_factory::publisher::PortFactoryPublisher::external_data_segment()),
+    /// so that a driver that operates on the file descriptor of the region can produce the
+    /// payload in place. Returns [`None`] when the [`crate::port::publisher::Publisher`] has no
+    /// external data segment.
+    pub fn external_data_segment_offset(&self) -> Option<usize> {
+        self.sample
+            .publisher_shared_state
+            .sender
+            .data_segment
+            .external_offset_of(self.sample.ptr.as_payload_ref() as *const Payload as *const u8)
+    }
 }
 
 impl<Service: crate::service::Service, Payload: Debug + ZeroCopySend, UserHeader: ZeroCopySend>
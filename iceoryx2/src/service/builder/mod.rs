@@ -26,7 +26,7 @@ pub mod request_response;
 use crate::node::SharedNode;
 use crate::service;
 use crate::service::dynamic_config::DynamicConfig;
-use crate::service::dynamic_config::RegisterNodeResult;
+use crate::service::dynamic_config::{NodeHandle, RegisterNodeResult};
 use crate::service::static_config::*;
 use core::fmt::Debug;
 use core::marker::PhantomData;
@@ -51,6 +51,7 @@ use alloc::sync::Arc;
 use super::config_scheme::dynamic_config_storage_config;
 use super::config_scheme::service_tag_config;
 use super::config_scheme::static_config_storage_config;
+use super::register_node_id;
 use super::service_name::ServiceName;
 use super::Service;
 
@@ -305,10 +306,10 @@ impl<ServiceType: service::Service> BuilderWithServiceType<ServiceType> {
             .create(DynamicConfig::new_uninit(messaging_pattern, max_number_of_nodes) ) {
                 Ok(dynamic_storage) => {
                     let node_id = self.shared_node.id();
-                    let node_handle = fatal_panic!(from self,
+                    let handle = fatal_panic!(from self,
                             when dynamic_storage.get().register_node_id(*node_id),
                             "{} since event the first NodeId could not be registered.", msg);
-                    self.shared_node.registered_services().add(self.service_config.service_id(), node_handle);
+                    self.shared_node.registered_services().add(self.service_config.service_id(), NodeHandle { segment: 0, handle });
                     Ok(dynamic_storage)
                 },
                 Err(e) => {
@@ -337,7 +338,12 @@ impl<ServiceType: service::Service> BuilderWithServiceType<ServiceType> {
             .registered_services()
             .add_or(self.service_config.service_id(), || {
                 let node_id = self.shared_node.id();
-                match storage.get().register_node_id(*node_id) {
+                match register_node_id::<ServiceType>(
+                    storage.get(),
+                    self.service_config.service_id(),
+                    self.shared_node.config(),
+                    *node_id,
+                ) {
                     Ok(handle) => Ok(handle),
                     Err(RegisterNodeResult::MarkedForDestruction) => {
                         fail!(from self, with OpenDynamicStorageFailure::IsMarkedForDestruction,
@@ -15,7 +15,9 @@
 //! See [`crate::service`]
 //!
 use core::marker::PhantomData;
+use core::time::Duration;
 
+use crate::config::PerformanceProfile;
 use crate::service;
 use crate::service::dynamic_config::publish_subscribe::DynamicConfigSettings;
 use crate::service::header::publish_subscribe::Header;
@@ -64,6 +66,11 @@ pub enum PublishSubscribeOpenError {
     DoesNotSupportRequestedAmountOfNodes,
     /// The [`Service`] required overflow behavior is not compatible.
     IncompatibleOverflowBehavior,
+    /// The [`Service`] does not deliver the samples via a broadcast ring of the requested size
+    /// or it uses a broadcast ring but none was requested.
+    IncompatibleDeliveryMode,
+    /// The [`Service`] has a different number of priority lanes than requested.
+    IncompatibleNumberOfPriorityLanes,
     /// The process has not enough permissions to open the [`Service`]
     InsufficientPermissions,
     /// Some underlying resources of the [`Service`] are either missing, corrupted or unaccessible.
@@ -225,6 +232,8 @@ pub struct Builder<
     verify_subscriber_max_borrowed_samples: bool,
     verify_publisher_history_size: bool,
     verify_enable_safe_overflow: bool,
+    verify_broadcast_ring_size: bool,
+    verify_number_of_priority_lanes: bool,
     verify_max_nodes: bool,
     _data: PhantomData<Payload>,
     _user_header: PhantomData<UserHeader>,
@@ -245,6 +254,8 @@ impl<
             verify_publisher_history_size: false,
             verify_subscriber_max_borrowed_samples: false,
             verify_enable_safe_overflow: false,
+            verify_broadcast_ring_size: false,
+            verify_number_of_priority_lanes: false,
             verify_max_nodes: false,
             override_alignment: None,
             override_payload_type: None,
@@ -324,6 +335,49 @@ impl<
         self
     }
 
+    /// If the [`Service`] is created with a value greater 0, every
+    /// [`crate::port::publisher::Publisher`] delivers its samples via a broadcast ring with
+    /// the given number of entries instead of the buffers of the
+    /// [`crate::port::subscriber::Subscriber`]s. Sending a sample costs the same
+    /// independent of the number of [`crate::port::subscriber::Subscriber`]s, only those that
+    /// were created with
+    /// [`crate::service::port_factory::subscriber::PortFactorySubscriber::notify_on_data_arrival()`]
+    /// are woken up individually. The ring always
+    /// overwrites the oldest sample, a [`crate::port::subscriber::Subscriber`] that is too slow
+    /// loses samples and can query the number with
+    /// [`crate::port::subscriber::Subscriber::missed_samples()`]. If an existing [`Service`] is
+    /// opened it requires a broadcast ring with at least the given size when the value is
+    /// greater 0 and no broadcast ring otherwise.
+    pub fn broadcast_ring_size(mut self, value: usize) -> Self {
+        self.config_details_mut().broadcast_ring_size = value;
+        self.verify_broadcast_ring_size = true;
+        self
+    }
+
+    /// If the [`Service`] is created it defines the number of priority lanes of every
+    /// connection. A [`crate::port::publisher::Publisher`] selects the lane with
+    /// [`crate::sample_mut::SampleMut::send_with_priority()`] and a
+    /// [`crate::port::subscriber::Subscriber`] receives the samples of the highest lane first,
+    /// so that urgent samples overtake a backlog of bulk data. The subscriber buffer size and the
+    /// number of borrowed samples apply to every lane. If an existing [`Service`] is opened it
+    /// requires the same number of lanes.
+    pub fn number_of_priority_lanes(mut self, value: usize) -> Self {
+        self.config_details_mut().number_of_priority_lanes = value;
+        self.verify_number_of_priority_lanes = true;
+        self
+    }
+
+    /// If the [`Service`] is created it defines the time after which a sent
+    /// [`crate::sample::Sample`] expires. A [`crate::port::subscriber::Subscriber`] discards
+    /// expired samples while receiving instead of handing them out. A
+    /// [`crate::port::publisher::Publisher`] can override it with
+    /// [`PortFactoryPublisher::time_to_live()`](crate::service::port_factory::publisher::PortFactoryPublisher::time_to_live()).
+    /// The value is not considered when an existing [`Service`] is opened.
+    pub fn sample_time_to_live(mut self, value: Duration) -> Self {
+        self.config_details_mut().sample_time_to_live = Some(value);
+        self
+    }
+
     /// If the [`Service`] is created it defines how many [`crate::sample::Sample`] a
     /// [`crate::port::subscriber::Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -360,6 +414,17 @@ impl<
         self
     }
 
+    /// If the [`Service`] is created it defines by how many
+    /// [`crate::port::subscriber::Subscriber`] the capacity can be increased at runtime with
+    /// [`PortFactory::increase_port_capacity()`](crate::service::port_factory::publish_subscribe::PortFactory::increase_port_capacity()).
+    /// Every [`crate::port::publisher::Publisher`] reserves samples for them, so that it can
+    /// serve the additional [`crate::port::subscriber::Subscriber`] as well. The value is not
+    /// considered when an existing [`Service`] is opened.
+    pub fn max_additional_subscribers(mut self, value: usize) -> Self {
+        self.config_details_mut().max_additional_subscribers = value;
+        self
+    }
+
     /// If the [`Service`] is created it defines how many [`crate::port::publisher::Publisher`] shall
     /// be supported at most. If an existing [`Service`] is opened it defines how many
     /// [`crate::port::publisher::Publisher`] must be at least supported.
@@ -378,6 +443,43 @@ impl<
         self
     }
 
+    /// If the [`Service`] is created it uses the settings of the provided
+    /// [`PerformanceProfile`] from the [`Config`](crate::config::Config) of the
+    /// [`Node`](crate::node::Node) instead of the publish-subscribe defaults. Settings that are
+    /// defined explicitly, like [`Builder::subscriber_max_buffer_size()`], always take
+    /// precedence. The port defaults, like the number of loaned samples of a
+    /// [`crate::port::publisher::Publisher`], are not affected, use
+    /// [`Config::apply_profile()`](crate::config::Config::apply_profile()) for them.
+    pub fn performance_profile(mut self, profile: PerformanceProfile) -> Self {
+        let settings = self.base.shared_node.config().profiles.get(profile).clone();
+
+        if !self.verify_number_of_subscribers {
+            self.config_details_mut().max_subscribers = settings.max_subscribers;
+        }
+        if !self.verify_number_of_publishers {
+            self.config_details_mut().max_publishers = settings.max_publishers;
+        }
+        if !self.verify_max_nodes {
+            self.config_details_mut().max_nodes = settings.max_nodes;
+        }
+        if !self.verify_publisher_history_size {
+            self.config_details_mut().history_size = settings.publisher_history_size;
+        }
+        if !self.verify_subscriber_max_buffer_size {
+            self.config_details_mut().subscriber_max_buffer_size =
+                settings.subscriber_max_buffer_size;
+        }
+        if !self.verify_subscriber_max_borrowed_samples {
+            self.config_details_mut().subscriber_max_borrowed_samples =
+                settings.subscriber_max_borrowed_samples;
+        }
+        if !self.verify_enable_safe_overflow {
+            self.config_details_mut().enable_safe_overflow = settings.enable_safe_overflow;
+        }
+
+        self
+    }
+
     /// Validates configuration and overrides the invalid setting with meaningful values.
     fn adjust_configuration_to_meaningful_values(&mut self) {
         let origin = format!("{:?}", self);
@@ -412,6 +514,33 @@ impl<
                 "Setting the maximum amount of nodes to 0 is not supported. Adjust it to 1, the smallest supported value.");
             settings.max_nodes = 1;
         }
+
+        if settings.broadcast_ring_size != 0 && settings.broadcast_ring_size < settings.history_size
+        {
+            warn!(from origin,
+                "The broadcast ring size {} is smaller than the history size. Adjust it to the history size {} so that the ring can hold the whole history.",
+                settings.broadcast_ring_size, settings.history_size);
+            settings.broadcast_ring_size = settings.history_size;
+        }
+
+        if settings.number_of_priority_lanes == 0 {
+            warn!(from origin,
+                "Setting the number of priority lanes to 0 is not supported. Adjust it to 1, the smallest supported value.");
+            settings.number_of_priority_lanes = 1;
+        }
+
+        if settings.broadcast_ring_size != 0 && settings.number_of_priority_lanes != 1 {
+            warn!(from origin,
+                "The broadcast ring delivers the samples in the order they were sent and does not support {} priority lanes. Adjust it to 1.",
+                settings.number_of_priority_lanes);
+            settings.number_of_priority_lanes = 1;
+        }
+
+        if settings.sample_time_to_live == Some(Duration::ZERO) {
+            warn!(from origin,
+                "A sample time to live of 0 would discard every sample. Disable the time to live instead.");
+            settings.sample_time_to_live = None;
+        }
     }
 
     fn verify_service_configuration(
@@ -487,6 +616,25 @@ impl<
                                 msg);
         }
 
+        if self.verify_broadcast_ring_size
+            && ((existing_settings.broadcast_ring_size == 0)
+                != (required_settings.broadcast_ring_size == 0)
+                || existing_settings.broadcast_ring_size < required_settings.broadcast_ring_size)
+        {
+            fail!(from self, with PublishSubscribeOpenError::IncompatibleDeliveryMode,
+                                "{} since the service has a broadcast ring size of {} but a size of {} was requested.",
+                                msg, existing_settings.broadcast_ring_size, required_settings.broadcast_ring_size);
+        }
+
+        if self.verify_number_of_priority_lanes
+            && existing_settings.number_of_priority_lanes
+                != required_settings.number_of_priority_lanes
+        {
+            fail!(from self, with PublishSubscribeOpenError::IncompatibleNumberOfPriorityLanes,
+                                "{} since the service has {} priority lanes but {} were requested.",
+                                msg, existing_settings.number_of_priority_lanes, required_settings.number_of_priority_lanes);
+        }
+
         if self.verify_max_nodes && existing_settings.max_nodes < required_settings.max_nodes {
             fail!(from self, with PublishSubscribeOpenError::DoesNotSupportRequestedAmountOfNodes,
                                 "{} since the service supports only {} nodes but {} are required.",
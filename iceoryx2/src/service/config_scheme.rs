@@ -10,8 +10,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use crate::{config, node::NodeId};
+use crate::{config, node::NodeId, service::naming_scheme::external_data_segment_request_name};
 use iceoryx2_bb_log::fatal_panic;
+use iceoryx2_bb_system_types::{file_name::FileName, file_path::FilePath};
 use iceoryx2_cal::named_concept::{NamedConceptConfiguration, NamedConceptMgmt};
 
 pub(crate) fn dynamic_config_storage_config<Service: crate::service::Service>(
@@ -66,6 +67,16 @@ pub(crate) fn data_segment_config<Service: crate::service::Service>(
         .path_hint(global_config.global.root_path())
 }
 
+/// The path of the unix datagram socket via which the receivers request the file descriptor of
+/// an external data segment.
+pub(crate) fn external_data_segment_request_path<Service: crate::service::Service>(
+    global_config: &config::Config,
+    data_segment_name: &FileName,
+) -> FilePath {
+    data_segment_config::<Service>(global_config)
+        .path_for(&external_data_segment_request_name(data_segment_name))
+}
+
 pub(crate) fn resizable_data_segment_config<Service: crate::service::Service>(
     global_config: &config::Config,
 ) -> <Service::ResizableSharedMemory as NamedConceptMgmt>::Configuration {
@@ -26,6 +26,7 @@ pub mod publish_subscribe;
 pub mod request_response;
 
 use core::fmt::Display;
+use core::sync::atomic::{fence, Ordering};
 use iceoryx2_bb_container::queue::RelocatableContainer;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_lock_free::mpmc::{
@@ -34,6 +35,7 @@ use iceoryx2_bb_lock_free::mpmc::{
 };
 use iceoryx2_bb_log::{fail, fatal_panic};
 use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
 
 use crate::{node::NodeId, port::port_identifiers::UniquePortId};
 
@@ -54,6 +56,16 @@ pub(crate) enum DeregisterNodeState {
     NoMoreOwners,
 }
 
+/// Identifies the registration of a node in the dynamic config of a service. A node is
+/// registered in the primary segment or, when it is full, in one of the extension segments.
+#[derive(Debug, Clone, Copy)]
+pub(crate) struct NodeHandle {
+    /// The segment index, see
+    /// [`ServiceState::dynamic_config_segment()`](crate::service::ServiceState::dynamic_config_segment())
+    pub(crate) segment: usize,
+    pub(crate) handle: ContainerHandle,
+}
+
 #[derive(Debug)]
 pub(crate) enum RemoveDeadNodeResult {
     NodeNotRegistered,
@@ -66,11 +78,24 @@ pub(crate) enum MessagingPattern {
     Event(event::DynamicConfig),
 }
 
+/// The maximum number of segments that can be chained to the dynamic config of a service to
+/// increase its port capacity at runtime.
+pub const MAX_NUMBER_OF_EXTENSIONS: usize = 8;
+
+// set in the counter of extension nodes when the last owner left the service
+const EXTENSION_NODES_LOCKED: usize = 1 << (usize::BITS - 1);
+
 #[doc(hidden)]
 #[derive(Debug)]
 pub struct DynamicConfig {
     messaging_pattern: MessagingPattern,
     nodes: Container<NodeId>,
+    // only used in the primary segment, counts the extension segments that are fully
+    // initialized and can be opened by everyone
+    number_of_extensions: IoxAtomicUsize,
+    // only used in the primary segment, counts the nodes that are registered in extension
+    // segments. They keep the service alive even when the primary segment has no nodes left.
+    number_of_extension_nodes: IoxAtomicUsize,
 }
 
 impl Display for DynamicConfig {
@@ -91,9 +116,20 @@ impl DynamicConfig {
         Self {
             messaging_pattern,
             nodes: unsafe { Container::new_uninit(max_number_of_nodes) },
+            number_of_extensions: IoxAtomicUsize::new(0),
+            number_of_extension_nodes: IoxAtomicUsize::new(0),
         }
     }
 
+    /// Creates the dynamic config of an extension segment. Its nodes are registered with
+    /// [`DynamicConfig::register_extension_node_id()`] of the primary segment.
+    pub(crate) fn new_extension_uninit(
+        messaging_pattern: MessagingPattern,
+        max_number_of_nodes: usize,
+    ) -> Self {
+        Self::new_uninit(messaging_pattern, max_number_of_nodes)
+    }
+
     pub(crate) fn memory_size(max_number_of_nodes: usize) -> usize {
         Container::<NodeId>::memory_size(max_number_of_nodes)
     }
@@ -108,13 +144,29 @@ impl DynamicConfig {
         }
     }
 
-    pub(crate) unsafe fn remove_dead_node_id<
+    /// Returns the number of extension segments that were published with
+    /// [`DynamicConfig::publish_extension()`].
+    pub(crate) fn number_of_extensions(&self) -> usize {
+        self.number_of_extensions.load(Ordering::Acquire)
+    }
+
+    /// Makes the fully initialized extension segment with the provided index visible to all
+    /// participants. Returns false when the extension was already published by someone else.
+    pub(crate) fn publish_extension(&self, index: usize) -> bool {
+        self.number_of_extensions
+            .compare_exchange(index, index + 1, Ordering::AcqRel, Ordering::Acquire)
+            .is_ok()
+    }
+
+    /// Removes all ports of the dead node. Used directly for extension segments, their nodes
+    /// are removed with [`DynamicConfig::remove_dead_extension_node_id()`].
+    pub(crate) unsafe fn remove_dead_node_ports<
         PortCleanup: FnMut(UniquePortId) -> PortCleanupAction,
     >(
         &self,
         node_id: &NodeId,
         port_cleanup_callback: PortCleanup,
-    ) -> Result<DeregisterNodeState, RemoveDeadNodeResult> {
+    ) {
         match self.messaging_pattern {
             MessagingPattern::PublishSubscribe(ref v) => {
                 v.remove_dead_node_id(node_id, port_cleanup_callback)
@@ -124,6 +176,16 @@ impl DynamicConfig {
                 v.remove_dead_node_id(node_id, port_cleanup_callback)
             }
         };
+    }
+
+    pub(crate) unsafe fn remove_dead_node_id<
+        PortCleanup: FnMut(UniquePortId) -> PortCleanupAction,
+    >(
+        &self,
+        node_id: &NodeId,
+        port_cleanup_callback: PortCleanup,
+    ) -> Result<DeregisterNodeState, RemoveDeadNodeResult> {
+        self.remove_dead_node_ports(node_id, port_cleanup_callback);
 
         let mut ret_val = Err(RemoveDeadNodeResult::NodeNotRegistered);
         self.nodes
@@ -140,6 +202,41 @@ impl DynamicConfig {
         ret_val
     }
 
+    /// Removes the dead node from the provided extension segment of this primary segment.
+    /// Returns [`None`] when the node is not registered in the extension.
+    pub(crate) unsafe fn remove_dead_extension_node_id(
+        &self,
+        extension: &DynamicConfig,
+        node_id: &NodeId,
+    ) -> Option<DeregisterNodeState> {
+        let mut ret_val = None;
+        extension
+            .nodes
+            .get_state()
+            .for_each(|handle: ContainerHandle, registered_node_id| {
+                if registered_node_id == node_id {
+                    ret_val = Some(self.deregister_extension_node_id(extension, handle));
+                    CallbackProgression::Stop
+                } else {
+                    CallbackProgression::Continue
+                }
+            });
+
+        ret_val
+    }
+
+    /// Removes all ports that were retained beyond the lifetime of their node, see
+    /// [`publish_subscribe::DynamicConfig::remove_retained_publishers()`]. Must only be called
+    /// when no node owns the service anymore.
+    pub(crate) unsafe fn remove_retained_ports<PortCleanup: FnMut(UniquePortId)>(
+        &self,
+        mut port_cleanup_callback: PortCleanup,
+    ) {
+        if let MessagingPattern::PublishSubscribe(ref v) = self.messaging_pattern {
+            v.remove_retained_publishers(|id| port_cleanup_callback(UniquePortId::Publisher(id)))
+        }
+    }
+
     pub(crate) fn register_node_id(
         &self,
         node_id: NodeId,
@@ -158,25 +255,109 @@ impl DynamicConfig {
         }
     }
 
+    /// Registers the node in the provided extension segment of this primary segment. The node
+    /// owns the service like the nodes of the primary segment.
+    pub(crate) fn register_extension_node_id(
+        &self,
+        extension: &DynamicConfig,
+        node_id: NodeId,
+    ) -> Result<ContainerHandle, RegisterNodeResult> {
+        let msg = "Unable to register NodeId in service extension";
+        let handle = match unsafe { extension.nodes.add(node_id) } {
+            Ok(handle) => handle,
+            Err(ContainerAddFailure::IsLocked) => {
+                fail!(from self, with RegisterNodeResult::MarkedForDestruction,
+                    "{msg} since the extension is already marked for destruction.");
+            }
+            Err(ContainerAddFailure::OutOfSpace) => {
+                fail!(from self, with RegisterNodeResult::ExceedsMaxNumberOfNodes,
+                    "{msg} since it would exceed the maximum supported nodes of {}.", extension.nodes.capacity());
+            }
+        };
+
+        let mut number_of_extension_nodes = self.number_of_extension_nodes.load(Ordering::SeqCst);
+        loop {
+            if number_of_extension_nodes & EXTENSION_NODES_LOCKED != 0 {
+                unsafe { extension.nodes.remove(handle, ReleaseMode::Default) };
+                fail!(from self, with RegisterNodeResult::MarkedForDestruction,
+                    "{msg} since the service is already marked for destruction.");
+            }
+
+            match self.number_of_extension_nodes.compare_exchange_weak(
+                number_of_extension_nodes,
+                number_of_extension_nodes + 1,
+                Ordering::SeqCst,
+                Ordering::SeqCst,
+            ) {
+                Ok(_) => return Ok(handle),
+                Err(v) => number_of_extension_nodes = v,
+            }
+        }
+    }
+
     pub(crate) fn list_node_ids<F: FnMut(&NodeId) -> CallbackProgression>(&self, mut callback: F) {
         let state = unsafe { self.nodes.get_state() };
         state.for_each(|_, node_id| callback(node_id));
     }
 
+    /// Returns the maximum number of nodes that can be registered in this segment.
+    pub(crate) fn max_number_of_nodes(&self) -> usize {
+        self.nodes.capacity()
+    }
+
     pub(crate) fn is_marked_for_destruction(&self) -> bool {
+        let number_of_extension_nodes = self.number_of_extension_nodes.load(Ordering::SeqCst);
         self.nodes.is_locked()
+            && (number_of_extension_nodes == 0
+                || number_of_extension_nodes == EXTENSION_NODES_LOCKED)
     }
 
     pub(crate) fn deregister_node_id(&self, handle: ContainerHandle) -> DeregisterNodeState {
         if unsafe { self.nodes.remove(handle, ReleaseMode::LockIfLastIndex) }
             == ReleaseState::Locked
         {
-            DeregisterNodeState::NoMoreOwners
+            self.lock_extension_nodes()
         } else {
             DeregisterNodeState::HasOwners
         }
     }
 
+    /// Removes the node that was registered with
+    /// [`DynamicConfig::register_extension_node_id()`].
+    pub(crate) fn deregister_extension_node_id(
+        &self,
+        extension: &DynamicConfig,
+        handle: ContainerHandle,
+    ) -> DeregisterNodeState {
+        unsafe { extension.nodes.remove(handle, ReleaseMode::Default) };
+        let number_of_extension_nodes = self
+            .number_of_extension_nodes
+            .fetch_sub(1, Ordering::SeqCst);
+        // pairs with the fence in lock_extension_nodes(), the lock state of the node container
+        // is loaded relaxed
+        fence(Ordering::SeqCst);
+        if number_of_extension_nodes == 1 && self.nodes.is_locked() {
+            self.lock_extension_nodes()
+        } else {
+            DeregisterNodeState::HasOwners
+        }
+    }
+
+    // The primary segment has no nodes left. Whoever observes that no extension node is left
+    // either, the last node of the primary segment or of the extensions, removes the service.
+    fn lock_extension_nodes(&self) -> DeregisterNodeState {
+        fence(Ordering::SeqCst);
+        match self.number_of_extension_nodes.compare_exchange(
+            0,
+            EXTENSION_NODES_LOCKED,
+            Ordering::SeqCst,
+            Ordering::SeqCst,
+        ) {
+            Ok(_) => DeregisterNodeState::NoMoreOwners,
+            Err(_) => DeregisterNodeState::HasOwners,
+        }
+    }
+
     pub(crate) fn request_response(&self) -> &request_response::DynamicConfig {
         match &self.messaging_pattern {
             MessagingPattern::RequestResponse(ref v) => v,
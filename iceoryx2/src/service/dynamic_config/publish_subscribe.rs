@@ -35,6 +35,7 @@ use crate::{
     node::NodeId,
     port::{
         details::data_segment::DataSegmentType,
+        downsampling::Downsampling,
         port_identifiers::{UniquePortId, UniquePublisherId, UniqueSubscriberId},
     },
 };
@@ -70,6 +71,11 @@ pub struct PublisherDetails {
     /// [`DataSegmentType::Dynamic`] it defines how many segment the
     /// [`Publisher`](crate::port::publisher::Publisher) can have at most.
     pub max_number_of_segments: u8,
+    /// The key under which a restarted [`Publisher`](crate::port::publisher::Publisher) can
+    /// adopt the data segment and connections of this
+    /// [`Publisher`](crate::port::publisher::Publisher) when its process died, see
+    /// [`PortFactoryPublisher::warm_restart_key()`](crate::service::port_factory::publisher::PortFactoryPublisher::warm_restart_key()).
+    pub warm_restart_key: Option<u64>,
 }
 
 /// Contains the communication settings of the connected
@@ -84,6 +90,16 @@ pub struct SubscriberDetails {
     pub node_id: NodeId,
     /// The size of the receive buffer that stores [`Sample`](crate::sample::Sample).
     pub buffer_size: usize,
+    /// If the [`Subscriber`](crate::port::subscriber::Subscriber) wants to be notified by
+    /// the [`Publisher`](crate::port::publisher::Publisher) whenever a new
+    /// [`Sample`](crate::sample::Sample) was delivered.
+    pub notify_on_data_arrival: bool,
+    /// The group of the [`Subscriber`](crate::port::subscriber::Subscriber). Every
+    /// [`Sample`](crate::sample::Sample) is delivered to only one member of a group.
+    pub group: Option<u64>,
+    /// The [`Downsampling`] policy the [`Publisher`](crate::port::publisher::Publisher)
+    /// applies when delivering to the [`Subscriber`](crate::port::subscriber::Subscriber).
+    pub downsampling: Option<Downsampling>,
 }
 
 /// The dynamic configuration of an
@@ -125,10 +141,13 @@ impl DynamicConfig {
         node_id: &NodeId,
         mut port_cleanup_callback: PortCleanup,
     ) {
+        // publishers with a warm restart key are retained until a successor adopts them or the
+        // service is removed, see remove_retained_publishers()
         self.publishers
             .get_state()
             .for_each(|handle: ContainerHandle, registered_publisher| {
                 if registered_publisher.node_id == *node_id
+                    && registered_publisher.warm_restart_key.is_none()
                     && port_cleanup_callback(UniquePortId::Publisher(
                         registered_publisher.publisher_id,
                     )) == PortCleanupAction::RemovePort
@@ -162,6 +181,18 @@ impl DynamicConfig {
         self.subscribers.len()
     }
 
+    /// Returns how many [`crate::port::publisher::Publisher`] ports can be connected to this
+    /// segment of the dynamic config.
+    pub fn max_publishers(&self) -> usize {
+        self.publishers.capacity()
+    }
+
+    /// Returns how many [`crate::port::subscriber::Subscriber`] ports can be connected to this
+    /// segment of the dynamic config.
+    pub fn max_subscribers(&self) -> usize {
+        self.subscribers.capacity()
+    }
+
     /// Iterates over all [`Subscriber`](crate::port::subscriber::Subscriber)s and calls the
     /// callback with the corresponding [`SubscriberDetails`].
     /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
@@ -203,4 +234,40 @@ impl DynamicConfig {
     pub(crate) fn release_publisher_handle(&self, handle: ContainerHandle) {
         unsafe { self.publishers.remove(handle, ReleaseMode::Default) };
     }
+
+    pub(crate) fn publisher_state(&self) -> ContainerState<PublisherDetails> {
+        unsafe { self.publishers.get_state() }
+    }
+
+    /// Removes a retained publisher of a dead node from the service. Returns true when the caller
+    /// has claimed it, false when it was already claimed by someone else.
+    pub(crate) fn claim_retained_publisher(
+        &self,
+        handle: ContainerHandle,
+        state: &ContainerState<PublisherDetails>,
+    ) -> bool {
+        unsafe {
+            self.publishers
+                .remove_if_unchanged(handle, state, ReleaseMode::Default)
+                .is_some()
+        }
+    }
+
+    /// Removes all publishers that were retained for a warm restart and calls the
+    /// `port_cleanup_callback` for every one of them so that their resources can be removed.
+    /// Must only be called when no node owns the service anymore.
+    pub(crate) unsafe fn remove_retained_publishers<PortCleanup: FnMut(UniquePublisherId)>(
+        &self,
+        mut port_cleanup_callback: PortCleanup,
+    ) {
+        let state = self.publisher_state();
+        state.for_each(|handle: ContainerHandle, registered_publisher| {
+            if registered_publisher.warm_restart_key.is_some()
+                && self.claim_retained_publisher(handle, &state)
+            {
+                port_cleanup_callback(registered_publisher.publisher_id);
+            }
+            CallbackProgression::Continue
+        });
+    }
 }
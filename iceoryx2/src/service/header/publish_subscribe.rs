@@ -31,6 +31,8 @@
 //! # }
 //! ```
 
+use core::time::Duration;
+
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 
@@ -43,6 +45,8 @@ use crate::port::port_identifiers::UniquePublisherId;
 pub struct Header {
     publisher_port_id: UniquePublisherId,
     number_of_elements: u64,
+    // monotonic time in nanoseconds, 0 when the sample never expires
+    expiration_time: u64,
 }
 
 impl Header {
@@ -50,6 +54,25 @@ impl Header {
         Self {
             publisher_port_id,
             number_of_elements,
+            expiration_time: 0,
+        }
+    }
+
+    pub(crate) fn set_expiration_time(&mut self, value: Duration) {
+        self.expiration_time = (value.as_nanos() as u64).max(1);
+    }
+
+    pub(crate) fn has_expired(&self, now: Duration) -> bool {
+        self.expiration_time != 0 && self.expiration_time <= now.as_nanos() as u64
+    }
+
+    /// Returns the point in time, measured with the monotonic clock, at which the sample
+    /// expires. Returns [`None`] when the sample was sent without a time to live, see
+    /// [`crate::service::static_config::publish_subscribe::StaticConfig::sample_time_to_live()`].
+    pub fn expiration_time(&self) -> Option<Duration> {
+        match self.expiration_time {
+            0 => None,
+            v => Some(Duration::from_nanos(v)),
         }
     }
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Same as [`ipc`](crate::service::ipc) but the events are delivered via an eventfd that the
+//! listener shares with its notifiers. A notification is a single `write` and the
+//! [`FileDescriptor`](iceoryx2_bb_posix::file_descriptor::FileDescriptor) of the
+//! [`Listener`](crate::port::listener::Listener) can be attached directly to an external epoll
+//! or io_uring loop.
+//!
+//! The listener tracks the event ids in a bitset that is sized by
+//! [`event_id_max_value`](crate::service::builder::event::Builder::event_id_max_value()), so it
+//! should be set to the greatest [`EventId`](crate::port::event_id::EventId) that is actually
+//! used. All participants of a service must use the same variant.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::service::ipc_eventfd;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc_eventfd::Service>()?;
+//!
+//! // use `ipc_eventfd` as communication variant
+//! let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .event()
+//!     .event_id_max_value(64)
+//!     .open_or_create()?;
+//!
+//! let listener = service.listener_builder().create()?;
+//! let notifier = service.notifier_builder().create()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
+//! See [`Service`](crate::service) for more detailed examples.
+
+extern crate alloc;
+use alloc::sync::Arc;
+
+use crate::service::dynamic_config::DynamicConfig;
+use iceoryx2_cal::shm_allocator::pool_allocator::PoolAllocator;
+use iceoryx2_cal::*;
+
+use super::ServiceState;
+
+/// Defines a zero copy inter-process communication setup based on posix mechanisms that uses
+/// an eventfd for the event messaging pattern.
+#[derive(Debug)]
+pub struct Service {
+    state: Arc<ServiceState<Self>>,
+}
+
+impl crate::service::Service for Service {
+    type StaticStorage = static_storage::recommended::Ipc;
+    type ConfigSerializer = serialize::recommended::Recommended;
+    type DynamicStorage = dynamic_storage::recommended::Ipc<DynamicConfig>;
+    type ServiceNameHasher = hash::recommended::Recommended;
+    type SharedMemory = shared_memory::recommended::Ipc<PoolAllocator>;
+    type ResizableSharedMemory = resizable_shared_memory::recommended::Ipc<PoolAllocator>;
+    type Connection = zero_copy_connection::recommended::Ipc;
+    type Event = event::eventfd_bitset_posix_shared_memory::Event;
+    type Monitoring = monitoring::recommended::Ipc;
+    type Reactor = reactor::recommended::Ipc;
+}
+
+impl crate::service::internal::ServiceInternal<Service> for Service {
+    fn __internal_from_state(state: ServiceState<Self>) -> Self {
+        Self {
+            state: Arc::new(state),
+        }
+    }
+
+    fn __internal_state(&self) -> &Arc<ServiceState<Self>> {
+        &self.state
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Reports how much shared memory a [`Service`](crate::service::Service) or one of its ports
+//! occupies, broken down into the payload data segments, the connection queues and the
+//! management structures.
+//!
+//! The [`MemoryUsage`] of a service is derived from its static and dynamic configuration and
+//! describes the memory of all ports of all processes. The [`MemoryUsage`] of a port describes
+//! the memory that the port has actually mapped.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .open_or_create()?;
+//!
+//! let publisher = service.publisher_builder().create()?;
+//! let subscriber = service.subscriber_builder().create()?;
+//!
+//! let usage = service.memory_usage();
+//! println!("service data segments: {} bytes", usage.data_segments.mapped);
+//! println!("service connections:   {} bytes", usage.connections.mapped);
+//! println!("service management:    {} bytes", usage.management.mapped);
+//!
+//! let usage = publisher.memory_usage();
+//! println!("publisher samples in use: {} bytes", usage.data_segments.used);
+//! # Ok(())
+//! # }
+//! ```
+
+use core::ops::{Add, AddAssign};
+
+use serde::{Deserialize, Serialize};
+
+/// The number of bytes of one category of shared memory.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, Serialize, Deserialize)]
+pub struct MemoryRegionUsage {
+    /// The number of bytes that are reserved for the category.
+    pub mapped: usize,
+    /// The number of bytes that are occupied by samples or port entries. Memory that is
+    /// preallocated for exactly one port or connection counts as used as a whole.
+    pub used: usize,
+}
+
+impl Add for MemoryRegionUsage {
+    type Output = Self;
+
+    fn add(self, rhs: Self) -> Self::Output {
+        Self {
+            mapped: self.mapped + rhs.mapped,
+            used: self.used + rhs.used,
+        }
+    }
+}
+
+impl AddAssign for MemoryRegionUsage {
+    fn add_assign(&mut self, rhs: Self) {
+        *self = *self + rhs;
+    }
+}
+
+/// The shared memory consumption of a [`Service`](crate::service::Service) or a port.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, Serialize, Deserialize)]
+pub struct MemoryUsage {
+    /// The data segments that contain the payload of the samples.
+    pub data_segments: MemoryRegionUsage,
+    /// The queues of the connections between the ports.
+    pub connections: MemoryRegionUsage,
+    /// The dynamic configuration of the service that tracks the nodes and ports.
+    pub management: MemoryRegionUsage,
+}
+
+impl MemoryUsage {
+    /// Returns the sum of the mapped bytes of all categories.
+    pub fn mapped(&self) -> usize {
+        self.data_segments.mapped + self.connections.mapped + self.management.mapped
+    }
+
+    /// Returns the sum of the used bytes of all categories.
+    pub fn used(&self) -> usize {
+        self.data_segments.used + self.connections.used + self.management.used
+    }
+}
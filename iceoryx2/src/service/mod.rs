@@ -178,6 +178,9 @@ pub mod dynamic_config;
 /// [`MessagingPattern`]s
 pub mod header;
 
+/// Reports the shared memory consumption of a [`Service`] and its ports
+pub mod memory_usage;
+
 /// The messaging patterns with their custom
 /// [`StaticConfig`]
 pub mod messaging_pattern;
@@ -209,6 +212,11 @@ pub mod local;
 /// A configuration when communicating between different processes using posix mechanisms.
 pub mod ipc;
 
+/// A configuration when communicating between different processes using posix mechanisms and
+/// an eventfd to deliver events.
+#[cfg(target_os = "linux")]
+pub mod ipc_eventfd;
+
 pub(crate) mod config_scheme;
 pub(crate) mod naming_scheme;
 
@@ -218,17 +226,24 @@ use core::time::Duration;
 extern crate alloc;
 use alloc::sync::Arc;
 
+use std::sync::OnceLock;
+
 use crate::config;
 use crate::node::{NodeId, NodeListFailure, NodeState, SharedNode};
 use crate::service::config_scheme::dynamic_config_storage_config;
-use crate::service::dynamic_config::DynamicConfig;
+use crate::service::dynamic_config::{
+    DynamicConfig, NodeHandle, RegisterNodeResult, MAX_NUMBER_OF_EXTENSIONS,
+};
+use crate::service::naming_scheme::dynamic_config_extension_name;
+use crate::service::stale_resource_cleanup::remove_retained_ports;
 use crate::service::static_config::*;
 use config_scheme::service_tag_config;
 use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_elementary::CallbackProgression;
-use iceoryx2_bb_log::{debug, fail, trace, warn};
+use iceoryx2_bb_log::{debug, fail, fatal_panic, trace, warn};
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
 use iceoryx2_cal::dynamic_storage::{
-    DynamicStorage, DynamicStorageBuilder, DynamicStorageOpenError,
+    DynamicStorage, DynamicStorageBuilder, DynamicStorageCreateError, DynamicStorageOpenError,
 };
 use iceoryx2_cal::event::Event;
 use iceoryx2_cal::hash::*;
@@ -306,6 +321,31 @@ impl core::fmt::Display for ServiceListError {
 
 impl core::error::Error for ServiceListError {}
 
+/// Failure that can be reported when the port capacity of a running [`Service`] is increased,
+/// see
+/// [`PortFactory::increase_port_capacity()`](crate::service::port_factory::publish_subscribe::PortFactory::increase_port_capacity()).
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ServiceCapacityIncreaseError {
+    /// The dynamic config of the [`Service`] was already extended
+    /// [`MAX_NUMBER_OF_EXTENSIONS`] times.
+    ExceedsMaxNumberOfExtensions,
+    /// The increase exceeds the additional subscribers the [`Service`] was created for, see
+    /// [`Builder::max_additional_subscribers()`](crate::service::builder::publish_subscribe::Builder::max_additional_subscribers()).
+    ExceedsMaxAdditionalSubscribers,
+    /// The process has insufficient permissions to create the extension.
+    InsufficientPermissions,
+    /// Errors that indicate either an implementation issue or a wrongly configured system.
+    InternalError,
+}
+
+impl core::fmt::Display for ServiceCapacityIncreaseError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        std::write!(f, "ServiceCapacityIncreaseError::{:?}", self)
+    }
+}
+
+impl core::error::Error for ServiceCapacityIncreaseError {}
+
 /// Represents all the [`Service`] information that one can acquire with [`Service::list()`]
 /// when the [`Service`] is accessible by the current process.
 #[derive(Debug, Clone)]
@@ -331,6 +371,7 @@ pub struct ServiceState<S: Service> {
     pub(crate) shared_node: Arc<SharedNode<S>>,
     pub(crate) dynamic_storage: S::DynamicStorage,
     pub(crate) static_storage: S::StaticStorage,
+    dynamic_storage_extensions: [OnceLock<S::DynamicStorage>; MAX_NUMBER_OF_EXTENSIONS],
 }
 
 impl<S: Service> ServiceState<S> {
@@ -345,11 +386,64 @@ impl<S: Service> ServiceState<S> {
             shared_node,
             dynamic_storage,
             static_storage,
+            dynamic_storage_extensions: core::array::from_fn(|_| OnceLock::new()),
         };
         trace!(from "Service::open()", "open service: {} ({:?})",
             new_self.static_config.name(), new_self.static_config.service_id());
         new_self
     }
+
+    /// Returns the number of segments of the dynamic config, the primary one that was created
+    /// with the service and all extensions that were published so far. Extensions that were
+    /// published since the last call are opened.
+    pub(crate) fn number_of_dynamic_config_segments(&self) -> usize {
+        let number_of_extensions = self.dynamic_storage.get().number_of_extensions();
+        for (n, extension) in self
+            .dynamic_storage_extensions
+            .iter()
+            .enumerate()
+            .take(number_of_extensions)
+        {
+            if extension.get().is_some() {
+                continue;
+            }
+
+            match open_dynamic_config_extension::<S>(
+                self.shared_node.config(),
+                self.static_config.service_id(),
+                n,
+            ) {
+                // when another thread opened it concurrently, the duplicate is just closed
+                Ok(storage) => {
+                    let _ = extension.set(storage);
+                }
+                Err(e) => {
+                    warn!(from self,
+                        "Unable to open the dynamic config extension {} ({:?}). The ports of the extension are not visible.", n, e);
+                    return n + 1;
+                }
+            }
+        }
+
+        number_of_extensions + 1
+    }
+
+    /// Returns the segment of the dynamic config with the provided index. The index zero is the
+    /// primary segment, all others must be smaller than
+    /// [`ServiceState::number_of_dynamic_config_segments()`].
+    pub(crate) fn dynamic_config_segment(&self, index: usize) -> &DynamicConfig {
+        if index == 0 {
+            return self.dynamic_storage.get();
+        }
+
+        match self.dynamic_storage_extensions[index - 1].get() {
+            Some(storage) => storage.get(),
+            None => {
+                fatal_panic!(from self,
+                    "This should never happen! Accessing the dynamic config extension {} before it was opened.", index - 1);
+            }
+        }
+    }
 }
 
 impl<S: Service> Drop for ServiceState<S> {
@@ -363,13 +457,41 @@ impl<S: Service> Drop for ServiceState<S> {
                         self.shared_node.id(), e);
             }
 
-            match self.dynamic_storage.get().deregister_node_id(handle) {
+            let deregister_state = match handle.segment {
+                0 => self.dynamic_storage.get().deregister_node_id(handle.handle),
+                segment => {
+                    if self.number_of_dynamic_config_segments() <= segment {
+                        warn!(from origin,
+                            "Unable to deregister from the dynamic config extension {} since it is not accessible.",
+                            segment - 1);
+                        return;
+                    }
+
+                    self.dynamic_storage.get().deregister_extension_node_id(
+                        self.dynamic_config_segment(segment),
+                        handle.handle,
+                    )
+                }
+            };
+
+            match deregister_state {
                 DeregisterNodeState::HasOwners => {
                     trace!(from origin, "close service: {} ({:?})",
                             self.static_config.name(), id);
                 }
                 DeregisterNodeState::NoMoreOwners => {
+                    unsafe {
+                        remove_retained_ports::<S>(
+                            self.dynamic_storage.get(),
+                            self.shared_node.config(),
+                        )
+                    };
                     self.static_storage.acquire_ownership();
+                    remove_dynamic_config_extensions::<S>(
+                        self.dynamic_storage.get(),
+                        id,
+                        self.shared_node.config(),
+                    );
                     self.dynamic_storage.acquire_ownership();
                     trace!(from origin, "close and remove service: {} ({:?})",
                             self.static_config.name(), id);
@@ -389,11 +511,12 @@ pub(crate) mod internal {
         port::{
             listener::remove_connection_of_listener, notifier::Notifier,
             port_identifiers::UniquePortId,
+            subscriber::remove_data_arrival_notification_of_subscriber,
         },
         prelude::EventId,
         service::stale_resource_cleanup::{
-            remove_data_segment_of_port, remove_receiver_port_from_all_connections,
-            remove_sender_port_from_all_connections,
+            remove_data_segment_of_port, remove_receiver_port_from_all_broadcast_rings,
+            remove_receiver_port_from_all_connections, remove_sender_port_from_all_connections,
         },
     };
 
@@ -548,7 +671,7 @@ pub(crate) mod internal {
             };
 
             let mut number_of_dead_node_notifications = 0;
-            let cleanup_port_resources = |port_id| {
+            let mut cleanup_port_resources = |port_id: UniquePortId| {
                 match port_id {
                     UniquePortId::Publisher(ref id) => {
                         if remove_sender_connection_and_data_segment::<S>(
@@ -563,12 +686,26 @@ pub(crate) mod internal {
                         }
                     }
                     UniquePortId::Subscriber(ref id) => {
+                        if let Err(e) = unsafe {
+                            remove_receiver_port_from_all_broadcast_rings::<S>(id.value(), config)
+                        } {
+                            debug!(from origin, "Failed to release the samples the subscriber ({:?}) pinned in broadcast rings ({:?}).", id, e);
+                            return PortCleanupAction::SkipPort;
+                        }
+
                         if let Err(e) = unsafe {
                             remove_receiver_port_from_all_connections::<S>(id.value(), config)
                         } {
                             debug!(from origin, "Failed to remove the subscriber ({:?}) from all of its connections ({:?}).", id, e);
                             return PortCleanupAction::SkipPort;
                         }
+
+                        if let Err(e) = unsafe {
+                            remove_data_arrival_notification_of_subscriber::<S>(id, config)
+                        } {
+                            debug!(from origin, "Failed to remove the subscribers ({:?}) data arrival notification ({:?}).", id, e);
+                            return PortCleanupAction::SkipPort;
+                        }
                     }
                     UniquePortId::Notifier(_) => {
                         number_of_dead_node_notifications += 1;
@@ -609,24 +746,55 @@ pub(crate) mod internal {
                 PortCleanupAction::RemovePort
             };
 
+            // the extensions come first since removing the node from the primary segment may
+            // remove the whole service
+            let mut extension_deregister_state = None;
+            for n in 0..dynamic_config.get().number_of_extensions() {
+                match open_dynamic_config_extension::<S>(config, service_id, n) {
+                    Ok(extension) => unsafe {
+                        extension
+                            .get()
+                            .remove_dead_node_ports(node_id, &mut cleanup_port_resources);
+                        if extension_deregister_state.is_none() {
+                            extension_deregister_state = dynamic_config
+                                .get()
+                                .remove_dead_extension_node_id(extension.get(), node_id);
+                        }
+                    },
+                    Err(e) => {
+                        debug!(from origin,
+                            "Unable to open the dynamic config extension {} to remove the ports of the node ({:?}).", n, e);
+                    }
+                }
+            }
+
             let remove_service = match unsafe {
                 dynamic_config
                     .get()
-                    .remove_dead_node_id(node_id, cleanup_port_resources)
+                    .remove_dead_node_id(node_id, &mut cleanup_port_resources)
             } {
                 Ok(DeregisterNodeState::HasOwners) => false,
                 Ok(DeregisterNodeState::NoMoreOwners) => true,
-                Err(RemoveDeadNodeResult::NodeNotRegistered) => {
-                    dynamic_config.get().is_marked_for_destruction()
-                }
+                Err(RemoveDeadNodeResult::NodeNotRegistered) => match extension_deregister_state {
+                    Some(DeregisterNodeState::HasOwners) => false,
+                    Some(DeregisterNodeState::NoMoreOwners) => true,
+                    None => dynamic_config.get().is_marked_for_destruction(),
+                },
             };
 
             if remove_service {
+                unsafe { remove_retained_ports::<S>(dynamic_config.get(), config) };
+
                 match unsafe {
                     remove_static_service_config::<S>(config, &service_id.0.clone().into())
                 } {
                     Ok(_) => {
                         trace!(from origin, "Remove unused service.");
+                        remove_dynamic_config_extensions::<S>(
+                            dynamic_config.get(),
+                            service_id,
+                            config,
+                        );
                         dynamic_config.acquire_ownership()
                     }
                     Err(e) => {
@@ -847,18 +1015,32 @@ fn details<S: Service>(
     let dynamic_config = open_dynamic_config::<S>(config, service_config.service_id())?;
     let dynamic_details = if let Some(d) = dynamic_config {
         let mut nodes = vec![];
-        d.get().list_node_ids(|node_id| {
-            match NodeState::new(node_id, config) {
-                Ok(Some(state)) => nodes.push(state),
-                Ok(None)
-                | Err(NodeListFailure::InsufficientPermissions)
-                | Err(NodeListFailure::Interrupt) => (),
-                Err(NodeListFailure::InternalError) => {
-                    debug!(from origin, "Unable to acquire NodeState for service \"{:?}\"", uuid);
+        let mut list_node_ids = |dynamic_config: &DynamicConfig| {
+            dynamic_config.list_node_ids(|node_id| {
+                match NodeState::new(node_id, config) {
+                    Ok(Some(state)) => nodes.push(state),
+                    Ok(None)
+                    | Err(NodeListFailure::InsufficientPermissions)
+                    | Err(NodeListFailure::Interrupt) => (),
+                    Err(NodeListFailure::InternalError) => {
+                        debug!(from origin, "Unable to acquire NodeState for service \"{:?}\"", uuid);
+                    }
+                };
+                CallbackProgression::Continue
+            })
+        };
+
+        list_node_ids(d.get());
+        for n in 0..d.get().number_of_extensions() {
+            match open_dynamic_config_extension::<S>(config, service_config.service_id(), n) {
+                Ok(extension) => list_node_ids(extension.get()),
+                Err(e) => {
+                    debug!(from origin,
+                        "Unable to open the dynamic config extension {} of service \"{:?}\" ({:?}).",
+                        n, uuid, e);
                 }
-            };
-            CallbackProgression::Continue
-        });
+            }
+        }
         Some(ServiceDynamicDetails { nodes })
     } else {
         None
@@ -902,6 +1084,145 @@ fn open_dynamic_config<S: Service>(
     }
 }
 
+/// Registers the node in the dynamic config of a service. When the primary segment has no free
+/// slot left or no node is registered in it anymore, the node is registered in the first
+/// extension segment with a free slot.
+pub(crate) fn register_node_id<S: Service>(
+    dynamic_config: &DynamicConfig,
+    service_id: &ServiceId,
+    config: &config::Config,
+    node_id: NodeId,
+) -> Result<NodeHandle, RegisterNodeResult> {
+    let origin = format!("register_node_id({:?}, {:?})", service_id, node_id);
+    let primary_result = match dynamic_config.register_node_id(node_id) {
+        Ok(handle) => return Ok(NodeHandle { segment: 0, handle }),
+        Err(e) => e,
+    };
+
+    for n in 0..dynamic_config.number_of_extensions() {
+        let extension = match open_dynamic_config_extension::<S>(config, service_id, n) {
+            Ok(extension) => extension,
+            Err(e) => {
+                debug!(from origin,
+                    "Unable to open the dynamic config extension {} to register the node ({:?}).", n, e);
+                continue;
+            }
+        };
+
+        match dynamic_config.register_extension_node_id(extension.get(), node_id) {
+            Ok(handle) => {
+                return Ok(NodeHandle {
+                    segment: n + 1,
+                    handle,
+                })
+            }
+            Err(RegisterNodeResult::ExceedsMaxNumberOfNodes) => (),
+            Err(e) => return Err(e),
+        }
+    }
+
+    Err(primary_result)
+}
+
+fn open_dynamic_config_extension<S: Service>(
+    config: &config::Config,
+    service_id: &ServiceId,
+    index: usize,
+) -> Result<S::DynamicStorage, DynamicStorageOpenError> {
+    <<S::DynamicStorage as DynamicStorage<DynamicConfig>>::Builder<'_> as NamedConceptBuilder<
+        S::DynamicStorage,
+    >>::new(&dynamic_config_extension_name(service_id, index))
+    .timeout(config.global.service.creation_timeout)
+    .config(&dynamic_config_storage_config::<S>(config))
+    .has_ownership(false)
+    .open()
+}
+
+/// Creates and publishes the next extension segment of the dynamic config of a service. When
+/// the next segment already exists, it was created concurrently by someone else or by a process
+/// that died before it could publish it. In both cases the existing segment is published and
+/// the creation is repeated with the next index. Returns the index of the created extension.
+pub(crate) fn add_dynamic_config_extension<
+    S: Service,
+    F: FnMut() -> dynamic_config::MessagingPattern,
+>(
+    dynamic_config: &DynamicConfig,
+    service_id: &ServiceId,
+    config: &config::Config,
+    supplementary_size: usize,
+    max_number_of_nodes: usize,
+    mut messaging_pattern: F,
+) -> Result<usize, ServiceCapacityIncreaseError> {
+    let origin = format!("add_dynamic_config_extension({:?})", service_id);
+    let msg = "Unable to add a dynamic config extension";
+
+    loop {
+        let index = dynamic_config.number_of_extensions();
+        if index >= MAX_NUMBER_OF_EXTENSIONS {
+            fail!(from origin, with ServiceCapacityIncreaseError::ExceedsMaxNumberOfExtensions,
+                "{} since the service has already the maximum number of {} extensions.",
+                msg, MAX_NUMBER_OF_EXTENSIONS);
+        }
+
+        match <<S::DynamicStorage as DynamicStorage<DynamicConfig>>::Builder<'_> as NamedConceptBuilder<
+            S::DynamicStorage,
+        >>::new(&dynamic_config_extension_name(service_id, index))
+        .config(&dynamic_config_storage_config::<S>(config))
+        .supplementary_size(supplementary_size)
+        .has_ownership(false)
+        .initializer(|extension: &mut DynamicConfig, allocator: &mut BumpAllocator| {
+            unsafe { extension.init(allocator) };
+            true
+        })
+        .create(DynamicConfig::new_extension_uninit(
+            messaging_pattern(),
+            max_number_of_nodes,
+        ))
+        {
+            Ok(_) => {
+                dynamic_config.publish_extension(index);
+                trace!(from origin, "Added dynamic config extension {}.", index);
+                return Ok(index);
+            }
+            Err(DynamicStorageCreateError::AlreadyExists) => {
+                fail!(from origin, when open_dynamic_config_extension::<S>(config, service_id, index),
+                    with ServiceCapacityIncreaseError::InternalError,
+                    "{} since the existing extension {} could not be opened.", msg, index);
+                dynamic_config.publish_extension(index);
+            }
+            Err(DynamicStorageCreateError::InsufficientPermissions) => {
+                fail!(from origin, with ServiceCapacityIncreaseError::InsufficientPermissions,
+                    "{} since the process has insufficient permissions to create the extension {}.", msg, index);
+            }
+            Err(e) => {
+                fail!(from origin, with ServiceCapacityIncreaseError::InternalError,
+                    "{} since the extension {} could not be created ({:?}).", msg, index, e);
+            }
+        }
+    }
+}
+
+/// Removes all extension segments of the dynamic config of a service. Must only be called when
+/// the service itself is removed.
+fn remove_dynamic_config_extensions<S: Service>(
+    dynamic_config: &DynamicConfig,
+    service_id: &ServiceId,
+    config: &config::Config,
+) {
+    let origin = format!("remove_dynamic_config_extensions({:?})", service_id);
+    // one more than published, a participant may have died before it published its extension
+    for n in 0..=dynamic_config.number_of_extensions() {
+        if let Err(e) = unsafe {
+            <S::DynamicStorage as NamedConceptMgmt>::remove_cfg(
+                &dynamic_config_extension_name(service_id, n),
+                &dynamic_config_storage_config::<S>(config),
+            )
+        } {
+            debug!(from origin, "Unable to remove the dynamic config extension {} ({:?}).", n, e);
+        }
+    }
+}
+
 pub(crate) fn remove_service_tag<S: Service>(
     node_id: &NodeId,
     service_id: &ServiceId,
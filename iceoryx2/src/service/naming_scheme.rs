@@ -10,7 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use crate::port::port_identifiers::UniqueListenerId;
+use crate::port::port_identifiers::{UniqueListenerId, UniqueSubscriberId};
+use crate::service::service_id::ServiceId;
 use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_log::fatal_panic;
 use iceoryx2_bb_system_types::file_name::FileName;
@@ -23,6 +24,25 @@ pub(crate) fn event_concept_name(listener_id: &UniqueListenerId) -> FileName {
                  "{}", msg)
 }
 
+pub(crate) fn data_arrival_event_concept_name(subscriber_id: &UniqueSubscriberId) -> FileName {
+    let msg = "The system does not support the required file name length for the subscribers data arrival event concept name.";
+    let origin = "data_arrival_event_concept_name()";
+    fatal_panic!(from origin,
+                 when FileName::new(subscriber_id.0.value().to_string().as_bytes()),
+                 "{}", msg)
+}
+
+pub(crate) fn dynamic_config_extension_name(service_id: &ServiceId, index: usize) -> FileName {
+    let msg = "The system does not support the required file name length for the dynamic config extension.";
+    let origin = "dynamic_config_extension_name()";
+
+    let mut name: FileName = service_id.0.clone().into();
+    fatal_panic!(from origin,
+                 when name.push_bytes(format!("_ext{}", index).as_bytes()),
+                 "{}", msg);
+    name
+}
+
 pub(crate) fn connection_name(sender_port_id: u128, receiver_port_id: u128) -> FileName {
     let mut file = FileName::new(sender_port_id.to_string().as_bytes()).unwrap();
     file.push(b'_').unwrap();
@@ -51,3 +71,37 @@ pub(crate) fn data_segment_name(port_id_value: u128) -> FileName {
                  when FileName::new(port_id_value.to_string().as_bytes()),
                  "{}", msg)
 }
+
+pub(crate) fn overflow_data_segment_name(data_segment_name: &FileName) -> FileName {
+    let msg =
+        "The system does not support the required file name length for the overflow data segment.";
+    let origin = "overflow_data_segment_name()";
+
+    let mut name = data_segment_name.clone();
+    fatal_panic!(from origin,
+                 when name.push_bytes(b"_overflow"),
+                 "{}", msg);
+    name
+}
+
+pub(crate) fn broadcast_ring_name(data_segment_name: &FileName) -> FileName {
+    let msg = "The system does not support the required file name length for the broadcast ring.";
+    let origin = "broadcast_ring_name()";
+
+    let mut name = data_segment_name.clone();
+    fatal_panic!(from origin,
+                 when name.push_bytes(b"_broadcast"),
+                 "{}", msg);
+    name
+}
+
+pub(crate) fn external_data_segment_request_name(data_segment_name: &FileName) -> FileName {
+    let msg = "The system does not support the required file name length for the request socket of the external data segment.";
+    let origin = "external_data_segment_request_name()";
+
+    let mut name = data_segment_name.clone();
+    fatal_panic!(from origin,
+                 when name.push_bytes(b"_fd_request"),
+                 "{}", msg);
+    name
+}
@@ -92,11 +92,7 @@ impl<Service: service::Service> crate::service::port_factory::PortFactory for Po
         &self,
         callback: F,
     ) -> Result<(), NodeListFailure> {
-        nodes(
-            self.service.__internal_state().dynamic_storage.get(),
-            self.service.__internal_state().shared_node.config(),
-            callback,
-        )
+        nodes(self.service.__internal_state(), callback)
     }
 }
 
@@ -12,11 +12,10 @@
 
 use iceoryx2_bb_elementary::CallbackProgression;
 
-use crate::config::Config;
 use crate::node::{NodeListFailure, NodeState};
 
-use super::dynamic_config::DynamicConfig;
 use super::service_id::ServiceId;
+use super::ServiceState;
 use super::{attribute::AttributeSet, service_name::ServiceName};
 
 pub mod request_response;
@@ -91,21 +90,31 @@ pub(crate) fn nodes<
     Service: crate::service::Service,
     F: FnMut(NodeState<Service>) -> CallbackProgression,
 >(
-    dynamic_config: &DynamicConfig,
-    config: &Config,
+    service_state: &ServiceState<Service>,
     mut callback: F,
 ) -> Result<(), NodeListFailure> {
+    let config = service_state.shared_node.config();
     let mut ret_val = Ok(());
-    dynamic_config.list_node_ids(|node_id| {
-        match crate::node::NodeState::<Service>::new(node_id, config) {
-            Ok(Some(node_state)) => callback(node_state),
-            Ok(None) => CallbackProgression::Continue,
-            Err(e) => {
-                ret_val = Err(e);
-                CallbackProgression::Stop
-            }
+    let mut progression = CallbackProgression::Continue;
+    for n in 0..service_state.number_of_dynamic_config_segments() {
+        service_state
+            .dynamic_config_segment(n)
+            .list_node_ids(|node_id| {
+                progression = match crate::node::NodeState::<Service>::new(node_id, config) {
+                    Ok(Some(node_state)) => callback(node_state),
+                    Ok(None) => CallbackProgression::Continue,
+                    Err(e) => {
+                        ret_val = Err(e);
+                        CallbackProgression::Stop
+                    }
+                };
+                progression
+            });
+
+        if progression == CallbackProgression::Stop {
+            break;
         }
-    });
+    }
 
     ret_val
 }
@@ -40,17 +40,29 @@
 //! # }
 //! ```
 
+extern crate alloc;
+
+use alloc::vec::Vec;
 use core::{fmt::Debug, marker::PhantomData};
 
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_log::fail;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::named_concept::NamedConceptBuilder;
+use iceoryx2_cal::zero_copy_connection::{ZeroCopyConnection, ZeroCopyConnectionBuilder};
 
 use crate::node::NodeListFailure;
 use crate::service::attribute::AttributeSet;
+use crate::service::config_scheme::connection_config;
+use crate::service::dynamic_config::publish_subscribe::DynamicConfigSettings;
+use crate::service::memory_usage::MemoryUsage;
+use crate::service::naming_scheme::connection_name;
 use crate::service::service_id::ServiceId;
 use crate::service::service_name::ServiceName;
-use crate::service::{self, dynamic_config, static_config};
+use crate::service::{
+    self, add_dynamic_config_extension, dynamic_config, static_config, ServiceCapacityIncreaseError,
+};
 
 use super::nodes;
 use super::{publisher::PortFactoryPublisher, subscriber::PortFactorySubscriber};
@@ -127,11 +139,7 @@ impl<
         &self,
         callback: F,
     ) -> Result<(), NodeListFailure> {
-        nodes(
-            self.service.__internal_state().dynamic_storage.get(),
-            self.service.__internal_state().shared_node.config(),
-            callback,
-        )
+        nodes(self.service.__internal_state(), callback)
     }
 }
 
@@ -197,4 +205,251 @@ impl<
     pub fn publisher_builder(&self) -> PortFactoryPublisher<Service, Payload, UserHeader> {
         PortFactoryPublisher::new(self)
     }
+
+    /// Increases the maximum number of [`Publisher`](crate::port::publisher::Publisher)s and
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s of the running
+    /// [`Service`](crate::service::Service) without recreating it. An additional segment is
+    /// chained to the dynamic config, existing ports follow it with their next connection
+    /// update and new ports use it when all preceding segments are full. The dynamic config
+    /// can be extended at most
+    /// [`MAX_NUMBER_OF_EXTENSIONS`](crate::service::dynamic_config::MAX_NUMBER_OF_EXTENSIONS)
+    /// times. The maximum number of [`Node`](crate::node::Node)s grows by the number of
+    /// additional ports so that every new port can be created by another
+    /// [`Node`](crate::node::Node).
+    ///
+    /// Every [`Publisher`](crate::port::publisher::Publisher) reserves samples for the
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s that can be added later, see
+    /// [`Builder::max_additional_subscribers()`](crate::service::builder::publish_subscribe::Builder::max_additional_subscribers()).
+    /// Therefore, existing [`Publisher`](crate::port::publisher::Publisher)s serve the additional
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s as well. An increase beyond that
+    /// bound fails with [`ServiceCapacityIncreaseError::ExceedsMaxAdditionalSubscribers`].
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// let pubsub = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .max_publishers(1)
+    ///     .max_subscribers(1)
+    ///     .max_additional_subscribers(1)
+    ///     .open_or_create()?;
+    ///
+    /// let publisher = pubsub.publisher_builder().create()?;
+    /// let subscriber = pubsub.subscriber_builder().create()?;
+    ///
+    /// pubsub.increase_port_capacity(1, 1)?;
+    /// let another_publisher = pubsub.publisher_builder().create()?;
+    /// // served by both publishers
+    /// let another_subscriber = pubsub.subscriber_builder().create()?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn increase_port_capacity(
+        &self,
+        additional_publishers: usize,
+        additional_subscribers: usize,
+    ) -> Result<(), ServiceCapacityIncreaseError> {
+        let msg = "Unable to increase the port capacity";
+        let service_state = self.service.__internal_state();
+        let dynamic_config_settings = DynamicConfigSettings {
+            number_of_publishers: additional_publishers,
+            number_of_subscribers: additional_subscribers,
+        };
+
+        let max_subscribers = self.max_subscribers() + additional_subscribers;
+        let static_config = service_state.static_config.publish_subscribe();
+        if static_config.max_subscribers_including_additional_ones() < max_subscribers {
+            fail!(from self, with ServiceCapacityIncreaseError::ExceedsMaxAdditionalSubscribers,
+                "{} to {} subscribers since the service was created with {} subscribers and at most {} additional ones.",
+                msg, max_subscribers, static_config.max_subscribers(), static_config.max_additional_subscribers());
+        }
+
+        // every additional port may be created by another node
+        let additional_nodes = additional_publishers + additional_subscribers;
+        add_dynamic_config_extension::<Service, _>(
+            service_state.dynamic_storage.get(),
+            service_state.static_config.service_id(),
+            service_state.shared_node.config(),
+            dynamic_config::DynamicConfig::memory_size(additional_nodes)
+                + dynamic_config::publish_subscribe::DynamicConfig::memory_size(
+                    &dynamic_config_settings,
+                ),
+            additional_nodes,
+            || {
+                dynamic_config::MessagingPattern::PublishSubscribe(
+                    dynamic_config::publish_subscribe::DynamicConfig::new(&dynamic_config_settings),
+                )
+            },
+        )?;
+
+        Ok(())
+    }
+
+    /// Calls the callback with every segment of the dynamic config, starting with the one that
+    /// was created with the [`Service`](crate::service::Service) followed by all that were added
+    /// with [`PortFactory::increase_port_capacity()`].
+    /// [`PortFactory::dynamic_config()`](crate::service::port_factory::PortFactory::dynamic_config())
+    /// returns only the first one.
+    pub fn for_each_dynamic_config_segment<
+        F: FnMut(&dynamic_config::publish_subscribe::DynamicConfig) -> CallbackProgression,
+    >(
+        &self,
+        mut callback: F,
+    ) {
+        let service_state = self.service.__internal_state();
+        for n in 0..service_state.number_of_dynamic_config_segments() {
+            if callback(service_state.dynamic_config_segment(n).publish_subscribe())
+                == CallbackProgression::Stop
+            {
+                break;
+            }
+        }
+    }
+
+    /// Returns how many [`Publisher`](crate::port::publisher::Publisher)s can be connected in
+    /// all segments of the dynamic config, see [`PortFactory::increase_port_capacity()`].
+    pub fn max_publishers(&self) -> usize {
+        let mut max_publishers = 0;
+        self.for_each_dynamic_config_segment(|segment| {
+            max_publishers += segment.max_publishers();
+            CallbackProgression::Continue
+        });
+        max_publishers
+    }
+
+    /// Returns how many [`Subscriber`](crate::port::subscriber::Subscriber)s can be connected in
+    /// all segments of the dynamic config, see [`PortFactory::increase_port_capacity()`].
+    pub fn max_subscribers(&self) -> usize {
+        let mut max_subscribers = 0;
+        self.for_each_dynamic_config_segment(|segment| {
+            max_subscribers += segment.max_subscribers();
+            CallbackProgression::Continue
+        });
+        max_subscribers
+    }
+
+    /// Returns how many [`Node`](crate::node::Node)s can open the
+    /// [`Service`](crate::service::Service) in parallel in all segments of the dynamic config,
+    /// see [`PortFactory::increase_port_capacity()`].
+    pub fn max_nodes(&self) -> usize {
+        let service_state = self.service.__internal_state();
+        (0..service_state.number_of_dynamic_config_segments())
+            .map(|n| {
+                service_state
+                    .dynamic_config_segment(n)
+                    .max_number_of_nodes()
+            })
+            .sum()
+    }
+
+    /// Returns the [`MemoryUsage`] of the [`Service`](crate::service::Service) with all
+    /// [`Publisher`](crate::port::publisher::Publisher)s and
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s of all processes. It is derived
+    /// from the static and dynamic configuration, therefore the used bytes of the data
+    /// segments are not known and reported as zero. They can be acquired with
+    /// [`Publisher::memory_usage()`](crate::port::publisher::Publisher::memory_usage()).
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// let pubsub = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .open_or_create()?;
+    ///
+    /// println!("mapped bytes: {}", pubsub.memory_usage().mapped());
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn memory_usage(&self) -> MemoryUsage {
+        let static_config = self
+            .service
+            .__internal_state()
+            .static_config
+            .publish_subscribe();
+        let connection_config =
+            connection_config::<Service>(self.service.__internal_state().shared_node.config());
+
+        let mut publishers = Vec::new();
+        let mut subscribers = Vec::new();
+        let mut extensions_size = 0;
+        let mut is_first_segment = true;
+        self.for_each_dynamic_config_segment(|segment| {
+            segment.list_publishers(|details| {
+                publishers.push(*details);
+                CallbackProgression::Continue
+            });
+            segment.list_subscribers(|details| {
+                subscribers.push(*details);
+                CallbackProgression::Continue
+            });
+
+            if !is_first_segment {
+                extensions_size += core::mem::size_of::<dynamic_config::DynamicConfig>()
+                    + dynamic_config::DynamicConfig::memory_size(0)
+                    + dynamic_config::publish_subscribe::DynamicConfig::memory_size(
+                        &DynamicConfigSettings {
+                            number_of_publishers: segment.max_publishers(),
+                            number_of_subscribers: segment.max_subscribers(),
+                        },
+                    );
+            }
+            is_first_segment = false;
+            CallbackProgression::Continue
+        });
+
+        let mut usage = MemoryUsage::default();
+        for publisher in &publishers {
+            usage.data_segments.mapped += static_config
+                .message_type_details()
+                .sample_layout(publisher.max_slice_len)
+                .size()
+                * publisher.number_of_samples;
+
+            for subscriber in &subscribers {
+                let connection_size =
+                    <Service::Connection as ZeroCopyConnection>::Builder::new(&connection_name(
+                        publisher.publisher_id.value(),
+                        subscriber.subscriber_id.value(),
+                    ))
+                    .config(&connection_config)
+                    .buffer_size(subscriber.buffer_size)
+                    .receiver_max_borrowed_samples_per_channel(
+                        static_config.subscriber_max_borrowed_samples(),
+                    )
+                    .number_of_samples_per_segment(publisher.number_of_samples)
+                    .max_supported_shared_memory_segments(publisher.max_number_of_segments)
+                    .memory_size();
+
+                usage.connections.mapped += connection_size;
+                usage.connections.used += connection_size;
+            }
+        }
+
+        let dynamic_config_settings = DynamicConfigSettings {
+            number_of_publishers: static_config.max_publishers(),
+            number_of_subscribers: static_config.max_subscribers(),
+        };
+        usage.management.mapped = core::mem::size_of::<dynamic_config::DynamicConfig>()
+            + dynamic_config::DynamicConfig::memory_size(static_config.max_nodes())
+            + dynamic_config::publish_subscribe::DynamicConfig::memory_size(
+                &dynamic_config_settings,
+            )
+            + extensions_size;
+        usage.management.used = publishers.len()
+            * core::mem::size_of::<dynamic_config::publish_subscribe::PublisherDetails>()
+            + subscribers.len()
+                * core::mem::size_of::<dynamic_config::publish_subscribe::SubscriberDetails>();
+
+        usage
+    }
 }
@@ -55,9 +55,11 @@
 //! ```
 
 use core::fmt::Debug;
+use core::time::Duration;
 
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_log::fail;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_cal::shm_allocator::AllocationStrategy;
 
 use super::publish_subscribe::PortFactory;
@@ -70,6 +72,8 @@ use crate::{
     service,
 };
 
+const DEFAULT_OVERFLOW_NUMBER_OF_SAMPLES: usize = 2;
+
 #[derive(Debug)]
 pub(crate) struct LocalPublisherConfig {
     pub(crate) max_loaned_samples: usize,
@@ -77,6 +81,12 @@ pub(crate) struct LocalPublisherConfig {
     pub(crate) degradation_callback: Option<DegradationCallback<'static>>,
     pub(crate) initial_max_slice_len: usize,
     pub(crate) allocation_strategy: AllocationStrategy,
+    pub(crate) overflow_max_slice_len: usize,
+    pub(crate) overflow_number_of_samples: usize,
+    pub(crate) chunk_cache_size: usize,
+    pub(crate) time_to_live: Option<Duration>,
+    pub(crate) warm_restart_key: Option<u64>,
+    pub(crate) external_data_segment: Option<FileDescriptor>,
 }
 
 /// Factory to create a new [`Publisher`] port/endpoint for
@@ -114,6 +124,12 @@ impl<
                 allocation_strategy: AllocationStrategy::Static,
                 degradation_callback: None,
                 initial_max_slice_len: 1,
+                overflow_max_slice_len: 0,
+                overflow_number_of_samples: DEFAULT_OVERFLOW_NUMBER_OF_SAMPLES,
+                chunk_cache_size: 0,
+                time_to_live: None,
+                warm_restart_key: None,
+                external_data_segment: None,
                 max_loaned_samples: factory
                     .service
                     .__internal_state()
@@ -143,6 +159,63 @@ impl<
         self
     }
 
+    /// Defines how many chunks that were returned by the
+    /// [`crate::port::subscriber::Subscriber`]s the [`Publisher`] keeps in a local cache. The
+    /// most recently returned chunk is loaned first so that its cache lines are likely still
+    /// hot. Cached chunks are not available to other loans of the shared pool, therefore the
+    /// value should stay small. `0` disables the cache.
+    pub fn chunk_cache_size(mut self, value: usize) -> Self {
+        self.config.chunk_cache_size = value;
+        self
+    }
+
+    /// Defines the time after which the [`crate::sample::Sample`]s sent by the [`Publisher`]
+    /// expire. It overrides the
+    /// [`sample_time_to_live()`](crate::service::static_config::publish_subscribe::StaticConfig::sample_time_to_live())
+    /// of the service.
+    pub fn time_to_live(mut self, value: Duration) -> Self {
+        self.config.time_to_live = Some(value);
+        self
+    }
+
+    /// Enables warm restarts for the [`Publisher`]. When the process of the [`Publisher`] dies,
+    /// its data segment and its connections to the [`crate::port::subscriber::Subscriber`]s are
+    /// retained instead of being cleaned up. The next [`Publisher`] that is created with the
+    /// same key adopts them, so that connected [`crate::port::subscriber::Subscriber`]s keep
+    /// their received samples and continue to receive without reconnecting.
+    ///
+    /// Only a predecessor with an identical [`AllocationStrategy::Static`] data segment, no
+    /// overflow segment and a service without a broadcast ring can be adopted, otherwise its
+    /// resources are removed and the [`Publisher`] starts with fresh ones. Retained resources
+    /// that are never adopted are removed together with the service.
+    pub fn warm_restart_key(mut self, value: u64) -> Self {
+        self.config.warm_restart_key = Some(value);
+        self
+    }
+
+    /// Uses the memory region of the [`FileDescriptor`], like a memfd that a driver produces
+    /// into, as data segment of the [`Publisher`] instead of creating one. The region is divided
+    /// into chunks that hold one sample each and must be large enough for all samples the
+    /// [`Publisher`] requires, otherwise the creation fails with
+    /// [`PublisherCreateError::UnableToCreateDataSegment`]. The offset of a loaned payload in the
+    /// region is returned by
+    /// [`SampleMutUninit::external_data_segment_offset()`](crate::sample_mut_uninit::SampleMutUninit::external_data_segment_offset()).
+    ///
+    /// The [`crate::port::subscriber::Subscriber`]s acquire a read-only [`FileDescriptor`] of
+    /// the region from the [`Publisher`] via file descriptor passing. It is opened via
+    /// `/proc/self/fd`, therefore the creation fails on platforms without it and for regions
+    /// that cannot be opened again, like a dma-buf. A
+    /// [`crate::port::subscriber::Subscriber`] receives samples only after it has acquired the
+    /// [`FileDescriptor`], samples that are sent before are not delivered to it.
+    ///
+    /// Cannot be combined with a broadcast ring or a
+    /// [`PortFactoryPublisher::warm_restart_key()`] and overrides the
+    /// [`AllocationStrategy`] and overflow settings.
+    pub fn external_data_segment(mut self, value: FileDescriptor) -> Self {
+        self.config.external_data_segment = Some(value);
+        self
+    }
+
     /// Sets the [`UnableToDeliverStrategy`].
     pub fn unable_to_deliver_strategy(mut self, value: UnableToDeliverStrategy) -> Self {
         self.config.unable_to_deliver_strategy = value;
@@ -197,4 +270,26 @@ impl<
         self.config.allocation_strategy = value;
         self
     }
+
+    /// Enables an overflow segment for slices that are larger than
+    /// [`PortFactoryPublisher::initial_max_slice_len()`] but do not justify enlarging every chunk
+    /// of the data segment. Slices with up to `value` elements are then served from a separate
+    /// shared memory segment that is created with the first oversized loan, all smaller slices
+    /// are still served from the regular data segment. A `value` that is not larger than
+    /// [`PortFactoryPublisher::initial_max_slice_len()`] disables the overflow segment.
+    ///
+    /// Only supported in combination with [`AllocationStrategy::Static`], all other strategies
+    /// resize the data segment instead.
+    pub fn overflow_max_slice_len(mut self, value: usize) -> Self {
+        self.config.overflow_max_slice_len = value;
+        self
+    }
+
+    /// Defines how many oversized slices can be in flight at the same time, see
+    /// [`PortFactoryPublisher::overflow_max_slice_len()`]. The value is clamped to the number of
+    /// samples of the regular data segment.
+    pub fn overflow_number_of_samples(mut self, value: usize) -> Self {
+        self.config.overflow_number_of_samples = value;
+        self
+    }
 }
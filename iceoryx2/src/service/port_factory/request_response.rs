@@ -139,11 +139,7 @@ impl<
         &self,
         callback: F,
     ) -> Result<(), NodeListFailure> {
-        nodes(
-            self.service.__internal_state().dynamic_storage.get(),
-            self.service.__internal_state().shared_node.config(),
-            callback,
-        )
+        nodes(self.service.__internal_state(), callback)
     }
 }
 
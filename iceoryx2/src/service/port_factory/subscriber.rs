@@ -30,11 +30,16 @@
 
 use core::fmt::Debug;
 
+extern crate alloc;
+use alloc::boxed::Box;
+
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_log::fail;
 
 use crate::{
     port::{
+        details::conflation_buffer::ConflationConfig,
+        downsampling::Downsampling,
         subscriber::{Subscriber, SubscriberCreateError},
         DegradationAction, DegradationCallback,
     },
@@ -47,6 +52,10 @@ use super::publish_subscribe::PortFactory;
 pub(crate) struct SubscriberConfig {
     pub(crate) buffer_size: Option<usize>,
     pub(crate) degradation_callback: Option<DegradationCallback<'static>>,
+    pub(crate) notify_on_data_arrival: bool,
+    pub(crate) group: Option<u64>,
+    pub(crate) downsampling: Option<Downsampling>,
+    pub(crate) conflation: Option<ConflationConfig>,
 }
 
 /// Factory to create a new [`Subscriber`] port/endpoint for
@@ -83,6 +92,10 @@ impl<
             config: SubscriberConfig {
                 buffer_size: None,
                 degradation_callback: None,
+                notify_on_data_arrival: false,
+                group: None,
+                downsampling: None,
+                conflation: None,
             },
             factory,
         }
@@ -94,6 +107,95 @@ impl<
         self
     }
 
+    /// Defines if the [`Subscriber`] shall be notified by the
+    /// [`Publisher`](crate::port::publisher::Publisher) whenever a new
+    /// [`Sample`](crate::sample::Sample) was delivered. When enabled, the [`Subscriber`] is
+    /// [`FileDescriptorBased`](iceoryx2_bb_posix::file_descriptor::FileDescriptorBased) and can
+    /// be attached directly to a [`WaitSet`](crate::waitset::WaitSet) without an additional
+    /// event service.
+    pub fn notify_on_data_arrival(mut self, value: bool) -> Self {
+        self.config.notify_on_data_arrival = value;
+        self
+    }
+
+    /// Adds the [`Subscriber`] to a group of competing consumers. Every
+    /// [`Sample`](crate::sample::Sample) is delivered to only one member of the group, the one
+    /// with the fewest unreceived samples in its buffer. Members of a group do not receive the
+    /// history of the [`Service`](crate::service::Service). Subscribers without a group still
+    /// receive every [`Sample`](crate::sample::Sample).
+    ///
+    /// Groups require the connection based delivery, a service with a
+    /// [`broadcast_ring_size()`](crate::service::builder::publish_subscribe::Builder::broadcast_ring_size())
+    /// does not support them.
+    pub fn group(mut self, value: u64) -> Self {
+        self.config.group = Some(value);
+        self
+    }
+
+    /// Requests that the [`Publisher`](crate::port::publisher::Publisher)s deliver only the
+    /// [`Sample`](crate::sample::Sample)s that match the [`Downsampling`] policy. The skipped
+    /// samples never enter the buffer of the [`Subscriber`].
+    ///
+    /// The policy requires the connection based delivery of a [`Subscriber`] that is not a
+    /// member of a [`PortFactorySubscriber::group()`]. A service with a
+    /// [`broadcast_ring_size()`](crate::service::builder::publish_subscribe::Builder::broadcast_ring_size())
+    /// does not support it.
+    pub fn downsampling(mut self, value: Downsampling) -> Self {
+        self.config.downsampling = Some(value);
+        self
+    }
+
+    /// Conflates the received [`Sample`](crate::sample::Sample)s by the key that `key_of`
+    /// extracts from the user header. Whenever the [`Subscriber`] receives, it drains its buffer
+    /// and keeps only the newest sample of every key, superseded samples are returned to the
+    /// [`Publisher`](crate::port::publisher::Publisher) right away. The keys are received in the
+    /// order of their first unreceived sample. At most `capacity` keys are stored, when a new key
+    /// arrives at a full buffer the oldest key is dropped.
+    ///
+    /// The stored samples are borrowed from the [`Publisher`](crate::port::publisher::Publisher)
+    /// and count towards
+    /// [`subscriber_max_borrowed_samples()`](crate::service::builder::publish_subscribe::Builder::subscriber_max_borrowed_samples()),
+    /// the drain stops when the limit is reached. A `capacity` that exceeds this limit lets the
+    /// creation fail with [`SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples`].
+    pub fn conflate_by_key<F: Fn(&UserHeader) -> u64 + Send + Sync + 'static>(
+        mut self,
+        capacity: usize,
+        key_of: F,
+    ) -> Self
+    where
+        UserHeader: 'static,
+    {
+        self.config.conflation = Some(ConflationConfig {
+            capacity,
+            key_of: Box::new(move |user_header| {
+                key_of(unsafe { &*(user_header as *const UserHeader) })
+            }),
+            required_user_header_size: 0,
+        });
+        self
+    }
+
+    /// Conflates by the [`u64`] key that is stored at `key_offset` bytes inside the user
+    /// header, see [`PortFactorySubscriber::conflate_by_key()`]. Used by the language bindings
+    /// that have no typed user header. When the key is not located completely inside the user
+    /// header of the [`Service`](crate::service::Service), the creation fails with
+    /// [`SubscriberCreateError::InvalidConflationKeyOffset`].
+    #[doc(hidden)]
+    pub fn __internal_conflate_by_key_at_offset(
+        mut self,
+        capacity: usize,
+        key_offset: usize,
+    ) -> Self {
+        self.config.conflation = Some(ConflationConfig {
+            capacity,
+            key_of: Box::new(move |user_header| unsafe {
+                (user_header.add(key_offset) as *const u64).read_unaligned()
+            }),
+            required_user_header_size: key_offset.saturating_add(core::mem::size_of::<u64>()),
+        });
+        self
+    }
+
     /// Sets the [`DegradationCallback`] of the [`Subscriber`]. Whenever a connection to a
     /// [`crate::port::subscriber::Subscriber`] is corrupted or it seems to be dead, this callback
     /// is called and depending on the returned [`DegradationAction`] measures will be taken.
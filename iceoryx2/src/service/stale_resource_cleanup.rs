@@ -10,7 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use iceoryx2_bb_log::fail;
+use iceoryx2_bb_log::{debug, fail};
+use iceoryx2_bb_posix::file::File;
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_cal::event::NamedConceptMgmt;
 use iceoryx2_cal::named_concept::NamedConceptListError;
@@ -18,9 +19,14 @@ use iceoryx2_cal::named_concept::NamedConceptRemoveError;
 use iceoryx2_cal::zero_copy_connection::{ZeroCopyConnection, ZeroCopyPortRemoveError};
 
 use crate::config;
+use crate::port::details::broadcast_ring::remove_receiver_from_broadcast_ring;
+use crate::port::port_identifiers::UniquePortId;
 use crate::service;
-use crate::service::config_scheme::data_segment_config;
-use crate::service::naming_scheme::data_segment_name;
+use crate::service::config_scheme::{data_segment_config, external_data_segment_request_path};
+use crate::service::dynamic_config::DynamicConfig;
+use crate::service::naming_scheme::{
+    broadcast_ring_name, data_segment_name, overflow_data_segment_name,
+};
 
 use super::config_scheme::connection_config;
 use super::naming_scheme::extract_receiver_port_id_from_connection;
@@ -50,6 +56,26 @@ pub(crate) unsafe fn remove_data_segment_of_port<Service: service::Service>(
         ), "Unable to remove the ports ({port_id}) data segment."
     );
 
+    fail!(from origin, when <Service::SharedMemory as NamedConceptMgmt>::remove_cfg(
+            &overflow_data_segment_name(&data_segment_name(port_id)),
+            &data_segment_config::<Service>(config),
+        ), "Unable to remove the ports ({port_id}) overflow data segment."
+    );
+
+    fail!(from origin, when <Service::SharedMemory as NamedConceptMgmt>::remove_cfg(
+            &broadcast_ring_name(&data_segment_name(port_id)),
+            &data_segment_config::<Service>(config),
+        ), "Unable to remove the ports ({port_id}) broadcast ring."
+    );
+
+    if let Err(e) = File::remove(&external_data_segment_request_path::<Service>(
+        config,
+        &data_segment_name(port_id),
+    )) {
+        debug!(from origin,
+            "Unable to remove the request socket of the ports ({port_id}) external data segment ({:?}).", e);
+    }
+
     Ok(())
 }
 
@@ -175,3 +201,76 @@ pub(crate) unsafe fn remove_receiver_port_from_all_connections<Service: service:
 
     ret_val
 }
+
+/// Releases the samples the dead receiver port has pinned in the broadcast rings of all senders
+/// it is connected to. Must be called before the receiver is removed from its connections.
+pub(crate) unsafe fn remove_receiver_port_from_all_broadcast_rings<Service: service::Service>(
+    port_id: u128,
+    config: &config::Config,
+) -> Result<(), RemovePortFromAllConnectionsError> {
+    let origin = format!(
+        "remove_receiver_port_from_all_broadcast_rings::<{}>::({:?})",
+        core::any::type_name::<Service>(),
+        port_id
+    );
+    let msg = "Unable to remove the receiver port from all broadcast rings";
+
+    let connection_config = connection_config::<Service>(config);
+    let connection_list = connections::<Service>(&origin, msg, &connection_config)?;
+
+    let mut ret_val = Ok(());
+    for connection in connection_list {
+        if extract_receiver_port_id_from_connection(&connection) != Some(port_id) {
+            continue;
+        }
+
+        if let Some(sender_port_id) = extract_sender_port_id_from_connection(&connection) {
+            if let Err(e) =
+                remove_receiver_from_broadcast_ring::<Service>(sender_port_id, port_id, config)
+            {
+                debug!(from origin,
+                    "{} since the broadcast ring of the sender ({:?}) could not be opened ({:?}).",
+                    msg, sender_port_id, e);
+                ret_val = Err(RemovePortFromAllConnectionsError::InternalError);
+            }
+        }
+    }
+
+    ret_val
+}
+
+/// Removes the connections and the data segment of a publisher that was retained for a warm
+/// restart but will never be adopted.
+pub(crate) unsafe fn remove_retained_publisher<Service: service::Service>(
+    port_id: u128,
+    config: &config::Config,
+) {
+    let origin = format!(
+        "remove_retained_publisher::<{}>::({:?})",
+        core::any::type_name::<Service>(),
+        port_id
+    );
+
+    if let Err(e) = remove_sender_port_from_all_connections::<Service>(port_id, config) {
+        debug!(from origin,
+            "Failed to remove the retained publisher from all of its connections ({:?}).", e);
+    }
+
+    if let Err(e) = remove_data_segment_of_port::<Service>(port_id, config) {
+        debug!(from origin,
+            "Failed to remove the data segment of the retained publisher ({:?}).", e);
+    }
+}
+
+/// Removes all ports of the service that were retained beyond the lifetime of their node
+/// together with their resources. Must only be called when no node owns the service anymore.
+pub(crate) unsafe fn remove_retained_ports<Service: service::Service>(
+    dynamic_config: &DynamicConfig,
+    config: &config::Config,
+) {
+    dynamic_config.remove_retained_ports(|port_id| {
+        if let UniquePortId::Publisher(id) = port_id {
+            remove_retained_publisher::<Service>(id.value(), config);
+        }
+    });
+}
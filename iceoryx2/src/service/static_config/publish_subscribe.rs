@@ -24,15 +24,21 @@
 //! println!("type details:                     {:?}", pubsub.static_config().message_type_details());
 //! println!("max publishers:                   {:?}", pubsub.static_config().max_publishers());
 //! println!("max subscribers:                  {:?}", pubsub.static_config().max_subscribers());
+//! println!("max additional subscribers:       {:?}", pubsub.static_config().max_additional_subscribers());
 //! println!("subscriber buffer size:           {:?}", pubsub.static_config().subscriber_max_buffer_size());
 //! println!("history size:                     {:?}", pubsub.static_config().history_size());
 //! println!("subscriber max borrowed samples:  {:?}", pubsub.static_config().subscriber_max_borrowed_samples());
 //! println!("safe overflow:                    {:?}", pubsub.static_config().has_safe_overflow());
+//! println!("broadcast ring size:              {:?}", pubsub.static_config().broadcast_ring_size());
+//! println!("number of priority lanes:         {:?}", pubsub.static_config().number_of_priority_lanes());
+//! println!("sample time to live:              {:?}", pubsub.static_config().sample_time_to_live());
 //!
 //! # Ok(())
 //! # }
 //! ```
 
+use core::time::Duration;
+
 use super::message_type_details::MessageTypeDetails;
 use crate::config;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
@@ -47,12 +53,16 @@ use serde::{Deserialize, Serialize};
 #[repr(C)]
 pub struct StaticConfig {
     pub(crate) max_subscribers: usize,
+    pub(crate) max_additional_subscribers: usize,
     pub(crate) max_publishers: usize,
     pub(crate) max_nodes: usize,
     pub(crate) history_size: usize,
     pub(crate) subscriber_max_buffer_size: usize,
     pub(crate) subscriber_max_borrowed_samples: usize,
     pub(crate) enable_safe_overflow: bool,
+    pub(crate) broadcast_ring_size: usize,
+    pub(crate) number_of_priority_lanes: usize,
+    pub(crate) sample_time_to_live: Option<Duration>,
     pub(crate) message_type_details: MessageTypeDetails,
 }
 
@@ -60,6 +70,7 @@ impl StaticConfig {
     pub(crate) fn new(config: &config::Config) -> Self {
         Self {
             max_subscribers: config.defaults.publish_subscribe.max_subscribers,
+            max_additional_subscribers: 0,
             max_publishers: config.defaults.publish_subscribe.max_publishers,
             max_nodes: config.defaults.publish_subscribe.max_nodes,
             history_size: config.defaults.publish_subscribe.publisher_history_size,
@@ -72,15 +83,39 @@ impl StaticConfig {
                 .publish_subscribe
                 .subscriber_max_borrowed_samples,
             enable_safe_overflow: config.defaults.publish_subscribe.enable_safe_overflow,
+            broadcast_ring_size: 0,
+            number_of_priority_lanes: 1,
+            sample_time_to_live: None,
             message_type_details: MessageTypeDetails::default(),
         }
     }
 
+    /// Returns the number of subscribers the service supports at most, including all that can
+    /// be added later with
+    /// [`PortFactory::increase_port_capacity()`](crate::service::port_factory::publish_subscribe::PortFactory::increase_port_capacity()).
+    pub(crate) fn max_subscribers_including_additional_ones(&self) -> usize {
+        self.max_subscribers + self.max_additional_subscribers
+    }
+
+    /// Returns the number of samples a publisher requires to serve every subscriber the service
+    /// can ever have, see [`StaticConfig::max_additional_subscribers()`].
     pub(crate) fn required_amount_of_samples_per_data_segment(
         &self,
         publisher_max_loaned_data: usize,
     ) -> usize {
-        self.max_subscribers
+        let max_subscribers = self.max_subscribers_including_additional_ones();
+
+        // every ring entry holds a sample and every sample a subscriber has borrowed can be
+        // overwritten in the ring while it is still in use
+        if self.broadcast_ring_size != 0 {
+            return self.broadcast_ring_size
+                + max_subscribers * self.subscriber_max_borrowed_samples
+                + publisher_max_loaned_data;
+        }
+
+        // every priority lane has its own buffer and borrow limit
+        max_subscribers
+            * self.number_of_priority_lanes
             * (self.subscriber_max_buffer_size + self.subscriber_max_borrowed_samples)
             + self.history_size
             + publisher_max_loaned_data
@@ -102,6 +137,13 @@ impl StaticConfig {
         self.max_subscribers
     }
 
+    /// Returns by how many [`crate::port::subscriber::Subscriber`] ports the capacity of the
+    /// [`crate::service::Service`] can be increased at runtime. Every
+    /// [`crate::port::publisher::Publisher`] reserves samples for them.
+    pub fn max_additional_subscribers(&self) -> usize {
+        self.max_additional_subscribers
+    }
+
     /// Returns the maximum history size that can be requested on connect.
     pub fn history_size(&self) -> usize {
         self.history_size
@@ -126,6 +168,27 @@ impl StaticConfig {
         self.enable_safe_overflow
     }
 
+    /// Returns the number of entries of the broadcast ring via which the
+    /// [`crate::port::publisher::Publisher`]s deliver their samples. When it is 0 the samples
+    /// are delivered into the buffer of every [`crate::port::subscriber::Subscriber`].
+    pub fn broadcast_ring_size(&self) -> usize {
+        self.broadcast_ring_size
+    }
+
+    /// Returns the number of priority lanes of every connection between a
+    /// [`crate::port::publisher::Publisher`] and a [`crate::port::subscriber::Subscriber`].
+    /// Every lane has its own buffer, samples in a higher lane are received first.
+    pub fn number_of_priority_lanes(&self) -> usize {
+        self.number_of_priority_lanes
+    }
+
+    /// Returns the time after which a sent [`crate::sample::Sample`] expires. Expired samples
+    /// are discarded by the [`crate::port::subscriber::Subscriber`] instead of being received.
+    /// When it is [`None`] the samples never expire.
+    pub fn sample_time_to_live(&self) -> Option<Duration> {
+        self.sample_time_to_live
+    }
+
     /// Returns the type details of the [`crate::service::Service`].
     pub fn message_type_details(&self) -> &MessageTypeDetails {
         &self.message_type_details
@@ -72,6 +72,44 @@
 //! # }
 //! ```
 //!
+//! ## Subscriber Notification
+//!
+//! A [`Subscriber`](crate::port::subscriber::Subscriber) that was created with
+//! [`notify_on_data_arrival()`](crate::service::port_factory::subscriber::PortFactorySubscriber::notify_on_data_arrival())
+//! can be attached directly. The [`WaitSet`](crate::waitset::WaitSet) wakes up whenever a new
+//! sample arrives, no additional event service is required.
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! # let pubsub = node.service_builder(&"MyServiceName".try_into()?)
+//! #     .publish_subscribe::<u64>()
+//! #     .open_or_create()?;
+//!
+//! let subscriber = pubsub.subscriber_builder()
+//!     .notify_on_data_arrival(true)
+//!     .create()?;
+//!
+//! let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+//! let guard = waitset.attach_notification(&subscriber)?;
+//!
+//! let on_event = |attachment_id: WaitSetAttachmentId<ipc::Service>| {
+//!     if attachment_id.has_event_from(&guard) {
+//!         // receive until the buffer is empty, this consumes the notification
+//!         while let Ok(Some(sample)) = subscriber.receive() {
+//!             println!("received: {:?}", *sample);
+//!         }
+//!     }
+//!     CallbackProgression::Continue
+//! };
+//!
+//! waitset.wait_and_process(on_event)?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
 //! ## Deadline
 //!
 //! ```no_run
@@ -185,6 +223,74 @@
 //! # }
 //! ```
 //!
+//! ## Prioritized Attachments
+//!
+//! When multiple attachments become ready in the same wakeup, the callback is called for the
+//! attachments with the highest priority first. With
+//! [`WaitSetBuilder::processing_budget()`](crate::waitset::WaitSetBuilder::processing_budget())
+//! the time spent in one wakeup can be bounded, notifications that could not be handled within
+//! the budget are deferred to the next wakeup.
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! # use core::time::Duration;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! # let control_event = node.service_builder(&"Control".try_into()?)
+//! #     .event()
+//! #     .open_or_create()?;
+//! # let telemetry_event = node.service_builder(&"Telemetry".try_into()?)
+//! #     .event()
+//! #     .open_or_create()?;
+//!
+//! let control = control_event.listener_builder().create()?;
+//! let telemetry = telemetry_event.listener_builder().create()?;
+//!
+//! let waitset = WaitSetBuilder::new()
+//!                 .processing_budget(Duration::from_micros(500))
+//!                 .create::<ipc::Service>()?;
+//!
+//! let control_guard = waitset.attach_notification(&control)?;
+//! let telemetry_guard = waitset.attach_notification(&telemetry)?;
+//! control_guard.set_priority(10);
+//!
+//! let on_event = |attachment_id: WaitSetAttachmentId<ipc::Service>| {
+//!     if attachment_id.has_event_from(&control_guard) {
+//!         // always handled before the telemetry
+//!         while let Ok(Some(_)) = control.try_wait_one() {}
+//!     } else if attachment_id.has_event_from(&telemetry_guard) {
+//!         while let Ok(Some(_)) = telemetry.try_wait_one() {}
+//!     }
+//!     CallbackProgression::Continue
+//! };
+//!
+//! waitset.wait_and_process(on_event)?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
+//! ## Running The [`WaitSet`](crate::waitset::WaitSet) On An Isolated CPU Core
+//!
+//! The [`WaitSetBuilder`](crate::waitset::WaitSetBuilder) can configure the thread that
+//! creates and runs the [`WaitSet`](crate::waitset::WaitSet) for deterministic latency. It is
+//! pinned to a CPU core, scheduled with `SCHED_FIFO` and all memory of the process is locked
+//! so that it cannot be swapped out.
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let waitset = WaitSetBuilder::new()
+//!                 .cpu_affinity(3)
+//!                 .realtime_priority(80)
+//!                 .lock_memory(true)
+//!                 .create::<ipc::Service>()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
 //! ## Using [`WaitSet`](crate::waitset::WaitSet) Without [`Signal`](iceoryx2_bb_posix::signal::Signal) Handling
 //!
 //! This example demonstrates how the [`WaitSet`](crate::waitset::WaitSet) can be used when
@@ -214,24 +320,31 @@
 //! # }
 
 use core::{
-    cell::RefCell, fmt::Debug, hash::Hash, marker::PhantomData, sync::atomic::Ordering,
-    time::Duration,
+    cell::RefCell, cmp::Reverse, fmt::Debug, hash::Hash, marker::PhantomData,
+    sync::atomic::Ordering, time::Duration,
 };
 use std::collections::HashMap;
 
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_log::fail;
 use iceoryx2_bb_posix::{
+    clock::{ClockType, Time},
     deadline_queue::{DeadlineQueue, DeadlineQueueBuilder, DeadlineQueueGuard, DeadlineQueueIndex},
     file_descriptor::FileDescriptor,
     file_descriptor_set::SynchronousMultiplexing,
+    memory_lock::{LockMode, MemoryLock, MemoryLockAllError},
+    scheduler::{Scheduler, SchedulerApplyError},
     signal::SignalHandler,
+    system_configuration::SystemInfo,
+    thread::{ThreadHandle, ThreadProperties},
 };
 use iceoryx2_cal::reactor::*;
 use iceoryx2_pal_concurrency_sync::iox_atomic::IoxAtomicUsize;
 
 use crate::signal_handling_mode::SignalHandlingMode;
 
+pub use iceoryx2_cal::reactor::ReactorMechanism;
+
 /// States why the [`WaitSet::wait_and_process()`] method returned.
 #[derive(Debug, PartialEq, Eq, Copy, Clone)]
 pub enum WaitSetRunResult {
@@ -253,6 +366,10 @@ pub enum WaitSetAttachmentError {
     InsufficientCapacity,
     /// The attachment is already attached.
     AlreadyAttached,
+    /// The attachment does not provide a file descriptor, e.g. a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) that was created without
+    /// [`PortFactorySubscriber::notify_on_data_arrival()`](crate::service::port_factory::subscriber::PortFactorySubscriber::notify_on_data_arrival()).
+    NotMultiplexable,
     /// An internal error has occurred.
     InternalError,
 }
@@ -289,6 +406,16 @@ impl core::error::Error for WaitSetRunError {}
 pub enum WaitSetCreateError {
     /// An internal error has occurred.
     InternalError,
+    /// The CPU core provided with [`WaitSetBuilder::cpu_affinity()`] does not exist.
+    InvalidCpuCore,
+    /// The process lacks the privileges to apply the
+    /// [`WaitSetBuilder::realtime_priority()`] or [`WaitSetBuilder::lock_memory()`] setting.
+    InsufficientPermissions,
+    /// The memory of the process could not be locked, see [`WaitSetBuilder::lock_memory()`].
+    UnableToLockMemory,
+    /// The [`ReactorMechanism`] provided with [`WaitSetBuilder::reactor_mechanism()`] is not
+    /// supported on this platform.
+    UnsupportedReactorMechanism,
 }
 
 impl core::fmt::Display for WaitSetCreateError {
@@ -306,6 +433,12 @@ enum AttachmentIdType {
     Notification(u64, i32),
 }
 
+#[derive(Debug, Clone, Copy, Hash, Eq, PartialEq)]
+enum PriorityKey {
+    Reactor(i32),
+    DeadlineQueue(DeadlineQueueIndex),
+}
+
 /// Represents an attachment to the [`WaitSet`]
 #[derive(Clone, Copy)]
 pub struct WaitSetAttachmentId<Service: crate::service::Service> {
@@ -456,12 +589,37 @@ where
     guard_type: GuardType<'waitset, 'attachment, Service>,
 }
 
+impl<Service: crate::service::Service> WaitSetGuard<'_, '_, Service> {
+    /// Sets the priority of the attachment. When multiple attachments are ready in the same
+    /// wakeup, the attachments with the higher priority are handled first. Attachments with
+    /// the same priority are handled in the order provided by the underlying reactor.
+    /// The default priority is `0`.
+    pub fn set_priority(&self, priority: u8) {
+        self.waitset.set_priority(self.priority_key(), priority);
+    }
+
+    /// Returns the priority of the attachment.
+    pub fn priority(&self) -> u8 {
+        self.waitset.priority_of(&self.priority_key())
+    }
+
+    fn priority_key(&self) -> PriorityKey {
+        match &self.guard_type {
+            GuardType::Tick(t) => PriorityKey::DeadlineQueue(t.index()),
+            GuardType::Deadline(r, _) | GuardType::Notification(r) => {
+                PriorityKey::Reactor(unsafe { r.file_descriptor().native_handle() })
+            }
+        }
+    }
+}
+
 impl<Service: crate::service::Service> Drop for WaitSetGuard<'_, '_, Service> {
     fn drop(&mut self) {
         if let GuardType::Deadline(r, t) = &self.guard_type {
             self.waitset
                 .remove_deadline(unsafe { r.file_descriptor().native_handle() }, t.index())
         }
+        self.waitset.set_priority(self.priority_key(), 0);
         self.waitset.detach();
     }
 }
@@ -470,6 +628,11 @@ impl<Service: crate::service::Service> Drop for WaitSetGuard<'_, '_, Service> {
 #[derive(Default, Debug)]
 pub struct WaitSetBuilder {
     signal_handling_mode: SignalHandlingMode,
+    processing_budget: Option<Duration>,
+    cpu_affinity: Option<usize>,
+    realtime_priority: Option<u8>,
+    lock_memory: bool,
+    reactor_mechanism: ReactorMechanism,
 }
 
 impl WaitSetBuilder {
@@ -487,16 +650,122 @@ impl WaitSetBuilder {
         self
     }
 
-    /// Creates the [`WaitSet`].
+    /// Defines the maximum time the [`WaitSet`] spends in calling the users callback in one
+    /// wakeup. When the budget is exhausted, the remaining notifications are deferred to the next
+    /// wakeup. Since the attachments are handled in the order of their priority, see
+    /// [`WaitSetGuard::set_priority()`], low priority notifications are deferred first.
+    /// Missed deadlines and ticks are never deferred since they would be lost otherwise.
+    ///
+    /// At least one attachment is handled per wakeup, independent of the budget.
+    pub fn processing_budget(mut self, value: Duration) -> Self {
+        self.processing_budget = Some(value);
+        self
+    }
+
+    /// Pins the thread that creates the [`WaitSet`] to the provided CPU core. Since the
+    /// [`WaitSet`] is bound to the thread that created it, the event loop runs on this core.
+    /// The core must be in the range `[0, number of cpu cores)`.
+    pub fn cpu_affinity(mut self, cpu_core: usize) -> Self {
+        self.cpu_affinity = Some(cpu_core);
+        self
+    }
+
+    /// Schedules the thread that creates the [`WaitSet`] with the realtime scheduler
+    /// `SCHED_FIFO` whereby `0` represents the lowest and `255` the highest priority.
+    /// Requires elevated privileges, e.g. `CAP_SYS_NICE`.
+    pub fn realtime_priority(mut self, priority: u8) -> Self {
+        self.realtime_priority = Some(priority);
+        self
+    }
+
+    /// Locks all current and future memory pages of the process into RAM so that the event
+    /// loop never waits for a page to be swapped in. It affects the whole process and
+    /// requires elevated privileges or a sufficient `RLIMIT_MEMLOCK`.
+    pub fn lock_memory(mut self, value: bool) -> Self {
+        self.lock_memory = value;
+        self
+    }
+
+    /// Defines the [`ReactorMechanism`] the [`WaitSet`] uses to wait on its attachments. With
+    /// many attachments [`ReactorMechanism::Epoll`] scales better than the default
+    /// [`ReactorMechanism::Select`] since the attachments are registered only once and a wakeup
+    /// reports only the ready attachments. It is available on Linux only.
+    /// [`ReactorMechanism::IoUring`] registers the attachments as multishot polls and reaps
+    /// the ready ones from a ring shared with the kernel. When io_uring is not available at
+    /// runtime, the [`WaitSet`] falls back to [`ReactorMechanism::Epoll`].
+    pub fn reactor_mechanism(mut self, value: ReactorMechanism) -> Self {
+        self.reactor_mechanism = value;
+        self
+    }
+
+    fn configure_calling_thread(&self) -> Result<(), WaitSetCreateError> {
+        let msg = "Unable to configure the WaitSet thread";
+
+        if let Some(cpu_core) = self.cpu_affinity {
+            let number_of_cores = SystemInfo::NumberOfCpuCores.value();
+            if cpu_core >= number_of_cores {
+                fail!(from self, with WaitSetCreateError::InvalidCpuCore,
+                    "{msg} since the cpu core {cpu_core} is not in the range of available cores [0, {number_of_cores}).");
+            }
+
+            fail!(from self, when ThreadHandle::from_self().set_affinity(cpu_core),
+                with WaitSetCreateError::InvalidCpuCore,
+                "{msg} since the affinity to cpu core {cpu_core} could not be set.");
+        }
+
+        if let Some(priority) = self.realtime_priority {
+            match Scheduler::Fifo.apply_to_calling_thread(priority) {
+                Ok(()) => (),
+                Err(SchedulerApplyError::InsufficientPermissions) => {
+                    fail!(from self, with WaitSetCreateError::InsufficientPermissions,
+                        "{msg} since the privileges are insufficient to apply SCHED_FIFO with priority {priority}.");
+                }
+                Err(e) => {
+                    fail!(from self, with WaitSetCreateError::InternalError,
+                        "{msg} since SCHED_FIFO with priority {priority} could not be applied ({:?}).", e);
+                }
+            }
+        }
+
+        if self.lock_memory {
+            for mode in [
+                LockMode::LockAllPagesCurrentlyMapped,
+                LockMode::LockAllPagesThatBecomeMapped,
+            ] {
+                match MemoryLock::lock_all(mode) {
+                    Ok(()) => (),
+                    Err(MemoryLockAllError::InsufficientPermissions) => {
+                        fail!(from self, with WaitSetCreateError::InsufficientPermissions,
+                            "{msg} since the privileges are insufficient to lock the memory.");
+                    }
+                    Err(e) => {
+                        fail!(from self, with WaitSetCreateError::UnableToLockMemory,
+                            "{msg} since the memory could not be locked ({:?}).", e);
+                    }
+                }
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Creates the [`WaitSet`]. When [`WaitSetBuilder::cpu_affinity()`],
+    /// [`WaitSetBuilder::realtime_priority()`] or [`WaitSetBuilder::lock_memory()`] are set,
+    /// they are applied to the calling thread first.
     pub fn create<Service: crate::service::Service>(
         self,
     ) -> Result<WaitSet<Service>, WaitSetCreateError> {
         let msg = "Unable to create WaitSet";
+        self.configure_calling_thread()?;
+
         let deadline_queue = fail!(from self, when DeadlineQueueBuilder::new().create(),
                 with WaitSetCreateError::InternalError,
                 "{msg} since the underlying Timer could not be created.");
 
-        match <Service::Reactor as Reactor>::Builder::new().create() {
+        match <Service::Reactor as Reactor>::Builder::new()
+            .mechanism(self.reactor_mechanism)
+            .create()
+        {
             Ok(reactor) => Ok(WaitSet {
                 reactor,
                 deadline_queue,
@@ -504,7 +773,14 @@ impl WaitSetBuilder {
                 deadline_to_attachment: RefCell::new(HashMap::new()),
                 attachment_counter: IoxAtomicUsize::new(0),
                 signal_handling_mode: self.signal_handling_mode,
+                priorities: RefCell::new(HashMap::new()),
+                processing_budget: self.processing_budget,
             }),
+            Err(ReactorCreateError::UnsupportedMechanism) => {
+                fail!(from self, with WaitSetCreateError::UnsupportedReactorMechanism,
+                    "{msg} since the reactor mechanism {:?} is not supported on this platform.",
+                    self.reactor_mechanism);
+            }
             Err(ReactorCreateError::UnknownError(e)) => {
                 fail!(from self, with WaitSetCreateError::InternalError,
                     "{msg} due to an internal error (error code = {})", e);
@@ -532,9 +808,39 @@ pub struct WaitSet<Service: crate::service::Service> {
     deadline_to_attachment: RefCell<HashMap<DeadlineQueueIndex, i32>>,
     attachment_counter: IoxAtomicUsize,
     signal_handling_mode: SignalHandlingMode,
+    priorities: RefCell<HashMap<PriorityKey, u8>>,
+    processing_budget: Option<Duration>,
 }
 
 impl<Service: crate::service::Service> WaitSet<Service> {
+    fn set_priority(&self, key: PriorityKey, priority: u8) {
+        // only non-default priorities are stored so that the WaitSet can use the fast path
+        // without any ordering when no priorities are defined
+        if priority == 0 {
+            self.priorities.borrow_mut().remove(&key);
+        } else {
+            self.priorities.borrow_mut().insert(key, priority);
+        }
+    }
+
+    fn has_prioritized_processing(&self) -> bool {
+        !self.priorities.borrow().is_empty() || self.processing_budget.is_some()
+    }
+
+    fn priority_of(&self, key: &PriorityKey) -> u8 {
+        self.priorities.borrow().get(key).copied().unwrap_or(0)
+    }
+
+    fn priority_of_attachment(&self, attachment: &WaitSetAttachmentId<Service>) -> u8 {
+        let key = match attachment.attachment_type {
+            AttachmentIdType::Tick(_, idx) => PriorityKey::DeadlineQueue(idx),
+            AttachmentIdType::Deadline(_, fd, _) | AttachmentIdType::Notification(_, fd) => {
+                PriorityKey::Reactor(fd)
+            }
+        };
+        self.priority_of(&key)
+    }
+
     fn detach(&self) {
         self.attachment_counter.fetch_sub(1, Ordering::Relaxed);
     }
@@ -620,6 +926,14 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         // must be called after the deadlines have been reset, in the case that the
         // event has been received shortly before the deadline ended.
 
+        if self.has_prioritized_processing() {
+            return self.handle_prioritized_attachments(
+                triggered_file_descriptors,
+                fn_call,
+                error_msg,
+            );
+        }
+
         match self.handle_deadlines(fn_call, error_msg)? {
             WaitSetRunResult::AllEventsHandled => (),
             v => return Ok(v),
@@ -635,6 +949,73 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         Ok(WaitSetRunResult::AllEventsHandled)
     }
 
+    fn handle_prioritized_attachments<
+        F: FnMut(WaitSetAttachmentId<Service>) -> CallbackProgression,
+    >(
+        &self,
+        triggered_file_descriptors: &Vec<i32>,
+        fn_call: &mut F,
+        error_msg: &str,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        let start = fail!(from self, when Time::now_with_clock(ClockType::Monotonic),
+                with WaitSetRunError::InternalError,
+                "{error_msg} since the current time required for the processing budget could not be acquired.");
+
+        let mut ready_attachments = Vec::with_capacity(triggered_file_descriptors.len());
+
+        {
+            let deadline_to_attachment = self.deadline_to_attachment.borrow();
+            let collect = |idx: DeadlineQueueIndex| -> CallbackProgression {
+                ready_attachments.push(match deadline_to_attachment.get(&idx) {
+                    Some(reactor_idx) => WaitSetAttachmentId::deadline(self, *reactor_idx, idx),
+                    None => WaitSetAttachmentId::tick(self, idx),
+                });
+                CallbackProgression::Continue
+            };
+
+            fail!(from self,
+                  when self.deadline_queue.missed_deadlines(collect),
+                  with WaitSetRunError::InternalError,
+                  "{error_msg} since the missed deadlines could not be acquired.");
+        }
+
+        for fd in triggered_file_descriptors {
+            ready_attachments.push(WaitSetAttachmentId::notification(self, *fd));
+        }
+
+        // stable sort, attachments with the same priority keep the order of the reactor
+        ready_attachments
+            .sort_by_key(|attachment| Reverse(self.priority_of_attachment(attachment)));
+
+        let mut is_budget_exhausted = false;
+        for attachment in ready_attachments {
+            let is_notification = matches!(
+                attachment.attachment_type,
+                AttachmentIdType::Notification(..)
+            );
+
+            // the reactor reports the deferred notifications again on the next wakeup
+            if is_budget_exhausted && is_notification {
+                continue;
+            }
+
+            if let CallbackProgression::Stop = fn_call(attachment) {
+                return Ok(WaitSetRunResult::StopRequest);
+            }
+
+            if let Some(budget) = self.processing_budget {
+                if !is_budget_exhausted {
+                    let elapsed = fail!(from self, when start.elapsed(),
+                            with WaitSetRunError::InternalError,
+                            "{error_msg} since the elapsed time of the processing budget could not be acquired.");
+                    is_budget_exhausted = budget <= elapsed;
+                }
+            }
+        }
+
+        Ok(WaitSetRunResult::AllEventsHandled)
+    }
+
     /// Attaches an object as notification to the [`WaitSet`]. Whenever an event is received on the
     /// object the [`WaitSet`] informs the user in [`WaitSet::wait_and_process()`] to handle the event.
     /// The object cannot be attached twice and the
@@ -904,7 +1285,7 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         };
 
         match reactor_wait_result {
-            Ok(0) => self.handle_deadlines(&mut fn_call, msg),
+            Ok(0) if !self.has_prioritized_processing() => self.handle_deadlines(&mut fn_call, msg),
             Ok(_) => self.handle_all_attachments(&triggered_file_descriptors, &mut fn_call, msg),
             Err(ReactorWaitError::Interrupt) => Ok(WaitSetRunResult::Interrupt),
             Err(ReactorWaitError::InsufficientPermissions) => {
@@ -938,6 +1319,12 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         self.signal_handling_mode
     }
 
+    /// Returns the processing budget per wakeup with which the [`WaitSet`] was created.
+    /// See [`WaitSetBuilder::processing_budget()`].
+    pub fn processing_budget(&self) -> Option<Duration> {
+        self.processing_budget
+    }
+
     fn attach_to_reactor<'waitset, 'attachment, T: SynchronousMultiplexing + Debug>(
         &'waitset self,
         attachment: &'attachment T,
@@ -945,6 +1332,11 @@ impl<Service: crate::service::Service> WaitSet<Service> {
     {
         let msg = "Unable to attach object to internal reactor";
 
+        if !attachment.is_multiplexable() {
+            fail!(from self, with WaitSetAttachmentError::NotMultiplexable,
+                "{msg} {:?} since it does not provide a file descriptor.", attachment);
+        }
+
         match self.reactor.attach(attachment) {
             Ok(guard) => Ok(guard),
             Err(ReactorAttachError::AlreadyAttached) => {
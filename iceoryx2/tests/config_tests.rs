@@ -42,3 +42,22 @@ mod node_name {
         assert_that!(default_config, eq file_config);
     }
 }
+
+mod profiles {
+    use iceoryx2::config::Profiles;
+    use iceoryx2_bb_testing::assert_that;
+
+    #[test]
+    fn missing_profiles_are_replaced_with_the_built_in_profiles() {
+        let default_profiles = Profiles::default();
+        let mut low_latency = default_profiles.low_latency.clone();
+        low_latency.max_subscribers += 1;
+
+        let profiles_toml = format!("[low-latency]\n{}", toml::to_string(&low_latency).unwrap());
+        let sut: Profiles = toml::from_str(&profiles_toml).unwrap();
+
+        assert_that!(sut.low_latency, eq low_latency);
+        assert_that!(sut.high_throughput, eq default_profiles.high_throughput);
+        assert_that!(sut.low_memory, eq default_profiles.low_memory);
+    }
+}
@@ -12,12 +12,18 @@
 
 #[generic_tests::define]
 mod listener {
+    use core::time::Duration;
     use std::collections::HashSet;
 
+    use iceoryx2::prelude::EventId;
     use iceoryx2::testing::*;
     use iceoryx2::{node::NodeBuilder, port::listener::ListenerCreateError, service::Service};
+    use iceoryx2_bb_posix::file_descriptor_set::{FileDescriptorSet, FileEvent};
     use iceoryx2_bb_testing::assert_that;
 
+    const TIMEOUT: Duration = Duration::from_millis(50);
+    const EVENT_ID_MAX_VALUE: usize = 64;
+
     #[test]
     fn create_error_display_works<S: Service>() {
         assert_that!(
@@ -37,6 +43,7 @@ mod listener {
             .service_builder(&service_name)
             .event()
             .max_listeners(MAX_LISTENERS)
+            .event_id_max_value(EVENT_ID_MAX_VALUE)
             .create()
             .unwrap();
 
@@ -50,9 +57,69 @@ mod listener {
         }
     }
 
+    #[test]
+    fn file_descriptor_signals_notifications_of_new_and_existing_notifiers<Sut: Service>() {
+        let service_name = generate_service_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let service = node
+            .service_builder(&service_name)
+            .event()
+            .event_id_max_value(EVENT_ID_MAX_VALUE)
+            .create()
+            .unwrap();
+
+        let sut = service.listener_builder().create().unwrap();
+        let fd_set = FileDescriptorSet::new();
+        let _guard = fd_set.add(&sut).unwrap();
+
+        // the notifier is created before the listener waits for the first time
+        let notifier_1 = service.notifier_builder().create().unwrap();
+        notifier_1
+            .notify_with_custom_event_id(EventId::new(3))
+            .unwrap();
+
+        let result = fd_set.timed_wait(TIMEOUT, FileEvent::Read, |_| {});
+        assert_that!(result, eq Ok(1));
+
+        let mut ids = vec![];
+        sut.try_wait_all(|id| ids.push(id)).unwrap();
+        assert_that!(ids, eq vec![EventId::new(3)]);
+
+        // the notifier is created after the listener has already waited
+        let notifier_2 = service.notifier_builder().create().unwrap();
+        notifier_2
+            .notify_with_custom_event_id(EventId::new(5))
+            .unwrap();
+        notifier_1
+            .notify_with_custom_event_id(EventId::new(7))
+            .unwrap();
+
+        let result = fd_set.timed_wait(TIMEOUT, FileEvent::Read, |_| {});
+        assert_that!(result, eq Ok(1));
+
+        let mut ids = HashSet::new();
+        sut.try_wait_all(|id| {
+            ids.insert(id);
+        })
+        .unwrap();
+        assert_that!(ids, len 2);
+        assert_that!(ids.contains(&EventId::new(5)), eq true);
+        assert_that!(ids.contains(&EventId::new(7)), eq true);
+
+        let mut ids = vec![];
+        sut.try_wait_all(|id| ids.push(id)).unwrap();
+        assert_that!(ids, len 0);
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
     #[instantiate_tests(<iceoryx2::service::local::Service>)]
     mod local {}
+
+    #[cfg(target_os = "linux")]
+    #[instantiate_tests(<iceoryx2::service::ipc_eventfd::Service>)]
+    mod ipc_eventfd {}
 }
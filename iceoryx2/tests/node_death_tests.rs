@@ -14,7 +14,10 @@
 mod node_death_tests {
     use core::sync::atomic::{AtomicU32, Ordering};
 
+    use core::time::Duration;
+
     use iceoryx2::config::Config;
+    use iceoryx2::node::dead_node_reaper::DeadNodeReaper;
     use iceoryx2::node::testing::__internal_node_staged_death;
     use iceoryx2::node::{CleanupState, NodeState};
     use iceoryx2::prelude::*;
@@ -188,6 +191,121 @@ mod node_death_tests {
         }
     }
 
+    #[test]
+    fn publisher_with_warm_restart_key_is_adopted_after_node_death<S: Test>() {
+        const WARM_RESTART_KEY: u64 = 42;
+        let service_name = generate_service_name();
+        let mut config = generate_isolated_config();
+        config.global.node.cleanup_dead_nodes_on_creation = false;
+
+        let good_node = NodeBuilder::new()
+            .config(&config)
+            .create::<S::Service>()
+            .unwrap();
+        let service = good_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open_or_create()
+            .unwrap();
+        let subscriber = service.subscriber_builder().create().unwrap();
+
+        let mut bad_node = S::create_test_node(&config).node;
+        let bad_service = bad_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        let bad_publisher = bad_service
+            .publisher_builder()
+            .warm_restart_key(WARM_RESTART_KEY)
+            .create()
+            .unwrap();
+        let predecessor_id = bad_publisher.id();
+        assert_that!(bad_publisher.send_copy(123), eq Ok(1));
+        core::mem::forget(bad_publisher.loan_uninit().unwrap());
+
+        S::staged_death(&mut bad_node);
+        core::mem::forget(bad_publisher);
+
+        assert_that!(Node::<S::Service>::cleanup_dead_nodes(&config), eq CleanupState { cleanups: 1, failed_cleanups: 0});
+        assert_that!(service.dynamic_config().number_of_publishers(), eq 1);
+
+        let sut = service
+            .publisher_builder()
+            .warm_restart_key(WARM_RESTART_KEY)
+            .create()
+            .unwrap();
+        assert_that!(sut.id(), eq predecessor_id);
+        assert_that!(service.dynamic_config().number_of_publishers(), eq 1);
+
+        assert_that!(sut.send_copy(456), eq Ok(1));
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(*sample, eq 123);
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(*sample, eq 456);
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn samples_borrowed_from_broadcast_ring_are_released_when_subscriber_dies<S: Test>() {
+        const RING_SIZE: usize = 2;
+        let service_name = generate_service_name();
+        let mut config = generate_isolated_config();
+        config.global.node.cleanup_dead_nodes_on_creation = false;
+
+        let good_node = NodeBuilder::new()
+            .config(&config)
+            .create::<S::Service>()
+            .unwrap();
+        let service = good_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .history_size(0)
+            .subscriber_max_borrowed_samples(RING_SIZE)
+            .broadcast_ring_size(RING_SIZE)
+            .create()
+            .unwrap();
+
+        let mut bad_node = S::create_test_node(&config).node;
+        let bad_service = bad_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        let bad_subscriber = bad_service.subscriber_builder().create().unwrap();
+
+        let publisher = service.publisher_builder().create().unwrap();
+        for i in 0..RING_SIZE as u64 {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+        }
+        let ring_usage = publisher.memory_usage().data_segments.used;
+
+        for i in 0..RING_SIZE as u64 {
+            let sample = bad_subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample, eq i);
+            core::mem::forget(sample);
+        }
+
+        // overwrites the borrowed samples in the ring, the publisher retires them
+        for i in 0..RING_SIZE as u64 {
+            assert_that!(publisher.send_copy(i), eq Ok(1));
+        }
+        assert_that!(publisher.memory_usage().data_segments.used, eq 2 * ring_usage);
+
+        S::staged_death(&mut bad_node);
+        core::mem::forget(bad_subscriber);
+
+        assert_that!(Node::<S::Service>::cleanup_dead_nodes(&config), eq CleanupState { cleanups: 1, failed_cleanups: 0});
+        assert_that!(service.dynamic_config().number_of_subscribers(), eq 0);
+
+        // the retired samples are released with the next delivery
+        for i in 0..RING_SIZE as u64 {
+            assert_that!(publisher.send_copy(i), eq Ok(0));
+        }
+        assert_that!(publisher.memory_usage().data_segments.used, eq ring_usage);
+    }
+
     #[test]
     fn dead_node_is_removed_from_event_service<S: Test>() {
         let _watchdog = Watchdog::new();
@@ -578,6 +696,85 @@ mod node_death_tests {
         assert_that!(number_of_nodes(), eq 0);
     }
 
+    #[test]
+    fn dead_node_reaper_removes_dead_nodes_incrementally<S: Test>() {
+        const NUMBER_OF_BAD_NODES: usize = 5;
+        const NODES_PER_CYCLE: usize = 2;
+        let mut config = generate_isolated_config();
+        config.global.node.cleanup_dead_nodes_on_creation = false;
+        config.global.node.cleanup_dead_nodes_on_destruction = false;
+
+        let _good_node = NodeBuilder::new()
+            .config(&config)
+            .create::<S::Service>()
+            .unwrap();
+
+        for _ in 0..NUMBER_OF_BAD_NODES {
+            let mut bad_node = S::create_test_node(&config).node;
+            S::staged_death(&mut bad_node);
+            core::mem::forget(bad_node);
+        }
+
+        let mut sut = DeadNodeReaper::<S::Service>::new(&config).nodes_per_cycle(NODES_PER_CYCLE);
+
+        let mut cleanups = 0;
+        let mut number_of_cycles = 0;
+        loop {
+            let cleanup_state = sut.reap();
+            assert_that!(cleanup_state.failed_cleanups, eq 0);
+            assert_that!(cleanup_state.cleanups, le NODES_PER_CYCLE);
+            cleanups += cleanup_state.cleanups;
+            number_of_cycles += 1;
+
+            if sut.number_of_pending_nodes() == 0 {
+                break;
+            }
+        }
+
+        assert_that!(cleanups, eq NUMBER_OF_BAD_NODES);
+        assert_that!(
+            number_of_cycles,
+            eq(NUMBER_OF_BAD_NODES + 1).div_ceil(NODES_PER_CYCLE)
+        );
+        assert_that!(sut.reap(), eq CleanupState { cleanups: 0, failed_cleanups: 0 });
+    }
+
+    #[test]
+    fn node_with_dead_node_reaper_removes_dead_nodes_in_the_background<S: Test>() {
+        let _watchdog = Watchdog::new();
+        let mut config = generate_isolated_config();
+        config.global.node.cleanup_dead_nodes_on_creation = false;
+        config.global.node.cleanup_dead_nodes_on_destruction = false;
+
+        let mut bad_node = S::create_test_node(&config).node;
+        S::staged_death(&mut bad_node);
+        core::mem::forget(bad_node);
+
+        let number_of_nodes = || {
+            let mut counter = 0;
+            Node::<S::Service>::list(&config, |_| {
+                counter += 1;
+                CallbackProgression::Continue
+            })
+            .unwrap();
+            counter
+        };
+        assert_that!(number_of_nodes(), eq 1);
+
+        let sut = NodeBuilder::new()
+            .config(&config)
+            .dead_node_reaper(Duration::from_millis(10))
+            .create::<S::Service>()
+            .unwrap();
+
+        while number_of_nodes() != 1 {
+            std::thread::sleep(Duration::from_millis(10));
+        }
+
+        drop(sut);
+        assert_that!(number_of_nodes(), eq 0);
+    }
+
     #[instantiate_tests(<ZeroCopy>)]
     mod ipc {}
 }
@@ -213,6 +213,163 @@ mod publisher {
         Ok(())
     }
 
+    #[test]
+    fn publisher_loan_slice_up_to_overflow_max_elements_is_delivered<Sut: Service>(
+    ) -> TestResult<()> {
+        const NUMBER_OF_ELEMENTS: usize = 16;
+        const OVERFLOW_NUMBER_OF_ELEMENTS: usize = 4096;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .overflow_max_slice_len(OVERFLOW_NUMBER_OF_ELEMENTS)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        for len in [
+            NUMBER_OF_ELEMENTS,
+            OVERFLOW_NUMBER_OF_ELEMENTS,
+            NUMBER_OF_ELEMENTS + 1,
+        ] {
+            let sample = sut.loan_slice_uninit(len)?;
+            let sample = sample.write_from_fn(|i| i as u64);
+            sample.send()?;
+
+            let received = subscriber.receive()?.unwrap();
+            assert_that!(received.payload().len(), eq len);
+            for (i, element) in received.payload().iter().enumerate() {
+                assert_that!(*element, eq i as u64);
+            }
+        }
+
+        let sample = sut.loan_slice(OVERFLOW_NUMBER_OF_ELEMENTS + 1);
+        assert_that!(sample, is_err);
+        assert_that!(sample.err().unwrap(), eq LoanError::ExceedsMaxLoanSize);
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_overflow_segment_is_limited_by_overflow_number_of_samples<Sut: Service>(
+    ) -> TestResult<()> {
+        const NUMBER_OF_ELEMENTS: usize = 16;
+        const OVERFLOW_NUMBER_OF_SAMPLES: usize = 2;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .max_loaned_samples(OVERFLOW_NUMBER_OF_SAMPLES + 2)
+            .initial_max_slice_len(NUMBER_OF_ELEMENTS)
+            .overflow_max_slice_len(NUMBER_OF_ELEMENTS * 2)
+            .overflow_number_of_samples(OVERFLOW_NUMBER_OF_SAMPLES)
+            .create()?;
+
+        let mut samples = vec![];
+        for _ in 0..OVERFLOW_NUMBER_OF_SAMPLES {
+            samples.push(sut.loan_slice(NUMBER_OF_ELEMENTS * 2)?);
+        }
+
+        let sample = sut.loan_slice(NUMBER_OF_ELEMENTS * 2);
+        assert_that!(sample, is_err);
+        assert_that!(sample.err().unwrap(), eq LoanError::OutOfMemory);
+
+        assert_that!(sut.loan_slice(NUMBER_OF_ELEMENTS), is_ok);
+
+        samples.clear();
+        assert_that!(sut.loan_slice(NUMBER_OF_ELEMENTS * 2), is_ok);
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_with_chunk_cache_loans_most_recently_returned_chunk_first<Sut: Service>(
+    ) -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .max_loaned_samples(2)
+            .chunk_cache_size(2)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        let sample_1 = sut.loan_uninit()?.write_payload(1);
+        let sample_2 = sut.loan_uninit()?.write_payload(2);
+        let address_2 = sample_2.payload() as *const u64;
+        drop(sample_1);
+        drop(sample_2);
+
+        let sample = sut.loan_uninit()?;
+        assert_that!(sample.payload().as_ptr() as *const u64, eq address_2);
+        let sample = sample.write_payload(3);
+        let address_3 = sample.payload() as *const u64;
+        sample.send()?;
+
+        let received = subscriber.receive()?.unwrap();
+        assert_that!(*received.payload(), eq 3);
+        drop(received);
+
+        let sample = sut.loan_uninit()?;
+        assert_that!(sample.payload().as_ptr() as *const u64, eq address_3);
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_with_chunk_cache_can_loan_all_samples_repeatedly<Sut: Service>() -> TestResult<()>
+    {
+        const MAX_LOANED_SAMPLES: usize = 5;
+        const REPETITIONS: usize = 10;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .history_size(0)
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .max_loaned_samples(MAX_LOANED_SAMPLES)
+            .chunk_cache_size(2)
+            .create()?;
+
+        for _ in 0..REPETITIONS {
+            let mut samples = vec![];
+            for _ in 0..MAX_LOANED_SAMPLES {
+                samples.push(sut.loan_uninit()?);
+            }
+
+            let addresses: HashSet<_> = samples
+                .iter()
+                .map(|sample| sample.payload().as_ptr() as usize)
+                .collect();
+            assert_that!(addresses, len MAX_LOANED_SAMPLES);
+        }
+
+        Ok(())
+    }
+
     #[test]
     fn publisher_loan_unit_and_send_sample_works<Sut: Service>() -> TestResult<()> {
         let service_name = generate_name()?;
@@ -559,6 +716,95 @@ mod publisher {
         Ok(())
     }
 
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn publisher_with_external_data_segment_delivers_payload_written_to_the_memory_region<
+        Sut: Service,
+    >() -> TestResult<()> {
+        use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+        use iceoryx2_bb_posix::memory_fd::MemoryFdBuilder;
+
+        const NUMBER_OF_ITERATIONS: u64 = 32;
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let mut memory = MemoryFdBuilder::new(&"external_data_segment".try_into()?)
+            .size(65536)
+            .create()
+            .unwrap();
+        let sut = service
+            .publisher_builder()
+            .external_data_segment(memory.file_descriptor().clone())
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        for n in 0..NUMBER_OF_ITERATIONS {
+            let sample = sut.loan_uninit()?;
+            let offset = sample.external_data_segment_offset().unwrap();
+            // the driver produces the payload directly into the memory region
+            memory.as_mut_slice()[offset..offset + 8].copy_from_slice(&(n * 31).to_ne_bytes());
+            unsafe { sample.assume_init() }.send()?;
+
+            let received = subscriber.receive()?.unwrap();
+            assert_that!(*received.payload(), eq n * 31);
+        }
+
+        Ok(())
+    }
+
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn publisher_with_too_small_external_data_segment_fails<Sut: Service>() -> TestResult<()> {
+        use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+        use iceoryx2_bb_posix::memory_fd::MemoryFdBuilder;
+
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()?;
+
+        let memory = MemoryFdBuilder::new(&"external_data_segment".try_into()?)
+            .size(4096)
+            .create()
+            .unwrap();
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(4096)
+            .external_data_segment(memory.file_descriptor().clone())
+            .create();
+
+        assert_that!(sut.err(), eq Some(PublisherCreateError::UnableToCreateDataSegment));
+
+        Ok(())
+    }
+
+    #[test]
+    fn publisher_without_external_data_segment_has_no_external_offset<Sut: Service>(
+    ) -> TestResult<()> {
+        let service_name = generate_name()?;
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        let sample = sut.loan_uninit()?;
+
+        assert_that!(sample.external_data_segment_offset(), eq None);
+
+        Ok(())
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
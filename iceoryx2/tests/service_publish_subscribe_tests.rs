@@ -13,10 +13,12 @@
 #[generic_tests::define]
 mod service_publish_subscribe {
     use core::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+    use core::time::Duration;
     use std::sync::{Barrier, Mutex};
     use std::thread;
 
-    use iceoryx2::config::Config;
+    use iceoryx2::config::{Config, PerformanceProfile};
+    use iceoryx2::port::downsampling::Downsampling;
     use iceoryx2::port::publisher::PublisherCreateError;
     use iceoryx2::port::subscriber::SubscriberCreateError;
     use iceoryx2::port::update_connections::UpdateConnections;
@@ -25,9 +27,10 @@ mod service_publish_subscribe {
     use iceoryx2::service::builder::publish_subscribe::PublishSubscribeCreateError;
     use iceoryx2::service::builder::publish_subscribe::PublishSubscribeOpenError;
     use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
+    use iceoryx2::service::dynamic_config::MAX_NUMBER_OF_EXTENSIONS;
     use iceoryx2::service::messaging_pattern::MessagingPattern;
     use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
-    use iceoryx2::service::{Service, ServiceDetails};
+    use iceoryx2::service::{Service, ServiceCapacityIncreaseError, ServiceDetails};
     use iceoryx2::testing::*;
     use iceoryx2_bb_derive_macros::ZeroCopySend;
     use iceoryx2_bb_elementary::alignment::Alignment;
@@ -1392,6 +1395,240 @@ mod service_publish_subscribe {
         }
     }
 
+    #[test]
+    fn increased_port_capacity_allows_additional_communicating_ports<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let other_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .max_subscribers(1)
+            .max_additional_subscribers(1)
+            .create()
+            .unwrap();
+        let sut2 = other_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        let result = sut2.subscriber_builder().create();
+        assert_that!(result.err(), eq Some(SubscriberCreateError::ExceedsMaxSupportedSubscribers));
+
+        assert_that!(sut.increase_port_capacity(1, 1), is_ok);
+        assert_that!(sut.max_publishers(), eq 2);
+        assert_that!(sut2.max_subscribers(), eq 2);
+
+        let publisher2 = sut2.publisher_builder().create().unwrap();
+        let subscriber2 = sut2.subscriber_builder().create().unwrap();
+
+        let mut number_of_publishers = 0;
+        sut.for_each_dynamic_config_segment(|segment| {
+            number_of_publishers += segment.number_of_publishers();
+            CallbackProgression::Continue
+        });
+        assert_that!(number_of_publishers, eq 2);
+
+        for (n, publisher) in [&publisher, &publisher2].iter().enumerate() {
+            assert_that!(publisher.send_copy(n as u64), is_ok);
+
+            for subscriber in [&subscriber, &subscriber2] {
+                let sample = subscriber.receive().unwrap();
+                assert_that!(sample, is_some);
+                assert_that!(*sample.unwrap(), eq n as u64);
+            }
+        }
+
+        drop(publisher2);
+        drop(subscriber2);
+        assert_that!(sut2.subscriber_builder().create(), is_ok);
+    }
+
+    #[test]
+    fn increase_port_capacity_fails_when_it_exceeds_max_additional_subscribers<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .max_subscribers(1)
+            .max_additional_subscribers(2)
+            .create()
+            .unwrap();
+        assert_that!(sut.static_config().max_additional_subscribers(), eq 2);
+
+        let result = sut.increase_port_capacity(0, 3);
+        assert_that!(result.err(), eq Some(ServiceCapacityIncreaseError::ExceedsMaxAdditionalSubscribers));
+        assert_that!(sut.max_subscribers(), eq 1);
+
+        assert_that!(sut.increase_port_capacity(0, 1), is_ok);
+        assert_that!(sut.increase_port_capacity(0, 1), is_ok);
+        assert_that!(sut.max_subscribers(), eq 3);
+
+        let result = sut.increase_port_capacity(0, 1);
+        assert_that!(result.err(), eq Some(ServiceCapacityIncreaseError::ExceedsMaxAdditionalSubscribers));
+
+        // only the subscribers are bounded
+        assert_that!(sut.increase_port_capacity(1, 0), is_ok);
+    }
+
+    #[test]
+    fn publisher_serves_every_subscriber_added_after_it_was_created<Sut: Service>() {
+        const MAX_ADDITIONAL_SUBSCRIBERS: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_subscribers(1)
+            .max_additional_subscribers(MAX_ADDITIONAL_SUBSCRIBERS)
+            .subscriber_max_buffer_size(2)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let mut subscribers = vec![sut.subscriber_builder().create().unwrap()];
+        for _ in 0..MAX_ADDITIONAL_SUBSCRIBERS {
+            assert_that!(sut.increase_port_capacity(0, 1), is_ok);
+            subscribers.push(sut.subscriber_builder().create().unwrap());
+        }
+
+        // every subscriber holds a full buffer and borrows the maximum number of samples
+        let mut borrowed_samples = vec![];
+        for n in 0..2 {
+            assert_that!(publisher.send_copy(n), eq Ok(subscribers.len()));
+        }
+        for subscriber in &subscribers {
+            for n in 0..2 {
+                borrowed_samples.push(subscriber.receive().unwrap().unwrap());
+                assert_that!(*borrowed_samples.last().unwrap().payload(), eq n);
+            }
+        }
+        for n in 2..4 {
+            assert_that!(publisher.send_copy(n), eq Ok(subscribers.len()));
+        }
+
+        assert_that!(publisher.loan_uninit(), is_ok);
+    }
+
+    #[test]
+    fn increased_port_capacity_allows_additional_nodes<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+        let other_node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_nodes(1)
+            .max_publishers(1)
+            .max_subscribers(1)
+            .max_additional_subscribers(1)
+            .create()
+            .unwrap();
+
+        let result = other_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open();
+        assert_that!(result.err(), eq Some(PublishSubscribeOpenError::ExceedsMaxNumberOfNodes));
+
+        assert_that!(sut.increase_port_capacity(0, 1), is_ok);
+        assert_that!(sut.max_nodes(), eq 2);
+
+        let sut2 = other_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+
+        let mut number_of_nodes = 0;
+        assert_that!(
+            sut2.nodes(|_| {
+                number_of_nodes += 1;
+                CallbackProgression::Continue
+            }),
+            is_ok
+        );
+        assert_that!(number_of_nodes, eq 2);
+
+        // the node of the extension keeps the service alive
+        drop(sut);
+        assert_that!(Sut::does_exist(&service_name, &config, MessagingPattern::PublishSubscribe).unwrap(), eq true);
+        let subscriber = sut2.subscriber_builder().create().unwrap();
+        let publisher = sut2.publisher_builder().create().unwrap();
+        assert_that!(publisher.send_copy(123), is_ok);
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 123);
+
+        drop(subscriber);
+        drop(publisher);
+        drop(sut2);
+        assert_that!(Sut::does_exist(&service_name, &config, MessagingPattern::PublishSubscribe).unwrap(), eq false);
+    }
+
+    #[test]
+    fn increase_port_capacity_fails_when_max_number_of_extensions_is_exceeded<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .create()
+            .unwrap();
+
+        for _ in 0..MAX_NUMBER_OF_EXTENSIONS {
+            assert_that!(sut.increase_port_capacity(1, 0), is_ok);
+        }
+
+        let result = sut.increase_port_capacity(1, 0);
+        assert_that!(result.err(), eq Some(ServiceCapacityIncreaseError::ExceedsMaxNumberOfExtensions));
+        assert_that!(sut.max_publishers(), eq MAX_NUMBER_OF_EXTENSIONS + 1);
+    }
+
+    #[test]
+    fn recreated_service_does_not_contain_extensions_of_its_predecessor<Sut: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<Sut>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .create()
+            .unwrap();
+        assert_that!(sut.increase_port_capacity(5, 0), is_ok);
+        drop(sut);
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(1)
+            .create()
+            .unwrap();
+        assert_that!(sut.max_publishers(), eq 1);
+
+        assert_that!(sut.increase_port_capacity(2, 0), is_ok);
+        assert_that!(sut.max_publishers(), eq 3);
+    }
+
     #[test]
     fn multi_channel_communication_with_max_subscribers_and_publishers<Sut: Service>() {
         const MAX_PUB: usize = 5;
@@ -3446,6 +3683,599 @@ mod service_publish_subscribe {
         assert_that!(recv_res, is_ok);
     }
 
+    #[test]
+    fn performance_profile_defines_settings_unless_set_explicitly<S: Service>() {
+        const EXPLICIT_BUFFER_SIZE: usize = 3;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let profile = config.profiles.get(PerformanceProfile::HighThroughput);
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(EXPLICIT_BUFFER_SIZE)
+            .performance_profile(PerformanceProfile::HighThroughput)
+            .create()
+            .unwrap();
+
+        let static_config = sut.static_config();
+        assert_that!(static_config.max_subscribers(), eq profile.max_subscribers);
+        assert_that!(static_config.max_publishers(), eq profile.max_publishers);
+        assert_that!(static_config.subscriber_max_borrowed_samples(), eq profile.subscriber_max_borrowed_samples);
+        assert_that!(static_config.has_safe_overflow(), eq profile.enable_safe_overflow);
+        assert_that!(static_config.subscriber_max_buffer_size(), eq EXPLICIT_BUFFER_SIZE);
+    }
+
+    #[test]
+    fn open_fails_when_service_has_incompatible_delivery_mode<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let _sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .broadcast_ring_size(8)
+            .create()
+            .unwrap();
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .broadcast_ring_size(0)
+            .open();
+        assert_that!(sut2.err(), eq Some(PublishSubscribeOpenError::IncompatibleDeliveryMode));
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .broadcast_ring_size(16)
+            .open();
+        assert_that!(sut2.err(), eq Some(PublishSubscribeOpenError::IncompatibleDeliveryMode));
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .broadcast_ring_size(4)
+            .open();
+        assert_that!(sut2, is_ok);
+    }
+
+    #[test]
+    fn broadcast_ring_delivers_every_sample_to_every_subscriber<S: Service>() {
+        const NUMBER_OF_SUBSCRIBERS: usize = 4;
+        const NUMBER_OF_SAMPLES: u64 = 32;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_subscribers(NUMBER_OF_SUBSCRIBERS)
+            .broadcast_ring_size(NUMBER_OF_SAMPLES as usize)
+            .create()
+            .unwrap();
+        assert_that!(sut.static_config().broadcast_ring_size(), eq NUMBER_OF_SAMPLES as usize);
+
+        let subscribers: Vec<_> = (0..NUMBER_OF_SUBSCRIBERS)
+            .map(|_| sut.subscriber_builder().create().unwrap())
+            .collect();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher.send_copy(i), eq Ok(NUMBER_OF_SUBSCRIBERS));
+        }
+
+        for subscriber in &subscribers {
+            for i in 0..NUMBER_OF_SAMPLES {
+                let sample = subscriber.receive().unwrap().unwrap();
+                assert_that!(*sample, eq i);
+            }
+            assert_that!(subscriber.receive().unwrap(), is_none);
+            assert_that!(subscriber.missed_samples(), eq 0);
+        }
+    }
+
+    #[test]
+    fn broadcast_ring_reports_missed_samples_of_slow_subscriber<S: Service>() {
+        const RING_SIZE: usize = 4;
+        const NUMBER_OF_SAMPLES: u64 = 10;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .history_size(0)
+            .broadcast_ring_size(RING_SIZE)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        // a borrowed sample is not recycled when it is overwritten in the ring
+        publisher.send_copy(1234).unwrap();
+        let borrowed_sample = subscriber.receive().unwrap().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(i).unwrap();
+        }
+
+        for i in NUMBER_OF_SAMPLES - RING_SIZE as u64..NUMBER_OF_SAMPLES {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample, eq i);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+        assert_that!(subscriber.missed_samples(), eq NUMBER_OF_SAMPLES - RING_SIZE as u64);
+        assert_that!(*borrowed_sample, eq 1234);
+    }
+
+    #[test]
+    fn subscriber_group_members_share_samples<S: Service>() {
+        const NUMBER_OF_SAMPLES: u64 = 10;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_subscribers(3)
+            .history_size(0)
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()
+            .unwrap();
+
+        let member_1 = sut.subscriber_builder().group(7).create().unwrap();
+        let member_2 = sut.subscriber_builder().group(7).create().unwrap();
+        let observer = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        assert_that!(member_1.group(), eq Some(7));
+        assert_that!(observer.group(), is_none);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(publisher.send_copy(i).unwrap(), eq 2);
+        }
+
+        let mut received_by_members = vec![];
+        for member in [&member_1, &member_2] {
+            let mut number_of_received_samples = 0;
+            while let Some(sample) = member.receive().unwrap() {
+                received_by_members.push(*sample);
+                number_of_received_samples += 1;
+            }
+            assert_that!(number_of_received_samples, eq NUMBER_OF_SAMPLES / 2);
+        }
+
+        received_by_members.sort();
+        assert_that!(
+            received_by_members,
+            eq(0..NUMBER_OF_SAMPLES).collect::<Vec<_>>()
+        );
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(*observer.receive().unwrap().unwrap(), eq i);
+        }
+    }
+
+    #[test]
+    fn subscriber_group_delivers_to_member_with_fewest_queued_samples<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_subscribers(2)
+            .history_size(0)
+            .subscriber_max_buffer_size(4)
+            .create()
+            .unwrap();
+
+        let busy_member = sut.subscriber_builder().group(1).create().unwrap();
+        let idle_member = sut.subscriber_builder().group(1).create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        publisher.send_copy(1).unwrap();
+        publisher.send_copy(2).unwrap();
+        // one sample is queued for every member, the idle member drains its buffer
+        assert_that!(idle_member.receive().unwrap(), is_some);
+
+        publisher.send_copy(3).unwrap();
+        assert_that!(*idle_member.receive().unwrap().unwrap(), eq 3);
+        assert_that!(busy_member.receive().unwrap(), is_some);
+        assert_that!(busy_member.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn subscriber_group_is_not_supported_with_broadcast_ring<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .broadcast_ring_size(4)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().group(1).create();
+        assert_that!(subscriber.err().unwrap(), eq SubscriberCreateError::GroupsNotSupportedByDeliveryMode);
+    }
+
+    #[test]
+    fn open_fails_when_service_has_different_number_of_priority_lanes<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let _sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .number_of_priority_lanes(3)
+            .create()
+            .unwrap();
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .number_of_priority_lanes(2)
+            .open();
+        assert_that!(sut2.err().unwrap(), eq PublishSubscribeOpenError::IncompatibleNumberOfPriorityLanes);
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        assert_that!(sut2.static_config().number_of_priority_lanes(), eq 3);
+    }
+
+    #[test]
+    fn samples_of_higher_priority_lane_are_received_first<S: Service>() {
+        const BUFFER_SIZE: usize = 4;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .number_of_priority_lanes(3)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        // the bulk lane is full, urgent samples still overtake it
+        for i in 0..BUFFER_SIZE as u64 {
+            publisher.send_copy(i).unwrap();
+        }
+        for (value, priority) in [(100, 2), (50, 1), (101, 7)] {
+            let sample = publisher.loan_uninit().unwrap().write_payload(value);
+            assert_that!(sample.send_with_priority(priority), eq Ok(1));
+        }
+
+        // priorities beyond the highest lane are delivered via the highest lane
+        for (value, priority) in [(100, 2), (101, 2), (50, 1)] {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample, eq value);
+            assert_that!(sample.priority(), eq priority);
+        }
+
+        for i in 0..BUFFER_SIZE as u64 {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample, eq i);
+            assert_that!(sample.priority(), eq 0);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn expired_samples_are_discarded_while_receiving<S: Service>() {
+        const BUFFER_SIZE: usize = 8;
+        const TIME_TO_LIVE: Duration = Duration::from_millis(10);
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let stale_publisher = sut
+            .publisher_builder()
+            .time_to_live(TIME_TO_LIVE)
+            .create()
+            .unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for i in 0..BUFFER_SIZE as u64 / 2 {
+            stale_publisher.send_copy(i).unwrap();
+        }
+        std::thread::sleep(TIME_TO_LIVE * 2);
+        publisher.send_copy(1234).unwrap();
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(*sample, eq 1234);
+        assert_that!(sample.header().expiration_time(), is_none);
+        assert_that!(subscriber.expired_samples(), eq BUFFER_SIZE as u64 / 2);
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn sample_time_to_live_of_service_is_stamped_into_header<S: Service>() {
+        const TIME_TO_LIVE: Duration = Duration::from_secs(3600);
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .sample_time_to_live(TIME_TO_LIVE)
+            .create()
+            .unwrap();
+        assert_that!(sut.static_config().sample_time_to_live(), eq Some(TIME_TO_LIVE));
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        publisher.send_copy(42).unwrap();
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(*sample, eq 42);
+        assert_that!(sample.header().expiration_time(), is_some);
+        assert_that!(subscriber.expired_samples(), eq 0);
+    }
+
+    #[test]
+    fn downsampled_subscriber_receives_only_every_nth_sample<S: Service>() {
+        const NUMBER_OF_SAMPLES: u64 = 9;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let downsampled_subscriber = sut
+            .subscriber_builder()
+            .downsampling(Downsampling::EveryNth(3))
+            .create()
+            .unwrap();
+        let throttled_subscriber = sut
+            .subscriber_builder()
+            .downsampling(Downsampling::MinInterval(Duration::from_secs(3600)))
+            .create()
+            .unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(i).unwrap();
+        }
+
+        for i in (0..NUMBER_OF_SAMPLES).step_by(3) {
+            assert_that!(*downsampled_subscriber.receive().unwrap().unwrap(), eq i);
+        }
+        assert_that!(downsampled_subscriber.receive().unwrap(), is_none);
+
+        assert_that!(*throttled_subscriber.receive().unwrap().unwrap(), eq 0);
+        assert_that!(throttled_subscriber.receive().unwrap(), is_none);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            assert_that!(*subscriber.receive().unwrap().unwrap(), eq i);
+        }
+    }
+
+    #[test]
+    fn downsampling_is_not_supported_for_group_members<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .group(1)
+            .downsampling(Downsampling::EveryNth(2))
+            .create();
+        assert_that!(subscriber.err().unwrap(), eq SubscriberCreateError::DownsamplingNotSupportedByDeliveryMode);
+    }
+
+    #[test]
+    fn conflating_subscriber_receives_only_newest_sample_per_key<S: Service>() {
+        const CAPACITY: usize = 8;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .subscriber_max_buffer_size(CAPACITY)
+            .subscriber_max_borrowed_samples(CAPACITY)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .conflate_by_key(CAPACITY, |key| *key)
+            .create()
+            .unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for (key, value) in [(1, 10), (2, 20), (1, 11), (3, 30), (2, 21), (1, 12)] {
+            let mut sample = publisher.loan_uninit().unwrap();
+            *sample.user_header_mut() = key;
+            sample.write_payload(value).send().unwrap();
+        }
+
+        for (key, value) in [(1, 12), (2, 21), (3, 30)] {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample.user_header(), eq key);
+            assert_that!(*sample, eq value);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+        assert_that!(subscriber.has_samples().unwrap(), eq false);
+    }
+
+    #[test]
+    fn conflating_subscriber_evicts_oldest_key_when_capacity_is_reached<S: Service>() {
+        const CAPACITY: usize = 2;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .subscriber_max_buffer_size(8)
+            .subscriber_max_borrowed_samples(CAPACITY + 1)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .conflate_by_key(CAPACITY, |key| *key)
+            .create()
+            .unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for (key, value) in [(1, 10), (2, 20), (3, 30), (2, 21)] {
+            let mut sample = publisher.loan_uninit().unwrap();
+            *sample.user_header_mut() = key;
+            sample.write_payload(value).send().unwrap();
+        }
+
+        for (key, value) in [(2, 21), (3, 30)] {
+            let sample = subscriber.receive().unwrap().unwrap();
+            assert_that!(*sample.user_header(), eq key);
+            assert_that!(*sample, eq value);
+        }
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[test]
+    fn conflating_subscriber_with_capacity_exceeding_max_borrowed_samples_fails<S: Service>() {
+        const MAX_BORROWED_SAMPLES: usize = 4;
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .subscriber_max_borrowed_samples(MAX_BORROWED_SAMPLES)
+            .create()
+            .unwrap();
+
+        let subscriber = sut
+            .subscriber_builder()
+            .conflate_by_key(MAX_BORROWED_SAMPLES + 1, |key| *key)
+            .create();
+        assert_that!(subscriber.err().unwrap(), eq SubscriberCreateError::ConflationCapacityExceedsMaxBorrowedSamples);
+
+        let subscriber = sut
+            .subscriber_builder()
+            .conflate_by_key(MAX_BORROWED_SAMPLES, |key| *key)
+            .create();
+        assert_that!(subscriber, is_ok);
+    }
+
+    #[test]
+    fn memory_usage_of_service_grows_with_ports<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let usage_without_ports = sut.memory_usage();
+        assert_that!(usage_without_ports.data_segments.mapped, eq 0);
+        assert_that!(usage_without_ports.connections.mapped, eq 0);
+        assert_that!(usage_without_ports.management.mapped, gt 0);
+        assert_that!(usage_without_ports.management.used, eq 0);
+
+        let _publisher = sut.publisher_builder().create().unwrap();
+        let _subscriber = sut.subscriber_builder().create().unwrap();
+
+        let usage = sut.memory_usage();
+        assert_that!(usage.data_segments.mapped, gt 0);
+        assert_that!(usage.connections.mapped, gt 0);
+        assert_that!(usage.management.mapped, eq usage_without_ports.management.mapped);
+        assert_that!(usage.management.used, gt 0);
+        assert_that!(usage.mapped(), gt usage_without_ports.mapped());
+    }
+
+    #[test]
+    fn memory_usage_of_ports_reflects_connections_and_loaned_samples<S: Service>() {
+        let service_name = generate_name();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        assert_that!(publisher.memory_usage().data_segments.mapped, gt 0);
+        assert_that!(publisher.memory_usage().data_segments.used, eq 0);
+        assert_that!(publisher.memory_usage().connections.mapped, eq 0);
+
+        assert_that!(publisher.update_connections(), is_ok);
+        assert_that!(publisher.memory_usage().connections.mapped, gt 0);
+
+        let sample = publisher.loan().unwrap();
+        assert_that!(publisher.memory_usage().data_segments.used, gt 0);
+        sample.send().unwrap();
+
+        let received_sample = subscriber.receive().unwrap();
+        assert_that!(received_sample, is_some);
+        assert_that!(subscriber.memory_usage().connections.mapped, gt 0);
+        assert_that!(subscriber.memory_usage().data_segments.mapped, gt 0);
+        assert_that!(publisher.memory_usage().data_segments.used, gt 0);
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
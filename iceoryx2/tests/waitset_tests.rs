@@ -19,7 +19,9 @@ mod waitset {
     use iceoryx2::port::notifier::Notifier;
     use iceoryx2::prelude::{WaitSetBuilder, *};
     use iceoryx2::testing::*;
-    use iceoryx2::waitset::{WaitSetAttachmentError, WaitSetRunError};
+    use iceoryx2::waitset::{
+        ReactorMechanism, WaitSetAttachmentError, WaitSetCreateError, WaitSetRunError,
+    };
     use iceoryx2_bb_posix::config::test_directory;
     use iceoryx2_bb_posix::directory::Directory;
     use iceoryx2_bb_posix::file::Permission;
@@ -27,7 +29,10 @@ mod waitset {
         UnixDatagramReceiver, UnixDatagramSender, UnixDatagramSenderBuilder,
     };
     use iceoryx2_bb_posix::{
-        file_descriptor_set::SynchronousMultiplexing, unique_system_id::UniqueSystemId,
+        file_descriptor_set::SynchronousMultiplexing,
+        system_configuration::SystemInfo,
+        thread::{ThreadHandle, ThreadProperties},
+        unique_system_id::UniqueSystemId,
         unix_datagram_socket::UnixDatagramReceiverBuilder,
     };
     use iceoryx2_bb_system_types::file_path::*;
@@ -92,6 +97,30 @@ mod waitset {
         assert_that!(result.err(), eq Some(WaitSetRunError::NoAttachments));
     }
 
+    #[test]
+    fn create_with_cpu_affinity_pins_the_calling_thread<S: Service>() {
+        let cpu_core = *ThreadHandle::from_self()
+            .get_affinity()
+            .unwrap()
+            .last()
+            .unwrap();
+        let _sut = WaitSetBuilder::new()
+            .cpu_affinity(cpu_core)
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(ThreadHandle::from_self().get_affinity().unwrap(), eq vec![cpu_core]);
+    }
+
+    #[test]
+    fn create_with_non_existing_cpu_core_fails<S: Service>() {
+        let sut = WaitSetBuilder::new()
+            .cpu_affinity(SystemInfo::NumberOfCpuCores.value())
+            .create::<S>();
+
+        assert_that!(sut.err(), eq Some(WaitSetCreateError::InvalidCpuCore));
+    }
+
     #[test]
     fn attach_multiple_notifications_works<S: Service>()
     where
@@ -224,6 +253,114 @@ mod waitset {
         assert_that!(receiver_1_triggered, eq true);
     }
 
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn wait_and_process_once_with_epoll_mechanism_lists_all_notifications<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new()
+            .reactor_mechanism(ReactorMechanism::Epoll)
+            .create::<S>()
+            .unwrap();
+
+        let (listener_1, notifier_1) = create_event::<S>(&node);
+        let (listener_2, _notifier_2) = create_event::<S>(&node);
+        let (receiver, sender) = create_socket();
+
+        let listener_1_guard = sut.attach_notification(&listener_1).unwrap();
+        let listener_2_guard = sut.attach_notification(&listener_2).unwrap();
+        let receiver_guard = sut.attach_notification(&receiver).unwrap();
+
+        notifier_1.notify().unwrap();
+        sender.try_send(b"bla").unwrap();
+
+        let mut listener_1_triggered = false;
+        let mut receiver_triggered = false;
+
+        sut.wait_and_process_once(|attachment_id| {
+            if attachment_id.has_event_from(&listener_1_guard) {
+                listener_1_triggered = true;
+            } else if attachment_id.has_event_from(&receiver_guard) {
+                receiver_triggered = true;
+            } else if attachment_id.has_event_from(&listener_2_guard) {
+                test_fail!("listener 2 was not notified");
+            } else {
+                test_fail!("only attachments shall trigger");
+            }
+
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(listener_1_triggered, eq true);
+        assert_that!(receiver_triggered, eq true);
+    }
+
+    #[cfg(target_os = "linux")]
+    #[test]
+    fn wait_and_process_once_with_io_uring_mechanism_lists_all_notifications<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new()
+            .reactor_mechanism(ReactorMechanism::IoUring)
+            .create::<S>()
+            .unwrap();
+
+        let (listener_1, notifier_1) = create_event::<S>(&node);
+        let (listener_2, _notifier_2) = create_event::<S>(&node);
+        let (receiver, sender) = create_socket();
+
+        let listener_1_guard = sut.attach_notification(&listener_1).unwrap();
+        let listener_2_guard = sut.attach_notification(&listener_2).unwrap();
+        let receiver_guard = sut.attach_notification(&receiver).unwrap();
+
+        notifier_1.notify().unwrap();
+        sender.try_send(b"bla").unwrap();
+
+        let mut listener_1_triggered = false;
+        let mut receiver_triggered = false;
+
+        sut.wait_and_process_once(|attachment_id| {
+            if attachment_id.has_event_from(&listener_1_guard) {
+                listener_1_triggered = true;
+            } else if attachment_id.has_event_from(&receiver_guard) {
+                receiver_triggered = true;
+            } else if attachment_id.has_event_from(&listener_2_guard) {
+                test_fail!("listener 2 was not notified");
+            } else {
+                test_fail!("only attachments shall trigger");
+            }
+
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(listener_1_triggered, eq true);
+        assert_that!(receiver_triggered, eq true);
+    }
+
+    #[cfg(not(target_os = "linux"))]
+    #[test]
+    fn create_with_unsupported_reactor_mechanism_fails<S: Service>() {
+        let sut = WaitSetBuilder::new()
+            .reactor_mechanism(ReactorMechanism::Epoll)
+            .create::<S>();
+
+        assert_that!(sut.err(), eq Some(WaitSetCreateError::UnsupportedReactorMechanism));
+
+        let sut = WaitSetBuilder::new()
+            .reactor_mechanism(ReactorMechanism::IoUring)
+            .create::<S>();
+
+        assert_that!(sut.err(), eq Some(WaitSetCreateError::UnsupportedReactorMechanism));
+    }
+
     #[test]
     fn wait_and_process_once_with_tick_interval_blocks_for_at_least_timeout<S: Service>()
     where
@@ -606,6 +743,198 @@ mod waitset {
         assert_that!(now.elapsed(), time_at_least TIMEOUT / 2);
     }
 
+    #[test]
+    fn subscriber_with_data_arrival_notification_wakes_up_waitset<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let _watchdog = Watchdog::new();
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let service = node
+            .service_builder(&generate_name())
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        let subscriber = service
+            .subscriber_builder()
+            .notify_on_data_arrival(true)
+            .create()
+            .unwrap();
+        assert_that!(subscriber.has_data_arrival_notification(), eq true);
+
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+        let subscriber_guard = sut.attach_notification(&subscriber).unwrap();
+
+        publisher.send_copy(123).unwrap();
+
+        let mut subscriber_triggered = false;
+        sut.wait_and_process_once_with_timeout(
+            |attachment_id| {
+                subscriber_triggered = attachment_id.has_event_from(&subscriber_guard);
+                CallbackProgression::Continue
+            },
+            TIMEOUT,
+        )
+        .unwrap();
+        assert_that!(subscriber_triggered, eq true);
+
+        let sample = subscriber.receive().unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 123);
+        assert_that!(subscriber.receive().unwrap(), is_none);
+
+        let mut callback_called = false;
+        sut.wait_and_process_once_with_timeout(
+            |_| {
+                callback_called = true;
+                CallbackProgression::Continue
+            },
+            TIMEOUT,
+        )
+        .unwrap();
+        assert_that!(callback_called, eq false);
+    }
+
+    #[test]
+    fn subscriber_without_data_arrival_notification_is_not_notified<S: Service>() {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let service = node
+            .service_builder(&generate_name())
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        let subscriber = service.subscriber_builder().create().unwrap();
+
+        assert_that!(subscriber.has_data_arrival_notification(), eq false);
+
+        publisher.send_copy(456).unwrap();
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 456);
+    }
+
+    #[test]
+    fn attaching_subscriber_without_data_arrival_notification_fails<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let service = node
+            .service_builder(&generate_name())
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let subscriber = service.subscriber_builder().create().unwrap();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        assert_that!(sut.attach_notification(&subscriber).err(), eq Some(WaitSetAttachmentError::NotMultiplexable));
+        assert_that!(sut.attach_deadline(&subscriber, TIMEOUT).err(), eq Some(WaitSetAttachmentError::NotMultiplexable));
+        assert_that!(sut.is_empty(), eq true);
+    }
+
+    #[test]
+    fn ready_attachments_are_handled_in_priority_order<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let (listener_1, notifier_1) = create_event::<S>(&node);
+        let (listener_2, notifier_2) = create_event::<S>(&node);
+        let (listener_3, notifier_3) = create_event::<S>(&node);
+
+        let guard_1 = sut.attach_notification(&listener_1).unwrap();
+        let guard_2 = sut.attach_notification(&listener_2).unwrap();
+        let guard_3 = sut.attach_deadline(&listener_3, TIMEOUT * 1000).unwrap();
+        let tick_guard = sut.attach_interval(Duration::from_nanos(1)).unwrap();
+
+        guard_2.set_priority(5);
+        guard_3.set_priority(10);
+        tick_guard.set_priority(1);
+
+        assert_that!(guard_1.priority(), eq 0);
+        assert_that!(guard_2.priority(), eq 5);
+        assert_that!(guard_3.priority(), eq 10);
+        assert_that!(tick_guard.priority(), eq 1);
+
+        notifier_1.notify().unwrap();
+        notifier_2.notify().unwrap();
+        notifier_3.notify().unwrap();
+
+        let mut order = vec![];
+        sut.wait_and_process_once(|attachment_id| {
+            if attachment_id.has_event_from(&guard_1) {
+                order.push(1);
+            } else if attachment_id.has_event_from(&guard_2) {
+                order.push(2);
+            } else if attachment_id.has_event_from(&guard_3) {
+                order.push(3);
+            } else if attachment_id.has_event_from(&tick_guard) {
+                order.push(4);
+            }
+
+            CallbackProgression::Continue
+        })
+        .unwrap();
+
+        assert_that!(order, eq vec![3, 2, 4, 1]);
+    }
+
+    #[test]
+    fn exhausted_processing_budget_defers_low_priority_notifications<S: Service>()
+    where
+        <S::Event as Event>::Listener: SynchronousMultiplexing,
+    {
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+        let sut = WaitSetBuilder::new()
+            .processing_budget(Duration::from_nanos(1))
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(sut.processing_budget(), eq Some(Duration::from_nanos(1)));
+
+        let (listener_1, notifier_1) = create_event::<S>(&node);
+        let (listener_2, notifier_2) = create_event::<S>(&node);
+
+        let low_priority_guard = sut.attach_notification(&listener_1).unwrap();
+        let high_priority_guard = sut.attach_notification(&listener_2).unwrap();
+        high_priority_guard.set_priority(1);
+
+        notifier_1.notify().unwrap();
+        notifier_2.notify().unwrap();
+
+        let mut high_priority_calls = 0;
+        let mut low_priority_calls = 0;
+        let mut on_event = |attachment_id: WaitSetAttachmentId<S>| {
+            if attachment_id.has_event_from(&high_priority_guard) {
+                high_priority_calls += 1;
+                while let Ok(Some(_)) = listener_2.try_wait_one() {}
+            } else if attachment_id.has_event_from(&low_priority_guard) {
+                low_priority_calls += 1;
+                while let Ok(Some(_)) = listener_1.try_wait_one() {}
+            }
+            std::thread::sleep(Duration::from_millis(1));
+
+            CallbackProgression::Continue
+        };
+
+        sut.wait_and_process_once(&mut on_event).unwrap();
+        assert_that!(high_priority_calls, eq 1);
+        assert_that!(low_priority_calls, eq 0);
+
+        // the deferred notification is still pending and handled in the next wakeup
+        sut.wait_and_process_once_with_timeout(&mut on_event, TIMEOUT)
+            .unwrap();
+        assert_that!(high_priority_calls, eq 1);
+        assert_that!(low_priority_calls, eq 1);
+    }
+
     #[test]
     fn signal_handling_mechanism_can_be_configured<S: Service>() {
         let sut_1 = WaitSetBuilder::new()